@@ -0,0 +1,285 @@
+/*
+ * Copyright 2008 Search Solution Corporation
+ * Copyright 2016 CUBRID Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ */
+
+/*
+ * crc32c.c - CRC-32C (Castagnoli) checksum
+ *
+ * The CRC is computed with the SSE4.2 crc32 instruction on x86 and with the ARMv8 CRC32 extension on aarch64
+ * when it is available. Otherwise a slicing-by-8 table driven implementation is used. Both produce identical
+ * results, so checksums written by one machine are verified correctly by the other.
+ */
+
+#ident "$Id$"
+
+#include "config.h"
+
+#include <string.h>
+#include <stdint.h>
+
+#if defined (__GNUC__) && (defined (__x86_64__) || defined (__i386__))
+#define CRC32C_HAVE_SSE42
+#include <nmmintrin.h>
+#elif defined (_MSC_VER) && (defined (_M_X64) || defined (_M_IX86))
+#define CRC32C_HAVE_SSE42
+#include <intrin.h>
+#include <nmmintrin.h>
+#elif defined (__aarch64__) && defined (__ARM_FEATURE_CRC32)
+#define CRC32C_HAVE_ARMV8
+#include <arm_acle.h>
+#endif
+
+#include "crc32c.h"
+
+/* reflected Castagnoli polynomial */
+#define CRC32C_POLY 0x82F63B78U
+
+typedef unsigned int (*CRC32C_FUNC) (unsigned int crc, const unsigned char *p, size_t len);
+
+static unsigned int crc32c_Table[8][256];
+
+static bool crc32c_init (void);
+static unsigned int crc32c_sw (unsigned int crc, const unsigned char *p, size_t len);
+#if defined (CRC32C_HAVE_SSE42)
+static bool crc32c_cpu_has_sse42 (void);
+static unsigned int crc32c_sse42 (unsigned int crc, const unsigned char *p, size_t len);
+#elif defined (CRC32C_HAVE_ARMV8)
+static unsigned int crc32c_armv8 (unsigned int crc, const unsigned char *p, size_t len);
+#endif
+
+static CRC32C_FUNC crc32c_Func = crc32c_sw;
+static bool crc32c_Is_hw = false;
+static bool crc32c_Initialized = crc32c_init ();
+
+/*
+ * crc32c_init () - build the software tables and pick the fastest implementation for this cpu
+ *   return: always true
+ *
+ * Note: called once during static initialization.
+ */
+static bool
+crc32c_init (void)
+{
+  unsigned int crc;
+  int i, j;
+
+  for (i = 0; i < 256; i++)
+    {
+      crc = (unsigned int) i;
+      for (j = 0; j < 8; j++)
+	{
+	  crc = (crc & 1) ? ((crc >> 1) ^ CRC32C_POLY) : (crc >> 1);
+	}
+      crc32c_Table[0][i] = crc;
+    }
+
+  for (i = 0; i < 256; i++)
+    {
+      crc = crc32c_Table[0][i];
+      for (j = 1; j < 8; j++)
+	{
+	  crc = crc32c_Table[0][crc & 0xff] ^ (crc >> 8);
+	  crc32c_Table[j][i] = crc;
+	}
+    }
+
+#if defined (CRC32C_HAVE_SSE42)
+  if (crc32c_cpu_has_sse42 ())
+    {
+      crc32c_Func = crc32c_sse42;
+      crc32c_Is_hw = true;
+    }
+#elif defined (CRC32C_HAVE_ARMV8)
+  crc32c_Func = crc32c_armv8;
+  crc32c_Is_hw = true;
+#endif
+
+  return true;
+}
+
+/*
+ * crc32c_sw () - slicing-by-8 software implementation
+ *   return: updated (non-inverted) crc register
+ *   crc(in): crc register
+ *   p(in): data
+ *   len(in): data length
+ */
+static unsigned int
+crc32c_sw (unsigned int crc, const unsigned char *p, size_t len)
+{
+  uint32_t lo, hi;
+
+  for (; len > 0 && ((uintptr_t) p & 7) != 0; len--)
+    {
+      crc = crc32c_Table[0][(crc ^ *p++) & 0xff] ^ (crc >> 8);
+    }
+
+  for (; len >= 8; len -= 8, p += 8)
+    {
+      /* the bytes are consumed in memory order, regardless of the host endianness */
+      lo = crc ^ ((uint32_t) p[0] | ((uint32_t) p[1] << 8) | ((uint32_t) p[2] << 16) | ((uint32_t) p[3] << 24));
+      hi = (uint32_t) p[4] | ((uint32_t) p[5] << 8) | ((uint32_t) p[6] << 16) | ((uint32_t) p[7] << 24);
+
+      crc = (crc32c_Table[7][lo & 0xff] ^ crc32c_Table[6][(lo >> 8) & 0xff]
+	     ^ crc32c_Table[5][(lo >> 16) & 0xff] ^ crc32c_Table[4][lo >> 24]
+	     ^ crc32c_Table[3][hi & 0xff] ^ crc32c_Table[2][(hi >> 8) & 0xff]
+	     ^ crc32c_Table[1][(hi >> 16) & 0xff] ^ crc32c_Table[0][hi >> 24]);
+    }
+
+  for (; len > 0; len--)
+    {
+      crc = crc32c_Table[0][(crc ^ *p++) & 0xff] ^ (crc >> 8);
+    }
+
+  return crc;
+}
+
+#if defined (CRC32C_HAVE_SSE42)
+/*
+ * crc32c_cpu_has_sse42 () - check whether the cpu supports the crc32 instruction
+ *   return: true if SSE4.2 is available
+ */
+static bool
+crc32c_cpu_has_sse42 (void)
+{
+#if defined (_MSC_VER)
+  int info[4];
+
+  __cpuid (info, 1);
+  return (info[2] & (1 << 20)) != 0;
+#else
+  return __builtin_cpu_supports ("sse4.2") != 0;
+#endif
+}
+
+/*
+ * crc32c_sse42 () - SSE4.2 implementation
+ *   return: updated (non-inverted) crc register
+ *   crc(in): crc register
+ *   p(in): data
+ *   len(in): data length
+ */
+#if defined (__GNUC__)
+__attribute__ ((target ("sse4.2")))
+#endif
+static unsigned int
+crc32c_sse42 (unsigned int crc, const unsigned char *p, size_t len)
+{
+  for (; len > 0 && ((uintptr_t) p & 7) != 0; len--)
+    {
+      crc = _mm_crc32_u8 (crc, *p++);
+    }
+
+#if defined (__x86_64__) || defined (_M_X64)
+  {
+    uint64_t crc64 = crc;
+    uint64_t word;
+
+    for (; len >= 8; len -= 8, p += 8)
+      {
+	memcpy (&word, p, sizeof (word));
+	crc64 = _mm_crc32_u64 (crc64, word);
+      }
+    crc = (unsigned int) crc64;
+  }
+#endif
+
+  {
+    uint32_t word;
+
+    for (; len >= 4; len -= 4, p += 4)
+      {
+	memcpy (&word, p, sizeof (word));
+	crc = _mm_crc32_u32 (crc, word);
+      }
+  }
+
+  for (; len > 0; len--)
+    {
+      crc = _mm_crc32_u8 (crc, *p++);
+    }
+
+  return crc;
+}
+#elif defined (CRC32C_HAVE_ARMV8)
+/*
+ * crc32c_armv8 () - ARMv8 CRC32 extension implementation
+ *   return: updated (non-inverted) crc register
+ *   crc(in): crc register
+ *   p(in): data
+ *   len(in): data length
+ */
+static unsigned int
+crc32c_armv8 (unsigned int crc, const unsigned char *p, size_t len)
+{
+  uint64_t word;
+
+  for (; len > 0 && ((uintptr_t) p & 7) != 0; len--)
+    {
+      crc = __crc32cb (crc, *p++);
+    }
+
+  for (; len >= 8; len -= 8, p += 8)
+    {
+      memcpy (&word, p, sizeof (word));
+      crc = __crc32cd (crc, word);
+    }
+
+  for (; len > 0; len--)
+    {
+      crc = __crc32cb (crc, *p++);
+    }
+
+  return crc;
+}
+#endif /* CRC32C_HAVE_ARMV8 */
+
+/*
+ * crc32c_compute () - compute CRC-32C using the fastest implementation available
+ *   return: CRC-32C of buf
+ *   crc(in): CRC-32C of the preceding data or CRC32C_INIT_VALUE
+ *   buf(in): data
+ *   len(in): data length
+ */
+unsigned int
+crc32c_compute (unsigned int crc, const void *buf, size_t len)
+{
+  return ~(*crc32c_Func) (~crc, (const unsigned char *) buf, len);
+}
+
+/*
+ * crc32c_compute_sw () - compute CRC-32C with the software implementation
+ *   return: CRC-32C of buf
+ *   crc(in): CRC-32C of the preceding data or CRC32C_INIT_VALUE
+ *   buf(in): data
+ *   len(in): data length
+ */
+unsigned int
+crc32c_compute_sw (unsigned int crc, const void *buf, size_t len)
+{
+  return ~crc32c_sw (~crc, (const unsigned char *) buf, len);
+}
+
+/*
+ * crc32c_is_hw_accelerated () - is crc32c_compute using a cpu instruction?
+ *   return: true if hardware accelerated
+ */
+bool
+crc32c_is_hw_accelerated (void)
+{
+  return crc32c_Initialized && crc32c_Is_hw;
+}
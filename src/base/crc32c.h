@@ -0,0 +1,36 @@
+/*
+ * Copyright 2008 Search Solution Corporation
+ * Copyright 2016 CUBRID Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ */
+
+/*
+ * crc32c.h - CRC-32C (Castagnoli) checksum used for page integrity checks
+ */
+
+#ifndef _CRC32C_H_
+#define _CRC32C_H_
+
+#ident "$Id$"
+
+#include <stddef.h>
+
+#define CRC32C_INIT_VALUE ((unsigned int) 0)
+
+extern unsigned int crc32c_compute (unsigned int crc, const void *buf, size_t len);
+extern unsigned int crc32c_compute_sw (unsigned int crc, const void *buf, size_t len);
+extern bool crc32c_is_hw_accelerated (void);
+
+#endif /* _CRC32C_H_ */
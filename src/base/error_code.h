@@ -1736,7 +1736,15 @@
 #define ER_CGW_SQL_CONV_ERROR                       -1357
 #define ER_CGW_UNKNOWN_AFFECTED_ROWS                -1358
 
-#define ER_LAST_ERROR                               -1359
+#define ER_PB_PAGE_CHECKSUM_MISMATCH                -1359
+
+#define ER_BO_RESTART_TIME_BREAKDOWN                -1360
+
+#define ER_LC_UPGRADE_DOMAIN_PROGRESS               -1361
+
+#define ER_BTREE_INCLUDE_PAYLOAD_TOO_LARGE          -1362
+
+#define ER_LAST_ERROR                               -1363
 
 /*
  * CAUTION!
@@ -400,6 +400,8 @@ static const char sysprm_ha_conf_file_name[] = "cubrid_ha.conf";
 
 #define PRM_NAME_HA_COPY_LOG_TIMEOUT "ha_copy_log_timeout"
 
+#define PRM_NAME_HA_COPY_LOG_COMPRESS "ha_copy_log_compress"
+
 #define PRM_NAME_HA_REPLICA_DELAY "ha_replica_delay"
 
 #define PRM_NAME_HA_REPLICA_TIME_BOUND "ha_replica_time_bound"
@@ -737,6 +739,36 @@ static const char sysprm_ha_conf_file_name[] = "cubrid_ha.conf";
 
 #define PRM_NAME_ORACLE_STYLE_DIVIDE "oracle_style_divide"
 
+#define PRM_NAME_DATA_PAGE_CHECKSUM "data_page_checksum"
+
+#define PRM_NAME_LK_TRAN_ENTRY_POOL_SIZE "lock_entry_pool_size"
+
+#define PRM_NAME_OPTIMIZER_INDEX_ADVISOR "optimizer_index_advisor"
+
+#define PRM_NAME_DIRECT_IO "direct_io"
+
+#define PRM_NAME_MAX_SUBQUERY_CACHE_SIZE "max_subquery_cache_size"
+
+#define PRM_NAME_MAX_HASH_SETOP_SIZE "max_hash_setop_size"
+
+#define PRM_NAME_ADAPTIVE_PRED_REORDER "adaptive_predicate_reordering"
+
+#define PRM_NAME_SHARED_SCHEMA_CACHE_SIZE "shared_schema_cache_size"
+
+#define PRM_NAME_BOOT_WORKER_COUNT "boot_worker_count"
+
+#define PRM_NAME_ALTER_TABLE_CHANGE_TYPE_WORKER_COUNT "alter_table_change_type_worker_count"
+
+#define PRM_NAME_AUTO_UPDATE_STATISTICS_INTERVAL_IN_SECS "auto_update_statistics_interval_in_secs"
+
+#define PRM_NAME_AUTO_UPDATE_STATISTICS_MIN_CHANGES "auto_update_statistics_min_changes"
+
+#define PRM_NAME_AUTO_UPDATE_STATISTICS_CHANGE_RATIO "auto_update_statistics_change_ratio"
+
+#define PRM_NAME_AUTO_UPDATE_STATISTICS_MAX_PAGES "auto_update_statistics_max_pages"
+
+#define PRM_NAME_INDEX_COALESCE_PAGES_PER_SEC "index_coalesce_pages_per_sec"
+
 /*
  * Note about ERROR_LIST and INTEGER_LIST type
  * ERROR_LIST type is an array of bool type with the size of -(ER_LAST_ERROR)
@@ -1536,6 +1568,10 @@ static int prm_ha_copy_log_timeout_upper = INT_MAX;
 static int prm_ha_copy_log_timeout_lower = -1;
 static unsigned int prm_ha_copy_log_timeout_flag = 0;
 
+bool PRM_HA_COPY_LOG_COMPRESS = false;
+static bool prm_ha_copy_log_compress_default = false;
+static unsigned int prm_ha_copy_log_compress_flag = 0;
+
 int PRM_HA_REPLICA_DELAY_IN_SECS = 0;
 static int prm_ha_replica_delay_in_secs_default = 0;
 static int prm_ha_replica_delay_in_secs_upper = INT_MAX;
@@ -2413,6 +2449,88 @@ static int prm_vacuum_ovfp_check_threshold_upper = INT_MAX;
 static int prm_vacuum_ovfp_check_threshold_lower = 2;
 static unsigned int prm_vacuum_ovfp_check_threshold_flag = 0;
 
+bool PRM_DATA_PAGE_CHECKSUM = false;
+static bool prm_data_page_checksum_default = false;
+static unsigned int prm_data_page_checksum_flag = 0;
+
+int PRM_LK_TRAN_ENTRY_POOL_SIZE = 256;
+static int prm_lk_tran_entry_pool_size_default = 256;
+static int prm_lk_tran_entry_pool_size_upper = 65536;
+static int prm_lk_tran_entry_pool_size_lower = 10;
+static unsigned int prm_lk_tran_entry_pool_size_flag = 0;
+
+bool PRM_OPTIMIZER_INDEX_ADVISOR = false;
+static bool prm_optimizer_index_advisor_default = false;
+static unsigned int prm_optimizer_index_advisor_flag = 0;
+
+bool PRM_DIRECT_IO = false;
+static bool prm_direct_io_default = false;
+static unsigned int prm_direct_io_flag = 0;
+
+UINT64 PRM_MAX_SUBQUERY_CACHE_SIZE = 2 * 1024 * 1024;	/* 2 MB */
+static UINT64 prm_max_subquery_cache_size_default = 2 * 1024 * 1024;	/* 2 MB */
+static UINT64 prm_max_subquery_cache_size_upper = 64 * 1024 * 1024;	/* 64 MB */
+static UINT64 prm_max_subquery_cache_size_lower = 0;	/* 0 */
+static unsigned int prm_max_subquery_cache_size_flag = 0;
+
+UINT64 PRM_MAX_HASH_SETOP_SIZE = 8 * 1024 * 1024;	/* 8 MB */
+static UINT64 prm_max_hash_setop_size_default = 8 * 1024 * 1024;	/* 8 MB */
+static UINT64 prm_max_hash_setop_size_upper = 1024 * 1024 * 1024;	/* 1 GB */
+static UINT64 prm_max_hash_setop_size_lower = 0;	/* 0 */
+static unsigned int prm_max_hash_setop_size_flag = 0;
+
+bool PRM_ADAPTIVE_PRED_REORDER = true;
+static bool prm_adaptive_pred_reorder_default = true;
+static unsigned int prm_adaptive_pred_reorder_flag = 0;
+
+UINT64 PRM_SHARED_SCHEMA_CACHE_SIZE = 0;
+static UINT64 prm_shared_schema_cache_size_default = 0;
+static UINT64 prm_shared_schema_cache_size_upper = 1024 * 1024 * 1024;
+static UINT64 prm_shared_schema_cache_size_lower = 0;
+static unsigned int prm_shared_schema_cache_size_flag = 0;
+
+int PRM_BOOT_WORKER_COUNT = 8;
+static int prm_boot_worker_count_default = 8;
+static int prm_boot_worker_count_upper = 64;
+static int prm_boot_worker_count_lower = 1;
+static unsigned int prm_boot_worker_count_flag = 0;
+
+int PRM_ALTER_TABLE_CHANGE_TYPE_WORKER_COUNT = 4;
+static int prm_alter_table_change_type_worker_count_default = 4;
+static int prm_alter_table_change_type_worker_count_upper = 64;
+static int prm_alter_table_change_type_worker_count_lower = 0;
+static unsigned int prm_alter_table_change_type_worker_count_flag = 0;
+
+int PRM_AUTO_UPDATE_STATISTICS_INTERVAL_IN_SECS = 60;
+static int prm_auto_update_statistics_interval_in_secs_default = 60;
+static int prm_auto_update_statistics_interval_in_secs_upper = 86400;
+static int prm_auto_update_statistics_interval_in_secs_lower = 0;
+static unsigned int prm_auto_update_statistics_interval_in_secs_flag = 0;
+
+int PRM_AUTO_UPDATE_STATISTICS_MIN_CHANGES = 1000;
+static int prm_auto_update_statistics_min_changes_default = 1000;
+static int prm_auto_update_statistics_min_changes_upper = INT_MAX;
+static int prm_auto_update_statistics_min_changes_lower = 0;
+static unsigned int prm_auto_update_statistics_min_changes_flag = 0;
+
+float PRM_AUTO_UPDATE_STATISTICS_CHANGE_RATIO = 0.1f;
+static float prm_auto_update_statistics_change_ratio_default = 0.1f;
+static float prm_auto_update_statistics_change_ratio_upper = 100.0f;
+static float prm_auto_update_statistics_change_ratio_lower = 0.0f;
+static unsigned int prm_auto_update_statistics_change_ratio_flag = 0;
+
+int PRM_AUTO_UPDATE_STATISTICS_MAX_PAGES = 100000;
+static int prm_auto_update_statistics_max_pages_default = 100000;
+static int prm_auto_update_statistics_max_pages_upper = INT_MAX;
+static int prm_auto_update_statistics_max_pages_lower = 1;
+static unsigned int prm_auto_update_statistics_max_pages_flag = 0;
+
+int PRM_INDEX_COALESCE_PAGES_PER_SEC = 1000;
+static int prm_index_coalesce_pages_per_sec_default = 1000;
+static int prm_index_coalesce_pages_per_sec_upper = INT_MAX;
+static int prm_index_coalesce_pages_per_sec_lower = 0;
+static unsigned int prm_index_coalesce_pages_per_sec_flag = 0;
+
 typedef int (*DUP_PRM_FUNC) (void *, SYSPRM_DATATYPE, void *, SYSPRM_DATATYPE);
 
 static int prm_size_to_io_pages (void *out_val, SYSPRM_DATATYPE out_type, void *in_val, SYSPRM_DATATYPE in_type);
@@ -6347,6 +6465,184 @@ SYSPRM_PARAM prm_Def[] = {
    (char *) NULL,
    (DUP_PRM_FUNC) NULL,
    (DUP_PRM_FUNC) NULL},
+  {PRM_ID_HA_COPY_LOG_COMPRESS,
+   PRM_NAME_HA_COPY_LOG_COMPRESS,
+   (PRM_FOR_CLIENT | PRM_FOR_HA),
+   PRM_BOOLEAN,
+   &prm_ha_copy_log_compress_flag,
+   (void *) &prm_ha_copy_log_compress_default,
+   (void *) &PRM_HA_COPY_LOG_COMPRESS,
+   (void *) NULL, (void *) NULL,
+   (char *) NULL,
+   (DUP_PRM_FUNC) NULL,
+   (DUP_PRM_FUNC) NULL},
+  {PRM_ID_DATA_PAGE_CHECKSUM,
+   PRM_NAME_DATA_PAGE_CHECKSUM,
+   (PRM_FOR_SERVER),
+   PRM_BOOLEAN,
+   &prm_data_page_checksum_flag,
+   (void *) &prm_data_page_checksum_default,
+   (void *) &PRM_DATA_PAGE_CHECKSUM,
+   (void *) NULL, (void *) NULL,
+   (char *) NULL,
+   (DUP_PRM_FUNC) NULL,
+   (DUP_PRM_FUNC) NULL},
+  {PRM_ID_LK_TRAN_ENTRY_POOL_SIZE,
+   PRM_NAME_LK_TRAN_ENTRY_POOL_SIZE,
+   (PRM_FOR_SERVER | PRM_HIDDEN),
+   PRM_INTEGER,
+   &prm_lk_tran_entry_pool_size_flag,
+   (void *) &prm_lk_tran_entry_pool_size_default,
+   (void *) &PRM_LK_TRAN_ENTRY_POOL_SIZE,
+   (void *) &prm_lk_tran_entry_pool_size_upper, (void *) &prm_lk_tran_entry_pool_size_lower,
+   (char *) NULL,
+   (DUP_PRM_FUNC) NULL,
+   (DUP_PRM_FUNC) NULL},
+  {PRM_ID_OPTIMIZER_INDEX_ADVISOR,
+   PRM_NAME_OPTIMIZER_INDEX_ADVISOR,
+   (PRM_FOR_CLIENT | PRM_USER_CHANGE),
+   PRM_BOOLEAN,
+   &prm_optimizer_index_advisor_flag,
+   (void *) &prm_optimizer_index_advisor_default,
+   (void *) &PRM_OPTIMIZER_INDEX_ADVISOR,
+   (void *) NULL, (void *) NULL,
+   (char *) NULL,
+   (DUP_PRM_FUNC) NULL,
+   (DUP_PRM_FUNC) NULL},
+  {PRM_ID_DIRECT_IO,
+   PRM_NAME_DIRECT_IO,
+   (PRM_FOR_SERVER),
+   PRM_BOOLEAN,
+   &prm_direct_io_flag,
+   (void *) &prm_direct_io_default,
+   (void *) &PRM_DIRECT_IO,
+   (void *) NULL, (void *) NULL,
+   (char *) NULL,
+   (DUP_PRM_FUNC) NULL,
+   (DUP_PRM_FUNC) NULL},
+  {PRM_ID_MAX_SUBQUERY_CACHE_SIZE,
+   PRM_NAME_MAX_SUBQUERY_CACHE_SIZE,
+   (PRM_FOR_SERVER | PRM_USER_CHANGE | PRM_SIZE_UNIT),
+   PRM_BIGINT,
+   &prm_max_subquery_cache_size_flag,
+   (void *) &prm_max_subquery_cache_size_default,
+   (void *) &PRM_MAX_SUBQUERY_CACHE_SIZE,
+   (void *) &prm_max_subquery_cache_size_upper,
+   (void *) &prm_max_subquery_cache_size_lower,
+   (char *) NULL,
+   (DUP_PRM_FUNC) NULL,
+   (DUP_PRM_FUNC) NULL},
+  {PRM_ID_MAX_HASH_SETOP_SIZE,
+   PRM_NAME_MAX_HASH_SETOP_SIZE,
+   (PRM_FOR_SERVER | PRM_USER_CHANGE | PRM_SIZE_UNIT),
+   PRM_BIGINT,
+   &prm_max_hash_setop_size_flag,
+   (void *) &prm_max_hash_setop_size_default,
+   (void *) &PRM_MAX_HASH_SETOP_SIZE,
+   (void *) &prm_max_hash_setop_size_upper,
+   (void *) &prm_max_hash_setop_size_lower,
+   (char *) NULL,
+   (DUP_PRM_FUNC) NULL,
+   (DUP_PRM_FUNC) NULL},
+  {PRM_ID_ADAPTIVE_PRED_REORDER,
+   PRM_NAME_ADAPTIVE_PRED_REORDER,
+   (PRM_FOR_SERVER | PRM_USER_CHANGE),
+   PRM_BOOLEAN,
+   &prm_adaptive_pred_reorder_flag,
+   (void *) &prm_adaptive_pred_reorder_default,
+   (void *) &PRM_ADAPTIVE_PRED_REORDER,
+   (void *) NULL, (void *) NULL,
+   (char *) NULL,
+   (DUP_PRM_FUNC) NULL,
+   (DUP_PRM_FUNC) NULL},
+  {PRM_ID_SHARED_SCHEMA_CACHE_SIZE,
+   PRM_NAME_SHARED_SCHEMA_CACHE_SIZE,
+   (PRM_FOR_CLIENT | PRM_SIZE_UNIT),
+   PRM_BIGINT,
+   &prm_shared_schema_cache_size_flag,
+   (void *) &prm_shared_schema_cache_size_default,
+   (void *) &PRM_SHARED_SCHEMA_CACHE_SIZE,
+   (void *) &prm_shared_schema_cache_size_upper, (void *) &prm_shared_schema_cache_size_lower,
+   (char *) NULL,
+   (DUP_PRM_FUNC) NULL,
+   (DUP_PRM_FUNC) NULL},
+  {PRM_ID_BOOT_WORKER_COUNT,
+   PRM_NAME_BOOT_WORKER_COUNT,
+   (PRM_FOR_SERVER),
+   PRM_INTEGER,
+   &prm_boot_worker_count_flag,
+   (void *) &prm_boot_worker_count_default,
+   (void *) &PRM_BOOT_WORKER_COUNT,
+   (void *) &prm_boot_worker_count_upper, (void *) &prm_boot_worker_count_lower,
+   (char *) NULL,
+   (DUP_PRM_FUNC) NULL,
+   (DUP_PRM_FUNC) NULL},
+  {PRM_ID_ALTER_TABLE_CHANGE_TYPE_WORKER_COUNT,
+   PRM_NAME_ALTER_TABLE_CHANGE_TYPE_WORKER_COUNT,
+   (PRM_FOR_SERVER),
+   PRM_INTEGER,
+   &prm_alter_table_change_type_worker_count_flag,
+   (void *) &prm_alter_table_change_type_worker_count_default,
+   (void *) &PRM_ALTER_TABLE_CHANGE_TYPE_WORKER_COUNT,
+   (void *) &prm_alter_table_change_type_worker_count_upper, (void *) &prm_alter_table_change_type_worker_count_lower,
+   (char *) NULL,
+   (DUP_PRM_FUNC) NULL,
+   (DUP_PRM_FUNC) NULL},
+  {PRM_ID_AUTO_UPDATE_STATISTICS_INTERVAL_IN_SECS,
+   PRM_NAME_AUTO_UPDATE_STATISTICS_INTERVAL_IN_SECS,
+   (PRM_FOR_SERVER),
+   PRM_INTEGER,
+   &prm_auto_update_statistics_interval_in_secs_flag,
+   (void *) &prm_auto_update_statistics_interval_in_secs_default,
+   (void *) &PRM_AUTO_UPDATE_STATISTICS_INTERVAL_IN_SECS,
+   (void *) &prm_auto_update_statistics_interval_in_secs_upper, (void *) &prm_auto_update_statistics_interval_in_secs_lower,
+   (char *) NULL,
+   (DUP_PRM_FUNC) NULL,
+   (DUP_PRM_FUNC) NULL},
+  {PRM_ID_AUTO_UPDATE_STATISTICS_MIN_CHANGES,
+   PRM_NAME_AUTO_UPDATE_STATISTICS_MIN_CHANGES,
+   (PRM_FOR_SERVER),
+   PRM_INTEGER,
+   &prm_auto_update_statistics_min_changes_flag,
+   (void *) &prm_auto_update_statistics_min_changes_default,
+   (void *) &PRM_AUTO_UPDATE_STATISTICS_MIN_CHANGES,
+   (void *) &prm_auto_update_statistics_min_changes_upper, (void *) &prm_auto_update_statistics_min_changes_lower,
+   (char *) NULL,
+   (DUP_PRM_FUNC) NULL,
+   (DUP_PRM_FUNC) NULL},
+  {PRM_ID_AUTO_UPDATE_STATISTICS_CHANGE_RATIO,
+   PRM_NAME_AUTO_UPDATE_STATISTICS_CHANGE_RATIO,
+   (PRM_FOR_SERVER),
+   PRM_FLOAT,
+   &prm_auto_update_statistics_change_ratio_flag,
+   (void *) &prm_auto_update_statistics_change_ratio_default,
+   (void *) &PRM_AUTO_UPDATE_STATISTICS_CHANGE_RATIO,
+   (void *) &prm_auto_update_statistics_change_ratio_upper, (void *) &prm_auto_update_statistics_change_ratio_lower,
+   (char *) NULL,
+   (DUP_PRM_FUNC) NULL,
+   (DUP_PRM_FUNC) NULL},
+  {PRM_ID_AUTO_UPDATE_STATISTICS_MAX_PAGES,
+   PRM_NAME_AUTO_UPDATE_STATISTICS_MAX_PAGES,
+   (PRM_FOR_SERVER),
+   PRM_INTEGER,
+   &prm_auto_update_statistics_max_pages_flag,
+   (void *) &prm_auto_update_statistics_max_pages_default,
+   (void *) &PRM_AUTO_UPDATE_STATISTICS_MAX_PAGES,
+   (void *) &prm_auto_update_statistics_max_pages_upper, (void *) &prm_auto_update_statistics_max_pages_lower,
+   (char *) NULL,
+   (DUP_PRM_FUNC) NULL,
+   (DUP_PRM_FUNC) NULL},
+  {PRM_ID_INDEX_COALESCE_PAGES_PER_SEC,
+   PRM_NAME_INDEX_COALESCE_PAGES_PER_SEC,
+   (PRM_FOR_SERVER),
+   PRM_INTEGER,
+   &prm_index_coalesce_pages_per_sec_flag,
+   (void *) &prm_index_coalesce_pages_per_sec_default,
+   (void *) &PRM_INDEX_COALESCE_PAGES_PER_SEC,
+   (void *) &prm_index_coalesce_pages_per_sec_upper, (void *) &prm_index_coalesce_pages_per_sec_lower,
+   (char *) NULL,
+   (DUP_PRM_FUNC) NULL,
+   (DUP_PRM_FUNC) NULL},
 };
 
 static int num_session_parameters = 0;
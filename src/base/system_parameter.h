@@ -475,8 +475,24 @@ enum param_id
   PRM_ID_DEDUPLICATE_KEY_LEVEL,	/* support for SUPPORT_DEDUPLICATE_KEY_MODE */
   PRM_ID_PRINT_INDEX_DETAIL,	/* support for SUPPORT_DEDUPLICATE_KEY_MODE */
   PRM_ID_HA_SQL_LOG_MAX_COUNT,
+  PRM_ID_HA_COPY_LOG_COMPRESS,
+  PRM_ID_DATA_PAGE_CHECKSUM,
+  PRM_ID_LK_TRAN_ENTRY_POOL_SIZE,
+  PRM_ID_OPTIMIZER_INDEX_ADVISOR,
+  PRM_ID_DIRECT_IO,
+  PRM_ID_MAX_SUBQUERY_CACHE_SIZE,
+  PRM_ID_MAX_HASH_SETOP_SIZE,
+  PRM_ID_ADAPTIVE_PRED_REORDER,
+  PRM_ID_SHARED_SCHEMA_CACHE_SIZE,
+  PRM_ID_BOOT_WORKER_COUNT,
+  PRM_ID_ALTER_TABLE_CHANGE_TYPE_WORKER_COUNT,
+  PRM_ID_AUTO_UPDATE_STATISTICS_INTERVAL_IN_SECS,
+  PRM_ID_AUTO_UPDATE_STATISTICS_MIN_CHANGES,
+  PRM_ID_AUTO_UPDATE_STATISTICS_CHANGE_RATIO,
+  PRM_ID_AUTO_UPDATE_STATISTICS_MAX_PAGES,
+  PRM_ID_INDEX_COALESCE_PAGES_PER_SEC,
   /* change PRM_LAST_ID when adding new system parameters */
-  PRM_LAST_ID = PRM_ID_HA_SQL_LOG_MAX_COUNT
+  PRM_LAST_ID = PRM_ID_INDEX_COALESCE_PAGES_PER_SEC
 };
 typedef enum param_id PARAM_ID;
 
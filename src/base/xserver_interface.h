@@ -174,20 +174,23 @@ extern bool logtb_has_updated (THREAD_ENTRY * thread_p);
 
 extern BTID *xbtree_add_index (THREAD_ENTRY * thread_p, BTID * btid, TP_DOMAIN * key_type, OID * class_oid, int attr_id,
 			       int unique_pk, long long num_oids, long long num_nulls, long long num_keys,
-			       int deduplicate_key_pos);
+			       int deduplicate_key_pos, int include_count);
 extern BTID *xbtree_load_index (THREAD_ENTRY * thread_p, BTID * btid, const char *bt_name, TP_DOMAIN * key_type,
 				OID * class_oids, int n_classes, int n_attrs, int *attr_ids, int *attrs_prefix_length,
 				HFID * hfids, int unique_pk, int not_null_flag, OID * fk_refcls_oid,
 				BTID * fk_refcls_pk_btid, const char *fk_name, char *pred_stream, int pred_stream_size,
-				char *expr_stream, int expr_steram_size, int func_col_id, int func_attr_index_start);
+				char *expr_stream, int expr_steram_size, int func_col_id, int func_attr_index_start,
+				int include_count);
 extern BTID *xbtree_load_online_index (THREAD_ENTRY * thread_p, BTID * btid, const char *bt_name, TP_DOMAIN * key_type,
 				       OID * class_oids, int n_classes, int n_attrs, int *attr_ids,
 				       int *attrs_prefix_length, HFID * hfids, int unique_pk, int not_null_flag,
 				       OID * fk_refcls_oid, BTID * fk_refcls_pk_btid, const char *fk_name,
 				       char *pred_stream, int pred_stream_size, char *expr_stream, int expr_steram_size,
-				       int func_col_id, int func_attr_index_start, int ib_thread_count);
+				       int func_col_id, int func_attr_index_start, int include_count,
+				       int ib_thread_count);
 
 extern int xbtree_delete_index (THREAD_ENTRY * thread_p, BTID * btid);
+extern int xbtree_coalesce_index (THREAD_ENTRY * thread_p, BTID * btid);
 extern BTREE_SEARCH xbtree_find_unique (THREAD_ENTRY * thread_p, BTID * btid, SCAN_OPERATION_TYPE scan_op_type,
 					DB_VALUE * key, OID * class_oid, OID * oid, bool is_all_class_srch);
 extern int xbtree_class_test_unique (THREAD_ENTRY * thread_p, char *buf, int buf_size);
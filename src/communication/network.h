@@ -271,6 +271,9 @@ enum net_server_request
   NET_SERVER_FLASHBACK_GET_SUMMARY,
   NET_SERVER_FLASHBACK_GET_LOGINFO,
 
+  NET_SERVER_LC_MOVE_PARTITION_ROWS,
+  NET_SERVER_BTREE_COALESCE_INDEX,
+
   /*
    * This is the last entry. It is also used for the end of an
    * array of statistics information on client/server communication.
@@ -288,6 +291,7 @@ enum net_server_request
 #define NET_CAP_INTERRUPT_ENABLED       0x00800000
 #define NET_CAP_UPDATE_DISABLED         0x00008000
 #define NET_CAP_REMOTE_DISABLED         0x00000080
+#define NET_CAP_HA_COPY_LOG_COMPRESS	0x00000010
 #define NET_CAP_HA_REPL_DELAY           0x00000008
 #define NET_CAP_HA_REPLICA              0x00000004
 #define NET_CAP_HA_IGNORE_REPL_DELAY	0x00000002
@@ -299,7 +303,8 @@ typedef enum
   ASYNC_OBTAIN_USER_INPUT,	/* server needs info from operator */
   GET_NEXT_LOG_PAGES,		/* log writer uses this type of request */
   END_CALLBACK,			/* normal end of non-query callback */
-  CONSOLE_OUTPUT
+  CONSOLE_OUTPUT,
+  GET_NEXT_COMPRESSED_LOG_PAGES	/* same as GET_NEXT_LOG_PAGES, but the page area is LZ4 compressed */
 } QUERY_SERVER_REQUEST;
 
 /* Server startup */
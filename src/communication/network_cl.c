@@ -92,6 +92,9 @@ static char net_Server_host[CUB_MAXHOSTNAMELEN + 1] = "";
 /* Contains the name of the current server name. */
 static char net_Server_name[DB_MAX_IDENTIFIER_LENGTH + 1] = "";
 
+/* Capabilities the current server sent at the handshake. */
+static int net_Server_capabilities = 0;
+
 static void return_error_to_server (char *host, unsigned int eid);
 static int client_capabilities (void);
 static int check_server_capabilities (int server_cap, int client_type, int rel_compare,
@@ -466,6 +469,17 @@ net_client_get_server_name (void)
   return net_Server_name;
 }
 
+/*
+ * net_client_get_server_capabilities () - the capabilities of the current server
+ *
+ * return: NET_CAP_ bits sent by the server at the handshake
+ */
+int
+net_client_get_server_capabilities (void)
+{
+  return net_Server_capabilities;
+}
+
 /*
  * net_client_request_internal -
  *
@@ -2134,10 +2148,13 @@ net_client_request_with_logwr_context (LOGWR_CONTEXT * ctx_ptr, int request, cha
 	  switch (server_request)
 	    {
 	    case GET_NEXT_LOG_PAGES:
+	    case GET_NEXT_COMPRESSED_LOG_PAGES:
 	      {
 		int length;
 		ptr = or_unpack_int (ptr, (int *) (&length));
-		error = net_client_get_next_log_pages (rc, replybuf, replysize, length);
+		error =
+		  net_client_get_next_log_pages (rc, replybuf, replysize, length,
+						 server_request == GET_NEXT_COMPRESSED_LOG_PAGES);
 	      }
 	      break;
 	    case END_CALLBACK:
@@ -2232,16 +2249,37 @@ net_client_logwr_send_end_msg (int rc, int error)
  *   replybuf(in): reply argument buffer
  *   replysize(in): reply argument buffer size
  *   ptr(in): pre-allocated data buffer
+ *   is_compressed(in): true if the server sends the page area LZ4 compressed
  *
  * Note:
  */
 int
-net_client_get_next_log_pages (int rc, char *replybuf, int replysize, int length)
+net_client_get_next_log_pages (int rc, char *replybuf, int replysize, int length, bool is_compressed)
 {
   char *reply = NULL;
+  char *recv_area;
+  int recv_area_size;
+  int recv_size;
   int error;
 
-  if (logwr_Gl.logpg_area_size < length)
+  if (is_compressed)
+    {
+      if (logwr_Gl.logpg_zip == NULL)
+	{
+	  /* compressed pages are only sent on request */
+	  er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_NET_SERVER_DATA_RECEIVE, 0);
+	  return ER_NET_SERVER_DATA_RECEIVE;
+	}
+      recv_area = logwr_Gl.logpg_zip->log_data;
+      recv_area_size = logwr_Gl.logpg_zip->buf_size;
+    }
+  else
+    {
+      recv_area = logwr_Gl.logpg_area;
+      recv_area_size = logwr_Gl.logpg_area_size;
+    }
+
+  if (recv_area_size < length)
     {
       /*
        * It means log_buffer_size/log_page_size are different between master
@@ -2252,19 +2290,31 @@ net_client_get_next_log_pages (int rc, char *replybuf, int replysize, int length
       return ER_NET_SERVER_CRASHED;
     }
 
-  (void) css_queue_receive_data_buffer (rc, logwr_Gl.logpg_area, logwr_Gl.logpg_area_size);
-  error = css_receive_data_from_server (rc, &reply, &logwr_Gl.logpg_fill_size);
+  (void) css_queue_receive_data_buffer (rc, recv_area, recv_area_size);
+  error = css_receive_data_from_server (rc, &reply, &recv_size);
   if (error != NO_ERROR)
     {
-      COMPARE_AND_FREE_BUFFER (logwr_Gl.logpg_area, reply);
+      COMPARE_AND_FREE_BUFFER (recv_area, reply);
       return set_server_error (error);
     }
   else
     {
-      error = logwr_set_hdr_and_flush_info ();
+      if (is_compressed)
+	{
+	  error = logwr_unzip_log_pages (reply, recv_size);
+	}
+      else
+	{
+	  logwr_Gl.logpg_fill_size = recv_size;
+	}
+
+      if (error == NO_ERROR)
+	{
+	  error = logwr_set_hdr_and_flush_info ();
+	}
       if (error != NO_ERROR)
 	{
-	  COMPARE_AND_FREE_BUFFER (logwr_Gl.logpg_area, reply);
+	  COMPARE_AND_FREE_BUFFER (recv_area, reply);
 	  return error;
 	}
 
@@ -2282,7 +2332,7 @@ net_client_get_next_log_pages (int rc, char *replybuf, int replysize, int length
 	}
     }
 
-  COMPARE_AND_FREE_BUFFER (logwr_Gl.logpg_area, reply);
+  COMPARE_AND_FREE_BUFFER (recv_area, reply);
   return error;
 }
 
@@ -3540,6 +3590,8 @@ net_client_ping_server_with_handshake (int client_type, bool check_capabilities,
   ptr = or_unpack_int (ptr, &server_bit_platform);
   ptr = or_unpack_string_nocopy (ptr, &server_host);
 
+  net_Server_capabilities = server_capabilities;
+
   /* get the error code which was from the server if it exists */
   error = er_errid ();
   if (error != NO_ERROR)
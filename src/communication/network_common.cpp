@@ -224,7 +224,10 @@ const char *net_server_request_name[NET_SERVER_REQUEST_END] =
   "NET_SERVER_CDC_END_SESSION",
 
   "NET_SERVER_FLASHBACK_GET_SUMMARY",
-  "NET_SERVER_FLASHBACK_GET_LOGINFO"
+  "NET_SERVER_FLASHBACK_GET_LOGINFO",
+
+  "NET_SERVER_LC_MOVE_PARTITION_ROWS",
+  "NET_SERVER_BTREE_COALESCE_INDEX"
 };
 
 /*
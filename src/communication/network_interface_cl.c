@@ -5870,12 +5870,14 @@ stats_update_all_statistics (int with_fullscan)
  *   class_oid(in):
  *   attr_id(in):
  *   unique_pk(in):
+ *   deduplicate_key_pos(in):
+ *   include_count(in):
  *
  * NOTE:
  */
 int
 btree_add_index (BTID * btid, TP_DOMAIN * key_type, OID * class_oid, int attr_id, int unique_pk,
-		 int deduplicate_key_pos)
+		 int deduplicate_key_pos, int include_count)
 {
 #if defined(CS_MODE)
   int error = NO_ERROR;
@@ -5890,6 +5892,7 @@ btree_add_index (BTID * btid, TP_DOMAIN * key_type, OID * class_oid, int attr_id
   domain_size = or_packed_domain_size (key_type, 0);
   request_size = OR_BTID_ALIGNED_SIZE + domain_size + OR_OID_SIZE + OR_INT_SIZE + OR_INT_SIZE;
   request_size += OR_INT_SIZE;	/* support for SUPPORT_DEDUPLICATE_KEY_MODE */
+  request_size += OR_INT_SIZE;	/* include_count */
 
   request = (char *) malloc (request_size);
   if (request == NULL)
@@ -5904,6 +5907,7 @@ btree_add_index (BTID * btid, TP_DOMAIN * key_type, OID * class_oid, int attr_id
   ptr = or_pack_int (ptr, attr_id);
   ptr = or_pack_int (ptr, unique_pk);
   ptr = or_pack_int (ptr, deduplicate_key_pos);	/* support for SUPPORT_DEDUPLICATE_KEY_MODE */
+  ptr = or_pack_int (ptr, include_count);
 
   req_error =
     net_client_request (NET_SERVER_BTREE_ADDINDEX, request, request_size, reply, OR_ALIGNED_BUF_SIZE (a_reply),
@@ -5930,7 +5934,9 @@ btree_add_index (BTID * btid, TP_DOMAIN * key_type, OID * class_oid, int attr_id
 
   THREAD_ENTRY *thread_p = enter_server ();
 
-  btid = xbtree_add_index (thread_p, btid, key_type, class_oid, attr_id, unique_pk, 0, 0, 0, deduplicate_key_pos);
+  btid =
+    xbtree_add_index (thread_p, btid, key_type, class_oid, attr_id, unique_pk, 0, 0, 0, deduplicate_key_pos,
+		      include_count);
   if (btid == NULL)
     {
       assert (er_errid () != NO_ERROR);
@@ -5960,6 +5966,7 @@ btree_add_index (BTID * btid, TP_DOMAIN * key_type, OID * class_oid, int attr_id
  *   fk_refcls_oid(in):
  *   fk_refcls_pk_btid(in):
  *   fk_name(in):
+ *   include_count(in):
  *
  * NOTE:
  */
@@ -5968,7 +5975,7 @@ btree_load_index (BTID * btid, const char *bt_name, TP_DOMAIN * key_type, OID *
 		  int *attr_ids, int *attrs_prefix_length, HFID * hfids, int unique_pk, int not_null_flag,
 		  OID * fk_refcls_oid, BTID * fk_refcls_pk_btid, const char *fk_name, char *pred_stream,
 		  int pred_stream_size, char *expr_stream, int expr_stream_size, int func_col_id,
-		  int func_attr_index_start, SM_INDEX_STATUS index_status)
+		  int func_attr_index_start, int include_count, SM_INDEX_STATUS index_status)
 {
 #if defined(CS_MODE)
   int error = NO_ERROR, req_error, request_size, domain_size;
@@ -6011,6 +6018,7 @@ btree_load_index (BTID * btid, const char *bt_name, TP_DOMAIN * key_type, OID *
 		  + OR_BTID_ALIGNED_SIZE	/* fk_refcls_pk_btid */
 		  + or_packed_string_length (fk_name, &fk_strlen)	/* fk_name */
 		  + index_info_size	/* filter predicate or function index stream size */
+		  + OR_INT_SIZE	/* include_count */
 		  + OR_INT_SIZE	/* Index status */
 		  + OR_INT_SIZE /* Thread count */ );
 
@@ -6086,6 +6094,7 @@ btree_load_index (BTID * btid, const char *bt_name, TP_DOMAIN * key_type, OID *
       ptr = or_pack_int (ptr, -1);	/* stream=NULL, stream_size=0 */
     }
 
+  ptr = or_pack_int (ptr, include_count);
   ptr = or_pack_int (ptr, index_status);	/* Index status. */
   ptr = or_pack_int (ptr, ib_get_thread_count ());	// Thread count needed for parallel building
 
@@ -6153,7 +6162,7 @@ btree_load_index (BTID * btid, const char *bt_name, TP_DOMAIN * key_type, OID *
 	xbtree_load_online_index (thread_p, btid, bt_name, key_type, class_oids, n_classes, n_attrs, attr_ids,
 				  attrs_prefix_length, hfids, unique_pk, not_null_flag, fk_refcls_oid,
 				  fk_refcls_pk_btid, fk_name, pred_stream, pred_stream_size, expr_stream,
-				  expr_stream_size, func_col_id, func_attr_index_start, 1);
+				  expr_stream_size, func_col_id, func_attr_index_start, include_count, 1);
     }
   else
     {
@@ -6161,7 +6170,7 @@ btree_load_index (BTID * btid, const char *bt_name, TP_DOMAIN * key_type, OID *
 	xbtree_load_index (thread_p, btid, bt_name, key_type, class_oids, n_classes, n_attrs, attr_ids,
 			   attrs_prefix_length, hfids, unique_pk, not_null_flag, fk_refcls_oid, fk_refcls_pk_btid,
 			   fk_name, pred_stream, pred_stream_size, expr_stream, expr_stream_size, func_col_id,
-			   func_attr_index_start);
+			   func_attr_index_start, include_count);
     }
 
   if (btid == NULL)
@@ -6230,6 +6239,54 @@ btree_delete_index (BTID * btid)
 #endif /* !CS_MODE */
 }
 
+/*
+ * btree_coalesce_index - merge the underfull nodes of an index
+ *
+ * return: error code
+ *
+ *   btid(in): index to coalesce
+ */
+int
+btree_coalesce_index (BTID * btid)
+{
+#if defined(CS_MODE)
+  int req_error, status = NO_ERROR;
+  OR_ALIGNED_BUF (OR_BTID_ALIGNED_SIZE) a_request;
+  char *request;
+  OR_ALIGNED_BUF (OR_INT_SIZE) a_reply;
+  char *reply;
+
+  request = OR_ALIGNED_BUF_START (a_request);
+  reply = OR_ALIGNED_BUF_START (a_reply);
+
+  (void) or_pack_btid (request, btid);
+
+  req_error =
+    net_client_request (NET_SERVER_BTREE_COALESCE_INDEX, request, OR_ALIGNED_BUF_SIZE (a_request), reply,
+			OR_ALIGNED_BUF_SIZE (a_reply), NULL, 0, NULL, 0);
+  if (!req_error)
+    {
+      or_unpack_int (reply, &status);
+    }
+  else
+    {
+      status = req_error;
+    }
+
+  return status;
+#else /* CS_MODE */
+  int success = ER_FAILED;
+
+  THREAD_ENTRY *thread_p = enter_server ();
+
+  success = xbtree_coalesce_index (thread_p, btid);
+
+  exit_server (*thread_p);
+
+  return success;
+#endif /* !CS_MODE */
+}
+
 /*
  * locator_log_force_nologging -
  *
@@ -9085,6 +9142,12 @@ logwr_get_log_pages (LOGWR_CONTEXT * ctx_ptr)
       ptr = or_pack_int64 (request, first_pageid_torecv);
     }
 
+  if (logwr_Gl.logpg_zip != NULL && (net_client_get_server_capabilities () & NET_CAP_HA_COPY_LOG_COMPRESS))
+    {
+      /* ha_copy_log_compress; a server without the capability would not know the bit */
+      mode = (LOGWR_MODE) (mode | LOGWR_COMPRESS_LOG_PAGES_MASK);
+    }
+
   ptr = or_pack_int (ptr, mode);
   ptr = or_pack_int (ptr, ctx_ptr->last_error);
 
@@ -10266,6 +10329,51 @@ locator_redistribute_partition_data (OID * class_oid, int no_oids, OID * oid_lis
 #endif /* !CS_MODE */
 }
 
+/*
+ * locator_move_partition_rows () - move the rows of a partitioned class to the partitions they belong to
+ *
+ * return : error code
+ *
+ * class_oid (in)     : partitioned class OID
+ */
+int
+locator_move_partition_rows (OID * class_oid)
+{
+#if defined(CS_MODE)
+  int success = ER_FAILED, req_error;
+  OR_ALIGNED_BUF (OR_OID_SIZE) a_request;
+  char *request;
+  OR_ALIGNED_BUF (OR_INT_SIZE) a_reply;
+  char *reply;
+
+  request = OR_ALIGNED_BUF_START (a_request);
+  reply = OR_ALIGNED_BUF_START (a_reply);
+
+  (void) or_pack_oid (request, class_oid);
+
+  req_error =
+    net_client_request (NET_SERVER_LC_MOVE_PARTITION_ROWS, request, OR_ALIGNED_BUF_SIZE (a_request), reply,
+			OR_ALIGNED_BUF_SIZE (a_reply), NULL, 0, NULL, 0);
+  if (!req_error)
+    {
+      (void) or_unpack_int (reply, &success);
+    }
+
+  return success;
+
+#else /* CS_MODE */
+  int success = ER_FAILED;
+
+  THREAD_ENTRY *thread_p = enter_server ();
+
+  success = xlocator_move_partition_rows (thread_p, class_oid);
+
+  exit_server (*thread_p);
+
+  return success;
+#endif /* !CS_MODE */
+}
+
 /*
  * netcl_spacedb () - client-side function to get database space info
  *
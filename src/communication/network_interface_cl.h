@@ -239,13 +239,15 @@ extern int stats_update_statistics (OID * classoid, int with_fullscan);
 extern int stats_update_all_statistics (int with_fullscan);
 
 extern int btree_add_index (BTID * btid, TP_DOMAIN * key_type, OID * class_oid, int attr_id, int unique_pk,
-			    int deduplicate_key_pos);
+			    int deduplicate_key_pos, int include_count);
 extern int btree_load_index (BTID * btid, const char *bt_name, TP_DOMAIN * key_type, OID * class_oids, int n_classes,
 			     int n_attrs, int *attr_ids, int *attrs_prefix_length, HFID * hfids, int unique_pk,
 			     int not_null_flag, OID * fk_refcls_oid, BTID * fk_refcls_pk_btid, const char *fk_name,
 			     char *pred_stream, int pred_stream_size, char *expr_stream, int expr_stream_size,
-			     int func_col_id, int func_attr_index_start, SM_INDEX_STATUS index_status);
+			     int func_col_id, int func_attr_index_start, int include_count,
+			     SM_INDEX_STATUS index_status);
 extern int btree_delete_index (BTID * btid);
+extern int btree_coalesce_index (BTID * btid);
 extern int locator_log_force_nologging (void);
 extern int locator_remove_class_from_index (OID * oid, BTID * btid, HFID * hfid);
 extern BTREE_SEARCH btree_find_unique (BTID * btid, DB_VALUE * key, OID * class_oid, OID * oid);
@@ -295,6 +297,7 @@ extern int btree_get_index_key_type (BTID btid, TP_DOMAIN ** key_type_p);
 extern int db_local_transaction_id (DB_VALUE * trid);
 extern int qp_get_server_info (PARSER_CONTEXT * parser, int server_info_bits);
 extern int locator_redistribute_partition_data (OID * class_oid, int no_oids, OID * oid_list);
+extern int locator_move_partition_rows (OID * class_oid);
 
 extern int jsp_get_server_port (void);
 extern int repl_log_get_append_lsa (LOG_LSA * lsa);
@@ -332,7 +335,7 @@ extern int net_client_request_with_logwr_context (LOGWR_CONTEXT * ctx_ptr, int r
 						  int *replydatasize_ptr1, char **replydata_ptr2,
 						  int *replydatasize_ptr2);
 extern void net_client_logwr_send_end_msg (int rc, int error);
-extern int net_client_get_next_log_pages (int rc, char *replybuf, int replysize, int length);
+extern int net_client_get_next_log_pages (int rc, char *replybuf, int replysize, int length, bool is_compressed);
 #if defined(ENABLE_UNUSED_FUNCTION)
 extern int net_client_request3 (int request, char *argbuf, int argsize, char *replybuf, int replysize, char *databuf,
 				int datasize, char **replydata_ptr, int *replydatasize_ptr, char **replydata_ptr2,
@@ -374,6 +377,7 @@ extern int net_client_receive_action (int rc, int *action);
 
 extern char *net_client_get_server_host (void);
 extern char *net_client_get_server_name (void);
+extern int net_client_get_server_capabilities (void);
 
 extern int boot_compact_classes (OID ** class_oids, int num_classes, int space_to_process, int instance_lock_timeout,
 				 int class_lock_timeout, bool delete_old_repr, OID * last_processed_class_oid,
@@ -439,6 +439,8 @@ server_capabilities (void)
       assert_release (css_ha_server_state () == HA_SERVER_STATE_STANDBY);
       capabilities |= NET_CAP_HA_REPLICA;
     }
+  /* the log writer can send GET_NEXT_COMPRESSED_LOG_PAGES */
+  capabilities |= NET_CAP_HA_COPY_LOG_COMPRESS;
 
   return capabilities;
 }
@@ -4065,6 +4067,7 @@ sbtree_add_index (THREAD_ENTRY * thread_p, unsigned int rid, char *request, int
   int attr_id, unique_pk;
   char *ptr;
   int deduplicate_key_pos = -1;
+  int include_count = 0;
 
   OR_ALIGNED_BUF (OR_INT_SIZE + OR_BTID_ALIGNED_SIZE) a_reply;
   char *reply = OR_ALIGNED_BUF_START (a_reply);
@@ -4075,9 +4078,11 @@ sbtree_add_index (THREAD_ENTRY * thread_p, unsigned int rid, char *request, int
   ptr = or_unpack_int (ptr, &attr_id);
   ptr = or_unpack_int (ptr, &unique_pk);
   ptr = or_unpack_int (ptr, &deduplicate_key_pos);	/* support for SUPPORT_DEDUPLICATE_KEY_MODE */
+  ptr = or_unpack_int (ptr, &include_count);
 
   return_btid =
-    xbtree_add_index (thread_p, &btid, key_type, &class_oid, attr_id, unique_pk, 0, 0, 0, deduplicate_key_pos);
+    xbtree_add_index (thread_p, &btid, key_type, &class_oid, attr_id, unique_pk, 0, 0, 0, deduplicate_key_pos,
+		      include_count);
   if (return_btid == NULL)
     {
       (void) return_error_to_client (thread_p, rid);
@@ -4127,6 +4132,7 @@ sbtree_load_index (THREAD_ENTRY * thread_p, unsigned int rid, char *request, int
   int csserror;
   int index_status = 0;
   int ib_thread_count = 0;
+  int include_count = 0;
 
   ptr = or_unpack_btid (request, &btid);
   ptr = or_unpack_string_nocopy (ptr, &bt_name);
@@ -4210,6 +4216,7 @@ sbtree_load_index (THREAD_ENTRY * thread_p, unsigned int rid, char *request, int
       break;
     }
 
+  ptr = or_unpack_int (ptr, &include_count);
   ptr = or_unpack_int (ptr, &index_status);	/* Get index status. */
   ptr = or_unpack_int (ptr, &ib_thread_count);	/* Get thread count. */
 
@@ -4219,7 +4226,7 @@ sbtree_load_index (THREAD_ENTRY * thread_p, unsigned int rid, char *request, int
 	xbtree_load_online_index (thread_p, &btid, bt_name, key_type, class_oids, n_classes, n_attrs, attr_ids,
 				  attr_prefix_lengths, hfids, unique_pk, not_null_flag, &fk_refcls_oid,
 				  &fk_refcls_pk_btid, fk_name, pred_stream, pred_stream_size, expr_stream,
-				  expr_stream_size, func_col_id, func_attr_index_start, ib_thread_count);
+				  expr_stream_size, func_col_id, func_attr_index_start, include_count, ib_thread_count);
     }
   else
     {
@@ -4227,7 +4234,7 @@ sbtree_load_index (THREAD_ENTRY * thread_p, unsigned int rid, char *request, int
 	xbtree_load_index (thread_p, &btid, bt_name, key_type, class_oids, n_classes, n_attrs, attr_ids,
 			   attr_prefix_lengths, hfids, unique_pk, not_null_flag, &fk_refcls_oid, &fk_refcls_pk_btid,
 			   fk_name, pred_stream, pred_stream_size, expr_stream, expr_stream_size, func_col_id,
-			   func_attr_index_start);
+			   func_attr_index_start, include_count);
     }
 
   if (return_btid == NULL)
@@ -4331,6 +4338,37 @@ sbtree_delete_index (THREAD_ENTRY * thread_p, unsigned int rid, char *request, i
   css_send_data_to_client (thread_p->conn_entry, rid, reply, OR_ALIGNED_BUF_SIZE (a_reply));
 }
 
+/*
+ * sbtree_coalesce_index -
+ *
+ * return:
+ *
+ *   rid(in):
+ *   request(in):
+ *   reqlen(in):
+ *
+ * NOTE:
+ */
+void
+sbtree_coalesce_index (THREAD_ENTRY * thread_p, unsigned int rid, char *request, int reqlen)
+{
+  BTID btid;
+  int success;
+  OR_ALIGNED_BUF (OR_INT_SIZE) a_reply;
+  char *reply = OR_ALIGNED_BUF_START (a_reply);
+
+  (void) or_unpack_btid (request, &btid);
+
+  success = xbtree_coalesce_index (thread_p, &btid);
+  if (success != NO_ERROR)
+    {
+      (void) return_error_to_client (thread_p, rid);
+    }
+
+  (void) or_pack_int (reply, success);
+  css_send_data_to_client (thread_p->conn_entry, rid, reply, OR_ALIGNED_BUF_SIZE (a_reply));
+}
+
 /*
  * slocator_remove_class_from_index -
  *
@@ -7416,10 +7454,14 @@ xio_send_user_prompt_to_client (THREAD_ENTRY * thread_p, FILEIO_REMOTE_PROMPT_TY
  * xlog_send_log_pages_to_client -
  *
  * return:
+ *
+ *   is_compressed(in): true if logpg_area holds the LZ4 compressed page area
+ *
  * NOTE:
  */
 int
-xlog_send_log_pages_to_client (THREAD_ENTRY * thread_p, char *logpg_area, int area_size, LOGWR_MODE mode)
+xlog_send_log_pages_to_client (THREAD_ENTRY * thread_p, char *logpg_area, int area_size, LOGWR_MODE mode,
+			       bool is_compressed)
 {
   OR_ALIGNED_BUF (OR_INT_SIZE * 2) a_reply;
   char *reply = OR_ALIGNED_BUF_START (a_reply);
@@ -7433,7 +7475,7 @@ xlog_send_log_pages_to_client (THREAD_ENTRY * thread_p, char *logpg_area, int ar
    * by 2 ints, otherwise client will abort due to protocol error
    * Prompt_length tells the receiver how big the followon message is.
    */
-  ptr = or_pack_int (reply, (int) GET_NEXT_LOG_PAGES);
+  ptr = or_pack_int (reply, (int) (is_compressed ? GET_NEXT_COMPRESSED_LOG_PAGES : GET_NEXT_LOG_PAGES));
   ptr = or_pack_int (ptr, (int) area_size);
 
   rc =
@@ -10049,6 +10091,37 @@ end:
   css_send_data_to_client (thread_p->conn_entry, rid, reply, OR_ALIGNED_BUF_SIZE (a_reply));
 }
 
+/*
+ * slocator_move_partition_rows () -
+ *
+ * return:
+ *
+ *   rid(in):
+ *   request(in):
+ *   reqlen(in):
+ *
+ * NOTE:
+ */
+void
+slocator_move_partition_rows (THREAD_ENTRY * thread_p, unsigned int rid, char *request, int reqlen)
+{
+  OR_ALIGNED_BUF (OR_INT_SIZE) a_reply;
+  char *reply = OR_ALIGNED_BUF_START (a_reply);
+  int success;
+  OID class_oid;
+
+  (void) or_unpack_oid (request, &class_oid);
+
+  success = xlocator_move_partition_rows (thread_p, &class_oid);
+  if (success != NO_ERROR)
+    {
+      (void) return_error_to_client (thread_p, rid);
+    }
+
+  (void) or_pack_int (reply, success);
+  css_send_data_to_client (thread_p->conn_entry, rid, reply, OR_ALIGNED_BUF_SIZE (a_reply));
+}
+
 /*
  * netsr_spacedb () - server-side function to get database space info
  *
@@ -125,6 +125,7 @@ extern void sqst_update_all_statistics (THREAD_ENTRY * thread_p, unsigned int ri
 extern void sbtree_add_index (THREAD_ENTRY * thread_p, unsigned int rid, char *request, int reqlen);
 extern void sbtree_load_index (THREAD_ENTRY * thread_p, unsigned int rid, char *request, int reqlen);
 extern void sbtree_delete_index (THREAD_ENTRY * thread_p, unsigned int rid, char *request, int reqlen);
+extern void sbtree_coalesce_index (THREAD_ENTRY * thread_p, unsigned int rid, char *request, int reqlen);
 extern void slocator_remove_class_from_index (THREAD_ENTRY * thread_p, unsigned int rid, char *request, int reqlen);
 extern void sbtree_find_unique (THREAD_ENTRY * thread_p, unsigned int rid, char *request, int reqlen);
 extern void sbtree_find_multi_uniques (THREAD_ENTRY * thread_p, unsigned int rid, char *request, int reqlen);
@@ -171,7 +172,8 @@ extern int xcallback_console_print (THREAD_ENTRY * thread_p, char *print_str);
 extern int xio_send_user_prompt_to_client (THREAD_ENTRY * thread_p, FILEIO_REMOTE_PROMPT_TYPE prompt_id,
 					   const char *buffer, const char *failure_prompt, int range_low,
 					   int range_high, const char *secondary_prompt, int reprompt_value);
-extern int xlog_send_log_pages_to_client (THREAD_ENTRY * thread_p, char *logpb_area, int area_size, LOGWR_MODE mode);
+extern int xlog_send_log_pages_to_client (THREAD_ENTRY * thread_p, char *logpb_area, int area_size, LOGWR_MODE mode,
+					  bool is_compressed);
 extern int xlog_get_page_request_with_reply (THREAD_ENTRY * thread_p, LOG_PAGEID * fpageid_ptr, LOGWR_MODE * mode_ptr,
 					     int timeout);
 extern void shf_get_class_num_objs_and_pages (THREAD_ENTRY * thread_p, unsigned int rid, char *request, int reqlen);
@@ -234,6 +236,7 @@ extern void schksum_insert_repl_log_and_demote_table_lock (THREAD_ENTRY * thread
 							   int reqlen);
 extern void slogtb_does_active_user_exist (THREAD_ENTRY * thread_p, unsigned int rid, char *request, int reqlen);
 extern void slocator_redistribute_partition_data (THREAD_ENTRY * thread_p, unsigned int rid, char *request, int reqlen);
+extern void slocator_move_partition_rows (THREAD_ENTRY * thread_p, unsigned int rid, char *request, int reqlen);
 
 extern void sloaddb_init (THREAD_ENTRY * thread_p, unsigned int rid, char *request, int reqlen);
 extern void sloaddb_install_class (THREAD_ENTRY * thread_p, unsigned int rid, char *request, int reqlen);
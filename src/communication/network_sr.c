@@ -300,6 +300,11 @@ net_server_init (void)
   req_p->action_attribute = IN_TRANSACTION;
   req_p->processing_function = slocator_redistribute_partition_data;
 
+  /* move rows to the partitions they belong to */
+  req_p = &net_Requests[NET_SERVER_LC_MOVE_PARTITION_ROWS];
+  req_p->action_attribute = IN_TRANSACTION;
+  req_p->processing_function = slocator_move_partition_rows;
+
   req_p = &net_Requests[NET_SERVER_LC_DEMOTE_CLASS_LOCK];
   req_p->action_attribute = IN_TRANSACTION;
   req_p->processing_function = slocator_demote_class_lock;
@@ -409,6 +414,10 @@ net_server_init (void)
   req_p->action_attribute = (CHECK_DB_MODIFICATION | IN_TRANSACTION);
   req_p->processing_function = sbtree_delete_index;
 
+  req_p = &net_Requests[NET_SERVER_BTREE_COALESCE_INDEX];
+  req_p->action_attribute = (CHECK_DB_MODIFICATION | IN_TRANSACTION);
+  req_p->processing_function = sbtree_coalesce_index;
+
   req_p = &net_Requests[NET_SERVER_BTREE_LOADINDEX];
   req_p->action_attribute = (CHECK_DB_MODIFICATION | IN_TRANSACTION);
   req_p->processing_function = sbtree_load_index;
@@ -446,7 +446,7 @@ dbt_add_constraint (DB_CTMPL * def, DB_CONSTRAINT_TYPE constraint_type, const ch
       else
 	{
 	  error = smt_add_constraint (def, constraint_type, name, attnames, NULL, NULL, class_attributes, NULL, NULL,
-				      NULL, comment, SM_NORMAL_INDEX);
+				      NULL, 0, comment, SM_NORMAL_INDEX);
 	  free_and_init (name);
 	}
     }
@@ -544,7 +544,7 @@ dbt_add_foreign_key (DB_CTMPL * def, const char *constraint_name, const char **a
   else
     {
       error = smt_add_constraint (def, DB_CONSTRAINT_FOREIGN_KEY, name, attnames, NULL, NULL, 0, &fk_info, NULL, NULL,
-				  comment, SM_NORMAL_INDEX);
+				  0, comment, SM_NORMAL_INDEX);
       free_and_init (name);
     }
 
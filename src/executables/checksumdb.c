@@ -29,6 +29,13 @@
 #include <string.h>
 #include <ctype.h>
 #include <assert.h>
+#include <errno.h>
+#if !defined (WINDOWS)
+#include <unistd.h>
+#include <sys/time.h>
+#include <sys/types.h>
+#include <sys/wait.h>
+#endif /* !WINDOWS */
 
 #include "authenticate.h"
 #include "error_code.h"
@@ -44,6 +51,7 @@
 #include "client_support.h"
 #include "connection_support.h"
 #include "environment_variable.h"
+#include "memory_hash.h"
 #include "network_interface_cl.h"
 #include "locator_cl.h"
 #include "db_value_printer.hpp"
@@ -53,6 +61,7 @@
 
 #define CHKSUM_DEFAULT_LIST_SIZE	10
 #define CHKSUM_MIN_CHUNK_SIZE		100
+#define CHKSUM_MAX_PARALLEL		64
 #define CHKSUM_DEFAULT_TABLE_OWNER_NAME	"dba"
 #define CHKSUM_DEFAULT_TABLE_NAME	"db_ha_checksum"
 #define CHKSUM_SCHEMA_TABLE_SUFFIX	"_schema"
@@ -91,15 +100,33 @@ struct chksum_result
   CHKSUM_RESULT *next;
 };
 
+/* chunks of a table found by the parent process before the workers start */
+typedef struct chksum_table_plan CHKSUM_TABLE_PLAN;
+struct chksum_table_plan
+{
+  char table_name[SM_MAX_IDENTIFIER_LENGTH];
+  int first_chunk_id;		/* chunk id of lower_bounds[0] */
+  int num_chunks;
+  int max_chunks;
+  char **lower_bounds;
+  int last_chunk_rows;		/* the other chunks have chunk_size rows */
+  CHKSUM_TABLE_PLAN *next;
+};
+
 typedef struct chksum_arg CHKSUM_ARG;
 struct chksum_arg
 {
   int chunk_size;
   int sleep_msecs;
   int timeout_msecs;
+  int max_rows_per_sec;		/* throttle for all workers together; 0 means no limit */
+  int num_workers;		/* number of worker processes; chunks of each table are divided among them */
+  int worker_index;
   bool resume;
   bool cont_on_err;
   bool schema_only;
+  bool tables_ready;		/* checksum tables were already prepared by the parent process */
+  CHKSUM_TABLE_PLAN *plans;	/* chunks of each table, with parallel workers */
   dynamic_array *include_list;
   dynamic_array *exclude_list;
 };
@@ -110,13 +137,21 @@ char chksum_schema_Table_name[SM_MAX_IDENTIFIER_LENGTH];
 
 static int chksum_drop_and_create_checksum_table (void);
 static int chksum_init_checksum_tables (bool resume);
-static int chksum_get_prev_checksum_results (void);
-static CHKSUM_RESULT *chksum_get_checksum_result (const char *table_name);
+static int chksum_get_prev_checksum_results (int num_workers);
+static CHKSUM_RESULT *chksum_get_checksum_result (const char *table_name, CHKSUM_ARG * chksum_arg);
 static void chksum_free_results (CHKSUM_RESULT * results);
 static bool chksum_need_skip_table (const char *table_name, CHKSUM_ARG * chksum_arg);
-static int chksum_set_initial_chunk_id_and_lower_bound (PARSER_CONTEXT * parser, const char *table_name,
-							DB_CONSTRAINT * pk_cons, int *chunk_id,
+static bool chksum_is_own_chunk (const char *table_name, int chunk_id, CHKSUM_ARG * chksum_arg);
+static int chksum_set_initial_chunk_id_and_lower_bound (PARSER_CONTEXT * parser, CHKSUM_ARG * chksum_arg,
+							const char *table_name, DB_CONSTRAINT * pk_cons,
+							CHKSUM_TABLE_PLAN * plan, int *chunk_id,
 							PARSER_VARCHAR ** lower_bound);
+static CHKSUM_TABLE_PLAN *chksum_find_table_plan (CHKSUM_ARG * chksum_arg, const char *table_name);
+static bool chksum_plan_has_own_chunk (CHKSUM_ARG * chksum_arg, CHKSUM_TABLE_PLAN * plan);
+static PARSER_VARCHAR *chksum_get_next_own_chunk (PARSER_CONTEXT * parser, CHKSUM_ARG * chksum_arg,
+						  CHKSUM_TABLE_PLAN * plan, int *chunk_id);
+static int chksum_get_plan_chunk_rows (CHKSUM_ARG * chksum_arg, CHKSUM_TABLE_PLAN * plan, int chunk_id);
+static void chksum_free_plans (CHKSUM_TABLE_PLAN * plans);
 static PARSER_VARCHAR *chksum_print_pk_list (PARSER_CONTEXT * parser, DB_CONSTRAINT * pk, int *pk_col_cnt,
 					     bool include_decs);
 static PARSER_VARCHAR *chksum_print_select_last_chunk (PARSER_CONTEXT * parser, const char *table_name,
@@ -132,7 +167,7 @@ static PARSER_VARCHAR *chksum_get_quote_escaped_lower_bound (PARSER_CONTEXT * pa
 static PARSER_VARCHAR *chksum_print_attribute_list (PARSER_CONTEXT * parser, DB_ATTRIBUTE * attributes);
 static PARSER_VARCHAR *chksum_get_next_lower_bound (PARSER_CONTEXT * parser, const char *table_name,
 						    DB_CONSTRAINT * pk_cons, PARSER_VARCHAR * prev_lower_bound,
-						    int chunk_size, int *exec_error);
+						    int chunk_size, int *num_rows, int *exec_error);
 static PARSER_VARCHAR *chksum_get_initial_lower_bound (PARSER_CONTEXT * parser, const char *table_name,
 						       DB_CONSTRAINT * pk_cons, int *exec_error);
 static PARSER_VARCHAR *chksum_print_select_master_checksum (PARSER_CONTEXT * parser, const char *table_name,
@@ -147,7 +182,16 @@ static int chksum_insert_schema_definition (const char *table_name, int repid);
 static int chksum_calculate_checksum (PARSER_CONTEXT * parser, const OID * class_oidp, const char *table_name,
 				      DB_ATTRIBUTE * attributes, PARSER_VARCHAR * lower_bound, int chunk_id,
 				      int chunk_size);
+static void chksum_throttle (CHKSUM_ARG * chksum_arg, const struct timeval *chunk_start_time, int chunk_rows,
+			     int num_processes);
 static int chksum_start (CHKSUM_ARG * chksum_arg);
+#if !defined (WINDOWS)
+static int chksum_plan_table (CHKSUM_ARG * chksum_arg, DB_OBJECT * classobj, const char *table_name,
+			      CHKSUM_TABLE_PLAN ** plan_out);
+static int chksum_plan_chunks (CHKSUM_ARG * chksum_arg);
+static int chksum_run_worker (CHKSUM_ARG * chksum_arg, const char *command_name, const char *database_name);
+static int chksum_start_workers (CHKSUM_ARG * chksum_arg, const char *command_name, const char *database_name);
+#endif /* !WINDOWS */
 static int chksum_report (const char *command_name, const char *database);
 static int chksum_report_summary (FILE * fp);
 static int chksum_report_diff (FILE * fp);
@@ -778,9 +822,12 @@ chksum_free_results (CHKSUM_RESULT * results)
  * 	- get previous checksum result for a table
  *   return: checksum result
  *   table_name(in): source table name
+ *   chksum_arg(in):
+ *
+ * Note: with parallel workers, the last chunk of the table handled by this worker is returned.
  */
 static CHKSUM_RESULT *
-chksum_get_checksum_result (const char *table_name)
+chksum_get_checksum_result (const char *table_name, CHKSUM_ARG * chksum_arg)
 {
   CHKSUM_RESULT *res;
 
@@ -792,7 +839,7 @@ chksum_get_checksum_result (const char *table_name)
   res = chksum_Prev_results;
   while (res != NULL)
     {
-      if (strcmp (res->class_name, table_name) == 0)
+      if (strcmp (res->class_name, table_name) == 0 && chksum_is_own_chunk (table_name, res->last_chunk_id, chksum_arg))
 	{
 	  return res;
 	}
@@ -807,9 +854,13 @@ chksum_get_checksum_result (const char *table_name)
  * chksum_get_prev_checksum_results ()
  * 	- get previous checksum results
  *   return: error
+ *   num_workers(in): number of worker processes the chunks are divided among
+ *
+ * Note: the last chunk of each table is loaded for every remainder of the chunk id divided by num_workers, so each
+ *       worker can resume after the last chunk it calculated itself.
  */
 static int
-chksum_get_prev_checksum_results (void)
+chksum_get_prev_checksum_results (int num_workers)
 {
 #define QUERY_BUF_SIZE		2048
 
@@ -829,9 +880,9 @@ chksum_get_prev_checksum_results (void)
 	    "SELECT " "C1." CHKSUM_TABLE_CLASS_NAME_COL ", " "C1." CHKSUM_TABLE_CHUNK_ID_COL ", " "C1."
 	    CHKSUM_TABLE_LOWER_BOUND_COL ", " "C1." CHKSUM_TABLE_COUNT_COL " FROM " " %s AS C1 INNER JOIN (SELECT "
 	    CHKSUM_TABLE_CLASS_NAME_COL ", " "MAX (" CHKSUM_TABLE_CHUNK_ID_COL ") " "AS MAX_ID FROM %s GROUP BY "
-	    CHKSUM_TABLE_CLASS_NAME_COL ") C2 " "ON C1." CHKSUM_TABLE_CLASS_NAME_COL " = C2."
-	    CHKSUM_TABLE_CLASS_NAME_COL " AND C1." CHKSUM_TABLE_CHUNK_ID_COL " = C2.MAX_ID", chksum_result_Table_name,
-	    chksum_result_Table_name);
+	    CHKSUM_TABLE_CLASS_NAME_COL ", MOD (" CHKSUM_TABLE_CHUNK_ID_COL ", %d)) C2 " "ON C1."
+	    CHKSUM_TABLE_CLASS_NAME_COL " = C2." CHKSUM_TABLE_CLASS_NAME_COL " AND C1." CHKSUM_TABLE_CHUNK_ID_COL
+	    " = C2.MAX_ID", chksum_result_Table_name, chksum_result_Table_name, MAX (num_workers, 1));
 
   res = db_execute (query_buf, &query_result, &query_error);
   if (res >= 0)
@@ -928,14 +979,17 @@ chksum_get_prev_checksum_results (void)
  * 	- set initial values to be used for calculating checksum
  *   return: error
  *   parser(in):
+ *   chksum_arg(in):
  *   table_name(in): source table name
  *   pk_cons(in): primary key constraint info
+ *   plan(in): chunks of the table with parallel workers, or NULL
  *   chunk_id(out):
  *   lower_bound(out): initial starting point
  */
 static int
-chksum_set_initial_chunk_id_and_lower_bound (PARSER_CONTEXT * parser, const char *table_name, DB_CONSTRAINT * pk_cons,
-					     int *chunk_id, PARSER_VARCHAR ** lower_bound)
+chksum_set_initial_chunk_id_and_lower_bound (PARSER_CONTEXT * parser, CHKSUM_ARG * chksum_arg, const char *table_name,
+					     DB_CONSTRAINT * pk_cons, CHKSUM_TABLE_PLAN * plan, int *chunk_id,
+					     PARSER_VARCHAR ** lower_bound)
 {
   CHKSUM_RESULT *prev_result = NULL;
   int error = NO_ERROR;
@@ -945,8 +999,14 @@ chksum_set_initial_chunk_id_and_lower_bound (PARSER_CONTEXT * parser, const char
   *chunk_id = 0;
   *lower_bound = NULL;
 
-  prev_result = chksum_get_checksum_result (table_name);
-  if (prev_result != NULL)
+  prev_result = chksum_get_checksum_result (table_name, chksum_arg);
+  if (plan != NULL)
+    {
+      /* the first chunk of this worker, or the last one it calculated */
+      *chunk_id = prev_result != NULL ? prev_result->last_chunk_id : plan->first_chunk_id;
+      *lower_bound = chksum_get_next_own_chunk (parser, chksum_arg, plan, chunk_id);
+    }
+  else if (prev_result != NULL)
     {
       *chunk_id = prev_result->last_chunk_id;
 
@@ -1312,11 +1372,12 @@ chksum_get_quote_escaped_lower_bound (PARSER_CONTEXT * parser, PARSER_VARCHAR *
  *   pk_cons(in): primary key constraint info
  *   prev_lower_bound(in): previous lower bound
  *   chunk_size(in):
+ *   num_rows(out): rows read from prev_lower_bound, which are the rows of its chunk; may be NULL
  *   exec_error(out): error
  */
 static PARSER_VARCHAR *
 chksum_get_next_lower_bound (PARSER_CONTEXT * parser, const char *table_name, DB_CONSTRAINT * pk_cons,
-			     PARSER_VARCHAR * prev_lower_bound, int chunk_size, int *exec_error)
+			     PARSER_VARCHAR * prev_lower_bound, int chunk_size, int *num_rows, int *exec_error)
 {
   DB_QUERY_RESULT *query_result = NULL;
   DB_QUERY_ERROR query_error;
@@ -1332,6 +1393,10 @@ chksum_get_next_lower_bound (PARSER_CONTEXT * parser, const char *table_name, DB
   const char *query;
 
   *exec_error = NO_ERROR;
+  if (num_rows != NULL)
+    {
+      *num_rows = 0;
+    }
 
   sprintf (chunk_size_str, "%d", chunk_size);
 
@@ -1343,6 +1408,10 @@ chksum_get_next_lower_bound (PARSER_CONTEXT * parser, const char *table_name, DB
 
   query = (const char *) pt_get_varchar_bytes (select_last_chunk);
   res = db_execute (query, &query_result, &query_error);
+  if (res > 0 && num_rows != NULL)
+    {
+      *num_rows = res;
+    }
 
   if (prev_lower_bound != NULL && res < chunk_size)
     {
@@ -1422,7 +1491,7 @@ static PARSER_VARCHAR *
 chksum_get_initial_lower_bound (PARSER_CONTEXT * parser, const char *table_name, DB_CONSTRAINT * pk_cons,
 				int *exec_error)
 {
-  return chksum_get_next_lower_bound (parser, table_name, pk_cons, NULL, 1, exec_error);
+  return chksum_get_next_lower_bound (parser, table_name, pk_cons, NULL, 1, NULL, exec_error);
 }
 
 /*
@@ -1789,6 +1858,184 @@ chksum_need_skip_table (const char *table_name, CHKSUM_ARG * chksum_arg)
   return !match_need_skip;
 }
 
+/*
+ * chksum_is_own_chunk() - is the chunk calculated by this worker
+ *   return: true if this worker calculates the chunk
+ *   table_name(in):
+ *   chunk_id(in):
+ *   chksum_arg(in):
+ *
+ * Note: chunks of a table are dealt to the workers in turn, starting from a worker chosen by the table name, so a
+ *       large table is divided among all workers and single chunk tables are spread too. The assignment is the same
+ *       on every run with the same --parallel, so --resume continues each worker's own chunks. The lower bounds of
+ *       the chunks are found once by the parent process (see chksum_plan_chunks).
+ */
+static bool
+chksum_is_own_chunk (const char *table_name, int chunk_id, CHKSUM_ARG * chksum_arg)
+{
+  unsigned int first_worker;
+
+  if (chksum_arg->num_workers <= 1)
+    {
+      return true;
+    }
+
+  first_worker = mht_1strhash (table_name, (unsigned int) chksum_arg->num_workers);
+  return (int) ((first_worker + (unsigned int) chunk_id) % chksum_arg->num_workers) == chksum_arg->worker_index;
+}
+
+/*
+ * chksum_find_table_plan() - find the chunks of a table found by the parent process
+ *   return: plan of the table or NULL if the table is not checked
+ *   chksum_arg(in):
+ *   table_name(in):
+ */
+static CHKSUM_TABLE_PLAN *
+chksum_find_table_plan (CHKSUM_ARG * chksum_arg, const char *table_name)
+{
+  CHKSUM_TABLE_PLAN *plan;
+
+  for (plan = chksum_arg->plans; plan != NULL; plan = plan->next)
+    {
+      if (strcmp (plan->table_name, table_name) == 0)
+	{
+	  return plan;
+	}
+    }
+
+  return NULL;
+}
+
+/*
+ * chksum_plan_has_own_chunk() - does this worker calculate any chunk of the table
+ *   return: true if it does
+ *   chksum_arg(in):
+ *   plan(in):
+ */
+static bool
+chksum_plan_has_own_chunk (CHKSUM_ARG * chksum_arg, CHKSUM_TABLE_PLAN * plan)
+{
+  int i;
+
+  /* every worker owns one of any num_workers consecutive chunks */
+  for (i = 0; i < plan->num_chunks && i < chksum_arg->num_workers; i++)
+    {
+      if (chksum_is_own_chunk (plan->table_name, plan->first_chunk_id + i, chksum_arg))
+	{
+	  return true;
+	}
+    }
+
+  return false;
+}
+
+/*
+ * chksum_get_next_own_chunk() - find the next chunk of this worker
+ *   return: lower bound of the chunk or NULL if there is no more chunk
+ *   parser(in):
+ *   chksum_arg(in):
+ *   plan(in):
+ *   chunk_id(in/out): chunk to start from; the chunk found
+ */
+static PARSER_VARCHAR *
+chksum_get_next_own_chunk (PARSER_CONTEXT * parser, CHKSUM_ARG * chksum_arg, CHKSUM_TABLE_PLAN * plan, int *chunk_id)
+{
+  int id;
+
+  for (id = MAX (*chunk_id, plan->first_chunk_id); id < plan->first_chunk_id + plan->num_chunks; id++)
+    {
+      if (chksum_is_own_chunk (plan->table_name, id, chksum_arg))
+	{
+	  *chunk_id = id;
+	  return pt_append_nulstring (parser, NULL, plan->lower_bounds[id - plan->first_chunk_id]);
+	}
+    }
+
+  return NULL;
+}
+
+/*
+ * chksum_get_plan_chunk_rows() - number of rows the parent process read for a chunk
+ *   return: rows of the chunk
+ *   chksum_arg(in):
+ *   plan(in):
+ *   chunk_id(in):
+ */
+static int
+chksum_get_plan_chunk_rows (CHKSUM_ARG * chksum_arg, CHKSUM_TABLE_PLAN * plan, int chunk_id)
+{
+  if (chunk_id == plan->first_chunk_id + plan->num_chunks - 1)
+    {
+      return plan->last_chunk_rows;
+    }
+
+  return chksum_arg->chunk_size;
+}
+
+/*
+ * chksum_free_plans() - free the chunks of the tables
+ *   return: none
+ *   plans(in):
+ */
+static void
+chksum_free_plans (CHKSUM_TABLE_PLAN * plans)
+{
+  CHKSUM_TABLE_PLAN *plan, *next_plan;
+  int i;
+
+  plan = plans;
+  while (plan != NULL)
+    {
+      next_plan = plan->next;
+
+      if (plan->lower_bounds != NULL)
+	{
+	  for (i = 0; i < plan->num_chunks; i++)
+	    {
+	      free_and_init (plan->lower_bounds[i]);
+	    }
+	  free_and_init (plan->lower_bounds);
+	}
+
+      free_and_init (plan);
+
+      plan = next_plan;
+    }
+}
+
+/*
+ * chksum_throttle() - wait before the next chunk
+ *   return: none
+ *   chksum_arg(in):
+ *   chunk_start_time(in): when reading the last chunk started
+ *   chunk_rows(in): rows read for the last chunk
+ *   num_processes(in): number of processes sharing --max-rows
+ *
+ * Note: waits at least --sleep msecs, and longer if needed to keep this process under its share of --max-rows.
+ */
+static void
+chksum_throttle (CHKSUM_ARG * chksum_arg, const struct timeval *chunk_start_time, int chunk_rows, int num_processes)
+{
+  struct timeval now;
+  INT64 min_chunk_msecs, elapsed_msecs;
+  int sleep_msecs = chksum_arg->sleep_msecs;
+
+  if (chksum_arg->max_rows_per_sec > 0)
+    {
+      /* each process gets an equal part of the rate */
+      min_chunk_msecs = ((INT64) chunk_rows * 1000 * num_processes) / chksum_arg->max_rows_per_sec;
+
+      gettimeofday (&now, NULL);
+      elapsed_msecs = timeval_diff_in_msec (&now, chunk_start_time);
+      if (min_chunk_msecs - elapsed_msecs > sleep_msecs)
+	{
+	  sleep_msecs = (int) (min_chunk_msecs - elapsed_msecs);
+	}
+    }
+
+  SLEEP_MILISEC (0, sleep_msecs);
+}
+
 /*
  * chksum_start() - calculate checksum values
  * 	to check replication integrity
@@ -1804,25 +2051,30 @@ chksum_start (CHKSUM_ARG * chksum_arg)
   DB_ATTRIBUTE *attributes = NULL;
   PARSER_VARCHAR *lower_bound = NULL, *next_lower_bound = NULL;
   OID *class_oidp = NULL;
+  CHKSUM_TABLE_PLAN *plan = NULL;
 
   char err_msg[LINE_MAX];
   const char *table_name = NULL;
   int error = NO_ERROR;
   int chunk_id = 0;
+  int next_chunk_id = 0;
+  int chunk_rows = 0;
   int repid = -1;
   int prev_repid = -1;
   bool force_refetch_class_info;
+  struct timeval chunk_start_time;
 
   er_set (ER_NOTIFICATION_SEVERITY, ARG_FILE_LINE, ER_CHKSUM_GENERIC_ERR, 2, "checksum calculation started", 0);
 
-  if (chksum_init_checksum_tables (chksum_arg->resume) != NO_ERROR)
+  /* with parallel workers the parent process has already dropped and created the tables */
+  if (chksum_init_checksum_tables (chksum_arg->resume || chksum_arg->tables_ready) != NO_ERROR)
     {
       goto exit;
     }
 
   if (chksum_arg->resume == true)
     {
-      error = chksum_get_prev_checksum_results ();
+      error = chksum_get_prev_checksum_results (chksum_arg->num_workers);
       if (error != NO_ERROR)
 	{
 	  snprintf (err_msg, LINE_MAX, "Failed to load previous checksum result");
@@ -1860,6 +2112,19 @@ chksum_start (CHKSUM_ARG * chksum_arg)
 	  continue;
 	}
 
+      plan = NULL;
+      if (chksum_arg->num_workers > 1)
+	{
+	  /* the owner of the first chunk also records the schema of a table without rows */
+	  plan = chksum_find_table_plan (chksum_arg, table_name);
+	  if (plan == NULL
+	      || (chksum_plan_has_own_chunk (chksum_arg, plan) == false
+		  && (plan->num_chunks > 0 || !chksum_is_own_chunk (table_name, plan->first_chunk_id, chksum_arg))))
+	    {
+	      continue;
+	    }
+	}
+
       prev_repid = -1;
       chunk_id = 0;
       lower_bound = NULL;
@@ -1952,7 +2217,8 @@ chksum_start (CHKSUM_ARG * chksum_arg)
 	  if (chunk_id == 0 && lower_bound == NULL)
 	    {
 	      error =
-		chksum_set_initial_chunk_id_and_lower_bound (parser, table_name, pk_cons, &chunk_id, &lower_bound);
+		chksum_set_initial_chunk_id_and_lower_bound (parser, chksum_arg, table_name, pk_cons, plan, &chunk_id,
+							     &lower_bound);
 	      if (error != NO_ERROR)
 		{
 		  (void) db_abort_transaction ();
@@ -1979,6 +2245,8 @@ chksum_start (CHKSUM_ARG * chksum_arg)
 
 	  assert (lower_bound != NULL);
 
+	  gettimeofday (&chunk_start_time, NULL);
+
 	  error =
 	    chksum_calculate_checksum (parser, class_oidp, table_name, attributes, lower_bound, chunk_id,
 				       chksum_arg->chunk_size);
@@ -1998,8 +2266,19 @@ chksum_start (CHKSUM_ARG * chksum_arg)
 	      continue;
 	    }
 
-	  next_lower_bound =
-	    chksum_get_next_lower_bound (parser, table_name, pk_cons, lower_bound, chksum_arg->chunk_size, &error);
+	  next_chunk_id = chunk_id + 1;
+	  if (plan != NULL)
+	    {
+	      /* the parent process has found the lower bounds, skip to the next chunk of this worker */
+	      chunk_rows = chksum_get_plan_chunk_rows (chksum_arg, plan, chunk_id);
+	      next_lower_bound = chksum_get_next_own_chunk (parser, chksum_arg, plan, &next_chunk_id);
+	    }
+	  else
+	    {
+	      next_lower_bound =
+		chksum_get_next_lower_bound (parser, table_name, pk_cons, lower_bound, chksum_arg->chunk_size,
+					     &chunk_rows, &error);
+	    }
 	  if (error != NO_ERROR)
 	    {
 	      (void) db_abort_transaction ();
@@ -2026,16 +2305,25 @@ chksum_start (CHKSUM_ARG * chksum_arg)
 
 	  if (lower_bound == NULL)
 	    {
+	      /* report each table as soon as it is done; with parallel workers the parent process does it */
+	      if (plan == NULL)
+		{
+		  snprintf (err_msg, sizeof (err_msg), "Table [%s] completed (%d chunks)", table_name, chunk_id + 1);
+		  er_set (ER_NOTIFICATION_SEVERITY, ARG_FILE_LINE, ER_CHKSUM_GENERIC_ERR, 2, err_msg, 0);
+		  fprintf (stdout, "%s\n", err_msg);
+		  fflush (stdout);
+		}
+
 	      /* move onto the next table */
 	      chunk_id = 0;
 	      break;
 	    }
 	  else
 	    {
-	      chunk_id++;
+	      chunk_id = next_chunk_id;
 	    }
 
-	  SLEEP_MILISEC (0, chksum_arg->sleep_msecs);
+	  chksum_throttle (chksum_arg, &chunk_start_time, chunk_rows, MAX (chksum_arg->num_workers, 1));
 	}
 
       parser_free_parser (parser);
@@ -2075,6 +2363,405 @@ exit:
   return error;
 }
 
+#if !defined (WINDOWS)
+/*
+ * chksum_plan_table() - find the lower bounds of all chunks of a table
+ *   return: error code
+ *   chksum_arg(in):
+ *   classobj(in):
+ *   table_name(in):
+ *   plan_out(out): chunks of the table, NULL if the table has no primary key
+ *
+ * Note: only the primary key is read, one chunk at a time in its own transaction, and it is throttled like the
+ *       checksum calculation. On resume, the walk starts from the earliest chunk a worker has to calculate again.
+ */
+static int
+chksum_plan_table (CHKSUM_ARG * chksum_arg, DB_OBJECT * classobj, const char *table_name,
+		   CHKSUM_TABLE_PLAN ** plan_out)
+{
+  PARSER_CONTEXT *parser = NULL;
+  DB_CONSTRAINT *pk_cons = NULL;
+  CHKSUM_TABLE_PLAN *plan = NULL;
+  CHKSUM_RESULT *res, *first_result = NULL;
+  PARSER_VARCHAR *lower_bound = NULL, *next_lower_bound = NULL;
+  char **lower_bounds = NULL;
+  struct timeval step_start_time;
+  int num_results = 0;
+  int num_rows = 0;
+  int new_max_chunks;
+  int error = NO_ERROR;
+
+  *plan_out = NULL;
+
+  pk_cons = db_constraint_find_primary_key (db_get_constraints (classobj));
+  if (pk_cons == NULL)
+    {
+      /* not checked, as with a single process */
+      return NO_ERROR;
+    }
+
+  plan = (CHKSUM_TABLE_PLAN *) calloc (1, sizeof (CHKSUM_TABLE_PLAN));
+  if (plan == NULL)
+    {
+      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_OUT_OF_VIRTUAL_MEMORY, 1, sizeof (CHKSUM_TABLE_PLAN));
+      return ER_OUT_OF_VIRTUAL_MEMORY;
+    }
+
+  snprintf (plan->table_name, SM_MAX_IDENTIFIER_LENGTH, "%s", table_name);
+  *plan_out = plan;
+
+  if (chksum_arg->schema_only == true)
+    {
+      return NO_ERROR;
+    }
+
+  parser = parser_create_parser ();
+  if (parser == NULL)
+    {
+      return ER_FAILED;
+    }
+
+  for (res = chksum_Prev_results; res != NULL; res = res->next)
+    {
+      if (strcmp (res->class_name, plan->table_name) == 0)
+	{
+	  num_results++;
+	  if (first_result == NULL || res->last_chunk_id < first_result->last_chunk_id)
+	    {
+	      first_result = res;
+	    }
+	}
+    }
+
+  tran_set_query_timeout (chksum_arg->timeout_msecs);
+
+  /* a worker without any result has not started the table yet */
+  if (first_result != NULL && num_results == chksum_arg->num_workers)
+    {
+      plan->first_chunk_id = first_result->last_chunk_id;
+      lower_bound = pt_append_nulstring (parser, NULL, first_result->last_lower_bound);
+    }
+  else
+    {
+      lower_bound = chksum_get_initial_lower_bound (parser, plan->table_name, pk_cons, &error);
+    }
+
+  while (error == NO_ERROR && lower_bound != NULL)
+    {
+      gettimeofday (&step_start_time, NULL);
+
+      next_lower_bound =
+	chksum_get_next_lower_bound (parser, plan->table_name, pk_cons, lower_bound, chksum_arg->chunk_size,
+				     &num_rows, &error);
+      if (error == NO_ERROR)
+	{
+	  error = db_commit_transaction ();
+	}
+
+      if (error == ER_INTERRUPTED)
+	{
+	  /* query timeout; try the same chunk again */
+	  (void) db_abort_transaction ();
+	  error = NO_ERROR;
+
+	  SLEEP_MILISEC (0, chksum_arg->sleep_msecs);
+	  continue;
+	}
+      else if (error != NO_ERROR)
+	{
+	  break;
+	}
+
+      if (plan->num_chunks == plan->max_chunks)
+	{
+	  new_max_chunks = plan->max_chunks > 0 ? plan->max_chunks * 2 : CHKSUM_DEFAULT_LIST_SIZE;
+	  lower_bounds = (char **) realloc (plan->lower_bounds, sizeof (char *) * new_max_chunks);
+	  if (lower_bounds == NULL)
+	    {
+	      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_OUT_OF_VIRTUAL_MEMORY, 1, sizeof (char *) * new_max_chunks);
+	      error = ER_OUT_OF_VIRTUAL_MEMORY;
+	      break;
+	    }
+
+	  plan->lower_bounds = lower_bounds;
+	  plan->max_chunks = new_max_chunks;
+	}
+
+      plan->lower_bounds[plan->num_chunks] = strdup ((const char *) pt_get_varchar_bytes (lower_bound));
+      if (plan->lower_bounds[plan->num_chunks] == NULL)
+	{
+	  er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_OUT_OF_VIRTUAL_MEMORY, 1,
+		  (size_t) pt_get_varchar_length (lower_bound) + 1);
+	  error = ER_OUT_OF_VIRTUAL_MEMORY;
+	  break;
+	}
+      plan->num_chunks++;
+
+      if (next_lower_bound == NULL)
+	{
+	  plan->last_chunk_rows = num_rows;
+	}
+
+      lower_bound = next_lower_bound;
+
+      /* reading the keys of a chunk counts against --max-rows as well */
+      chksum_throttle (chksum_arg, &step_start_time, num_rows, 1);
+    }
+
+  parser_free_parser (parser);
+
+  return error;
+}
+
+/*
+ * chksum_plan_chunks() - find the chunks of all tables before the workers start
+ *   return: error code
+ *   chksum_arg(in/out): plans are set
+ *
+ * Note: the workers then calculate their own chunks without reading the primary key of the others' (see
+ *       chksum_is_own_chunk). A table that fails here is skipped by all workers.
+ */
+static int
+chksum_plan_chunks (CHKSUM_ARG * chksum_arg)
+{
+  DB_OBJLIST *tbl_list = NULL, *tbl = NULL;
+  DB_OBJECT *classobj = NULL;
+  CHKSUM_TABLE_PLAN *plan = NULL;
+  CHKSUM_TABLE_PLAN **last_plan = &chksum_arg->plans;
+  char err_msg[LINE_MAX];
+  const char *table_name = NULL;
+  int error = NO_ERROR;
+
+  if (chksum_arg->resume == true)
+    {
+      error = chksum_get_prev_checksum_results (chksum_arg->num_workers);
+      if (error != NO_ERROR)
+	{
+	  er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_CHKSUM_GENERIC_ERR, 2, "Failed to load previous checksum result",
+		  error);
+	  goto exit;
+	}
+    }
+
+  tbl_list = db_fetch_all_classes (DB_FETCH_READ);
+
+  /* commit here to invalidate snapshot captured by db_fetch_all_classes */
+  error = db_commit_transaction ();
+  if (error != NO_ERROR)
+    {
+      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_CHKSUM_GENERIC_ERR, 2, "Failed to get the list of tables", error);
+      goto exit;
+    }
+
+  for (tbl = tbl_list; tbl != NULL; tbl = tbl->next)
+    {
+      classobj = tbl->op;
+      if (db_is_system_class (classobj) || db_is_vclass (classobj))
+	{
+	  continue;
+	}
+
+      table_name = db_get_class_name (classobj);
+      if (table_name == NULL || chksum_need_skip_table (table_name, chksum_arg) == true)
+	{
+	  continue;
+	}
+
+      error = chksum_plan_table (chksum_arg, classobj, table_name, &plan);
+      if (error == NO_ERROR)
+	{
+	  if (plan != NULL)
+	    {
+	      *last_plan = plan;
+	      last_plan = &plan->next;
+	    }
+	  continue;
+	}
+
+      (void) db_abort_transaction ();
+      chksum_free_plans (plan);
+
+      if (CHKSUM_STOP_ON_ERROR (error, chksum_arg) == true)
+	{
+	  break;
+	}
+
+      snprintf (err_msg, sizeof (err_msg), "Table [%s] skipped due to error", table_name);
+      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_CHKSUM_GENERIC_ERR, 2, err_msg, error);
+      error = NO_ERROR;
+    }
+
+exit:
+  if (tbl_list != NULL)
+    {
+      db_objlist_free (tbl_list);
+    }
+
+  /* each worker loads them again */
+  if (chksum_Prev_results != NULL)
+    {
+      chksum_free_results (chksum_Prev_results);
+      chksum_Prev_results = NULL;
+    }
+
+  return error;
+}
+
+/*
+ * chksum_run_worker() - connect and calculate checksum of the tables assigned to this worker process
+ *   return: error code
+ *   chksum_arg(in):
+ *   command_name(in):
+ *   database_name(in):
+ */
+static int
+chksum_run_worker (CHKSUM_ARG * chksum_arg, const char *command_name, const char *database_name)
+{
+  char er_msg_file[PATH_MAX];
+  int error = NO_ERROR;
+
+  snprintf (er_msg_file, sizeof (er_msg_file) - 1, "%s_%s_%d.err", database_name, command_name,
+	    chksum_arg->worker_index);
+  er_init (er_msg_file, ER_NEVER_EXIT);
+
+  db_set_client_type (DB_CLIENT_TYPE_ADMIN_UTILITY);
+  if (db_login ("DBA", NULL) != NO_ERROR)
+    {
+      fprintf (stderr, "%s\n", db_error_string (3));
+      return ER_FAILED;
+    }
+
+  error = db_restart (command_name, TRUE, database_name);
+  if (error != NO_ERROR)
+    {
+      fprintf (stderr, "%s\n", db_error_string (3));
+      return error;
+    }
+
+  db_set_lock_timeout (-1);
+  db_set_isolation (TRAN_REPEATABLE_READ);
+
+  if (sysprm_load_and_init (database_name, NULL, SYSPRM_LOAD_ALL) != NO_ERROR)
+    {
+      (void) db_shutdown ();
+      return ER_FAILED;
+    }
+
+  error = chksum_start (chksum_arg);
+
+  (void) db_shutdown ();
+
+  return error;
+}
+
+/*
+ * chksum_start_workers() - calculate checksum values with several worker processes
+ *   return: error code
+ *   chksum_arg(in):
+ *   command_name(in):
+ *   database_name(in):
+ *
+ * Note: the caller must be connected. The checksum tables are prepared and the chunks of all tables are found once
+ *       here, then the connection is closed and each worker opens its own and calculates its share of the chunks
+ *       (see chksum_is_own_chunk). Each table is reported once, after all workers have finished.
+ */
+static int
+chksum_start_workers (CHKSUM_ARG * chksum_arg, const char *command_name, const char *database_name)
+{
+  pid_t *worker_pids = NULL;
+  pid_t pid;
+  CHKSUM_TABLE_PLAN *plan = NULL;
+  int num_started = 0;
+  int status;
+  int error = NO_ERROR;
+  int i;
+
+  assert (chksum_arg->num_workers > 1);
+
+  error = chksum_init_checksum_tables (chksum_arg->resume);
+  if (error == NO_ERROR)
+    {
+      error = db_commit_transaction ();
+    }
+
+  if (error == NO_ERROR)
+    {
+      error = chksum_plan_chunks (chksum_arg);
+    }
+
+  /* a forked process cannot share this connection */
+  (void) db_shutdown ();
+
+  if (error != NO_ERROR)
+    {
+      goto exit;
+    }
+
+  worker_pids = (pid_t *) malloc (sizeof (pid_t) * chksum_arg->num_workers);
+  if (worker_pids == NULL)
+    {
+      error = ER_OUT_OF_VIRTUAL_MEMORY;
+      goto exit;
+    }
+
+  chksum_arg->tables_ready = true;
+
+  fflush (stdout);
+  fflush (stderr);
+
+  for (i = 0; i < chksum_arg->num_workers; i++)
+    {
+      pid = fork ();
+      if (pid < 0)
+	{
+	  fprintf (stderr, "Failed to start checksum worker %d (errno: %d)\n", i, errno);
+	  error = ER_FAILED;
+	  break;
+	}
+      else if (pid == 0)
+	{
+	  chksum_arg->worker_index = i;
+	  error = chksum_run_worker (chksum_arg, command_name, database_name);
+
+	  fflush (stdout);
+	  _exit (error == NO_ERROR ? EXIT_SUCCESS : EXIT_FAILURE);
+	}
+
+      worker_pids[num_started++] = pid;
+    }
+
+  for (i = 0; i < num_started; i++)
+    {
+      if (waitpid (worker_pids[i], &status, 0) < 0 || !WIFEXITED (status) || WEXITSTATUS (status) != EXIT_SUCCESS)
+	{
+	  error = ER_FAILED;
+	}
+    }
+
+  free_and_init (worker_pids);
+
+  if (error == NO_ERROR)
+    {
+      /* the error log of this process is closed; the workers have logged into their own */
+      for (plan = chksum_arg->plans; plan != NULL; plan = plan->next)
+	{
+	  if (plan->num_chunks > 0)
+	    {
+	      fprintf (stdout, "Table [%s] completed (%d chunks)\n", plan->table_name,
+		       plan->first_chunk_id + plan->num_chunks);
+	    }
+	}
+      fflush (stdout);
+    }
+
+exit:
+  chksum_free_plans (chksum_arg->plans);
+  chksum_arg->plans = NULL;
+
+  return error;
+}
+#endif /* !WINDOWS */
+
 /*
  * checksumdb() - checksumdb main routine
  *   return: EXIT_SUCCESS/EXIT_FAILURE
@@ -2261,6 +2948,25 @@ checksumdb (UTIL_FUNCTION_ARG * arg)
 
   chksum_arg.cont_on_err = utility_get_option_bool_value (arg_map, CHECKSUM_CONT_ON_ERROR_S);
 
+  chksum_arg.num_workers = utility_get_option_int_value (arg_map, CHECKSUM_PARALLEL_S);
+  if (chksum_arg.num_workers < 1 || chksum_arg.num_workers > CHKSUM_MAX_PARALLEL)
+    {
+      goto print_checksumdb_usage;
+    }
+#if defined (WINDOWS)
+  if (chksum_arg.num_workers > 1)
+    {
+      /* workers are forked processes */
+      goto print_checksumdb_usage;
+    }
+#endif /* WINDOWS */
+
+  chksum_arg.max_rows_per_sec = utility_get_option_int_value (arg_map, CHECKSUM_MAX_ROWS_S);
+  if (chksum_arg.max_rows_per_sec < 0)
+    {
+      chksum_arg.max_rows_per_sec = 0;
+    }
+
 begin:
   snprintf (er_msg_file, sizeof (er_msg_file) - 1, "%s_%s.err", database_name, arg->command_name);
   er_init (er_msg_file, ER_NEVER_EXIT);
@@ -2320,7 +3026,17 @@ begin:
 	  goto error_exit;
 	}
 
-      error = chksum_start (&chksum_arg);
+#if !defined (WINDOWS)
+      if (chksum_arg.num_workers > 1)
+	{
+	  /* disconnects this process; db_shutdown () below does nothing then */
+	  error = chksum_start_workers (&chksum_arg, arg->command_name, database_name);
+	}
+      else
+#endif /* !WINDOWS */
+	{
+	  error = chksum_start (&chksum_arg);
+	}
     }
 
   if (error != NO_ERROR)
@@ -175,6 +175,7 @@ static void emit_schema (extract_context & ctxt, print_output & output_ctx, EXTR
 static void emit_class_query_spec (extract_context & ctxt, print_output & output_ctx, EXTRACT_CLASS_TYPE extract_class);
 static bool has_vclass_domains (DB_OBJECT * vclass);
 static DB_OBJLIST *emit_query_specs (extract_context & ctxt, print_output & output_ctx, DB_OBJLIST * classes);
+static void emit_materialized_view_specs (extract_context & ctxt, print_output & output_ctx, DB_OBJLIST * classes);
 static int emit_query_specs_has_using_index (extract_context & ctxt, print_output & output_ctx,
 					     DB_OBJLIST * vclass_list_has_using_index);
 static bool emit_superclasses (extract_context & ctxt, print_output & output_ctx, DB_OBJECT * class_,
@@ -1682,6 +1683,7 @@ emit_class_query_spec (extract_context & ctxt, print_output & output_ctx, EXTRAC
   if (extract_class != EXTRACT_CLASS)
     {
       ctxt.vclass_list_has_using_index = emit_query_specs (ctxt, output_ctx, ctxt.classes);
+      emit_materialized_view_specs (ctxt, output_ctx, ctxt.classes);
     }
 
   if (er_errid () == ER_OBJ_NO_COMPONENTS)
@@ -1714,6 +1716,46 @@ has_vclass_domains (DB_OBJECT * vclass)
 }
 
 
+/*
+ * emit_materialized_view_specs - Emit the defining queries of materialized views.
+ *    return: void
+ *    classes(in): class list
+ * Note:
+ *    A materialized view is unloaded as an ordinary class with its rows. Its definition is attached afterwards, when
+ *    every class and view it may read exists, so that REFRESH MATERIALIZED VIEW works on the reloaded database.
+ */
+static void
+emit_materialized_view_specs (extract_context & ctxt, print_output & output_ctx, DB_OBJLIST * classes)
+{
+  DB_OBJLIST *cl;
+  const char *name;
+  char owner_name[DB_MAX_IDENTIFIER_LENGTH] = { '\0' };
+  char *class_name = NULL;
+  char output_owner[DB_MAX_USER_LENGTH + 4] = { '\0' };
+  char *spec = NULL;
+
+  for (cl = classes; cl != NULL; cl = cl->next)
+    {
+      if (db_is_vclass (cl->op) > 0 || !sm_is_materialized_view (cl->op))
+	{
+	  continue;
+	}
+
+      if (sm_get_materialized_view_spec (cl->op, &spec) != NO_ERROR || spec == NULL)
+	{
+	  continue;
+	}
+
+      name = db_get_class_name (cl->op);
+      SPLIT_USER_SPECIFIED_NAME (name, owner_name, class_name);
+      PRINT_OWNER_NAME (owner_name, (ctxt.is_dba_user || ctxt.is_dba_group_member), output_owner,
+			sizeof (output_owner));
+
+      output_ctx ("\nALTER MATERIALIZED VIEW %s%s%s%s AS %s;\n", output_owner, PRINT_IDENTIFIER (class_name), spec);
+      free_and_init (spec);
+    }
+}
+
 /*
  * emit_query_specs - Emit the object ids for a virtual class.
  *    return:
@@ -3460,7 +3502,11 @@ emit_index_def (extract_context & ctxt, print_output & output_ctx, DB_OBJECT * c
 		}
 	    }
 	  att_name = db_attribute_name (*att);
-	  if (k > 0)
+	  if (constraint->include_count > 0 && k == n_attrs - constraint->include_count)
+	    {
+	      output_ctx (") include (");
+	    }
+	  else if (k > 0)
 	    {
 	      output_ctx (", ");
 	    }
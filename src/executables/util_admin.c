@@ -830,6 +830,8 @@ static UTIL_ARG_MAP ua_Checksum_Option_Map[] = {
   {CHECKSUM_TABLE_NAME_S, {ARG_STRING}, {0}},
   {CHECKSUM_REPORT_ONLY_S, {ARG_BOOLEAN}, {0}},
   {CHECKSUM_SCHEMA_ONLY_S, {ARG_BOOLEAN}, {0}},
+  {CHECKSUM_PARALLEL_S, {ARG_INTEGER}, {(void *) 1}},
+  {CHECKSUM_MAX_ROWS_S, {ARG_INTEGER}, {(void *) 0}},
   {0, {0}, {0}}
 };
 
@@ -844,6 +846,8 @@ static GETOPT_LONG ua_Checksum_Option[] = {
   {CHECKSUM_TABLE_NAME_L, 1, 0, CHECKSUM_TABLE_NAME_S},
   {CHECKSUM_REPORT_ONLY_L, 0, 0, CHECKSUM_REPORT_ONLY_S},
   {CHECKSUM_SCHEMA_ONLY_L, 0, 0, CHECKSUM_SCHEMA_ONLY_S},
+  {CHECKSUM_PARALLEL_L, 1, 0, CHECKSUM_PARALLEL_S},
+  {CHECKSUM_MAX_ROWS_L, 1, 0, CHECKSUM_MAX_ROWS_S},
   {0, 0, 0, 0}
 };
 
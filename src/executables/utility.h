@@ -1658,6 +1658,10 @@ typedef struct _ha_config
 #define CHECKSUM_REPORT_ONLY_L			"report-only"
 #define CHECKSUM_SCHEMA_ONLY_S			14002
 #define CHECKSUM_SCHEMA_ONLY_L			"schema-only"
+#define CHECKSUM_PARALLEL_S			14003
+#define CHECKSUM_PARALLEL_L			"parallel"
+#define CHECKSUM_MAX_ROWS_S			14004
+#define CHECKSUM_MAX_ROWS_L			"max-rows-per-sec"
 
 /* tde option list */
 #define TDE_GENERATE_KEY_S    'n'
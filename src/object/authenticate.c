@@ -5377,7 +5377,7 @@ au_change_owner (MOP class_mop, MOP owner_mop)
 	{
 	  error = sm_add_constraint (class_mop, saved->constraint_type, saved->name, (const char **) saved->att_names,
 				     saved->asc_desc, saved->prefix_length, false, saved->filter_predicate,
-				     saved->func_index_info, saved->comment, saved->index_status);
+				     saved->func_index_info, saved->include_count, saved->comment, saved->index_status);
 	  if (error != NO_ERROR)
 	    {
 	      ASSERT_ERROR ();
@@ -114,6 +114,7 @@ static SM_FOREIGN_KEY_INFO *classobj_make_foreign_key_info (DB_SEQ * fk_seq, con
 static SM_FOREIGN_KEY_INFO *classobj_make_foreign_key_ref (DB_SEQ * fk_seq);
 static SM_FOREIGN_KEY_INFO *classobj_make_foreign_key_ref_list (DB_SEQ * fk_container);
 static int *classobj_make_index_prefix_info (DB_SEQ * prefix_seq, int num_attrs);
+static DB_SEQ *classobj_make_index_include_seq (int include_count);
 static SM_PREDICATE_INFO *classobj_make_index_filter_pred_info (DB_SEQ * pred_seq);
 static int classobj_cache_not_null_constraints (const char *class_name, SM_ATTRIBUTE * attributes,
 						SM_CLASS_CONSTRAINT ** con_ptr);
@@ -796,6 +797,29 @@ classobj_make_index_attr_prefix_seq (int num_attrs, const int *attrs_prefix_leng
 
 }
 
+/*
+ * classobj_make_index_include_seq() - Make sequence which contains the number of INCLUDE attributes
+ *   return: sequence
+ *   include_count(in): number of trailing attributes given in INCLUDE (...)
+ */
+static DB_SEQ *
+classobj_make_index_include_seq (int include_count)
+{
+  DB_SEQ *include_seq;
+  DB_VALUE v;
+
+  include_seq = set_create_sequence (1);
+  if (include_seq == NULL)
+    {
+      return NULL;
+    }
+
+  db_make_int (&v, include_count);
+  set_put_element (include_seq, 0, &v);
+
+  return include_seq;
+}
+
 /*
  * classobj_make_index_attr_prefix_seq() - Make sequence which contains filter predicate
  *   return: sequence
@@ -1146,7 +1170,7 @@ classobj_put_index (DB_SEQ ** properties, SM_CLASS_CONSTRAINT * con, const BTID
     {
       int *attr_prefix_length = con->attrs_prefix_length;
 
-      if (con->filter_predicate == NULL && con->func_index_info == NULL)
+      if (con->filter_predicate == NULL && con->func_index_info == NULL && con->include_count == 0)
 	{
 	  /* prefix length */
 	  if (classobj_put_seq_and_iterate (constraint, constraint_seq_index,
@@ -1175,7 +1199,10 @@ classobj_put_index (DB_SEQ ** properties, SM_CLASS_CONSTRAINT * con, const BTID
 		  set_free (seq);
 		  goto error;
 		}
+	    }
 
+	  if (con->filter_predicate != NULL || con->include_count > 0)
+	    {
 	      if (classobj_put_seq_with_name_and_iterate (seq, seq_index, SM_PREFIX_INDEX_ID,
 							  classobj_make_index_attr_prefix_seq (num_attrs,
 											       attr_prefix_length)) !=
@@ -1186,6 +1213,16 @@ classobj_put_index (DB_SEQ ** properties, SM_CLASS_CONSTRAINT * con, const BTID
 		}
 	    }
 
+	  if (con->include_count > 0)
+	    {
+	      if (classobj_put_seq_with_name_and_iterate (seq, seq_index, SM_INCLUDE_INDEX_ID,
+							  classobj_make_index_include_seq (con->include_count)) != NO_ERROR)
+		{
+		  set_free (seq);
+		  goto error;
+		}
+	    }
+
 	  if (con->func_index_info != NULL)
 	    {
 	      if (classobj_put_seq_with_name_and_iterate (seq, seq_index, SM_FUNCTION_INDEX_ID,
@@ -1871,7 +1908,6 @@ classobj_find_prop_constraint (DB_SEQ * properties, const char *prop_name, const
   return found;
 }
 
-#if defined (ENABLE_RENAME_CONSTRAINT)
 /*
  * classobj_rename_constraint() - This function is used to rename
  *                                a constraint name.
@@ -1934,7 +1970,6 @@ end:
   pr_clear_value (&new_val);
   return error;
 }
-#endif
 
 /*
  * classobj_change_constraint_comment() - This function is used to change a constraint comment.
@@ -2631,6 +2666,7 @@ classobj_make_class_constraint (const char *name, SM_CONSTRAINT_TYPE type)
   new_->comment = NULL;
   new_->extra_status = SM_FLAG_NORMALLY_INITIALIZED;
   new_->index_status = SM_NO_INDEX;
+  new_->include_count = 0;
 
   return new_;
 }
@@ -3126,7 +3162,7 @@ classobj_make_class_constraints (DB_SET * class_props, SM_ATTRIBUTE * attributes
   SM_ATTRIBUTE *att;
   SM_CLASS_CONSTRAINT *constraints, *last, *new_;
   DB_SET *props, *info, *fk;
-  DB_VALUE pvalue, uvalue, bvalue, avalue, fvalue, cvalue, statusval;
+  DB_VALUE pvalue, uvalue, bvalue, avalue, fvalue, cvalue, statusval, incvalue;
   int i, j, k, e, len, info_len, att_cnt;
   int *asc_desc;
   int num_constraint_types = NUM_CONSTRAINT_TYPES;
@@ -3408,6 +3444,10 @@ classobj_make_class_constraints (DB_SET * class_props, SM_ATTRIBUTE * attributes
 				{
 				  flag = 0x03;
 				}
+			      else if (strcmp (db_get_string (&avalue), SM_INCLUDE_INDEX_ID) == 0)
+				{
+				  flag = 0x04;
+				}
 
 			      pr_clear_value (&avalue);
 
@@ -3436,6 +3476,14 @@ classobj_make_class_constraints (DB_SET * class_props, SM_ATTRIBUTE * attributes
 				    classobj_make_index_prefix_info (db_get_set (&avalue), att_cnt);
 				  break;
 
+				case 0x04:
+				  if (set_get_element_nocopy (db_get_set (&avalue), 0, &incvalue) != NO_ERROR)
+				    {
+				      goto structure_error;
+				    }
+				  new_->include_count = db_get_int (&incvalue);
+				  break;
+
 				default:
 				  break;
 				}
@@ -6671,7 +6719,8 @@ classobj_copy_constraint_like (DB_CTMPL * ctemplate, SM_CLASS_CONSTRAINT * const
     {
       error = smt_add_constraint (ctemplate, constraint_type, new_cons_name, att_names,
 				  (constraint_type == DB_CONSTRAINT_UNIQUE) ? constraint->asc_desc : NULL, NULL, 0,
-				  NULL, constraint->filter_predicate, constraint->func_index_info, constraint->comment,
+				  NULL, constraint->filter_predicate, constraint->func_index_info, constraint->include_count,
+				  constraint->comment,
 				  constraint->index_status);
     }
   else
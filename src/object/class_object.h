@@ -548,6 +548,7 @@ struct sm_class_constraint
   const char *comment;
   SM_CONSTRAINT_EXTRA_FLAG extra_status;
   SM_INDEX_STATUS index_status;
+  int include_count;		/* CREATE INDEX ... INCLUDE (...), number of trailing non-key attributes */
 };
 
 /*
@@ -955,10 +956,8 @@ extern int classobj_put_index (DB_SEQ ** properties, SM_CLASS_CONSTRAINT * con,
 extern int classobj_find_prop_constraint (DB_SEQ * properties, const char *prop_name, const char *cnstr_name,
 					  DB_VALUE * cnstr_val);
 
-#if defined (ENABLE_RENAME_CONSTRAINT)
 extern int classobj_rename_constraint (DB_SEQ * properties, const char *prop_name, const char *old_name,
 				       const char *new_name);
-#endif
 
 extern int classobj_change_constraint_comment (DB_SEQ * properties, SM_CLASS_CONSTRAINT * cons, const char *comment);
 
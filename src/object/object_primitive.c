@@ -9054,6 +9054,244 @@ pr_midxkey_remove_prefix (DB_VALUE * key, int prefix)
   return NO_ERROR;
 }
 
+/*
+ * pr_midxkey_get_elements_range - get the byte range of a run of elements
+ *
+ *    return:
+ *    midxkey(in):
+ *    start(in): position of the first element
+ *    count(in): number of elements
+ *    begin(out): offset in midxkey buffer to the first element
+ *    end(out): offset in midxkey buffer after the last element
+ */
+static void
+pr_midxkey_get_elements_range (const DB_MIDXKEY * midxkey, int start, int count, int *begin, int *end)
+{
+  TP_DOMAIN *domain;
+  char *ptr;
+  int i;
+
+  assert (count > 0 && start + count <= midxkey->domain->precision);
+
+  ptr = midxkey->buf + OR_MULTI_BOUND_BIT_BYTES (midxkey->domain->precision);
+  *begin = -1;
+
+  for (i = 0, domain = midxkey->domain->setdomain; i < start + count; i++, domain = domain->next)
+    {
+      if (i == start)
+	{
+	  *begin = CAST_BUFLEN (ptr - midxkey->buf);
+	}
+      if (OR_MULTI_ATT_IS_BOUND (midxkey->buf, i))
+	{
+	  ptr += pr_midxkey_element_disk_size (ptr, domain);
+	}
+    }
+
+  *end = CAST_BUFLEN (ptr - midxkey->buf);
+}
+
+/*
+ * pr_midxkey_elements_max_size - maximum size of the image made by
+ *				  pr_midxkey_get_elements_image
+ *
+ *    return: size in bytes, or -1 if an element has no upper bound
+ *    domain(in): midxkey domain
+ *    start(in): position of the first element
+ *    count(in): number of elements
+ */
+int
+pr_midxkey_elements_max_size (DB_DOMAIN * domain, int start, int count)
+{
+  TP_DOMAIN *dom;
+  int i, size, elem_size;
+
+  assert (TP_DOMAIN_TYPE (domain) == DB_TYPE_MIDXKEY);
+
+  size = OR_MULTI_BOUND_BIT_BYTES (domain->precision);
+
+  for (i = 0, dom = domain->setdomain; dom != NULL && i < start + count; i++, dom = dom->next)
+    {
+      if (i < start)
+	{
+	  continue;
+	}
+
+      if (dom->precision == TP_FLOATING_PRECISION_VALUE)
+	{
+	  return -1;
+	}
+
+      switch (TP_DOMAIN_TYPE (dom))
+	{
+	case DB_TYPE_VARCHAR:
+	case DB_TYPE_VARNCHAR:
+	  elem_size = STR_SIZE (dom->precision, TP_DOMAIN_CODESET (dom));
+	  if (elem_size >= OR_MINIMUM_STRING_LENGTH_FOR_COMPRESSION)
+	    {
+	      /* compressible; the packed length is not worth estimating */
+	      return -1;
+	    }
+	  elem_size = or_varchar_length (elem_size);
+	  break;
+
+	case DB_TYPE_VARBIT:
+	  elem_size = or_varbit_length (dom->precision);
+	  break;
+
+	default:
+	  elem_size = tp_domain_disk_size (dom);
+	  break;
+	}
+
+      if (elem_size < 0)
+	{
+	  return -1;
+	}
+      size += elem_size;
+    }
+
+  return size;
+}
+
+/*
+ * pr_midxkey_get_elements_image - copy a run of midxkey elements into an
+ *				   image of their own
+ *
+ *    return: size of the image, or -1 if it does not fit in image_size
+ *    midxkey(in): multi-column key
+ *    start(in): position of the first element
+ *    count(in): number of elements
+ *    image(out): bound bits of the whole domain followed by the copied elements
+ *    image_size(in): size of image
+ *
+ * Note: only the copied elements are marked as bound in the image. The image
+ *	 can be put back into a key by pr_midxkey_add_elements_image.
+ */
+int
+pr_midxkey_get_elements_image (const DB_MIDXKEY * midxkey, int start, int count, char *image, int image_size)
+{
+  int i, nbytes, begin, end;
+
+  nbytes = OR_MULTI_BOUND_BIT_BYTES (midxkey->domain->precision);
+
+  pr_midxkey_get_elements_range (midxkey, start, count, &begin, &end);
+  if (nbytes + end - begin > image_size)
+    {
+      return -1;
+    }
+
+  memset (image, 0, nbytes);
+  for (i = start; i < start + count; i++)
+    {
+      if (OR_MULTI_ATT_IS_BOUND (midxkey->buf, i))
+	{
+	  OR_MULTI_ENABLE_BOUND_BIT (image, i);
+	}
+    }
+  memcpy (image + nbytes, midxkey->buf + begin, end - begin);
+
+  return nbytes + end - begin;
+}
+
+/*
+ * pr_midxkey_remove_elements - unbind a run of midxkey elements
+ *
+ *    return:
+ *    key(in/out):
+ *    start(in): position of the first element
+ *    count(in): number of elements
+ */
+int
+pr_midxkey_remove_elements (DB_VALUE * key, int start, int count)
+{
+  DB_MIDXKEY *midx_key;
+  int i, begin, end;
+
+  midx_key = db_get_midxkey (key);
+
+  pr_midxkey_get_elements_range (midx_key, start, count, &begin, &end);
+
+  memmove (midx_key->buf + begin, midx_key->buf + end, midx_key->size - end);
+
+  for (i = start; i < start + count; i++)
+    {
+      OR_MULTI_CLEAR_BOUND_BIT (midx_key->buf, i);
+    }
+
+  midx_key->size = midx_key->size - end + begin;
+
+  return NO_ERROR;
+}
+
+/*
+ * pr_midxkey_add_elements_image - bind again the elements copied by
+ *				   pr_midxkey_get_elements_image
+ *
+ *    return:
+ *    result(out): key with the image elements bound
+ *    key(in): key with the elements of the image unbound
+ *    image(in):
+ *    start(in): position of the first element
+ *    count(in): number of elements
+ */
+int
+pr_midxkey_add_elements_image (DB_VALUE * result, DB_VALUE * key, const char *image, int start, int count)
+{
+  DB_MIDXKEY *midx_key;
+  DB_MIDXKEY midx_result;
+  TP_DOMAIN *domain;
+  char *ptr;
+  int i, nbytes, begin, end, image_length;
+
+  assert (DB_VALUE_TYPE (key) == DB_TYPE_MIDXKEY);
+
+  midx_key = db_get_midxkey (key);
+  nbytes = OR_MULTI_BOUND_BIT_BYTES (midx_key->domain->precision);
+
+  pr_midxkey_get_elements_range (midx_key, start, count, &begin, &end);
+  assert (begin == end);
+
+  /* get the length of the image elements */
+  ptr = (char *) image + nbytes;
+  for (i = 0, domain = midx_key->domain->setdomain; i < start + count; i++, domain = domain->next)
+    {
+      if (i >= start && OR_MULTI_ATT_IS_BOUND (image, i))
+	{
+	  ptr += pr_midxkey_element_disk_size (ptr, domain);
+	}
+    }
+  image_length = CAST_BUFLEN (ptr - image) - nbytes;
+
+  midx_result.size = midx_key->size + image_length;
+  midx_result.buf = (char *) db_private_alloc (NULL, midx_result.size);
+  if (midx_result.buf == NULL)
+    {
+      assert (er_errid () != NO_ERROR);
+      return er_errid ();
+    }
+  midx_result.domain = midx_key->domain;
+  midx_result.ncolumns = midx_key->ncolumns;
+
+  memcpy (midx_result.buf, midx_key->buf, begin);
+  for (i = start; i < start + count; i++)
+    {
+      if (OR_MULTI_ATT_IS_BOUND (image, i))
+	{
+	  OR_MULTI_ENABLE_BOUND_BIT (midx_result.buf, i);
+	}
+    }
+  memcpy (midx_result.buf + begin, image + nbytes, image_length);
+  memcpy (midx_result.buf + begin + image_length, midx_key->buf + begin, midx_key->size - begin);
+
+  midx_result.min_max_val.position = -1;
+  midx_result.min_max_val.type = MIN_COLUMN;
+  db_make_midxkey (result, &midx_result);
+  result->need_clear = true;
+
+  return NO_ERROR;
+}
+
 /*
  * pr_midxkey_common_prefix -
  *
@@ -325,6 +325,12 @@ extern int pr_midxkey_get_element_offset (const DB_MIDXKEY * midxkey, int index)
 extern int pr_midxkey_add_prefix (DB_VALUE * result, DB_VALUE * prefix, DB_VALUE * postfix, int n_prefix);
 extern int pr_midxkey_remove_prefix (DB_VALUE * key, int prefix);
 extern int pr_midxkey_common_prefix (DB_VALUE * key1, DB_VALUE * key2);
+extern int pr_midxkey_elements_max_size (DB_DOMAIN * domain, int start, int count);
+extern int pr_midxkey_get_elements_image (const DB_MIDXKEY * midxkey, int start, int count, char *image,
+					  int image_size);
+extern int pr_midxkey_remove_elements (DB_VALUE * key, int start, int count);
+extern int pr_midxkey_add_elements_image (DB_VALUE * result, DB_VALUE * key, const char *image, int start,
+					  int count);
 
 extern int pr_Inhibit_oid_promotion;
 
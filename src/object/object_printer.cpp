@@ -643,7 +643,7 @@ void object_printer::describe_constraint (const sm_class &cls, const sm_class_co
   SM_ATTRIBUTE **attribute_p;
   const int *asc_desc;
   const int *prefix_length;
-  int k, n_attrs = 0;
+  int k, n_attrs = 0, n_key_attrs = -1;
   char reserved_col_buf[RESERVED_INDEX_ATTR_NAME_BUF_SIZE] = { 0x00, };
 
   if (prt_type == class_description::CSQL_SCHEMA_COMMAND)
@@ -731,6 +731,16 @@ void object_printer::describe_constraint (const sm_class &cls, const sm_class_co
 	{
 	  n_attrs++;
 	}
+
+      /* INCLUDE attributes follow the key attributes and precede the hidden deduplicate key attribute */
+      if (constraint.include_count > 0)
+	{
+	  n_key_attrs = n_attrs - constraint.include_count;
+	  if (IS_DEDUPLICATE_KEY_ATTR_ID (constraint.attributes[n_attrs - 1]->id))
+	    {
+	      n_key_attrs--;
+	    }
+	}
     }
 
   for (attribute_p = constraint.attributes; k < n_attrs; attribute_p++)
@@ -764,7 +774,11 @@ void object_printer::describe_constraint (const sm_class &cls, const sm_class_co
 	  break;
 	}
 
-      if (k > 0)
+      if (k == n_key_attrs)
+	{
+	  m_buf (") INCLUDE (");
+	}
+      else if (k > 0)
 	{
 	  m_buf (", ");
 	}
@@ -1017,6 +1031,7 @@ void object_printer::describe_class (struct db_object *class_op)
   class_description class_descr;
   TDE_ALGORITHM tde_algo;
   const char *tde_algo_str;
+  char *mview_spec = NULL;
 
   if (class_descr.init (class_op, class_description::SHOW_CREATE_TABLE, m_buf) != NO_ERROR)
     {
@@ -1040,8 +1055,21 @@ void object_printer::describe_class (struct db_object *class_op)
 
   char **line_ptr;
 
+  /* a materialized view is created with its columns and its defining query */
+  if (sm_get_materialized_view_spec (class_op, &mview_spec) != NO_ERROR)
+    {
+      mview_spec = NULL;
+    }
+
   /* class name */
-  m_buf ("CREATE TABLE %s", class_descr.name);
+  if (mview_spec != NULL)
+    {
+      m_buf ("CREATE MATERIALIZED VIEW %s", class_descr.name);
+    }
+  else
+    {
+      m_buf ("CREATE TABLE %s", class_descr.name);
+    }
 
   /* under or as subclass of */
   if (class_descr.supers != NULL)
@@ -1226,6 +1254,13 @@ void object_printer::describe_class (struct db_object *class_op)
       printer.describe_value (&comment_value);
       pr_clear_value (&comment_value);
     }
+
+  /* defining query */
+  if (mview_spec != NULL)
+    {
+      m_buf (" AS %s", mview_spec);
+      free_and_init (mview_spec);
+    }
 }
 
 /*
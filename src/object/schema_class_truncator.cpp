@@ -644,7 +644,7 @@ namespace cubschema
 
 	error = sm_add_constraint (m_mop, saved->constraint_type, saved->name, (const char **) saved->att_names,
 				   saved->asc_desc, saved->prefix_length, false, saved->filter_predicate,
-				   saved->func_index_info, saved->comment, saved->index_status);
+				   saved->func_index_info, saved->include_count, saved->comment, saved->index_status);
 	if (error != NO_ERROR)
 	  {
 	    return error;
@@ -661,7 +661,7 @@ namespace cubschema
 
 	error = sm_add_constraint (m_mop, saved->constraint_type, saved->name, (const char **) saved->att_names,
 				   saved->asc_desc, saved->prefix_length, false, saved->filter_predicate,
-				   saved->func_index_info, saved->comment, saved->index_status);
+				   saved->func_index_info, saved->include_count, saved->comment, saved->index_status);
 	if (error != NO_ERROR)
 	  {
 	    return error;
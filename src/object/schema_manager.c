@@ -3114,6 +3114,71 @@ sm_get_class_tde_algorithm (MOP classop, TDE_ALGORITHM * tde_algo)
   return error;
 }
 
+/*
+ * sm_is_materialized_view() - Is this class a materialized view?
+ *   return: true if the class was created by CREATE MATERIALIZED VIEW
+ *   classop (in): class pointer
+ */
+bool
+sm_is_materialized_view (MOP classop)
+{
+  SM_CLASS *class_;
+  DB_VALUE value;
+  bool is_mview = false;
+
+  if (classop == NULL || au_fetch_class_force (classop, &class_, AU_FETCH_READ) != NO_ERROR)
+    {
+      return false;
+    }
+
+  if (class_->properties != NULL && classobj_get_prop (class_->properties, SM_PROPERTY_MATERIALIZED_VIEW, &value) > 0)
+    {
+      is_mview = true;
+      pr_clear_value (&value);
+    }
+
+  return is_mview;
+}
+
+/*
+ * sm_get_materialized_view_spec() - Get the defining query of a materialized view.
+ *   return: NO_ERROR on success, negative for ERROR
+ *   classop (in): class pointer
+ *   spec (out): copy of the query text, NULL if the class is not a materialized view; the caller frees it
+ */
+int
+sm_get_materialized_view_spec (MOP classop, char **spec)
+{
+  SM_CLASS *class_;
+  DB_VALUE value;
+  int error = NO_ERROR;
+
+  assert (classop != NULL && spec != NULL);
+  *spec = NULL;
+
+  error = au_fetch_class_force (classop, &class_, AU_FETCH_READ);
+  if (error != NO_ERROR)
+    {
+      return error;
+    }
+
+  if (class_->properties != NULL && classobj_get_prop (class_->properties, SM_PROPERTY_MATERIALIZED_VIEW, &value) > 0)
+    {
+      if (DB_VALUE_TYPE (&value) == DB_TYPE_STRING && db_get_string (&value) != NULL)
+	{
+	  *spec = strdup (db_get_string (&value));
+	  if (*spec == NULL)
+	    {
+	      error = ER_OUT_OF_VIRTUAL_MEMORY;
+	      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, error, 1, strlen (db_get_string (&value)) + 1);
+	    }
+	}
+      pr_clear_value (&value);
+    }
+
+  return error;
+}
+
 /*
  * sm_set_class_collation() - This sets the table collation.
  *   return: NO_ERROR on success, non-zero for ERROR
@@ -10678,7 +10743,7 @@ allocate_index (MOP classop, SM_CLASS * class_, DB_OBJLIST * subclasses, SM_CLAS
     {
       error =
 	btree_add_index (index, domain, WS_OID (classop), attrs[0]->id, unique_pk,
-			 dk_sm_deduplicate_key_position (n_attrs, attrs, function_index));
+			 dk_sm_deduplicate_key_position (n_attrs, attrs, function_index), con->include_count);
     }
   /* If there are instances, load all of them (including applicable subclasses) into the new B-tree */
   else
@@ -10690,14 +10755,15 @@ allocate_index (MOP classop, SM_CLASS * class_, DB_OBJLIST * subclasses, SM_CLAS
 				    fk_refcls_pk_btid, fk_name, SM_GET_FILTER_PRED_STREAM (filter_index),
 				    SM_GET_FILTER_PRED_STREAM_SIZE (filter_index), function_index->expr_stream,
 				    function_index->expr_stream_size, function_index->col_id,
-				    function_index->attr_index_start, index_status);
+				    function_index->attr_index_start, con->include_count, index_status);
 	}
       else
 	{
 	  error = btree_load_index (index, constraint_name, domain, oids, n_classes, n_attrs, attr_ids,
 				    (int *) attrs_prefix_length, hfids, unique_pk, not_null, fk_refcls_oid,
 				    fk_refcls_pk_btid, fk_name, SM_GET_FILTER_PRED_STREAM (filter_index),
-				    SM_GET_FILTER_PRED_STREAM_SIZE (filter_index), NULL, -1, -1, -1, index_status);
+				    SM_GET_FILTER_PRED_STREAM_SIZE (filter_index), NULL, -1, -1, -1, con->include_count,
+				    index_status);
 	}
     }
 
@@ -14431,7 +14497,8 @@ sm_add_secondary_index_on_partition (MOP classop, DB_CONSTRAINT_TYPE constraint_
 				     const char *constraint_name, const char **att_names, const int *asc_desc,
 				     const int *attrs_prefix_length, int class_attributes,
 				     SM_PREDICATE_INFO * filter_index, SM_FUNCTION_INFO * function_index,
-				     const char *comment, SM_INDEX_STATUS index_status, MOP * sub_partitions)
+				     int include_count, const char *comment, SM_INDEX_STATUS index_status,
+				     MOP * sub_partitions)
 {
   int error, i;
   bool set_savept = false;
@@ -14539,7 +14606,7 @@ sm_add_secondary_index_on_partition (MOP classop, DB_CONSTRAINT_TYPE constraint_
 
       error = sm_add_constraint (sub_partitions[i], constraint_type, constraint_name, att_names, asc_desc,
 				 attrs_prefix_length, class_attributes, new_filter_index_info, new_func_index_info,
-				 comment, index_status);
+				 include_count, comment, index_status);
     }
 
 end:
@@ -14575,6 +14642,7 @@ end:
  *   class_attributes(in): Flag.  A true value indicates that the names refer to
  *     		class attributes. A false value indicates that the names
  *     		refer to instance attributes.
+ *   include_count(in): number of trailing attributes given in INCLUDE (...)
  *   comment(in): constraint comment
  *   is_online_index(in):
  *
@@ -14585,8 +14653,8 @@ end:
 int
 sm_add_constraint (MOP classop, DB_CONSTRAINT_TYPE constraint_type, const char *constraint_name, const char **att_names,
 		   const int *asc_desc, const int *attrs_prefix_length, int class_attributes,
-		   SM_PREDICATE_INFO * filter_index, SM_FUNCTION_INFO * function_index, const char *comment,
-		   SM_INDEX_STATUS index_status)
+		   SM_PREDICATE_INFO * filter_index, SM_FUNCTION_INFO * function_index, int include_count,
+		   const char *comment, SM_INDEX_STATUS index_status)
 {
   int error = NO_ERROR;
   SM_TEMPLATE *def = NULL;
@@ -14729,8 +14797,8 @@ sm_add_constraint (MOP classop, DB_CONSTRAINT_TYPE constraint_type, const char *
 
 	      error = sm_add_secondary_index_on_partition (classop, constraint_type, constraint_name, att_names,
 							   asc_desc, attrs_prefix_length, class_attributes,
-							   filter_index, function_index, comment, index_status,
-							   sub_partitions);
+							   filter_index, function_index, include_count, comment,
+							   index_status, sub_partitions);
 	      if (error != NO_ERROR)
 		{
 		  if (sub_partitions != NULL)
@@ -14749,7 +14817,7 @@ sm_add_constraint (MOP classop, DB_CONSTRAINT_TYPE constraint_type, const char *
 	}
 
       error = smt_add_constraint (def, constraint_type, constraint_name, att_names, asc_desc, attrs_prefix_length,
-				  class_attributes, NULL, filter_index, function_index, comment, index_status);
+				  class_attributes, NULL, filter_index, function_index, include_count, comment, index_status);
       if (error != NO_ERROR)
 	{
 	  smt_quit (def);
@@ -14814,7 +14882,7 @@ sm_add_constraint (MOP classop, DB_CONSTRAINT_TYPE constraint_type, const char *
 	}
 
       error = smt_add_constraint (def, constraint_type, constraint_name, att_names, asc_desc, attrs_prefix_length,
-				  class_attributes, NULL, filter_index, function_index, comment, index_status);
+				  class_attributes, NULL, filter_index, function_index, include_count, comment, index_status);
       if (error != NO_ERROR)
 	{
 	  smt_quit (def);
@@ -15152,6 +15220,7 @@ sm_save_constraint_info (SM_CONSTRAINT_INFO ** save_info, const SM_CLASS_CONSTRA
 
   new_constraint->comment = (c->comment == NULL) ? NULL : strdup (c->comment);
   new_constraint->index_status = c->index_status;
+  new_constraint->include_count = c->include_count;
 
   assert (c->attributes != NULL);
   for (crt_att_p = c->attributes, num_atts = 0; *crt_att_p != NULL; ++crt_att_p)
@@ -16349,7 +16418,7 @@ sm_load_online_index (MOP classmop, const char *constraint_name)
 				SM_GET_FILTER_PRED_STREAM_SIZE (con->filter_predicate),
 				con->func_index_info->expr_stream, con->func_index_info->expr_stream_size,
 				con->func_index_info->col_id, con->func_index_info->attr_index_start,
-				con->index_status);
+				con->include_count, con->index_status);
     }
   else
     {
@@ -16357,7 +16426,7 @@ sm_load_online_index (MOP classmop, const char *constraint_name)
 				(int *) con->attrs_prefix_length, hfids, unique_pk, not_null, NULL,
 				NULL, NULL, SM_GET_FILTER_PRED_STREAM (con->filter_predicate),
 				SM_GET_FILTER_PRED_STREAM_SIZE (con->filter_predicate), NULL, -1, -1, -1,
-				con->index_status);
+				con->include_count, con->index_status);
     }
 
   if (error != NO_ERROR)
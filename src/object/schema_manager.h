@@ -81,6 +81,7 @@ struct sm_constraint_info
   DB_CONSTRAINT_TYPE constraint_type;
   const char *comment;
   SM_INDEX_STATUS index_status;	// Used to save index_status in case of rebuild or moving the constraint
+  int include_count;		/* number of trailing INCLUDE attributes */
 };
 
 extern ROOT_CLASS sm_Root_class;
@@ -111,7 +112,7 @@ extern char *sm_produce_constraint_name_tmpl (SM_TEMPLATE * tmpl, DB_CONSTRAINT_
 extern int sm_add_constraint (MOP classop, DB_CONSTRAINT_TYPE constraint_type, const char *constraint_name,
 			      const char **att_names, const int *asc_desc, const int *attrs_prefix_length,
 			      int class_attributes, SM_PREDICATE_INFO * predicate_info, SM_FUNCTION_INFO * fi_info,
-			      const char *comment, SM_INDEX_STATUS index_status);
+			      int include_count, const char *comment, SM_INDEX_STATUS index_status);
 extern int sm_drop_constraint (MOP classop, DB_CONSTRAINT_TYPE constraint_type, const char *constraint_name,
 			       const char **att_names, bool class_attributes, bool mysql_index_name);
 extern int sm_drop_index (MOP classop, const char *constraint_name);
@@ -135,6 +136,8 @@ extern int sm_partitioned_class_type (DB_OBJECT * classop, int *partition_type,
 extern int sm_set_class_flag (MOP classop, SM_CLASS_FLAG flag, int onoff);
 extern int sm_set_class_tde_algorithm (MOP classop, TDE_ALGORITHM tde_algo);
 extern int sm_get_class_tde_algorithm (MOP classop, TDE_ALGORITHM * tde_algo);
+extern bool sm_is_materialized_view (MOP classop);
+extern int sm_get_materialized_view_spec (MOP classop, char **spec);
 extern int sm_get_class_flag (MOP op, SM_CLASS_FLAG flag);
 extern int sm_set_class_collation (MOP classop, int collation_id);
 extern int sm_get_class_collation (MOP classop, int *collation_id);
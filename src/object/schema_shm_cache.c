@@ -0,0 +1,650 @@
+/*
+ * Copyright 2008 Search Solution Corporation
+ * Copyright 2016 CUBRID Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ */
+
+/*
+ * schema_shm_cache.c - class records shared by the client processes of a host
+ *
+ * Every client process (typically the CAS processes of a broker) keeps the classes it uses in its own workspace and
+ * fetches them from the server on first use. When many processes start at once, or after a schema change, they all
+ * ask the server for the same class records. This module keeps the disk representation of the class records in a
+ * System V shared memory segment (one per database and server host, sized by shared_schema_cache_size) so a process
+ * can build its workspace class from the shared copy instead of transferring it from the server.
+ *
+ * The shared copy is never trusted blindly: the locator still requests the class lock from the server with the cache
+ * coherency number (CHN) of the shared record, and the server only sends the record when its CHN differs. The CHN is
+ * incremented by every update of a class record and class OIDs are never reused (the root class heap is neither MVCC
+ * nor reuse_oid), so a matching CHN means the shared record is the current one. The segment is also stamped with the
+ * server session key; a restarted or different server invalidates everything that was cached.
+ *
+ * Only records known to be committed are published. A record fetched by a transaction is kept in private memory and
+ * copied to the segment when the transaction commits, so a class altered and then rolled back by the transaction that
+ * read it never reaches the other processes.
+ *
+ * Readers do not lock: the segment carries a sequence number that a writer makes odd while it updates the segment, and
+ * a reader retries the lookup when the number changed under it. Writers serialize on an owner pid; a writer that finds
+ * the owner dead takes over and rebuilds the segment. When the table or the record area is full, the segment is
+ * emptied and repopulated by the next fetches.
+ *
+ * The segment lives as long as a process of the host is attached to it. The last process to detach removes it, so
+ * nothing is left behind once the clients of the database are shut down. A segment left by clients that crashed is
+ * reused by the next client and removed when that one shuts down.
+ */
+
+#ident "$Id$"
+
+#include "config.h"
+
+#include <stdlib.h>
+#include <string.h>
+#include <stddef.h>
+#include <errno.h>
+#include <assert.h>
+#if !defined (WINDOWS)
+#include <signal.h>
+#include <unistd.h>
+#include <sys/types.h>
+#include <sys/ipc.h>
+#include <sys/shm.h>
+#endif /* !WINDOWS */
+
+#include "porting.h"
+#include "schema_shm_cache.h"
+#include "boot_cl.h"
+#include "transaction_cl.h"
+#include "db.h"
+#include "memory_alloc.h"
+#include "memory_hash.h"
+#include "object_representation.h"
+#include "system_parameter.h"
+#include "error_manager.h"
+
+#define SCHEMA_SHM_CACHE_MAGIC 0x43485343	/* "CSHC" */
+
+/* segments keys are 0x5Cxxxxxx, derived from the database and server host names */
+#define SCHEMA_SHM_CACHE_KEY_BASE 0x5C000000
+#define SCHEMA_SHM_CACHE_KEY_MASK 0x00FFFFFF
+
+#define SCHEMA_SHM_CACHE_NAME_SIZE 256
+
+/* expected size of a class record; used to size the slot table */
+#define SCHEMA_SHM_CACHE_AVG_RECORD_SIZE 2048
+#define SCHEMA_SHM_CACHE_MIN_SLOTS 64
+
+/* lookups that keep running into writers give up and fetch from the server */
+#define SCHEMA_SHM_CACHE_MAX_RETRIES 16
+
+typedef struct schema_shm_cache_header SCHEMA_SHM_CACHE_HEADER;
+struct schema_shm_cache_header
+{
+  int magic;			/* set last, when the segment is initialized */
+  volatile int writer;		/* pid of the process updating the segment or 0 */
+  volatile int seq;		/* odd while a writer updates the segment */
+  int n_slots;
+  int n_used;
+  char name[SCHEMA_SHM_CACHE_NAME_SIZE];	/* database@host of the records */
+  char session_key[SERVER_SESSION_KEY_SIZE];	/* server the records were read from */
+  INT64 size;			/* size of the segment */
+  INT64 area_offset;		/* records area, from the start of the segment */
+  INT64 area_size;
+  INT64 area_used;
+};
+
+typedef struct schema_shm_cache_slot SCHEMA_SHM_CACHE_SLOT;
+struct schema_shm_cache_slot
+{
+  OID oid;			/* class OID */
+  int chn;			/* CHN of the record */
+  int length;			/* length of the record; 0 if the slot is free */
+  INT64 offset;			/* record, from the start of the segment */
+};
+
+/* class record read by the current transaction, published at commit */
+typedef struct schema_shm_cache_pending SCHEMA_SHM_CACHE_PENDING;
+struct schema_shm_cache_pending
+{
+  SCHEMA_SHM_CACHE_PENDING *next;
+  OID oid;
+  int length;
+  char data[1];
+};
+
+#define SCHEMA_SHM_CACHE_SLOTS(cache) \
+  ((SCHEMA_SHM_CACHE_SLOT *) ((char *) (cache) + DB_ALIGN (sizeof (SCHEMA_SHM_CACHE_HEADER), MAX_ALIGNMENT)))
+
+static SCHEMA_SHM_CACHE_HEADER *schema_shm_Cache = NULL;
+static int schema_shm_Cache_id = -1;
+static bool schema_shm_Cache_unavailable = false;
+static char schema_shm_Cache_name[SCHEMA_SHM_CACHE_NAME_SIZE];
+
+static SCHEMA_SHM_CACHE_PENDING *schema_shm_Pending = NULL;
+static INT64 schema_shm_Pending_size = 0;
+
+static SCHEMA_SHM_CACHE_HEADER *schema_shm_cache_attach (void);
+static bool schema_shm_cache_is_current (SCHEMA_SHM_CACHE_HEADER * cache);
+static SCHEMA_SHM_CACHE_SLOT *schema_shm_cache_find_slot (SCHEMA_SHM_CACHE_HEADER * cache, const OID * oid,
+							  bool for_insert);
+static bool schema_shm_cache_lock (SCHEMA_SHM_CACHE_HEADER * cache, bool * is_taken_over);
+static void schema_shm_cache_unlock (SCHEMA_SHM_CACHE_HEADER * cache);
+static void schema_shm_cache_reset (SCHEMA_SHM_CACHE_HEADER * cache);
+static void schema_shm_cache_publish (SCHEMA_SHM_CACHE_HEADER * cache, SCHEMA_SHM_CACHE_PENDING * record);
+static void schema_shm_cache_free_pending (void);
+
+/*
+ * schema_shm_cache_attach () - attach the segment of the connected database, creating it if needed
+ *   return: segment or NULL if the cache is disabled or not available
+ */
+static SCHEMA_SHM_CACHE_HEADER *
+schema_shm_cache_attach (void)
+{
+#if defined (WINDOWS)
+  return NULL;
+#else /* WINDOWS */
+  SCHEMA_SHM_CACHE_HEADER *cache;
+  UINT64 size;
+  key_t key;
+  int shm_id;
+  bool is_created = false;
+  void *p;
+
+  if (schema_shm_Cache != NULL || schema_shm_Cache_unavailable)
+    {
+      return schema_shm_Cache;
+    }
+
+  if (!BOOT_IS_CLIENT_RESTARTED () || db_Database_name[0] == '\0')
+    {
+      /* not connected yet */
+      return NULL;
+    }
+
+  size = prm_get_bigint_value (PRM_ID_SHARED_SCHEMA_CACHE_SIZE);
+  if (size < DB_ALIGN (sizeof (SCHEMA_SHM_CACHE_HEADER), MAX_ALIGNMENT)
+      + SCHEMA_SHM_CACHE_MIN_SLOTS * (sizeof (SCHEMA_SHM_CACHE_SLOT) + SCHEMA_SHM_CACHE_AVG_RECORD_SIZE))
+    {
+      schema_shm_Cache_unavailable = true;
+      return NULL;
+    }
+
+  snprintf (schema_shm_Cache_name, sizeof (schema_shm_Cache_name), "%s@%s", db_Database_name,
+	    boot_get_host_connected ());
+  key = (key_t) (SCHEMA_SHM_CACHE_KEY_BASE | (mht_5strhash (schema_shm_Cache_name, SCHEMA_SHM_CACHE_KEY_MASK)));
+
+  shm_id = shmget (key, 0, 0);
+  if (shm_id < 0)
+    {
+      shm_id = shmget (key, (size_t) size, IPC_CREAT | IPC_EXCL | 0600);
+      if (shm_id >= 0)
+	{
+	  is_created = true;
+	}
+      else if (errno == EEXIST)
+	{
+	  /* created by another process in the meantime */
+	  shm_id = shmget (key, 0, 0);
+	}
+    }
+  if (shm_id < 0)
+    {
+      er_log_debug (ARG_FILE_LINE, "schema_shm_cache_attach: shmget failed for %s, errno = %d\n",
+		    schema_shm_Cache_name, errno);
+      schema_shm_Cache_unavailable = true;
+      return NULL;
+    }
+
+  p = shmat (shm_id, NULL, 0);
+  if (p == (void *) -1)
+    {
+      er_log_debug (ARG_FILE_LINE, "schema_shm_cache_attach: shmat failed for %s, errno = %d\n",
+		    schema_shm_Cache_name, errno);
+      schema_shm_Cache_unavailable = true;
+      return NULL;
+    }
+  cache = (SCHEMA_SHM_CACHE_HEADER *) p;
+
+  if (is_created)
+    {
+      /* the segment is zeroed by the system; lay it out and publish it by setting the magic */
+      cache->size = (INT64) size;
+      cache->n_slots = (int) MAX (size / SCHEMA_SHM_CACHE_AVG_RECORD_SIZE, SCHEMA_SHM_CACHE_MIN_SLOTS);
+      cache->area_offset = DB_ALIGN (DB_ALIGN (sizeof (SCHEMA_SHM_CACHE_HEADER), MAX_ALIGNMENT)
+				     + cache->n_slots * sizeof (SCHEMA_SHM_CACHE_SLOT), MAX_ALIGNMENT);
+      cache->area_size = cache->size - cache->area_offset;
+      cache->area_used = 0;
+      strncpy (cache->name, schema_shm_Cache_name, sizeof (cache->name) - 1);
+      memcpy (cache->session_key, boot_get_server_session_key (), SERVER_SESSION_KEY_SIZE);
+      MEMORY_BARRIER ();
+      cache->magic = SCHEMA_SHM_CACHE_MAGIC;
+    }
+  else if (cache->magic != 0 && cache->magic != SCHEMA_SHM_CACHE_MAGIC)
+    {
+      /* the key is used by something else */
+      er_log_debug (ARG_FILE_LINE, "schema_shm_cache_attach: key 0x%x of %s is used by another segment\n",
+		    (unsigned int) key, schema_shm_Cache_name);
+      shmdt (p);
+      schema_shm_Cache_unavailable = true;
+      return NULL;
+    }
+
+  schema_shm_Cache = cache;
+  schema_shm_Cache_id = shm_id;
+  return schema_shm_Cache;
+#endif /* WINDOWS */
+}
+
+/*
+ * schema_shm_cache_is_current () - do the records of the segment come from the server this client is connected to?
+ *   return: true if the segment can be used
+ *   cache(in): segment
+ */
+static bool
+schema_shm_cache_is_current (SCHEMA_SHM_CACHE_HEADER * cache)
+{
+  /* a segment just created by another process is not laid out until its magic is set */
+  return (cache->magic == SCHEMA_SHM_CACHE_MAGIC
+	  && memcmp (cache->session_key, boot_get_server_session_key (), SERVER_SESSION_KEY_SIZE) == 0
+	  && strncmp (cache->name, schema_shm_Cache_name, sizeof (cache->name)) == 0);
+}
+
+/*
+ * schema_shm_cache_find_slot () - find the slot of a class
+ *   return: slot of the class, the free slot where it can be added if for_insert, or NULL
+ *   cache(in): segment
+ *   oid(in): class OID
+ *   for_insert(in): return the free slot when the class is not found
+ */
+static SCHEMA_SHM_CACHE_SLOT *
+schema_shm_cache_find_slot (SCHEMA_SHM_CACHE_HEADER * cache, const OID * oid, bool for_insert)
+{
+  SCHEMA_SHM_CACHE_SLOT *slots = SCHEMA_SHM_CACHE_SLOTS (cache);
+  SCHEMA_SHM_CACHE_SLOT *slot;
+  int n_slots = cache->n_slots;
+  unsigned int hash;
+  int i;
+
+  if (n_slots <= 0)
+    {
+      return NULL;
+    }
+
+  hash = OID_PSEUDO_KEY (oid) % (unsigned int) n_slots;
+  for (i = 0; i < n_slots; i++)
+    {
+      slot = &slots[(hash + i) % n_slots];
+      if (slot->length == 0)
+	{
+	  return for_insert ? slot : NULL;
+	}
+      if (OID_EQ (&slot->oid, oid))
+	{
+	  return slot;
+	}
+    }
+
+  return NULL;
+}
+
+/*
+ * schema_shm_cache_get () - copy the shared record of a class
+ *   return: private copy of the record (to be freed with free ()) or NULL if the class is not cached
+ *   class_oid(in): class OID
+ *   length(out): length of the record
+ *
+ * Note: the caller must still validate the record with the server by its CHN.
+ */
+char *
+schema_shm_cache_get (const OID * class_oid, int *length)
+{
+  SCHEMA_SHM_CACHE_HEADER *cache;
+  SCHEMA_SHM_CACHE_SLOT *slot;
+  char *buf = NULL;
+  int buf_size = 0;
+  int seq, rec_length, retry;
+  INT64 rec_offset;
+
+  cache = schema_shm_cache_attach ();
+  if (cache == NULL || OID_ISNULL (class_oid) || OID_ISTEMP (class_oid))
+    {
+      return NULL;
+    }
+
+  for (retry = 0; retry < SCHEMA_SHM_CACHE_MAX_RETRIES; retry++)
+    {
+      seq = ATOMIC_INC_32 (&cache->seq, 0);
+      if (seq & 1)
+	{
+	  /* a writer is updating the segment */
+	  continue;
+	}
+      MEMORY_BARRIER ();
+
+      if (!schema_shm_cache_is_current (cache))
+	{
+	  break;
+	}
+
+      slot = schema_shm_cache_find_slot (cache, class_oid, false);
+      if (slot == NULL)
+	{
+	  if (ATOMIC_INC_32 (&cache->seq, 0) == seq)
+	    {
+	      break;
+	    }
+	  continue;
+	}
+
+      rec_length = slot->length;
+      rec_offset = slot->offset;
+      if (rec_length <= 0 || rec_offset < cache->area_offset || rec_offset + rec_length > cache->size)
+	{
+	  /* torn read */
+	  continue;
+	}
+
+      if (buf_size < rec_length)
+	{
+	  free_and_init (buf);
+	  buf = (char *) malloc (rec_length);
+	  if (buf == NULL)
+	    {
+	      break;
+	    }
+	  buf_size = rec_length;
+	}
+      memcpy (buf, (char *) cache + rec_offset, rec_length);
+
+      MEMORY_BARRIER ();
+      if (ATOMIC_INC_32 (&cache->seq, 0) == seq)
+	{
+	  *length = rec_length;
+	  return buf;
+	}
+    }
+
+  if (buf != NULL)
+    {
+      free_and_init (buf);
+    }
+  return NULL;
+}
+
+/*
+ * schema_shm_cache_put () - remember a class record fetched from the server, to be shared when the transaction commits
+ *   return: nothing
+ *   class_oid(in): class OID
+ *   recdes(in): disk representation of the class
+ */
+void
+schema_shm_cache_put (const OID * class_oid, const RECDES * recdes)
+{
+  SCHEMA_SHM_CACHE_HEADER *cache;
+  SCHEMA_SHM_CACHE_PENDING *record;
+
+  cache = schema_shm_cache_attach ();
+  if (cache == NULL || recdes->length <= 0 || OID_ISNULL (class_oid) || OID_ISTEMP (class_oid)
+      || OID_IS_ROOTOID (class_oid))
+    {
+      return;
+    }
+
+  if (schema_shm_Pending_size + recdes->length > cache->area_size)
+    {
+      /* would not fit in the segment anyway */
+      return;
+    }
+
+  record = (SCHEMA_SHM_CACHE_PENDING *) malloc (offsetof (SCHEMA_SHM_CACHE_PENDING, data) + recdes->length);
+  if (record == NULL)
+    {
+      return;
+    }
+
+  COPY_OID (&record->oid, class_oid);
+  record->length = recdes->length;
+  memcpy (record->data, recdes->data, recdes->length);
+
+  record->next = schema_shm_Pending;
+  schema_shm_Pending = record;
+  schema_shm_Pending_size += recdes->length;
+}
+
+/*
+ * schema_shm_cache_lock () - become the writer of the segment
+ *   return: true if the lock was acquired
+ *   cache(in): segment
+ *   is_taken_over(out): the previous writer died while holding the segment
+ *
+ * Note: writers do not wait; if the segment is busy the records are simply not shared this time.
+ */
+static bool
+schema_shm_cache_lock (SCHEMA_SHM_CACHE_HEADER * cache, bool * is_taken_over)
+{
+#if defined (WINDOWS)
+  return false;
+#else /* WINDOWS */
+  int me = (int) getpid ();
+  int owner;
+
+  *is_taken_over = false;
+
+  if (ATOMIC_CAS_32 (&cache->writer, 0, me))
+    {
+      return true;
+    }
+
+  owner = ATOMIC_INC_32 (&cache->writer, 0);
+  if (owner != 0 && owner != me && kill (owner, 0) != 0 && errno == ESRCH)
+    {
+      if (ATOMIC_CAS_32 (&cache->writer, owner, me))
+	{
+	  *is_taken_over = true;
+	  return true;
+	}
+    }
+
+  return false;
+#endif /* WINDOWS */
+}
+
+/*
+ * schema_shm_cache_unlock () - release the segment
+ *   return: nothing
+ *   cache(in): segment
+ */
+static void
+schema_shm_cache_unlock (SCHEMA_SHM_CACHE_HEADER * cache)
+{
+  MEMORY_BARRIER ();
+  (void) ATOMIC_TAS_32 (&cache->writer, 0);
+}
+
+/*
+ * schema_shm_cache_reset () - empty the segment and stamp it with the server this client is connected to
+ *   return: nothing
+ *   cache(in): segment, locked and being updated
+ */
+static void
+schema_shm_cache_reset (SCHEMA_SHM_CACHE_HEADER * cache)
+{
+  memset (SCHEMA_SHM_CACHE_SLOTS (cache), 0, cache->n_slots * sizeof (SCHEMA_SHM_CACHE_SLOT));
+  cache->n_used = 0;
+  cache->area_used = 0;
+
+  memset (cache->name, 0, sizeof (cache->name));
+  strncpy (cache->name, schema_shm_Cache_name, sizeof (cache->name) - 1);
+  memcpy (cache->session_key, boot_get_server_session_key (), SERVER_SESSION_KEY_SIZE);
+}
+
+/*
+ * schema_shm_cache_publish () - copy a class record to the segment
+ *   return: nothing
+ *   cache(in): segment, locked and being updated
+ *   record(in): committed class record
+ */
+static void
+schema_shm_cache_publish (SCHEMA_SHM_CACHE_HEADER * cache, SCHEMA_SHM_CACHE_PENDING * record)
+{
+  SCHEMA_SHM_CACHE_SLOT *slot;
+  RECDES recdes;
+  int chn, aligned_length;
+
+  recdes.data = record->data;
+  recdes.length = recdes.area_size = record->length;
+  recdes.type = REC_HOME;
+  chn = or_chn (&recdes);
+
+  aligned_length = DB_ALIGN (record->length, MAX_ALIGNMENT);
+  if (aligned_length > cache->area_size)
+    {
+      return;
+    }
+
+  slot = schema_shm_cache_find_slot (cache, &record->oid, true);
+  if (slot != NULL && slot->length > 0 && slot->chn >= chn)
+    {
+      /* CHNs only grow; the shared record is the same or newer */
+      return;
+    }
+
+  if (slot == NULL || (slot->length == 0 && cache->n_used >= cache->n_slots * 3 / 4)
+      || cache->area_used + aligned_length > cache->area_size)
+    {
+      /* full; start over */
+      schema_shm_cache_reset (cache);
+      slot = schema_shm_cache_find_slot (cache, &record->oid, true);
+      if (slot == NULL)
+	{
+	  assert (false);
+	  return;
+	}
+    }
+
+  memcpy ((char *) cache + cache->area_offset + cache->area_used, record->data, record->length);
+
+  if (slot->length == 0)
+    {
+      cache->n_used++;
+    }
+  COPY_OID (&slot->oid, &record->oid);
+  slot->chn = chn;
+  slot->offset = cache->area_offset + cache->area_used;
+  slot->length = record->length;
+
+  cache->area_used += aligned_length;
+}
+
+/*
+ * schema_shm_cache_free_pending () - forget the records read by the transaction
+ *   return: nothing
+ */
+static void
+schema_shm_cache_free_pending (void)
+{
+  SCHEMA_SHM_CACHE_PENDING *record, *next;
+
+  for (record = schema_shm_Pending; record != NULL; record = next)
+    {
+      next = record->next;
+      free (record);
+    }
+
+  schema_shm_Pending = NULL;
+  schema_shm_Pending_size = 0;
+}
+
+/*
+ * schema_shm_cache_end_transaction () - share the class records read by the transaction if it committed
+ *   return: nothing
+ *   is_commit(in): true if the transaction committed, false if it was aborted or partially rolled back
+ */
+void
+schema_shm_cache_end_transaction (bool is_commit)
+{
+  SCHEMA_SHM_CACHE_HEADER *cache = schema_shm_Cache;
+  SCHEMA_SHM_CACHE_PENDING *record;
+  bool is_taken_over;
+
+  if (schema_shm_Pending == NULL)
+    {
+      return;
+    }
+
+  if (is_commit && cache != NULL && cache->magic == SCHEMA_SHM_CACHE_MAGIC
+      && schema_shm_cache_lock (cache, &is_taken_over))
+    {
+      /* make readers retry until the segment is consistent again */
+      if ((ATOMIC_INC_32 (&cache->seq, 1) & 1) == 0)
+	{
+	  /* the previous writer died in the middle of an update; the increment closed it */
+	  assert (is_taken_over);
+	  (void) ATOMIC_INC_32 (&cache->seq, 1);
+	  is_taken_over = true;
+	}
+      MEMORY_BARRIER ();
+
+      if (is_taken_over || !schema_shm_cache_is_current (cache))
+	{
+	  schema_shm_cache_reset (cache);
+	}
+
+      for (record = schema_shm_Pending; record != NULL; record = record->next)
+	{
+	  schema_shm_cache_publish (cache, record);
+	}
+
+      MEMORY_BARRIER ();
+      (void) ATOMIC_INC_32 (&cache->seq, 1);
+      schema_shm_cache_unlock (cache);
+    }
+
+  schema_shm_cache_free_pending ();
+}
+
+/*
+ * schema_shm_cache_final () - detach the segment, and remove it if no other process uses it
+ *   return: nothing
+ *
+ * Note: a process attaching between the check and the removal keeps using the segment until it detaches; the next
+ *       processes create a new one.
+ */
+void
+schema_shm_cache_final (void)
+{
+#if !defined (WINDOWS)
+  struct shmid_ds shm_stat;
+#endif /* !WINDOWS */
+
+  schema_shm_cache_free_pending ();
+
+#if !defined (WINDOWS)
+  if (schema_shm_Cache != NULL)
+    {
+      shmdt (schema_shm_Cache);
+
+      if (shmctl (schema_shm_Cache_id, IPC_STAT, &shm_stat) == 0 && shm_stat.shm_nattch == 0)
+	{
+	  /* last process of the host */
+	  (void) shmctl (schema_shm_Cache_id, IPC_RMID, NULL);
+	}
+    }
+#endif /* !WINDOWS */
+
+  schema_shm_Cache = NULL;
+  schema_shm_Cache_id = -1;
+  schema_shm_Cache_unavailable = false;
+  schema_shm_Cache_name[0] = '\0';
+}
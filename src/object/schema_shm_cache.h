@@ -0,0 +1,40 @@
+/*
+ * Copyright 2008 Search Solution Corporation
+ * Copyright 2016 CUBRID Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ */
+
+/*
+ * schema_shm_cache.h - class records shared by the client processes of a host
+ */
+
+#ifndef _SCHEMA_SHM_CACHE_H_
+#define _SCHEMA_SHM_CACHE_H_
+
+#ident "$Id$"
+
+#if !defined (CS_MODE)
+#error Does not belong to server or standalone module
+#endif /* !CS_MODE */
+
+#include "oid.h"
+#include "storage_common.h"
+
+extern char *schema_shm_cache_get (const OID * class_oid, int *length);
+extern void schema_shm_cache_put (const OID * class_oid, const RECDES * recdes);
+extern void schema_shm_cache_end_transaction (bool is_commit);
+extern void schema_shm_cache_final (void);
+
+#endif /* _SCHEMA_SHM_CACHE_H_ */
@@ -77,7 +77,7 @@ static int smt_add_constraint_to_property (SM_TEMPLATE * template_, SM_CONSTRAIN
 					   const char *constraint_name, SM_ATTRIBUTE ** atts, const int *asc_desc,
 					   const int *attr_prefix_length, SM_FOREIGN_KEY_INFO * fk_info,
 					   char *shared_cons_name, SM_PREDICATE_INFO * filter_index,
-					   SM_FUNCTION_INFO * function_index, const char *comment,
+					   SM_FUNCTION_INFO * function_index, int include_count, const char *comment,
 					   SM_INDEX_STATUS index_status);
 static int smt_set_attribute_orig_default_value (SM_ATTRIBUTE * att, DB_VALUE * new_orig_value,
 						 DB_DEFAULT_EXPR * default_expr);
@@ -118,6 +118,9 @@ static MOP smt_find_owner_of_constraint (SM_TEMPLATE * ctemplate, const char *co
 static int change_constraints_status_partitioned_class (MOP obj, const char *index_name, SM_INDEX_STATUS index_status);
 static SM_CLASS_CONSTRAINT *smt_find_constraint (SM_TEMPLATE * ctemplate, const char *constraint_name);
 
+/* Name of the index being rebuilt online. The copy built by the rebuild has the same definition. */
+static const char *smt_Rebuilt_index_name = NULL;
+
 /* TEMPLATE SEARCH FUNCTIONS */
 /*
  * These are used to walk over the template structures and extract information
@@ -1537,13 +1540,15 @@ smt_drop_constraint_from_property (SM_TEMPLATE * template_, const char *constrai
  *   shared_cons_name(in):
  *   filter_index(in):
  *   function_index(in)
+ *   include_count(in):
  *   comment(in):
  */
 static int
 smt_add_constraint_to_property (SM_TEMPLATE * template_, SM_CONSTRAINT_TYPE type, const char *constraint_name,
 				SM_ATTRIBUTE ** atts, const int *asc_desc, const int *attr_prefix_length,
 				SM_FOREIGN_KEY_INFO * fk_info, char *shared_cons_name, SM_PREDICATE_INFO * filter_index,
-				SM_FUNCTION_INFO * function_index, const char *comment, SM_INDEX_STATUS index_status)
+				SM_FUNCTION_INFO * function_index, int include_count, const char *comment,
+				SM_INDEX_STATUS index_status)
 {
   int error = NO_ERROR;
   DB_VALUE cnstr_val;
@@ -1570,6 +1575,7 @@ smt_add_constraint_to_property (SM_TEMPLATE * template_, SM_CONSTRAINT_TYPE type
   con.attrs_prefix_length = (int *) attr_prefix_length;
   con.filter_predicate = filter_index;
   con.func_index_info = function_index;
+  con.include_count = include_count;
   con.comment = comment;
   con.index_status = index_status;
   con.index_btid = BTID_INITIALIZER;
@@ -1951,10 +1957,29 @@ smt_check_index_exist (SM_TEMPLATE * template_, char **out_shared_cons_name, DB_
       temp_cons = check_cons;
     }
 
+  if (smt_Rebuilt_index_name != NULL)
+    {
+      SM_CLASS_CONSTRAINT *existing_con;
+
+      existing_con = classobj_find_constraint_by_attrs (check_cons, constraint_type, att_names, asc_desc, filter_index,
+							function_index);
+      if (existing_con != NULL && SM_COMPARE_NAMES (existing_con->name, smt_Rebuilt_index_name) == 0)
+	{
+	  /* The copy of the rebuilt index only needs a name of its own. */
+	  existing_con = classobj_find_constraint_by_name (check_cons, constraint_name);
+	  if (existing_con != NULL)
+	    {
+	      ERROR2 (error, ER_SM_INDEX_EXISTS, template_->name, existing_con->name);
+	    }
+	  goto end;
+	}
+    }
+
   error =
     classobj_check_index_exist (check_cons, out_shared_cons_name, template_->name, constraint_type, constraint_name,
 				att_names, asc_desc, filter_index, function_index);
 
+end:
   if (temp_cons != NULL)
     {
       classobj_free_class_constraints (temp_cons);
@@ -1976,6 +2001,7 @@ smt_check_index_exist (SM_TEMPLATE * template_, char **out_shared_cons_name, DB_
  *   fk_info(in): foreign key information
  *   filter_index(in): filter index info
  *   function_index(in): function index info
+ *   include_count(in): number of trailing attributes given in INCLUDE (...)
  *   comment(in): constraint comment
  *   index_status(in):
  */
@@ -1983,7 +2009,7 @@ int
 smt_add_constraint (SM_TEMPLATE * template_, DB_CONSTRAINT_TYPE constraint_type, const char *constraint_name,
 		    const char **att_names, const int *asc_desc, const int *attrs_prefix_length, int class_attribute,
 		    SM_FOREIGN_KEY_INFO * fk_info, SM_PREDICATE_INFO * filter_index, SM_FUNCTION_INFO * function_index,
-		    const char *comment, SM_INDEX_STATUS index_status)
+		    int include_count, const char *comment, SM_INDEX_STATUS index_status)
 {
   int error = NO_ERROR;
   SM_ATTRIBUTE **atts = NULL;
@@ -2025,6 +2051,17 @@ smt_add_constraint (SM_TEMPLATE * template_, DB_CONSTRAINT_TYPE constraint_type,
       goto error_return;
     }
 
+  /* INCLUDE attributes are only allowed on secondary and unique indexes and must leave at least one key attribute */
+  if (include_count < 0
+      || (include_count > 0
+	  && ((!is_secondary_index && constraint_type != DB_CONSTRAINT_UNIQUE
+	       && constraint_type != DB_CONSTRAINT_REVERSE_UNIQUE) || function_index != NULL
+	      || include_count >= n_atts - (deduplicate_key_col_pos != -1 ? 1 : 0))))
+    {
+      ERROR0 (error, ER_OBJ_INVALID_ARGUMENTS);
+      goto error_return;
+    }
+
   /* if primary key shares index with other constraint, it is neccessary to check whether the attributs do not have
    * null value. e.g. primary key shares index with unique constraint. Because unique constraint allows null value, we
    * can not just use the index simply. template_->op == NULL, it means this is a create statement, the class has not
@@ -2220,7 +2257,8 @@ smt_add_constraint (SM_TEMPLATE * template_, DB_CONSTRAINT_TYPE constraint_type,
       /* Add the constraint. */
       error = smt_add_constraint_to_property (template_, SM_MAP_INDEX_ATTFLAG_TO_CONSTRAINT (constraint),
 					      constraint_name, atts, asc_desc, attrs_prefix_length, fk_info,
-					      shared_cons_name, filter_index, function_index, comment, index_status);
+					      shared_cons_name, filter_index, function_index, include_count, comment,
+					      index_status);
       if (error != NO_ERROR)
 	{
 	  goto error_return;
@@ -4038,6 +4076,43 @@ smt_add_query_spec (SM_TEMPLATE * template_, const char *specification)
   return error;
 }
 
+/*
+ * smt_set_materialized_view_spec() - Marks a class template as a materialized view.
+ *   return: NO_ERROR on success, non-zero for ERROR
+ *   template(in/out): schema template
+ *   specification(in): defining query, re-run by REFRESH MATERIALIZED VIEW
+ *
+ * Note: the definition is kept in the class property list, the class itself is an ordinary class with its own heap.
+ */
+
+int
+smt_set_materialized_view_spec (SM_TEMPLATE * template_, const char *specification)
+{
+  int error = NO_ERROR;
+  DB_VALUE value;
+
+  if (template_->class_type != SM_CLASS_CT || specification == NULL)
+    {
+      ERROR0 (error, ER_SM_INVALID_CLASS);
+      return error;
+    }
+
+  if (template_->properties == NULL)
+    {
+      template_->properties = classobj_make_prop ();
+      if (template_->properties == NULL)
+	{
+	  assert (er_errid () != NO_ERROR);
+	  return er_errid ();
+	}
+    }
+
+  db_make_string (&value, specification);
+  classobj_put_prop (template_->properties, SM_PROPERTY_MATERIALIZED_VIEW, &value);
+
+  return NO_ERROR;
+}
+
 /*
  * smt_reset_query_spec() - Clears the query_spec list of a template.
  *   return: NO_ERROR on success, non-zero for ERROR
@@ -4904,3 +4979,47 @@ smt_change_constraint_status (SM_TEMPLATE * ctemplate, const char *index_name, S
 
   return NO_ERROR;
 }
+
+/*
+ * smt_set_rebuilt_index_name() - Names the index being rebuilt online, or NULL when the rebuild is over.
+ *   index_name(in): name of the rebuilt index
+ *
+ * Note: while it is set, smt_check_index_exist accepts a new index with the same definition as this one. It must be
+ *       reset on every path after the copy of the index is added.
+ */
+void
+smt_set_rebuilt_index_name (const char *index_name)
+{
+  smt_Rebuilt_index_name = index_name;
+}
+
+/*
+ * smt_rename_rebuilt_index() - Gives the copy built by an online index rebuild the name of the index it replaces.
+ *   return: NO_ERROR on success, non-zero for ERROR
+ *   ctemplate(in/out): schema template of the class
+ *   rebuilt_name(in): name of the copy
+ *   index_name(in): name of the replaced index, which is already dropped
+ *
+ * Note: only secondary indexes of a class without subclasses or partitions are rebuilt online, so unlike
+ *       smt_rename_constraint this renames the index of the class only.
+ */
+int
+smt_rename_rebuilt_index (SM_TEMPLATE * ctemplate, const char *rebuilt_name, const char *index_name)
+{
+  SM_CLASS_CONSTRAINT *cons;
+  int error = NO_ERROR;
+
+  assert (ctemplate != NULL && ctemplate->op != NULL);
+
+  cons = smt_find_constraint (ctemplate, rebuilt_name);
+  if (cons == NULL)
+    {
+      ASSERT_ERROR_AND_SET (error);
+      return error;
+    }
+
+  assert (cons->type == SM_CONSTRAINT_INDEX || cons->type == SM_CONSTRAINT_REVERSE_INDEX);
+
+  return classobj_rename_constraint (ctemplate->properties, classobj_map_constraint_to_property (cons->type),
+				     rebuilt_name, index_name);
+}
@@ -82,7 +82,8 @@ extern int smt_set_attribute_on_update (SM_TEMPLATE * template_, const char *nam
 extern int smt_add_constraint (SM_TEMPLATE * template_, DB_CONSTRAINT_TYPE constraint_type, const char *constraint_name,
 			       const char **att_names, const int *asc_desc, const int *attr_prefix_length,
 			       int class_attribute, SM_FOREIGN_KEY_INFO * fk_info, SM_PREDICATE_INFO * filter_index,
-			       SM_FUNCTION_INFO * function_index, const char *comment, SM_INDEX_STATUS index_status);
+			       SM_FUNCTION_INFO * function_index, int include_count, const char *comment,
+			       SM_INDEX_STATUS index_status);
 
 extern int smt_drop_constraint (SM_TEMPLATE * template_, const char **att_names, const char *constraint_name,
 				int class_attribute, SM_ATTRIBUTE_FLAG constraint);
@@ -121,6 +122,10 @@ extern int smt_change_constraint_comment (SM_TEMPLATE * ctemplate, const char *i
 /* Change index status function */
 extern int smt_change_constraint_status (SM_TEMPLATE * ctemplate, const char *index_name, SM_INDEX_STATUS index_status);
 
+/* Online index rebuild functions */
+extern void smt_set_rebuilt_index_name (const char *index_name);
+extern int smt_rename_rebuilt_index (SM_TEMPLATE * ctemplate, const char *rebuilt_name, const char *index_name);
+
 /* Deletion functions */
 extern int smt_delete_any (SM_TEMPLATE * template_, const char *name, SM_NAME_SPACE name_space);
 #if defined(ENABLE_UNUSED_FUNCTION)
@@ -155,6 +160,7 @@ extern int smt_add_query_spec (SM_TEMPLATE * template_, const char *specificatio
 extern int smt_drop_query_spec (SM_TEMPLATE * template_, const int index);
 extern int smt_reset_query_spec (SM_TEMPLATE * template_);
 extern int smt_change_query_spec (SM_TEMPLATE * def, const char *query, const int index);
+extern int smt_set_materialized_view_spec (SM_TEMPLATE * template_, const char *specification);
 extern int smt_change_attribute_w_dflt_w_order (DB_CTMPL * def, const char *name, const char *new_name,
 						const char *new_domain_string, DB_DOMAIN * new_domain,
 						const SM_NAME_SPACE name_space, DB_VALUE * new_default_value,
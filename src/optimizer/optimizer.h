@@ -145,6 +145,20 @@ typedef struct qo_limit_info
   regu_variable_node *upper;
 } QO_LIMIT_INFO;
 
+/* maximum number of key columns the index advisor proposes for one index */
+#define QO_ADVISOR_MAX_COLUMNS 4
+/* maximum number of indexes the index advisor keeps track of */
+#define QO_ADVISOR_MAX_ADVICE 128
+
+typedef struct qo_index_advice
+{
+  char class_name[DB_MAX_IDENTIFIER_LENGTH];
+  char columns[QO_ADVISOR_MAX_COLUMNS][DB_MAX_IDENTIFIER_LENGTH];
+  int n_columns;
+  int count;			/* number of optimized queries that would have used the index */
+  double benefit;		/* sum of the estimated cost those queries would have saved */
+} QO_INDEX_ADVICE;
+
 extern QO_NODE *lookup_node (PT_NODE * attr, QO_ENV * env, PT_NODE ** entity);
 
 extern QO_SEGMENT *lookup_seg (QO_NODE * head, PT_NODE * name, QO_ENV * env);
@@ -169,6 +183,8 @@ extern bool qo_is_index_loose_scan (QO_PLAN * plan);
 extern bool qo_is_index_mro_scan (QO_PLAN * plan);
 extern bool qo_plan_multi_range_opt (QO_PLAN * plan);
 extern void qo_set_cost (DB_OBJECT * target, DB_VALUE * result, DB_VALUE * plan, DB_VALUE * cost);
+extern void qo_advisor_record_plan (QO_PLAN * plan);
+extern int qo_advisor_get_advice (QO_INDEX_ADVICE * advice, int max_advice);
 
 /*
  *  QO_XASL support functions
@@ -3512,6 +3512,12 @@ qo_check_iscan_for_multi_range_opt (QO_PLAN * plan)
       return false;
     }
 
+  if (plan->plan_un.scan.index->head->constraints->include_count > 0)
+    {
+      /* the top N keys are kept without the INCLUDE values of their objects */
+      return false;
+    }
+
   assert (plan->info->env && plan->info->env->parser);
   env = plan->info->env;
   parser = env->parser;
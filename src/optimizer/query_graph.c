@@ -598,6 +598,7 @@ qo_optimize_helper (QO_ENV * env)
   /* now optimize */
 
   plan = qo_planner_search (env);
+  qo_advisor_record_plan (plan);
 
   /* need to set est_card for the select in case it is a subquery */
 
@@ -6973,6 +6974,12 @@ qo_get_ils_prefix_length (QO_ENV * env, QO_NODE * nodep, QO_INDEX_ENTRY * index_
     }
   assert (index_entry->nsegs > 1);
 
+  /* distinct keys of an index with INCLUDE columns do not give distinct INCLUDE values */
+  if (index_entry->constraints->include_count > 0)
+    {
+      return 0;
+    }
+
   tree = env->pt_tree;
   QO_ASSERT (env, tree != NULL);
 
@@ -7495,7 +7502,8 @@ qo_find_node_indexes (QO_ENV * env, QO_NODE * nodep)
 		  bitset_init (&(index_entryp->seg_equal_terms[j]), env);
 		  bitset_init (&(index_entryp->seg_other_terms[j]), env);
 		  index_entryp->seg_idxs[j] = seg_idx[j];
-		  if (index_entryp->seg_idxs[j] != -1)
+		  /* INCLUDE columns cannot bound a key range; their terms can only be key filters. */
+		  if (index_entryp->seg_idxs[j] != -1 && j < QO_ENTRY_KEY_COL_NUM (index_entryp))
 		    {
 		      qo_find_index_seg_terms (env, index_entryp, j, &index_segs);
 		    }
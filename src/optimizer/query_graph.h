@@ -185,6 +185,8 @@ struct qo_index_entry
 };
 
 #define QO_ENTRY_MULTI_COL(entry)       ((entry)->col_num > 1 ? true : false)
+/* number of index columns ordering the keys; INCLUDE columns are stored outside the key */
+#define QO_ENTRY_KEY_COL_NUM(entry)     ((entry)->col_num - (entry)->constraints->include_count)
 
 struct qo_index
 {
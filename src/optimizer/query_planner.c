@@ -139,6 +139,7 @@ static void qo_plan_compute_cost (QO_PLAN *);
 static void qo_plan_compute_subquery_cost (PT_NODE *, double *, double *);
 static void qo_sscan_cost (QO_PLAN *);
 static void qo_iscan_cost (QO_PLAN *);
+static double qo_iscan_object_io (double sel, double objects, double opages, double index_IO);
 static void qo_sort_cost (QO_PLAN *);
 static void qo_mjoin_cost (QO_PLAN *);
 static void qo_follow_cost (QO_PLAN *);
@@ -1840,6 +1841,58 @@ qo_index_scan_new (QO_INFO * info, QO_NODE * node, QO_NODE_INDEX_ENTRY * ni_entr
   return plan;
 }
 
+/*
+ * qo_iscan_object_io () - estimate the heap pages an index scan fetches
+ *   return: number of heap page reads
+ *   sel(in): selectivity of the key range
+ *   objects(in): number of objects selected
+ *   opages(in): number of heap pages of the class
+ *   index_IO(in): pages read from the B+tree
+ */
+static double
+qo_iscan_object_io (double sel, double objects, double opages, double index_IO)
+{
+  double object_IO;
+
+  if (sel < 0.3)
+    {
+      /* p = 1.0 (sel - 0.0) + 0.0 */
+      object_IO = opages * sel;
+      /* 0.0 <= sel < 0.3; 0 <= object_IO < opages * 0.3 */
+    }
+  else if (sel < 0.8)
+    {
+      /* p = ((1.0 - 0.6) / (0.8 - 0.3)) (sel - 0.3) + 0.6 = 0.8 sel + 0.36 */
+      object_IO = opages * (0.8 * sel + 0.36);
+      /* 0.3 <= selectivity < 0.8; opages * 0.6 <= object_IO < opages * 1.0 */
+    }
+  else
+    {
+      /* p = 0.0 (sel - 0.0) + 1.0 = 1.0 */
+      object_IO = opages;
+      /* 0.8 <= sel <= 1.0; object_IO = opages */
+    }
+
+  if (object_IO < 1.0)
+    {
+      /* at least one page */
+      object_IO = 1.0;
+    }
+  else if ((double) prm_get_integer_value (PRM_ID_PB_NBUFFERS) - index_IO < object_IO)
+    {
+      object_IO =
+	objects * (1.0 - (((double) prm_get_integer_value (PRM_ID_PB_NBUFFERS) - index_IO) / (double) opages));
+    }
+
+  if (sel < 1.0)
+    {				/* is not Full-Range sel */
+      object_IO = ceil (FUDGE_FACTOR * object_IO);
+    }
+  object_IO = MAX (1.0, object_IO);
+
+  return object_IO;
+}
+
 /*
  * qo_iscan_cost () -
  *   return:
@@ -1876,8 +1929,8 @@ qo_iscan_cost (QO_PLAN * planp)
       return;
     }
 
-  n = index_entryp->col_num;
-  if (SM_IS_CONSTRAINT_UNIQUE_FAMILY (index_entryp->constraints->type) && n == index_entryp->nsegs)
+  n = QO_ENTRY_KEY_COL_NUM (index_entryp);
+  if (SM_IS_CONSTRAINT_UNIQUE_FAMILY (index_entryp->constraints->type) && n <= index_entryp->nsegs)
     {
       assert (n > 0);
 
@@ -2038,41 +2091,7 @@ qo_iscan_cost (QO_PLAN * planp)
     }
 
   /* IO cost to fetch objects */
-  if (sel < 0.3)
-    {
-      /* p = 1.0 (sel - 0.0) + 0.0 */
-      object_IO = opages * sel;
-      /* 0.0 <= sel < 0.3; 0 <= object_IO < opages * 0.3 */
-    }
-  else if (sel < 0.8)
-    {
-      /* p = ((1.0 - 0.6) / (0.8 - 0.3)) (sel - 0.3) + 0.6 = 0.8 sel + 0.36 */
-      object_IO = opages * (0.8 * sel + 0.36);
-      /* 0.3 <= selectivity < 0.8; opages * 0.6 <= object_IO < opages * 1.0 */
-    }
-  else
-    {
-      /* p = 0.0 (sel - 0.0) + 1.0 = 1.0 */
-      object_IO = opages;
-      /* 0.8 <= sel <= 1.0; object_IO = opages */
-    }
-
-  if (object_IO < 1.0)
-    {
-      /* at least one page */
-      object_IO = 1.0;
-    }
-  else if ((double) prm_get_integer_value (PRM_ID_PB_NBUFFERS) - index_IO < object_IO)
-    {
-      object_IO =
-	objects * (1.0 - (((double) prm_get_integer_value (PRM_ID_PB_NBUFFERS) - index_IO) / (double) opages));
-    }
-
-  if (sel < 1.0)
-    {				/* is not Full-Range sel */
-      object_IO = ceil (FUDGE_FACTOR * object_IO);
-    }
-  object_IO = MAX (1.0, object_IO);
+  object_IO = qo_iscan_object_io (sel, objects, opages, index_IO);
 
   /* index scan requires more CPU cost than sequential scan */
 
@@ -10978,6 +10997,12 @@ qo_plan_compute_iscan_sort_list (QO_PLAN * root, PT_NODE * group_by, bool * is_i
 	  break;
 	}
 
+      if (i >= QO_ENTRY_KEY_COL_NUM (index_entryp))
+	{
+	  /* INCLUDE columns are not ordered by the index */
+	  break;
+	}
+
       seg_idx = (index_entryp->seg_idxs[i]);
       if (seg_idx == -1)
 	{			/* not exist in query */
@@ -11860,3 +11885,509 @@ qo_top_plan_print_text (PARSER_CONTEXT * parser, xasl_node * xasl, PT_NODE * sel
 
   return;
 }
+
+/*
+ * Index advisor
+ *
+ * When optimizer_index_advisor is on, every plan chosen by the optimizer is inspected for classes that are read
+ * with a sequential scan although the query has index-able terms on them. For each such scan an index is
+ * proposed: the equality columns first, then one range column, or the GROUP BY/ORDER BY columns when the query
+ * reads a single class. The proposal is costed as if the index existed, using the same formulas as
+ * qo_iscan_cost with B+tree statistics guessed from the key width, and it is kept only when it is cheaper than
+ * the sequential scan. The proposals are aggregated per class and column list in a bounded table of the client
+ * and reported by SHOW INDEX ADVICE.
+ */
+
+static QO_INDEX_ADVICE qo_advisor_entries[QO_ADVISOR_MAX_ADVICE];
+static int qo_advisor_num_entries = 0;
+
+/*
+ * qo_advisor_add_seg () - append a key column to a candidate index
+ *   return: 1 if added, 0 if the column is already in the key, -1 if the key is full
+ *   segs(in/out): key columns of the candidate
+ *   n_segs(in/out): number of key columns
+ *   seg(in): column to add
+ */
+static int
+qo_advisor_add_seg (QO_SEGMENT ** segs, int *n_segs, QO_SEGMENT * seg)
+{
+  int i;
+
+  for (i = 0; i < *n_segs; i++)
+    {
+      if (segs[i] == seg)
+	{
+	  return 0;
+	}
+    }
+
+  if (*n_segs >= QO_ADVISOR_MAX_COLUMNS)
+    {
+      return -1;
+    }
+
+  segs[(*n_segs)++] = seg;
+  return 1;
+}
+
+/*
+ * qo_advisor_term_seg () - the column of node a term could use as an index key
+ *   return: segment of node or NULL
+ *   term(in):
+ *   node(in):
+ */
+static QO_SEGMENT *
+qo_advisor_term_seg (QO_TERM * term, QO_NODE * node)
+{
+  QO_SEGMENT *seg;
+  int i;
+
+  if (QO_TERM_CAN_USE_INDEX (term) <= 0 || QO_TERM_MULTI_COL_CNT (term) > 0
+      || QO_TERM_IS_FLAGED (term, QO_TERM_NON_IDX_SARG_COLL))
+    {
+      return NULL;
+    }
+
+  for (i = 0; i < QO_TERM_CAN_USE_INDEX (term); i++)
+    {
+      seg = QO_TERM_INDEX_SEG (term, i);
+      if (seg != NULL && QO_SEG_HEAD (seg) == node && !QO_SEG_FUNC_INDEX (seg) && !QO_SEG_IS_SET_VALUED (seg))
+	{
+	  return seg;
+	}
+    }
+
+  return NULL;
+}
+
+/*
+ * qo_advisor_add_terms () - add the columns of index-able terms to a candidate index
+ *   return: number of columns added
+ *   node(in): scanned node
+ *   terms(in): terms evaluated on the scan
+ *   equal(in): add the equality terms if true, else add the first range term only
+ *   segs(in/out): key columns of the candidate
+ *   n_segs(in/out): number of key columns
+ *   sel(in/out): selectivity of the key range
+ */
+static int
+qo_advisor_add_terms (QO_NODE * node, BITSET * terms, bool equal, QO_SEGMENT ** segs, int *n_segs, double *sel)
+{
+  QO_ENV *env = QO_NODE_ENV (node);
+  BITSET_ITERATOR iter;
+  QO_TERM *term;
+  QO_SEGMENT *seg;
+  int t, added = 0;
+
+  for (t = bitset_iterate (terms, &iter); t != -1; t = bitset_next_member (&iter))
+    {
+      term = QO_ENV_TERM (env, t);
+      if ((QO_TERM_IS_FLAGED (term, QO_TERM_EQUAL_OP) != 0) != equal)
+	{
+	  continue;
+	}
+
+      seg = qo_advisor_term_seg (term, node);
+      if (seg == NULL)
+	{
+	  continue;
+	}
+
+      switch (qo_advisor_add_seg (segs, n_segs, seg))
+	{
+	case 1:
+	  *sel *= QO_TERM_SELECTIVITY (term);
+	  added++;
+	  if (!equal)
+	    {
+	      return added;
+	    }
+	  break;
+	case 0:
+	  break;
+	default:
+	  return added;
+	}
+    }
+
+  return added;
+}
+
+/*
+ * qo_advisor_add_sort_columns () - add the GROUP BY or ORDER BY columns to a candidate index
+ *   return: nothing
+ *   node(in): the only node of the query
+ *   segs(in/out): key columns of the candidate
+ *   n_segs(in/out): number of key columns
+ */
+static void
+qo_advisor_add_sort_columns (QO_NODE * node, QO_SEGMENT ** segs, int *n_segs)
+{
+  QO_ENV *env = QO_NODE_ENV (node);
+  PT_NODE *tree, *spec, *expr;
+  QO_SEGMENT *seg;
+
+  tree = QO_ENV_PT_TREE (env);
+  if (tree == NULL || tree->node_type != PT_SELECT)
+    {
+      return;
+    }
+
+  spec = tree->info.query.q.select.group_by;
+  if (spec == NULL || spec->flag.with_rollup)
+    {
+      spec = tree->info.query.order_by;
+    }
+
+  for (; spec != NULL; spec = spec->next)
+    {
+      expr = spec->info.sort_spec.expr;
+      if (expr == NULL || expr->node_type != PT_NAME)
+	{
+	  return;
+	}
+
+      seg = lookup_seg (node, expr, env);
+      if (seg == NULL || QO_SEG_IS_SET_VALUED (seg) || qo_advisor_add_seg (segs, n_segs, seg) < 0)
+	{
+	  return;
+	}
+    }
+}
+
+/*
+ * qo_advisor_has_index () - is there already an index starting with the candidate key columns?
+ *   return: true if the planner already had such an index to choose from
+ *   node(in):
+ *   segs(in): key columns of the candidate
+ *   n_segs(in): number of key columns
+ */
+static bool
+qo_advisor_has_index (QO_NODE * node, QO_SEGMENT ** segs, int n_segs)
+{
+  QO_NODE_INDEX *node_indexes = QO_NODE_INDEXES (node);
+  QO_INDEX_ENTRY *index_entry;
+  int i, j, k;
+
+  if (node_indexes == NULL)
+    {
+      return false;
+    }
+
+  for (i = 0; i < QO_NI_N (node_indexes); i++)
+    {
+      index_entry = QO_NI_ENTRY (node_indexes, i)->head;
+      if (index_entry == NULL || index_entry->col_num < n_segs)
+	{
+	  continue;
+	}
+
+      for (j = 0; j < n_segs; j++)
+	{
+	  for (k = 0; k < n_segs; k++)
+	    {
+	      if (index_entry->seg_idxs[k] == QO_SEG_IDX (segs[j]))
+		{
+		  break;
+		}
+	    }
+	  if (k == n_segs)
+	    {
+	      break;
+	    }
+	}
+
+      if (j == n_segs)
+	{
+	  return true;
+	}
+    }
+
+  return false;
+}
+
+/*
+ * qo_advisor_hypothetical_cost () - cost of an index scan on an index that does not exist
+ *   return: estimated cost
+ *   node(in):
+ *   segs(in): key columns of the hypothetical index
+ *   n_segs(in): number of key columns
+ *   sel(in): selectivity of the key range
+ *
+ * Note: the B+tree statistics are guessed from the key width and the class cardinality; the rest follows
+ *	 qo_iscan_cost.
+ */
+static double
+qo_advisor_hypothetical_cost (QO_NODE * node, QO_SEGMENT ** segs, int n_segs, double sel)
+{
+  double key_width, fanout, ncard, leaves, height, objects, index_IO, object_IO;
+  int i;
+
+  key_width = OR_OID_SIZE;
+  for (i = 0; i < n_segs; i++)
+    {
+      key_width += qo_seg_width (segs[i]);
+    }
+  key_width = MIN (key_width, (double) DB_PAGESIZE / 4);
+
+  fanout = MAX (2.0, floor ((double) DB_PAGESIZE / key_width));
+  ncard = MAX (1.0, (double) QO_NODE_NCARD (node));
+  leaves = ceil (ncard / fanout);
+  height = (leaves > 1.0) ? ceil (log (leaves) / log (fanout)) : 0.0;
+
+  sel = MIN (sel, 1.0);
+  sel = MAX (sel, 1.0 / ncard);
+  objects = sel * ncard;
+
+  index_IO = height + ceil (sel * leaves);
+  object_IO = qo_iscan_object_io (sel, objects, (double) QO_NODE_TCARD (node), index_IO);
+
+  return index_IO + object_IO + objects * (double) QO_CPU_WEIGHT * ISCAN_OVERHEAD_FACTOR;
+}
+
+/*
+ * qo_advisor_add_advice () - account a candidate index in the advisor table
+ *   return: nothing
+ *   class_name(in):
+ *   segs(in): key columns
+ *   n_segs(in): number of key columns
+ *   benefit(in): estimated cost saved by the index
+ *
+ * Note: when the table is full, the entry with the smallest benefit is replaced by a better one.
+ */
+static void
+qo_advisor_add_advice (const char *class_name, QO_SEGMENT ** segs, int n_segs, double benefit)
+{
+  QO_INDEX_ADVICE *advice;
+  int i, j, victim;
+
+  for (i = 0; i < qo_advisor_num_entries; i++)
+    {
+      advice = &qo_advisor_entries[i];
+      if (advice->n_columns != n_segs || intl_identifier_casecmp (advice->class_name, class_name) != 0)
+	{
+	  continue;
+	}
+
+      for (j = 0; j < n_segs; j++)
+	{
+	  if (intl_identifier_casecmp (advice->columns[j], QO_SEG_NAME (segs[j])) != 0)
+	    {
+	      break;
+	    }
+	}
+
+      if (j == n_segs)
+	{
+	  advice->count++;
+	  advice->benefit += benefit;
+	  return;
+	}
+    }
+
+  if (qo_advisor_num_entries < QO_ADVISOR_MAX_ADVICE)
+    {
+      advice = &qo_advisor_entries[qo_advisor_num_entries++];
+    }
+  else
+    {
+      victim = 0;
+      for (i = 1; i < QO_ADVISOR_MAX_ADVICE; i++)
+	{
+	  if (qo_advisor_entries[i].benefit < qo_advisor_entries[victim].benefit)
+	    {
+	      victim = i;
+	    }
+	}
+
+      if (qo_advisor_entries[victim].benefit >= benefit)
+	{
+	  return;
+	}
+      advice = &qo_advisor_entries[victim];
+    }
+
+  strncpy_bufsize (advice->class_name, class_name);
+  for (j = 0; j < n_segs; j++)
+    {
+      strncpy_bufsize (advice->columns[j], QO_SEG_NAME (segs[j]));
+    }
+  advice->n_columns = n_segs;
+  advice->count = 1;
+  advice->benefit = benefit;
+}
+
+/*
+ * qo_advisor_check_scan () - propose an index for a sequential scan
+ *   return: nothing
+ *   plan(in): sequential scan plan
+ *   join_terms(in): join terms of the nested loop join the scan is the inner of, or NULL
+ *   loops(in): number of times the scan is executed
+ */
+static void
+qo_advisor_check_scan (QO_PLAN * plan, BITSET * join_terms, double loops)
+{
+  QO_NODE *node = plan->plan_un.scan.node;
+  QO_SEGMENT *segs[QO_ADVISOR_MAX_COLUMNS];
+  int n_segs = 0;
+  bool has_range;
+  double sel = 1.0, seq_cost, index_cost;
+
+  if (QO_NODE_INFO (node) == NULL || QO_NODE_INFO_N (node) != 1 || QO_NODE_IS_CLASS_HIERARCHY (node)
+      || QO_NODE_INFO (node)->info[0].name == NULL || QO_NODE_TCARD (node) <= 1)
+    {
+      return;
+    }
+
+  /* equality columns lead the key, in any order */
+  qo_advisor_add_terms (node, &plan->sarged_terms, true, segs, &n_segs, &sel);
+  if (join_terms != NULL)
+    {
+      qo_advisor_add_terms (node, join_terms, true, segs, &n_segs, &sel);
+    }
+
+  /* a range can only be applied on the column following them */
+  has_range = qo_advisor_add_terms (node, &plan->sarged_terms, false, segs, &n_segs, &sel) > 0;
+  if (!has_range && join_terms != NULL)
+    {
+      has_range = qo_advisor_add_terms (node, join_terms, false, segs, &n_segs, &sel) > 0;
+    }
+
+  if (n_segs == 0)
+    {
+      return;
+    }
+
+  if (!has_range && join_terms == NULL && QO_NODE_ENV (node)->nnodes == 1)
+    {
+      qo_advisor_add_sort_columns (node, segs, &n_segs);
+    }
+
+  if (qo_advisor_has_index (node, segs, n_segs))
+    {
+      return;
+    }
+
+  seq_cost = plan->fixed_cpu_cost + plan->fixed_io_cost + plan->variable_cpu_cost + plan->variable_io_cost;
+  index_cost = qo_advisor_hypothetical_cost (node, segs, n_segs, sel);
+  if (index_cost >= seq_cost)
+    {
+      return;
+    }
+
+  qo_advisor_add_advice (QO_NODE_INFO (node)->info[0].name, segs, n_segs, (seq_cost - index_cost) * loops);
+}
+
+/*
+ * qo_advisor_walk_plan () - look for sequential scans in a plan tree
+ *   return: nothing
+ *   plan(in):
+ *   loops(in): number of times the plan is executed
+ */
+static void
+qo_advisor_walk_plan (QO_PLAN * plan, double loops)
+{
+  QO_PLAN *outer, *inner;
+
+  if (plan == NULL)
+    {
+      return;
+    }
+
+  switch (plan->plan_type)
+    {
+    case QO_PLANTYPE_SCAN:
+      if (qo_is_seq_scan (plan))
+	{
+	  qo_advisor_check_scan (plan, NULL, loops);
+	}
+      break;
+
+    case QO_PLANTYPE_SORT:
+      qo_advisor_walk_plan (plan->plan_un.sort.subplan, loops);
+      break;
+
+    case QO_PLANTYPE_JOIN:
+      outer = plan->plan_un.join.outer;
+      inner = plan->plan_un.join.inner;
+
+      qo_advisor_walk_plan (outer, loops);
+      if (plan->plan_un.join.join_method == QO_JOINMETHOD_NL_JOIN && qo_is_seq_scan (inner))
+	{
+	  /* the inner is scanned once per outer row; an index on the join columns turns that into a lookup */
+	  qo_advisor_check_scan (inner, &plan->plan_un.join.join_terms,
+				 loops * MAX (1.0, (outer->info)->cardinality));
+	}
+      else
+	{
+	  qo_advisor_walk_plan (inner, loops);
+	}
+      break;
+
+    case QO_PLANTYPE_FOLLOW:
+      qo_advisor_walk_plan (plan->plan_un.follow.head, loops);
+      break;
+
+    default:
+      break;
+    }
+}
+
+/*
+ * qo_advisor_record_plan () - feed the plan chosen for a query to the index advisor
+ *   return: nothing
+ *   plan(in):
+ */
+void
+qo_advisor_record_plan (QO_PLAN * plan)
+{
+  if (plan == NULL || !prm_get_bool_value (PRM_ID_OPTIMIZER_INDEX_ADVISOR))
+    {
+      return;
+    }
+
+  qo_advisor_walk_plan (plan, 1.0);
+}
+
+/*
+ * qo_advisor_compare_advice () - qsort callback, larger benefit first
+ */
+static int
+qo_advisor_compare_advice (const void *a, const void *b)
+{
+  const QO_INDEX_ADVICE *advice_a = (const QO_INDEX_ADVICE *) a;
+  const QO_INDEX_ADVICE *advice_b = (const QO_INDEX_ADVICE *) b;
+
+  if (advice_a->benefit > advice_b->benefit)
+    {
+      return -1;
+    }
+  else if (advice_a->benefit < advice_b->benefit)
+    {
+      return 1;
+    }
+
+  return advice_b->count - advice_a->count;
+}
+
+/*
+ * qo_advisor_get_advice () - get the indexes proposed by the advisor, best first
+ *   return: number of entries copied to advice
+ *   advice(out): array of at least max_advice entries
+ *   max_advice(in):
+ */
+int
+qo_advisor_get_advice (QO_INDEX_ADVICE * advice, int max_advice)
+{
+  int n;
+
+  qsort (qo_advisor_entries, qo_advisor_num_entries, sizeof (QO_INDEX_ADVICE), qo_advisor_compare_advice);
+
+  n = MIN (qo_advisor_num_entries, max_advice);
+  if (n > 0)
+    {
+      memcpy (advice, qo_advisor_entries, n * sizeof (QO_INDEX_ADVICE));
+    }
+
+  return n;
+}
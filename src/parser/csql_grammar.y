@@ -400,6 +400,7 @@ static PT_NODE *parser_make_number_lang (const int argc);
 static void parser_remove_dummy_select (PT_NODE ** node);
 static int parser_count_list (PT_NODE * list);
 static int parser_count_prefix_columns (PT_NODE * list, int * arg_count);
+static PT_NODE *parser_append_include_columns (PT_NODE * index, PT_NODE * column_list, PT_NODE * include_list);
 
 static void resolve_alias_in_expr_node (PT_NODE * node, PT_NODE * list);
 static void resolve_alias_in_name_node (PT_NODE ** node, PT_NODE * list);
@@ -627,6 +628,7 @@ int g_original_buffer_len;
 %type <number> opt_access_modifier
 %type <number> deduplicate_key_mod_level
 %type <number> opt_index_with_clause_no_online
+%type <number> opt_rebuild_with_online
 /*}}}*/
 
 /* define rule type (node) */
@@ -645,6 +647,7 @@ int g_original_buffer_len;
 %type <node> rename_class_pair
 %type <node> drop_stmt
 %type <node> opt_index_column_name_list
+%type <node> opt_index_include_clause
 %type <node> index_column_name_list
 %type <node> update_statistics_stmt
 %type <node> only_class_name_list
@@ -1463,6 +1466,7 @@ int g_original_buffer_len;
 %token <cptr> ACCESS
 %token <cptr> ACTIVE
 %token <cptr> ADDDATE
+%token <cptr> ADVICE
 %token <cptr> AES
 %token <cptr> ANALYZE
 %token <cptr> ARCHIVE
@@ -1516,6 +1520,7 @@ int g_original_buffer_len;
 %token <cptr> HOST
 %token <cptr> IFNULL
 %token <cptr> INACTIVE
+%token <cptr> INCLUDE
 %token <cptr> INCREMENT
 %token <cptr> INDEXES
 %token <cptr> INDEX_PREFIX
@@ -1563,6 +1568,7 @@ int g_original_buffer_len;
 %token <cptr> LEAD
 %token <cptr> LOCK_
 %token <cptr> LOG
+%token <cptr> MATERIALIZED
 %token <cptr> MAXIMUM
 %token <cptr> MAXVALUE
 %token <cptr> MEDIAN
@@ -1602,6 +1608,7 @@ int g_original_buffer_len;
 %token <cptr> QUEUES
 %token <cptr> RANGE_
 %token <cptr> RANK
+%token <cptr> REFRESH
 %token <cptr> REGEXP_COUNT
 %token <cptr> REGEXP_INSTR
 %token <cptr> REGEXP_LIKE
@@ -2695,6 +2702,37 @@ create_stmt
 
 		DBG_PRINT}}
 	| CREATE					/* 1 */
+	  MATERIALIZED					/* 2 */
+	  VIEW						/* 3 */
+	  opt_if_not_exists				/* 4 */
+	  class_name_without_dot			/* 5 */
+	  opt_class_or_normal_attr_def_list		/* 6 */
+	  opt_table_option_list				/* 7 */
+	  AS						/* 8 */
+	  csql_query					/* 9 */
+		{{ DBG_TRACE_GRAMMAR(create_stmt, | CREATE MATERIALIZED VIEW opt_if_not_exists class_name_without_dot opt_class_or_normal_attr_def_list opt_table_option_list AS csql_query);
+
+			PT_NODE *qc = parser_new_node (this_parser, PT_CREATE_ENTITY);
+
+			if (qc)
+			  {
+			    qc->info.create_entity.entity_type = PT_CLASS;
+			    qc->info.create_entity.if_not_exists = $4;
+			    qc->info.create_entity.entity_name = $5;
+			    qc->info.create_entity.attr_def_list = $6;
+			    qc->info.create_entity.table_option_list = $7;
+			    qc->info.create_entity.create_select_action = PT_CREATE_SELECT_NO_ACTION;
+			    qc->info.create_entity.create_select = $9;
+			    qc->info.create_entity.is_materialized_view = 1;
+
+			    pt_gather_constraints (this_parser, qc);
+			  }
+
+			$$ = qc;
+			PARSER_SAVE_ERR_CONTEXT ($$, @$.buffer_pos)
+
+		DBG_PRINT}}
+	| CREATE					/* 1 */
 		{					/* 2 */
                         DBG_TRACE_GRAMMAR(create_stmt, | CREATE);
 			PT_NODE* node = parser_new_node (this_parser, PT_CREATE_INDEX);
@@ -2710,17 +2748,18 @@ create_stmt
 	  ON_						/* 9 */
 	  only_class_name				/* 10 */
 	  index_column_name_list			/* 11 */
-	  opt_where_clause				/* 12 */
-          opt_index_with_clause                         /* 13 */
-	  opt_invisible					/* 14 */
-	  opt_comment_spec				/* 15 */          
+	  opt_index_include_clause			/* 12 */
+	  opt_where_clause				/* 13 */
+          opt_index_with_clause                         /* 14 */
+	  opt_invisible					/* 15 */
+	  opt_comment_spec				/* 16 */          
 		{{ DBG_TRACE_GRAMMAR(create_stmt,  CREATE ~ INDEX identifier ON_ ~);
 
 			PT_NODE *node = parser_pop_hint_node ();
 			PT_NODE *ocs = parser_new_node(this_parser, PT_SPEC);
 			PARSER_SAVE_ERR_CONTEXT (node, @$.buffer_pos)
 
-		        if ($5 && $12)
+		        if ($5 && ($12 || $13))
 			  {
 			    /* Currently, not allowed unique with filter/function index.
 			       However, may be introduced later, if it will be usefull.
@@ -2838,21 +2877,22 @@ create_stmt
 				  }
 			      }
                        
-			    node->info.index.where = $12;
-			    node->info.index.column_names = col;
+			    node->info.index.where = $13;
 
-                            node->info.index.deduplicate_level = CONTAINER_AT_1($13);
+			    node->info.index.column_names = parser_append_include_columns (node, col, $12);
+
+                            node->info.index.deduplicate_level = CONTAINER_AT_1($14);
                              if ($5 && (node->info.index.deduplicate_level >= DEDUPLICATE_KEY_LEVEL_OFF && node->info.index.deduplicate_level <= DEDUPLICATE_KEY_LEVEL_MAX))
                               {
                                   PT_ERRORf (this_parser, node, "%s", "UNIQUE and DEDUPLICATE cannot be specified together.");
                               }
 
-			    node->info.index.comment = $15;
+			    node->info.index.comment = $16;
 
-                            int with_online_ret = CONTAINER_AT_0($13);  // 0 for normal, 1 for online no parallel,
+                            int with_online_ret = CONTAINER_AT_0($14);  // 0 for normal, 1 for online no parallel,
                                                         // thread_count + 1 for parallel
                             bool is_online = with_online_ret > 0;
-                            bool is_invisible = $14;
+                            bool is_invisible = $15;
 
                             if (is_online && is_invisible)
                               {
@@ -3708,6 +3748,7 @@ alter_stmt
 	  opt_where_clause				/* 11 */
 	  opt_comment_spec				/* 12 */
 	  REBUILD					/* 13 */
+	  opt_rebuild_with_online			/* 14 */
 		{{ DBG_TRACE_GRAMMAR(alter_stmt, | ALTER ~ INDEX ~ );
 
 			PT_NODE *node = parser_pop_hint_node ();
@@ -3768,7 +3809,14 @@ alter_stmt
 
 			    node->info.index.column_names = col;
 			    node->info.index.where = $11;
-			    node->info.index.comment = $12;                            
+			    node->info.index.comment = $12;
+
+			    if ($14 > 0)
+			      {
+			        /* 1 for online without parallel, thread_count + 1 for parallel */
+			        node->info.index.index_status = SM_ONLINE_INDEX_BUILDING_IN_PROGRESS;
+			        node->info.index.ib_threads = $14 - 1;
+			      }
 			    $$ = node;
 			    PARSER_SAVE_ERR_CONTEXT ($$, @$.buffer_pos)
 			  }
@@ -3845,6 +3893,40 @@ alter_stmt
 
 		DBG_PRINT}}
 	| ALTER				/* 1 */
+	  INDEX				/* 2 */
+	  identifier			/* 3 */
+	  ON_				/* 4 */
+	  class_name			/* 5 */
+	  COALESCE			/* 6 */
+		{{ DBG_TRACE_GRAMMAR(alter_stmt, | ALTER INDEX identifier ON_ class_name COALESCE);
+			PT_NODE* node = parser_new_node(this_parser, PT_ALTER_INDEX);
+
+			if (node)
+			  {
+			    node->info.index.code = PT_COALESCE_INDEX;
+			    node->info.index.index_name = $3;
+
+			    if (node->info.index.index_name)
+			      {
+			        node->info.index.index_name->info.name.meta_class = PT_INDEX_NAME;
+			      }
+
+			    if ($5 != NULL)
+			      {
+			        PT_NODE *ocs = parser_new_node(this_parser, PT_SPEC);
+			        ocs->info.spec.entity_name = $5;
+			        ocs->info.spec.only_all = PT_ONLY;
+			        ocs->info.spec.meta_class = PT_CLASS;
+
+			        node->info.index.indexed_class = ocs;
+			      }
+			  }
+
+			$$ = node;
+			PARSER_SAVE_ERR_CONTEXT ($$, @$.buffer_pos)
+
+		DBG_PRINT}}
+	| ALTER				/* 1 */
 	  INDEX				/* 2 */
 	  identifier			/* 3 */
 	  ON_				/* 4 */
@@ -3923,6 +4005,43 @@ alter_stmt
 			$$ = node;
 			PARSER_SAVE_ERR_CONTEXT ($$, @$.buffer_pos)
 
+		DBG_PRINT}}
+	| REFRESH
+	  MATERIALIZED
+	  VIEW
+	  class_name
+		{{ DBG_TRACE_GRAMMAR(alter_stmt, | REFRESH MATERIALIZED VIEW class_name);
+
+			PT_NODE *node = parser_new_node (this_parser, PT_ALTER);
+			if (node)
+			  {
+			    node->info.alter.entity_type = PT_CLASS;
+			    node->info.alter.entity_name = $4;
+			    node->info.alter.code = PT_REFRESH_MATERIALIZED_VIEW;
+			  }
+			$$ = node;
+			PARSER_SAVE_ERR_CONTEXT ($$, @$.buffer_pos)
+
+		DBG_PRINT}}
+	| ALTER
+	  MATERIALIZED
+	  VIEW
+	  class_name
+	  AS
+	  csql_query
+		{{ DBG_TRACE_GRAMMAR(alter_stmt, | ALTER MATERIALIZED VIEW class_name AS csql_query);
+
+			PT_NODE *node = parser_new_node (this_parser, PT_ALTER);
+			if (node)
+			  {
+			    node->info.alter.entity_type = PT_CLASS;
+			    node->info.alter.entity_name = $4;
+			    node->info.alter.code = PT_CHANGE_MATERIALIZED_VIEW_QUERY;
+			    node->info.alter.alter_clause.query.query = $6;
+			  }
+			$$ = node;
+			PARSER_SAVE_ERR_CONTEXT ($$, @$.buffer_pos)
+
 		DBG_PRINT}}
 	| ALTER				/* 1 */
 	  procedure_or_function		/* 2 */
@@ -4687,6 +4806,22 @@ index_column_name_list
 		DBG_PRINT}}
 	;
 
+opt_index_include_clause
+	: /* empty */
+		{{ DBG_TRACE_GRAMMAR(opt_index_include_clause, : );
+
+			$$ = NULL;
+
+		DBG_PRINT}}
+	| INCLUDE '(' identifier_list ')'
+		{{ DBG_TRACE_GRAMMAR(opt_index_include_clause, | INCLUDE '(' identifier_list ')');
+
+			$$ = $3;
+			PARSER_SAVE_ERR_CONTEXT ($$, @$.buffer_pos)
+
+		DBG_PRINT}}
+	;
+
 update_statistics_stmt
 	: UPDATE STATISTICS ON_ only_class_name_list opt_with_fullscan
 		{{ DBG_TRACE_GRAMMAR(update_statistics_stmt, : UPDATE STATISTICS ON_ only_class_name_list opt_with_fullscan);
@@ -7564,6 +7699,16 @@ show_stmt
 			$$ = node;
 			PARSER_SAVE_ERR_CONTEXT ($$, @$.buffer_pos)
 
+		DBG_PRINT}}
+	| SHOW INDEX ADVICE
+		{{ DBG_TRACE_GRAMMAR(show_stmt, | SHOW INDEX ADVICE);
+			PT_NODE *node = NULL;
+
+			node = pt_make_query_show_index_advice (this_parser);
+
+			$$ = node;
+			PARSER_SAVE_ERR_CONTEXT ($$, @$.buffer_pos)
+
 		DBG_PRINT}}
 	| SHOW TRACE
 		{{ DBG_TRACE_GRAMMAR(show_stmt, | SHOW TRACE);
@@ -10469,11 +10614,12 @@ attr_index_def
 	: index_or_key              /* 1 */
 	  identifier                /* 2 */
 	  index_column_name_list    /* 3 */
-	  opt_where_clause          /* 4 */
-          opt_index_with_clause_no_online  /* 5 */
-	  opt_invisible             /* 6 */
-          opt_comment_spec          /* 7 */
-		{{ DBG_TRACE_GRAMMAR(attr_index_def, : index_or_key identifier index_column_name_list opt_where_clause opt_comment_spec opt_invisible);
+	  opt_index_include_clause  /* 4 */
+	  opt_where_clause          /* 5 */
+          opt_index_with_clause_no_online  /* 6 */
+	  opt_invisible             /* 7 */
+          opt_comment_spec          /* 8 */
+		{{ DBG_TRACE_GRAMMAR(attr_index_def, : index_or_key identifier index_column_name_list opt_index_include_clause opt_where_clause opt_comment_spec opt_invisible);
 			int arg_count = 0, prefix_col_count = 0;
 			PT_NODE* node = parser_new_node(this_parser,
 							PT_CREATE_INDEX);
@@ -10486,8 +10632,8 @@ attr_index_def
 			    node->info.index.index_name->info.name.meta_class = PT_INDEX_NAME;
 			  }
 			node->info.index.indexed_class = NULL;
-			node->info.index.where = $4;
-			node->info.index.comment = $7;
+			node->info.index.where = $5;
+			node->info.index.comment = $8;
 			node->info.index.index_status = SM_NORMAL_INDEX;
 
 			prefix_col_count = parser_count_prefix_columns (col, &arg_count);
@@ -10526,11 +10672,11 @@ attr_index_def
 			      }
 			  }
 
-                        node->info.index.deduplicate_level = $5;
+                        node->info.index.deduplicate_level = $6;
 
-			node->info.index.column_names = col;
+			node->info.index.column_names = parser_append_include_columns (node, col, $4);
 			node->info.index.index_status = SM_NORMAL_INDEX;
-			if ($6)
+			if ($7)
 			  {
 			       node->info.index.index_status = SM_INVISIBLE_INDEX;
 			  }
@@ -21589,6 +21735,15 @@ opt_index_with_clause_no_online
 	     $$ = $2; }
         ;
 
+opt_rebuild_with_online
+        : /* empty */
+          { DBG_TRACE_GRAMMAR(opt_rebuild_with_online, : );
+            $$ = 0; }
+        | WITH online_parallel
+          { DBG_TRACE_GRAMMAR(opt_rebuild_with_online, | WITH online_parallel );
+            $$ = $2; }
+        ;
+
 opt_index_with_clause
         : /* empty */
           { DBG_TRACE_GRAMMAR(opt_index_with_clause, : );
@@ -22388,6 +22543,7 @@ identifier
 /*{{{*/
 	| ACTIVE                 {{ DBG_TRACE_GRAMMAR(identifier, | ACTIVE             ); SET_CPTR_2_PTNAME($$, $1, @$.buffer_pos);  }}
 	| ADDDATE                {{ DBG_TRACE_GRAMMAR(identifier, | ADDDATE            ); SET_CPTR_2_PTNAME($$, $1, @$.buffer_pos);  }}
+	| ADVICE                 {{ DBG_TRACE_GRAMMAR(identifier, | ADVICE             ); SET_CPTR_2_PTNAME($$, $1, @$.buffer_pos);  }}
 	| AES                    {{ DBG_TRACE_GRAMMAR(identifier, | AES                ); SET_CPTR_2_PTNAME($$, $1, @$.buffer_pos);  }}
 	| ANALYZE                {{ DBG_TRACE_GRAMMAR(identifier, | ANALYZE            ); SET_CPTR_2_PTNAME($$, $1, @$.buffer_pos);  }}
 	| ARCHIVE                {{ DBG_TRACE_GRAMMAR(identifier, | ARCHIVE            ); SET_CPTR_2_PTNAME($$, $1, @$.buffer_pos);  }}
@@ -22443,6 +22599,7 @@ identifier
 	| HOST                   {{ DBG_TRACE_GRAMMAR(identifier, | HOST               ); SET_CPTR_2_PTNAME($$, $1, @$.buffer_pos);  }}
 	| IFNULL                 {{ DBG_TRACE_GRAMMAR(identifier, | IFNULL             ); SET_CPTR_2_PTNAME($$, $1, @$.buffer_pos);  }}
 	| INACTIVE               {{ DBG_TRACE_GRAMMAR(identifier, | INACTIVE           ); SET_CPTR_2_PTNAME($$, $1, @$.buffer_pos);  }}
+	| INCLUDE                {{ DBG_TRACE_GRAMMAR(identifier, | INCLUDE            ); SET_CPTR_2_PTNAME($$, $1, @$.buffer_pos);  }}
 	| INCREMENT              {{ DBG_TRACE_GRAMMAR(identifier, | INCREMENT          ); SET_CPTR_2_PTNAME($$, $1, @$.buffer_pos);  }}
 	| INDEXES                {{ DBG_TRACE_GRAMMAR(identifier, | INDEXES            ); SET_CPTR_2_PTNAME($$, $1, @$.buffer_pos);  }}
 	| INDEX_PREFIX           {{ DBG_TRACE_GRAMMAR(identifier, | INDEX_PREFIX       ); SET_CPTR_2_PTNAME($$, $1, @$.buffer_pos);  }}
@@ -22489,6 +22646,7 @@ identifier
 	| LEAD                   {{ DBG_TRACE_GRAMMAR(identifier, | LEAD               ); SET_CPTR_2_PTNAME($$, $1, @$.buffer_pos);  }}
 	| LOCK_                  {{ DBG_TRACE_GRAMMAR(identifier, | LOCK_              ); SET_CPTR_2_PTNAME($$, $1, @$.buffer_pos);  }}
 	| LOG                    {{ DBG_TRACE_GRAMMAR(identifier, | LOG                ); SET_CPTR_2_PTNAME($$, $1, @$.buffer_pos);  }}        
+	| MATERIALIZED           {{ DBG_TRACE_GRAMMAR(identifier, | MATERIALIZED       ); SET_CPTR_2_PTNAME($$, $1, @$.buffer_pos);  }}
 	| MAXIMUM                {{ DBG_TRACE_GRAMMAR(identifier, | MAXIMUM            ); SET_CPTR_2_PTNAME($$, $1, @$.buffer_pos);  }}
 	| MAXVALUE               {{ DBG_TRACE_GRAMMAR(identifier, | MAXVALUE           ); SET_CPTR_2_PTNAME($$, $1, @$.buffer_pos);  }}
 	| MEDIAN                 {{ DBG_TRACE_GRAMMAR(identifier, | MEDIAN             ); SET_CPTR_2_PTNAME($$, $1, @$.buffer_pos);  }}	
@@ -22526,6 +22684,7 @@ identifier
 	| QUEUES                 {{ DBG_TRACE_GRAMMAR(identifier, | QUEUES             ); SET_CPTR_2_PTNAME($$, $1, @$.buffer_pos);  }}
 	| RANGE_                 {{ DBG_TRACE_GRAMMAR(identifier, | RANGE_             ); SET_CPTR_2_PTNAME($$, $1, @$.buffer_pos);  }}
 	| RANK                   {{ DBG_TRACE_GRAMMAR(identifier, | RANK               ); SET_CPTR_2_PTNAME($$, $1, @$.buffer_pos);  }}
+	| REFRESH                {{ DBG_TRACE_GRAMMAR(identifier, | REFRESH            ); SET_CPTR_2_PTNAME($$, $1, @$.buffer_pos);  }}
 	| REGEXP_COUNT           {{ DBG_TRACE_GRAMMAR(identifier, | REGEXP_COUNT       ); SET_CPTR_2_PTNAME($$, $1, @$.buffer_pos);  }}
 	| REGEXP_INSTR           {{ DBG_TRACE_GRAMMAR(identifier, | REGEXP_INSTR       ); SET_CPTR_2_PTNAME($$, $1, @$.buffer_pos);  }}
 	| REGEXP_LIKE            {{ DBG_TRACE_GRAMMAR(identifier, | REGEXP_LIKE        ); SET_CPTR_2_PTNAME($$, $1, @$.buffer_pos);  }}
@@ -25522,6 +25681,38 @@ parser_count_prefix_columns (PT_NODE * list, int * arg_count)
   return i;
 }
 
+/*
+ * parser_append_include_columns () - append the INCLUDE columns of an index after its key columns
+ *   return: index column list
+ *   index(in): PT_CREATE_INDEX node; include_count is set
+ *   column_list(in): key columns (PT_SORT_SPEC list)
+ *   include_list(in): INCLUDE columns (PT_NAME list)
+ */
+static PT_NODE *
+parser_append_include_columns (PT_NODE * index, PT_NODE * column_list, PT_NODE * include_list)
+{
+  PT_NODE *name, *spec;
+
+  while (include_list != NULL)
+    {
+      name = include_list;
+      include_list = include_list->next;
+      name->next = NULL;
+
+      spec = parser_new_node (this_parser, PT_SORT_SPEC);
+      if (spec == NULL)
+	{
+	  break;
+	}
+      spec->info.sort_spec.expr = name;
+      spec->info.sort_spec.asc_or_desc = PT_ASC;
+      column_list = parser_append_node (spec, column_list);
+      index->info.index.include_count++;
+    }
+
+  return column_list;
+}
+
 static void
 parser_initialize_parser_context (void)
 {
@@ -47,6 +47,7 @@ static KEYWORD_RECORD keywords[] = {
   {ADD, "ADD", 0},
   {ADD_MONTHS, "ADD_MONTHS", 0},
   {ADDDATE, "ADDDATE", 1},
+  {ADVICE, "ADVICE", 1},
   {AFTER, "AFTER", 0},
   {ALL, "ALL", 0},
   {ALLOCATE, "ALLOCATE", 0},
@@ -229,6 +230,7 @@ static KEYWORD_RECORD keywords[] = {
   {IMMEDIATE, "IMMEDIATE", 0},
   {IN_, "IN", 0},
   {INACTIVE, "INACTIVE", 1},
+  {INCLUDE, "INCLUDE", 1},
   {INCREMENT, "INCREMENT", 1},
   {INDEX, "INDEX", 0},
   {INDEX_PREFIX, "INDEX_PREFIX", 1},
@@ -283,6 +285,7 @@ static KEYWORD_RECORD keywords[] = {
   {LOWER, "LOWER", 0},
   {MATCH, "MATCH", 0},
   {MATCHED, "MATCHED", 1},
+  {MATERIALIZED, "MATERIALIZED", 1},
   {Max, "MAX", 0},
   {MAXIMUM, "MAXIMUM", 1},
   {MAXVALUE, "MAXVALUE", 1},
@@ -370,6 +373,7 @@ static KEYWORD_RECORD keywords[] = {
   {REF, "REF", 0},
   {REFERENCES, "REFERENCES", 0},
   {REFERENCING, "REFERENCING", 0},
+  {REFRESH, "REFRESH", 1},
   {REJECT_, "REJECT", 1},
   {REMOVE, "REMOVE", 1},
   {RENAME, "RENAME", 0},
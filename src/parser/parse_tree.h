@@ -1439,7 +1439,10 @@ typedef enum
   PT_CHANGE_TABLE_COMMENT,
   PT_CHANGE_COLUMN_COMMENT,
   PT_CHANGE_INDEX_COMMENT,
-  PT_CHANGE_INDEX_STATUS
+  PT_CHANGE_INDEX_STATUS,
+  PT_COALESCE_INDEX,
+  PT_REFRESH_MATERIALIZED_VIEW,
+  PT_CHANGE_MATERIALIZED_VIEW_QUERY
 } PT_ALTER_CODE;
 
 /* Codes for trigger event type */
@@ -2099,6 +2102,7 @@ struct pt_create_entity_info
   PT_CREATE_SELECT_ACTION create_select_action;	/* nothing | REPLACE | IGNORE for CREATE SELECT */
   unsigned or_replace:1;	/* OR REPLACE clause for create view */
   unsigned if_not_exists:1;	/* IF NOT EXISTS clause for create table | class */
+  unsigned is_materialized_view:1;	/* CREATE MATERIALIZED VIEW, create_select is kept as its definition */
 };
 
 /* CREATE/DROP INDEX INFO */
@@ -2119,6 +2123,7 @@ struct pt_index_info
   int func_pos;			/* the position of the expression in the function index's column list */
   int func_no_args;		/* number of arguments in the function index expression
 				 * Appears only in function index expressions, excluding constants.  */
+  int include_count;		/* number of trailing column_names given in INCLUDE (...) */
   bool reverse;			/* REVERSE */
   bool unique;			/* UNIQUE specified? */
   SM_INDEX_STATUS index_status;	/* Index status : NORMAL / ONLINE / INVISIBLE */
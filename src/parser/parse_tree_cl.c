@@ -6225,11 +6225,27 @@ pt_print_alter_one_clause (PARSER_CONTEXT * parser, PT_NODE * p)
 static PARSER_VARCHAR *
 pt_print_alter (PARSER_CONTEXT * parser, PT_NODE * p)
 {
-  PARSER_VARCHAR *q = NULL, *r1 = NULL;
+  PARSER_VARCHAR *q = NULL, *r1 = NULL, *r2 = NULL;
   PT_NODE *crt_clause = NULL;
 
   /* ALTER VCLASS XYZ ... */
   r1 = pt_print_bytes (parser, p->info.alter.entity_name);
+  if (p->info.alter.code == PT_REFRESH_MATERIALIZED_VIEW)
+    {
+      q = pt_append_nulstring (parser, q, "refresh materialized view ");
+      q = pt_append_varchar (parser, q, r1);
+      return q;
+    }
+  if (p->info.alter.code == PT_CHANGE_MATERIALIZED_VIEW_QUERY)
+    {
+      r2 = pt_print_bytes (parser, p->info.alter.alter_clause.query.query);
+      q = pt_append_nulstring (parser, q, "alter materialized view ");
+      q = pt_append_varchar (parser, q, r1);
+      q = pt_append_nulstring (parser, q, " as ");
+      q = pt_append_varchar (parser, q, r2);
+      return q;
+    }
+
   q = pt_append_nulstring (parser, q, "alter ");
   if (p->info.alter.hint != PT_HINT_NONE)
     {
@@ -6366,6 +6382,21 @@ pt_print_alter_index (PARSER_CONTEXT * parser, PT_NODE * p)
   if (p->info.index.code == PT_REBUILD_INDEX)
     {
       b = pt_append_nulstring (parser, b, "rebuild");
+      if (p->info.index.index_status == SM_ONLINE_INDEX_BUILDING_IN_PROGRESS)
+	{
+	  b = pt_append_nulstring (parser, b, " with online");
+	  if (p->info.index.ib_threads > 0)
+	    {
+	      char buf[32];
+
+	      sprintf (buf, " parallel %d", p->info.index.ib_threads);
+	      b = pt_append_nulstring (parser, b, buf);
+	    }
+	}
+    }
+  else if (p->info.index.code == PT_COALESCE_INDEX)
+    {
+      b = pt_append_nulstring (parser, b, "coalesce");
     }
 
   return b;
@@ -6974,7 +7005,14 @@ pt_print_create_entity (PARSER_CONTEXT * parser, PT_NODE * p)
       q = pt_append_nulstring (parser, q, "or replace ");
     }
 
-  q = pt_append_nulstring (parser, q, pt_show_misc_type (p->info.create_entity.entity_type));
+  if (p->info.create_entity.is_materialized_view)
+    {
+      q = pt_append_nulstring (parser, q, "materialized view");
+    }
+  else
+    {
+      q = pt_append_nulstring (parser, q, pt_show_misc_type (p->info.create_entity.entity_type));
+    }
   q = pt_append_nulstring (parser, q, " ");
   if (p->info.create_entity.if_not_exists)
     {
@@ -7312,6 +7350,33 @@ pt_print_create_index (PARSER_CONTEXT * parser, PT_NODE * p)
   b = pt_append_varchar (parser, b, r2);
   b = pt_append_nulstring (parser, b, ") ");
 
+  if (p->info.index.include_count > 0)
+    {
+      int i, key_count = 0;
+
+      for (sort_spec = p->info.index.column_names; sort_spec != NULL; sort_spec = sort_spec->next)
+	{
+	  key_count++;
+	}
+      key_count -= p->info.index.include_count;
+
+      b = pt_append_nulstring (parser, b, "include (");
+      for (i = 0, sort_spec = p->info.index.column_names; sort_spec != NULL; i++, sort_spec = sort_spec->next)
+	{
+	  if (i < key_count)
+	    {
+	      continue;
+	    }
+	  r3 = pt_print_bytes (parser, sort_spec->info.sort_spec.expr);
+	  b = pt_append_varchar (parser, b, r3);
+	  if (sort_spec->next != NULL)
+	    {
+	      b = pt_append_nulstring (parser, b, ", ");
+	    }
+	}
+      b = pt_append_nulstring (parser, b, ") ");
+    }
+
   if (p->info.index.where != NULL)
     {
       r4 = pt_print_and_list (parser, p->info.index.where);
@@ -17094,7 +17159,28 @@ pt_print_index_columns (PARSER_CONTEXT * parser, PT_NODE * p)
   int list_size = 0, i;
   PT_NODE *q = NULL;
 
-  if (p->info.index.function_expr == NULL)
+  if (p->info.index.function_expr == NULL && p->info.index.include_count > 0)
+    {
+      /* index with INCLUDE columns: print the key columns only */
+      q = p->info.index.column_names;
+      while (q != NULL)
+	{
+	  list_size++;
+	  q = q->next;
+	}
+
+      q = p->info.index.column_names;
+      for (i = 0; i < list_size - p->info.index.include_count && q != NULL; i++, q = q->next)
+	{
+	  r1 = pt_print_bytes (parser, q);
+	  if (i < list_size - p->info.index.include_count - 1)
+	    {
+	      r1 = pt_append_bytes (parser, r1, ", ", 2);
+	    }
+	  b = pt_append_varchar (parser, b, r1);
+	}
+    }
+  else if (p->info.index.function_expr == NULL)
     {
       /* normal index */
       b = pt_print_bytes_l (parser, p->info.index.column_names);
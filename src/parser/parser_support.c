@@ -169,6 +169,7 @@ static PT_NODE *pt_resolve_showstmt_args_named (PARSER_CONTEXT * parser, const S
 static bool pt_convert_dblink_select_query (PARSER_CONTEXT * parser, PT_NODE * query_stmt, SERVER_NAME_LIST * snl);
 static void pt_convert_dblink_dml_query (PARSER_CONTEXT * parser, PT_NODE * node,
 					 int local_upd, int remote_upd, SERVER_NAME_LIST * snl);
+static PARSER_VARCHAR *pt_append_advice_literal (PARSER_CONTEXT * parser, PARSER_VARCHAR * q, const char *str);
 #define NULL_ATTRID -1
 
 /*
@@ -7598,6 +7599,109 @@ pt_make_query_show_exec_stats_all (PARSER_CONTEXT * parser)
   return node[0];
 }
 
+/*
+ * pt_append_advice_literal () - append a string literal to the SHOW INDEX ADVICE query
+ *   return: the appended buffer
+ *   parser(in):
+ *   q(in): query buffer
+ *   str(in): literal value, single quotes are doubled
+ */
+static PARSER_VARCHAR *
+pt_append_advice_literal (PARSER_CONTEXT * parser, PARSER_VARCHAR * q, const char *str)
+{
+  const char *p, *quote;
+
+  q = pt_append_bytes (parser, q, "'", 1);
+  for (p = str; (quote = strchr (p, '\'')) != NULL; p = quote + 1)
+    {
+      q = pt_append_bytes (parser, q, p, (int) (quote - p) + 1);
+      q = pt_append_bytes (parser, q, "'", 1);
+    }
+  q = pt_append_nulstring (parser, q, p);
+
+  return pt_append_bytes (parser, q, "'", 1);
+}
+
+/*
+ * pt_make_query_show_index_advice () - builds the query for SHOW INDEX ADVICE
+ *   return: query node
+ *   parser(in):
+ *
+ * Note: the advice is collected by the optimizer of this client (see optimizer_index_advisor) and returned as
+ *	 one constant row per proposed index, largest estimated benefit first.
+ */
+PT_NODE *
+pt_make_query_show_index_advice (PARSER_CONTEXT * parser)
+{
+  PT_NODE **node = NULL;
+  PT_NODE *show_node;
+  QO_INDEX_ADVICE *advice;
+  PARSER_VARCHAR *q = NULL;
+  char columns[QO_ADVISOR_MAX_COLUMNS * (DB_MAX_IDENTIFIER_LENGTH + 2)];
+  char numbers[64];
+  int n_advice, i, j;
+
+  advice = (QO_INDEX_ADVICE *) malloc (QO_ADVISOR_MAX_ADVICE * sizeof (QO_INDEX_ADVICE));
+  if (advice == NULL)
+    {
+      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_OUT_OF_VIRTUAL_MEMORY, 1,
+	      QO_ADVISOR_MAX_ADVICE * sizeof (QO_INDEX_ADVICE));
+      return NULL;
+    }
+
+  n_advice = qo_advisor_get_advice (advice, QO_ADVISOR_MAX_ADVICE);
+  if (n_advice == 0)
+    {
+      q = pt_append_nulstring (parser, q,
+			       "SELECT '' as [table_name], '' as [index_columns], 0 as [optimized_queries],"
+			       " CAST (0 AS DOUBLE) as [estimated_benefit] FROM db_root WHERE 1 = 0");
+    }
+
+  for (i = 0; i < n_advice; i++)
+    {
+      columns[0] = '\0';
+      for (j = 0; j < advice[i].n_columns; j++)
+	{
+	  if (j > 0)
+	    {
+	      strcat (columns, ", ");
+	    }
+	  strcat (columns, advice[i].columns[j]);
+	}
+
+      q = pt_append_nulstring (parser, q, (i == 0) ? "(SELECT " : " UNION ALL (SELECT ");
+      q = pt_append_advice_literal (parser, q, advice[i].class_name);
+      q = pt_append_nulstring (parser, q, " as [table_name], ");
+      q = pt_append_advice_literal (parser, q, columns);
+      snprintf (numbers, sizeof (numbers), " as [index_columns], %d as [optimized_queries], CAST (%.2f AS DOUBLE)",
+		advice[i].count, advice[i].benefit);
+      q = pt_append_nulstring (parser, q, numbers);
+      q = pt_append_nulstring (parser, q, " as [estimated_benefit])");
+    }
+
+  if (n_advice > 1)
+    {
+      q = pt_append_nulstring (parser, q, " ORDER BY 4 DESC, 3 DESC");
+    }
+
+  free_and_init (advice);
+
+  /* parser ';' will empty and reset the stack of parser, this make the status machine be right for the next statement,
+   * and avoid nested parser statement. */
+  parser_parse_string (parser, ";");
+
+  node = parser_parse_string_use_sys_charset (parser, (const char *) pt_get_varchar_bytes (q));
+  if (node == NULL)
+    {
+      return NULL;
+    }
+
+  show_node = pt_pop (parser);
+  assert (show_node == node[0]);
+
+  return node[0];
+}
+
 /*
  * pt_make_query_user_groups() - builds the query to return the SET of DB
  *				 groups to which a DB user belongs to.
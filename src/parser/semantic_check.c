@@ -5188,6 +5188,15 @@ pt_check_alter (PARSER_CONTEXT * parser, PT_NODE * alter)
 	    }
 	}
       break;
+
+    case PT_REFRESH_MATERIALIZED_VIEW:
+      if (!sm_is_materialized_view (db))
+	{
+	  PT_ERRORmf2 (parser, alter, MSGCAT_SET_PARSER_SEMANTIC, MSGCAT_SEMANTIC_IS_NOT_A, cls_nam,
+		       "materialized view");
+	}
+      break;
+
     default:
       break;
     }
@@ -8847,13 +8856,20 @@ pt_check_create_index (PARSER_CONTEXT * parser, PT_NODE * node)
 
       if (node->info.index.function_expr)
 	{
-	  if (node->info.index.prefix_length || node->info.index.where)
+	  if (node->info.index.prefix_length || node->info.index.where || node->info.index.include_count > 0)
 	    {
 	      PT_ERRORm (parser, node, MSGCAT_SET_PARSER_SEMANTIC, MSGCAT_SEMANTIC_INVALID_CREATE_INDEX);
 	    }
 	  return;
 	}
 
+      /* prefix keys cannot have INCLUDE columns */
+      if (node->info.index.include_count > 0 && node->info.index.prefix_length)
+	{
+	  PT_ERRORm (parser, node, MSGCAT_SET_PARSER_SEMANTIC, MSGCAT_SEMANTIC_INVALID_CREATE_INDEX);
+	  return;
+	}
+
       name->info.name.db_object = db_obj;
 
       /* check that there is only one column to index on */
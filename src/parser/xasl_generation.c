@@ -462,6 +462,9 @@ static REGU_VARIABLE_LIST pt_to_regu_variable_list (PARSER_CONTEXT * p, PT_NODE
 						    VAL_LIST * value_list, int *attr_offsets);
 
 static REGU_VARIABLE *pt_attribute_to_regu (PARSER_CONTEXT * parser, PT_NODE * attr);
+static void pt_add_correlated_value (PARSER_CONTEXT * parser, SYMBOL_INFO * home, REGU_VARIABLE * regu);
+static PT_NODE *pt_is_sq_cacheable_pre (PARSER_CONTEXT * parser, PT_NODE * node, void *arg, int *continue_walk);
+static void pt_set_sq_cache_key (PARSER_CONTEXT * parser, PT_NODE * query, XASL_NODE * xasl);
 
 static TP_DOMAIN *pt_xasl_data_type_to_domain (PARSER_CONTEXT * parser, const PT_NODE * node);
 static DB_VALUE *pt_index_value (const VAL_LIST * value, int index);
@@ -1258,6 +1261,8 @@ pt_make_pred_expr_pred (const PRED_EXPR * arg1, const PRED_EXPR * arg2, const BO
 	  pred->pe.m_pred.lhs = (PRED_EXPR *) arg1;
 	  pred->pe.m_pred.rhs = (PRED_EXPR *) arg2;
 	  pred->pe.m_pred.bool_op = bop;
+	  pred->pe.m_pred.reorder = NULL;
+	  pred->pe.m_pred.n_evals = 0;
 	}
     }
 
@@ -3641,6 +3646,8 @@ pt_symbol_info_alloc (void)
       symbols->listfile_unbox = UNBOX_AS_VALUE;
       symbols->listfile_value_list = NULL;
       symbols->reserved_values = NULL;
+      symbols->correlated_values = NULL;
+      symbols->has_opaque_correlation = false;
 
       /* only used for server inserts and updates */
       symbols->listfile_attr_offset = 0;
@@ -10141,6 +10148,7 @@ pt_attribute_to_regu (PARSER_CONTEXT * parser, PT_NODE * attr)
 			      regu = NULL;
 			    }
 			}
+		      pt_add_correlated_value (parser, symbols, regu);
 		    }
 		  else
 		    {
@@ -10175,6 +10183,118 @@ pt_attribute_to_regu (PARSER_CONTEXT * parser, PT_NODE * attr)
   return regu;
 }
 
+
+/*
+ * pt_add_correlated_value () - Remember a correlated reference in every scope between the current one and the
+ *				scope the referenced attribute belongs to
+ *   return: none
+ *   parser(in):
+ *   home(in): scope of the referenced attribute
+ *   regu(in): regu variable generated for the reference
+ *
+ * Note: the collected values are the key of the subquery cache (see pt_set_sq_cache_key).
+ */
+static void
+pt_add_correlated_value (PARSER_CONTEXT * parser, SYMBOL_INFO * home, REGU_VARIABLE * regu)
+{
+  SYMBOL_INFO *symbols;
+  REGU_VARIABLE_LIST value;
+
+  for (symbols = parser->symbols; symbols != NULL && symbols != home; symbols = symbols->stack)
+    {
+      if (regu == NULL || regu->type != TYPE_CONSTANT)
+	{
+	  symbols->has_opaque_correlation = true;
+	  continue;
+	}
+
+      for (value = symbols->correlated_values; value != NULL; value = value->next)
+	{
+	  if (value->value.value.dbvalptr == regu->value.dbvalptr)
+	    {
+	      break;
+	    }
+	}
+      if (value != NULL)
+	{
+	  /* already referenced */
+	  continue;
+	}
+
+      regu_alloc (value);
+      if (value == NULL)
+	{
+	  symbols->has_opaque_correlation = true;
+	  continue;
+	}
+      value->value = *regu;
+      value->next = symbols->correlated_values;
+      symbols->correlated_values = value;
+    }
+}
+
+/*
+ * pt_is_sq_cacheable_pre () - Check whether a subquery gives the same result for the same correlated values
+ *   return: node
+ *   parser(in):
+ *   node(in):
+ *   arg(in/out): bool, set to false if the subquery is not deterministic
+ *   continue_walk(in/out):
+ */
+static PT_NODE *
+pt_is_sq_cacheable_pre (PARSER_CONTEXT * parser, PT_NODE * node, void *arg, int *continue_walk)
+{
+  bool *is_cacheable = (bool *) arg;
+
+  if (node->node_type == PT_METHOD_CALL)
+    {
+      /* methods and stored procedures may have side effects or read data changed by the statement */
+      *is_cacheable = false;
+    }
+  else if (node->node_type == PT_EXPR
+	   && (PT_IS_EXPR_NODE_WITH_NON_PUSHABLE (node) || PT_IS_SERIAL (node->info.expr.op)
+	       || node->info.expr.op == PT_DEFINE_VARIABLE || node->info.expr.op == PT_EVALUATE_VARIABLE))
+    {
+      *is_cacheable = false;
+    }
+
+  if (*is_cacheable == false)
+    {
+      *continue_walk = PT_STOP_WALK;
+    }
+
+  return node;
+}
+
+/*
+ * pt_set_sq_cache_key () - Set the values a correlated subquery depends on as key of its result cache
+ *   return: none
+ *   parser(in):
+ *   query(in): subquery, whose scope is the current one
+ *   xasl(in/out): XASL of the subquery
+ *
+ * Note: the key is only used for scalar subqueries (see qexec_execute_regu_variable_xasl). A subquery that
+ *	 references an enclosing scope other than by value, or that is not deterministic, gets no key.
+ */
+static void
+pt_set_sq_cache_key (PARSER_CONTEXT * parser, PT_NODE * query, XASL_NODE * xasl)
+{
+  bool is_cacheable = true;
+
+  xasl->sq_cache_key = NULL;
+
+  if (query->info.query.correlation_level == 0 || parser->symbols->correlated_values == NULL
+      || parser->symbols->has_opaque_correlation)
+    {
+      return;
+    }
+
+  (void) parser_walk_tree (parser, query, pt_is_sq_cacheable_pre, &is_cacheable, NULL, NULL);
+  if (is_cacheable)
+    {
+      xasl->sq_cache_key = parser->symbols->correlated_values;
+    }
+}
 /*
  * pt_join_term_to_regu_variable () - Translate a PT_NODE path join term
  *      to the regu_variable to follow from (left hand side of path)
@@ -21884,6 +22004,10 @@ parser_generate_xasl_post (PARSER_CONTEXT * parser, PT_NODE * node, void *arg, i
 
       /* build XASL for the query */
       xasl = parser_generate_xasl_proc (parser, node, info->query_list);
+      if (xasl != NULL && parser->symbols != NULL)
+	{
+	  pt_set_sq_cache_key (parser, node, xasl);
+	}
       pt_pop_symbol_info (parser);
       if (node->node_type == PT_SELECT)
 	{
@@ -91,6 +91,8 @@ struct symbol_info
   int listfile_attr_offset;
   PT_NODE *query_node;		/* the query node that is being translated */
   DB_VALUE **reserved_values;	/* db_values array used for reserved attributes */
+  REGU_VARIABLE_LIST correlated_values;	/* values of enclosing scopes referenced in this scope */
+  bool has_opaque_correlation;	/* an enclosing scope is referenced by something else than a value */
 };
 
 
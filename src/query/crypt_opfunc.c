@@ -673,9 +673,14 @@ crypt_md5_buffer_hex (const char *buffer, size_t len, char *resblock)
 void
 crypt_crc32 (const char *src, int src_len, int *dest)
 {
+// *INDENT-OFF*
+  /* the lookup table is built once; computing bit by bit is much slower for log page checksums */
+  static const CRC::Table<crcpp_uint32, 32> crc32_table (CRC::CRC_32 ());
+// *INDENT-ON*
+
   assert (src != NULL && dest != NULL);
 // *INDENT-OFF*
-  *dest = CRC::Calculate (src, src_len, CRC::CRC_32 ());
+  *dest = CRC::Calculate (src, src_len, crc32_table);
 // *INDENT-ON*
 }
 
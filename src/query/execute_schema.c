@@ -341,9 +341,8 @@ static int do_promote_partition (SM_CLASS * class_);
 #if defined (ENABLE_UNUSED_FUNCTION)
 static int do_analyze_partition (PARSER_CONTEXT * parser, PT_NODE * alter, SM_PARTITION_ALTER_INFO * pinfo);
 #endif
-static int do_redistribute_partitions_data (const char *class_name, const char *keyname, char **promoted,
-					    int promoted_count, PT_ALTER_CODE alter_op, bool should_update,
-					    bool should_insert);
+static int do_redistribute_partitions_data (const char *class_name, char **promoted, int promoted_count,
+					    PT_ALTER_CODE alter_op, bool should_update, bool should_insert);
 static SM_FUNCTION_INFO *compile_partition_expression (PARSER_CONTEXT * parser, PT_NODE * entity_name, PT_NODE * pinfo);
 static PT_NODE *replace_names_alter_chg_attr (PARSER_CONTEXT * parser, PT_NODE * node, void *void_arg,
 					      int *continue_walk);
@@ -364,6 +363,8 @@ static PT_NODE *create_select_to_insert_into (PARSER_CONTEXT * parser, const cha
 static int execute_create_select_query (PARSER_CONTEXT * parser, const char *const class_name, PT_NODE * create_select,
 					PT_CREATE_SELECT_ACTION create_select_action, DB_QUERY_TYPE * query_columns,
 					PT_NODE * flagged_statement);
+static int set_materialized_view_spec (PARSER_CONTEXT * parser, DB_CTMPL * ctemplate, const PT_NODE * query);
+static int do_refresh_materialized_view (PARSER_CONTEXT * parser, PT_NODE * alter);
 
 static int do_find_auto_increment_serial (MOP * auto_increment_obj, const char *class_name, const char *attr_name);
 static int do_check_fk_constraints_internal (DB_CTMPL * ctemplate, PT_NODE * constraints, bool is_partitioned);
@@ -376,6 +377,7 @@ static int do_drop_saved_indexes (MOP classmop, SM_CONSTRAINT_INFO * index_save_
 static int do_recreate_saved_indexes (MOP classmop, SM_CONSTRAINT_INFO * index_save_info);
 
 static int do_alter_index_status (PARSER_CONTEXT * parser, const PT_NODE * statement);
+static int do_alter_index_coalesce (PARSER_CONTEXT * parser, const PT_NODE * statement);
 
 int ib_thread_count = 0;
 
@@ -526,6 +528,25 @@ do_alter_one_clause_with_template (PARSER_CONTEXT * parser, PT_NODE * alter)
 	}
       break;
 
+    case PT_CHANGE_MATERIALIZED_VIEW_QUERY:
+      {
+	DB_QUERY_TYPE *query_columns = NULL;
+
+	/* compiled on a copy only to validate the definition; the stored rows are kept until the next REFRESH */
+	error = pt_get_select_query_columns (parser, alter->info.alter.alter_clause.query.query, &query_columns);
+	if (query_columns != NULL)
+	  {
+	    db_free_query_format (query_columns);
+	  }
+	if (error != NO_ERROR)
+	  {
+	    break;
+	  }
+
+	error = set_materialized_view_spec (parser, ctemplate, alter->info.alter.alter_clause.query.query);
+      }
+      break;
+
     case PT_ADD_ATTR_MTHD:
 #if 0
       /* we currently core dump when adding a unique constraint at the same time as an attribute, whether the unique
@@ -1688,6 +1709,9 @@ do_alter (PARSER_CONTEXT * parser, PT_NODE * alter)
 	case PT_CHANGE_COLUMN_COMMENT:
 	  error_code = do_alter_change_col_comment (parser, crt_clause);
 	  break;
+	case PT_REFRESH_MATERIALIZED_VIEW:
+	  error_code = do_refresh_materialized_view (parser, crt_clause);
+	  break;
 	default:
 	  /* This code might not correctly handle a list of ALTER clauses so we keep crt_clause->next to NULL during
 	   * its execution just to be on the safe side. */
@@ -2969,7 +2993,8 @@ create_or_drop_index_helper (PARSER_CONTEXT * parser, const char *const constrai
 	}
 
       error = sm_add_constraint (obj, ctype, cname, (const char **) attnames, asc_desc, attrs_prefix_length, false,
-				 p_pred_index_info, func_index_info, comment_str, idx_info->index_status);
+				 p_pred_index_info, func_index_info, idx_info->include_count, comment_str,
+				 idx_info->index_status);
     }
   else
     {
@@ -3138,6 +3163,10 @@ do_drop_index (PARSER_CONTEXT * parser, const PT_NODE * statement)
  *                            the efficiency of indexes. For the backward
  *                            compatibility, this function supports the
  *                            previous grammar.
+ *                            With ONLINE, a copy of the index is built
+ *                            online under another name and replaces the
+ *                            index, so the class is locked exclusively only
+ *                            to swap them.
  *   return: Error code if it fails
  *   parser(in): Parser context
  *   statement(in): Parse tree of a alter index statement
@@ -3166,6 +3195,12 @@ do_alter_index_rebuild (PARSER_CONTEXT * parser, const PT_NODE * statement)
   const char *comment_str = NULL;
   bool do_rollback = false;
   SM_INDEX_STATUS saved_index_status = SM_NORMAL_INDEX;
+  int saved_include_count = 0;
+  bool is_online = false;
+  SM_CLASS_CONSTRAINT *cons;
+  SM_TEMPLATE *ctemplate = NULL;
+  char saved_index_name[SM_MAX_IDENTIFIER_LENGTH + 1];
+  char rebuilt_name[SM_MAX_IDENTIFIER_LENGTH + 1];
 
   /* TODO refactor this code, the code in create_or_drop_index_helper and the code in do_drop_index in order to remove
    * duplicate code */
@@ -3209,6 +3244,7 @@ do_alter_index_rebuild (PARSER_CONTEXT * parser, const PT_NODE * statement)
     }
 
   saved_index_status = idx->index_status;
+  saved_include_count = idx->include_count;
 
   if (statement->info.index.comment != NULL)
     {
@@ -3224,6 +3260,33 @@ do_alter_index_rebuild (PARSER_CONTEXT * parser, const PT_NODE * statement)
       er_set (ER_NOTIFICATION_SEVERITY, ARG_FILE_LINE, ER_SM_CONSTRAINT_HAS_DIFFERENT_TYPE, 1, index_name);
     }
 
+#if !defined (SA_MODE)
+  if (statement->info.index.index_status == SM_ONLINE_INDEX_BUILDING_IN_PROGRESS)
+    {
+      /* Only the indexes that sm_add_constraint builds online and that no other constraint shares are rebuilt online.
+       * The others are rebuilt as without ONLINE. */
+      is_online = ((original_ctype == DB_CONSTRAINT_INDEX || original_ctype == DB_CONSTRAINT_REVERSE_INDEX)
+		   && (saved_index_status == SM_NORMAL_INDEX || saved_index_status == SM_INVISIBLE_INDEX)
+		   && smcls->partition == NULL && smcls->users == NULL && smcls->inheritance == NULL);
+      for (cons = smcls->constraints; is_online && cons != NULL; cons = cons->next)
+	{
+	  if (cons != idx && BTID_IS_EQUAL (&cons->index_btid, &idx->index_btid))
+	    {
+	      is_online = false;
+	    }
+	}
+
+      if (is_online)
+	{
+	  /* idx is freed when the class is updated */
+	  strncpy (saved_index_name, idx->name, SM_MAX_IDENTIFIER_LENGTH);
+	  saved_index_name[SM_MAX_IDENTIFIER_LENGTH] = '\0';
+	  snprintf (rebuilt_name, sizeof (rebuilt_name), "rebuild_%d_%d_%d", idx->index_btid.vfid.volid,
+		    idx->index_btid.vfid.fileid, idx->index_btid.root_pageid);
+	}
+    }
+#endif /* !SA_MODE */
+
   /* get attributes of the index */
   attp = idx->attributes;
   if (attp == NULL)
@@ -3390,18 +3453,75 @@ do_alter_index_rebuild (PARSER_CONTEXT * parser, const PT_NODE * statement)
     }
   do_rollback = true;
 
-  error = sm_drop_constraint (obj, original_ctype, index_name, (const char **) attnames, false, false);
-  if (error != NO_ERROR)
+  if (is_online)
     {
-      goto error_exit;
-    }
+      ib_thread_count = statement->info.index.ib_threads;
 
-  error =
-    sm_add_constraint (obj, original_ctype, index_name, (const char **) attnames, asc_desc, attrs_prefix_length, false,
-		       p_pred_index_info, func_index_info, comment_str, saved_index_status);
-  if (error != NO_ERROR)
+      /* Build the copy while the index is in use. */
+      smt_set_rebuilt_index_name (saved_index_name);
+      error =
+	sm_add_constraint (obj, original_ctype, rebuilt_name, (const char **) attnames, asc_desc, attrs_prefix_length,
+			   false, p_pred_index_info, func_index_info, saved_include_count, comment_str,
+			   SM_ONLINE_INDEX_BUILDING_IN_PROGRESS);
+      smt_set_rebuilt_index_name (NULL);
+      if (error != NO_ERROR)
+	{
+	  goto error_exit;
+	}
+
+      /* Replace the index with its copy. */
+      error = sm_drop_constraint (obj, original_ctype, saved_index_name, (const char **) attnames, false, false);
+      if (error != NO_ERROR)
+	{
+	  goto error_exit;
+	}
+
+      ctemplate = smt_edit_class_mop (obj, AU_INDEX);
+      if (ctemplate == NULL)
+	{
+	  ASSERT_ERROR_AND_SET (error);
+	  goto error_exit;
+	}
+
+      if (saved_index_status == SM_INVISIBLE_INDEX)
+	{
+	  error = smt_change_constraint_status (ctemplate, rebuilt_name, SM_INVISIBLE_INDEX);
+	  if (error != NO_ERROR)
+	    {
+	      goto error_exit;
+	    }
+	}
+
+      error = smt_rename_rebuilt_index (ctemplate, rebuilt_name, saved_index_name);
+      if (error != NO_ERROR)
+	{
+	  goto error_exit;
+	}
+
+      /* classobj_free_template() is included in sm_update_class() */
+      error = sm_update_class (ctemplate, NULL);
+      ctemplate = NULL;
+      if (error != NO_ERROR)
+	{
+	  goto error_exit;
+	}
+    }
+  else
     {
-      goto error_exit;
+      error = sm_drop_constraint (obj, original_ctype, index_name, (const char **) attnames, false, false);
+      if (error != NO_ERROR)
+	{
+	  goto error_exit;
+	}
+
+      error =
+	sm_add_constraint (obj, original_ctype, index_name, (const char **) attnames, asc_desc, attrs_prefix_length,
+			   false, p_pred_index_info, func_index_info, saved_include_count, comment_str,
+			   saved_index_status);
+      if (error != NO_ERROR)
+	{
+	  goto error_exit;
+	}
     }
 
 end:
@@ -3455,6 +3575,12 @@ end:
   return error;
 
 error_exit:
+  if (ctemplate != NULL)
+    {
+      /* smt_quit() always returns NO_ERROR */
+      smt_quit (ctemplate);
+      ctemplate = NULL;
+    }
 
   if (do_rollback == true)
     {
@@ -3688,6 +3814,101 @@ error_exit:
   goto end;
 }
 
+/*
+ * do_alter_index_coalesce() - merges the underfull pages of an index on a
+ *                             class, and of its local indexes on the
+ *                             partitions.
+ *   return: Error code if it fails
+ *   parser(in): Parser context
+ *   statement(in): Parse tree of a alter index statement
+ *
+ * Note: The class is only read locked, the b-tree is compacted on the server
+ *       while other transactions keep reading and changing it.
+ */
+static int
+do_alter_index_coalesce (PARSER_CONTEXT * parser, const PT_NODE * statement)
+{
+  int error = NO_ERROR;
+  DB_OBJECT *obj;
+  PT_NODE *cls = NULL;
+  SM_CLASS *smcls;
+  SM_CLASS_CONSTRAINT *idx;
+  const char *index_name = NULL;
+  BTID btid;
+  int i, partition_type;
+  MOP *sub_partitions = NULL;
+
+  index_name = statement->info.index.index_name ? statement->info.index.index_name->info.name.original : NULL;
+  cls = statement->info.index.indexed_class ? statement->info.index.indexed_class->info.spec.flat_entity_list : NULL;
+  if (index_name == NULL || cls == NULL)
+    {
+      return ER_FAILED;
+    }
+
+  obj = db_find_class (cls->info.name.resolved);
+  if (obj == NULL)
+    {
+      ASSERT_ERROR_AND_SET (error);
+      return error;
+    }
+
+  error = au_fetch_class (obj, &smcls, AU_FETCH_READ, AU_INDEX);
+  if (error != NO_ERROR)
+    {
+      return error;
+    }
+
+  idx = classobj_find_class_index (smcls, index_name);
+  if (idx == NULL)
+    {
+      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_SM_NO_INDEX, 1, index_name);
+      return ER_SM_NO_INDEX;
+    }
+  BTID_COPY (&btid, &idx->index_btid);
+
+  error = btree_coalesce_index (&btid);
+  if (error != NO_ERROR)
+    {
+      return error;
+    }
+
+  error = sm_partitioned_class_type (obj, &partition_type, NULL, &sub_partitions);
+  if (error != NO_ERROR || partition_type != DB_PARTITIONED_CLASS)
+    {
+      goto end;
+    }
+
+  for (i = 0; sub_partitions[i] != NULL; i++)
+    {
+      error = au_fetch_class (sub_partitions[i], &smcls, AU_FETCH_READ, AU_INDEX);
+      if (error != NO_ERROR)
+	{
+	  goto end;
+	}
+
+      idx = classobj_find_class_index (smcls, index_name);
+      if (idx == NULL || BTID_IS_EQUAL (&idx->index_btid, &btid))
+	{
+	  /* global index, already coalesced */
+	  continue;
+	}
+
+      error = btree_coalesce_index (&idx->index_btid);
+      if (error != NO_ERROR)
+	{
+	  goto end;
+	}
+    }
+
+end:
+  if (sub_partitions != NULL)
+    {
+      free_and_init (sub_partitions);
+    }
+
+  return error;
+}
+
 /*
  * do_alter_index() - Alters an index on a class.
  *   return: Error code if it fails
@@ -3719,6 +3940,10 @@ do_alter_index (PARSER_CONTEXT * parser, const PT_NODE * statement)
     {
       error = do_alter_index_status (parser, statement);
     }
+  else if (statement->info.index.code == PT_COALESCE_INDEX)
+    {
+      error = do_alter_index_coalesce (parser, statement);
+    }
   else
     {
       return ER_FAILED;
@@ -4710,52 +4935,46 @@ end_rename:
  * do_redistribute_partitions_data() -
  *   return: error code or NO_ERROR
  *   classname(in):
- *   keyname(in):
  *   promoted(in):
  *   promoted_count(in):
  *   alter_op(in):
- *   should_update(in):
- *   should_insert(in):
- * Note:
+ *   should_update(in): move the rows of the class to the partitions they belong to
+ *   should_insert(in): insert the rows of the promoted partitions into the class
+ * Note: The rows are moved by the server; only the rows which change partition are rewritten.
  */
 static int
-do_redistribute_partitions_data (const char *classname, const char *keyname, char **promoted, int promoted_count,
-				 PT_ALTER_CODE alter_op, bool should_update, bool should_insert)
+do_redistribute_partitions_data (const char *classname, char **promoted, int promoted_count, PT_ALTER_CODE alter_op,
+				 bool should_update, bool should_insert)
 {
   int error = NO_ERROR;
-  DB_QUERY_RESULT *query_result;
-  DB_QUERY_ERROR query_error;
-  char *query_buf;
-  size_t query_size;
   int i = 0;
   MOP subclass_mop, class_mop;
   OID *partitions = NULL;
   SM_CONSTRAINT_INFO *index_save_info = NULL;
 
+  if (!should_update && !should_insert)
+    {
+      return NO_ERROR;
+    }
+
+  class_mop = sm_find_class (classname);
+  if (class_mop == NULL)
+    {
+      assert (er_errid () != NO_ERROR);
+      return er_errid ();
+    }
+
   if (should_update)
     {
-      query_size = 0;
-      query_size += 7;		/* 'UPDATE ' */
-      query_size += 28;		// ' /*+ NO_SUPPLEMENTAL_LOG */ ' 
-      query_size += strlen (classname) + 2;
-      query_size += 5;		/* ' SET ' */
-      query_size += strlen (keyname) * 2 + 6;	/* [keyname]=[keyname]; */
-      query_buf = (char *) malloc (query_size + 1);
-      if (query_buf == NULL)
+      /* the server routes the rows with the partitioning stored in the catalog */
+      error = locator_all_flush ();
+      if (error != NO_ERROR)
 	{
-	  er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_OUT_OF_VIRTUAL_MEMORY, 1, query_size + 1);
-	  return ER_FAILED;
+	  return error;
 	}
-      sprintf (query_buf, "UPDATE /*+ NO_SUPPLEMENTAL_LOG */ [%s] SET [%s]=[%s];", classname, keyname, keyname);
 
-      error = db_compile_and_execute_local (query_buf, &query_result, &query_error);
-      if (error >= 0)
-	{
-	  error = NO_ERROR;
-	  db_query_end (query_result);
-	}
-      free_and_init (query_buf);
-      if (error < 0)
+      error = locator_move_partition_rows (&class_mop->oid_info.oid);
+      if (error != NO_ERROR)
 	{
 	  return error;
 	}
@@ -4763,14 +4982,6 @@ do_redistribute_partitions_data (const char *classname, const char *keyname, cha
 
   if (should_insert)
     {
-      class_mop = sm_find_class (classname);
-      if (class_mop == NULL)
-	{
-	  assert (er_errid () != NO_ERROR);
-	  error = er_errid ();
-	  goto exit;
-	}
-
       if (alter_op != PT_REORG_PARTITION)
 	{
 	  error = do_save_all_indexes (class_mop, &index_save_info);
@@ -5556,7 +5767,7 @@ do_create_partition_constraint (PT_NODE * alter, SM_CLASS * root_class, SM_CLASS
 	  error =
 	    sm_add_constraint (subclass_op, db_constraint_type (constraint), constraint->name, (const char **) namep,
 			       asc_desc, constraint->attrs_prefix_length, false, constraint->filter_predicate,
-			       new_func_index_info, constraint->comment, constraint->index_status);
+			       new_func_index_info, constraint->include_count, constraint->comment, constraint->index_status);
 	  if (error != NO_ERROR)
 	    {
 	      goto cleanup;
@@ -5610,7 +5821,7 @@ do_create_partition_constraint (PT_NODE * alter, SM_CLASS * root_class, SM_CLASS
 	  error =
 	    sm_add_constraint (objs->op, db_constraint_type (constraint), constraint->name, (const char **) namep,
 			       asc_desc, constraint->attrs_prefix_length, false, constraint->filter_predicate,
-			       new_func_index_info, constraint->comment, constraint->index_status);
+			       new_func_index_info, constraint->include_count, constraint->comment, constraint->index_status);
 	  if (error != NO_ERROR)
 	    {
 	      goto cleanup;
@@ -5852,14 +6063,9 @@ do_alter_partitioning_post (PARSER_CONTEXT * parser, PT_NODE * alter, SM_PARTITI
 	  return error;
 	}
 
-      error = do_get_partition_keycol (pinfo->keycol, pinfo->root_op);
-      if (error != NO_ERROR)
-	{
-	  return error;
-	}
       /* fall through */
     case PT_ADD_HASHPARTITION:
-      error = do_redistribute_partitions_data (entity_name, pinfo->keycol, NULL, 0, PT_ADD_HASHPARTITION, true, false);
+      error = do_redistribute_partitions_data (entity_name, NULL, 0, PT_ADD_HASHPARTITION, true, false);
       break;
     case PT_COALESCE_PARTITION:
       error = do_coalesce_partition_post (parser, alter, pinfo);
@@ -6049,7 +6255,7 @@ do_remove_partition_post (PARSER_CONTEXT * parser, PT_NODE * alter, SM_PARTITION
   root_name = alter->info.alter.entity_name->info.name.original;
 
   error =
-    do_redistribute_partitions_data (root_name, pinfo->keycol, pinfo->promoted_names, pinfo->promoted_count,
+    do_redistribute_partitions_data (root_name, pinfo->promoted_names, pinfo->promoted_count,
 				     alter->info.alter.code, false, true);
   if (error != NO_ERROR)
     {
@@ -6267,7 +6473,7 @@ do_coalesce_partition_post (PARSER_CONTEXT * parser, PT_NODE * alter, SM_PARTITI
     }
 
   error =
-    do_redistribute_partitions_data (root_name, pinfo->keycol, pinfo->promoted_names, pinfo->promoted_count,
+    do_redistribute_partitions_data (root_name, pinfo->promoted_names, pinfo->promoted_count,
 				     alter->info.alter.code, true, true);
   if (error != NO_ERROR)
     {
@@ -6490,7 +6696,7 @@ do_reorganize_partition_post (PARSER_CONTEXT * parser, PT_NODE * alter, SM_PARTI
     }
 
   error =
-    do_redistribute_partitions_data (root_name, pinfo->keycol, pinfo->promoted_names, pinfo->promoted_count,
+    do_redistribute_partitions_data (root_name, pinfo->promoted_names, pinfo->promoted_count,
 				     alter->info.alter.code, update, insert);
   if (error != NO_ERROR)
     {
@@ -7747,7 +7953,7 @@ do_add_constraints (DB_CTMPL * ctemplate, PT_NODE * constraints)
 		    }
 
 		  error = smt_add_constraint (ctemplate, constraint_type, constraint_name, (const char **) att_names,
-					      asc_desc, NULL, class_attributes, NULL, NULL, NULL, comment,
+					      asc_desc, NULL, class_attributes, NULL, NULL, NULL, 0, comment,
 					      SM_NORMAL_INDEX);
 
 		  free_and_init (constraint_name);
@@ -7817,7 +8023,7 @@ do_add_constraints (DB_CTMPL * ctemplate, PT_NODE * constraints)
 
 		  error = smt_add_constraint (ctemplate, DB_CONSTRAINT_PRIMARY_KEY, constraint_name,
 					      (const char **) att_names, asc_desc, NULL, class_attributes, NULL, NULL,
-					      NULL, comment, SM_NORMAL_INDEX);
+					      NULL, 0, comment, SM_NORMAL_INDEX);
 
 		  free_and_init (constraint_name);
 		  free_and_init (asc_desc);
@@ -8703,6 +8909,152 @@ error_exit:
   return error;
 }
 
+/*
+ * set_materialized_view_spec() - Keeps the defining query of a materialized view with its class
+ *   return: NO_ERROR on success, non-zero for ERROR
+ *   parser(in): Parser context
+ *   ctemplate(in/out): Class template
+ *   query(in): the AS query of CREATE MATERIALIZED VIEW
+ */
+static int
+set_materialized_view_spec (PARSER_CONTEXT * parser, DB_CTMPL * ctemplate, const PT_NODE * query)
+{
+  const char *spec;
+  unsigned int save_custom;
+
+  /* aliases name the columns of the view, they must survive printing */
+  save_custom = parser->custom_print;
+  parser->custom_print |= (PT_CHARSET_COLLATE_FULL | PT_PRINT_ALIAS);
+
+  spec = parser_print_tree_with_quotes (parser, query);
+  parser->custom_print = save_custom;
+  if (spec == NULL)
+    {
+      assert (er_errid () != NO_ERROR);
+      return er_errid ();
+    }
+
+  return smt_set_materialized_view_spec (ctemplate, spec);
+}
+
+/*
+ * do_refresh_materialized_view() - Recomputes the contents of a materialized view
+ *   return: Error code
+ *   parser(in): Parser context
+ *   alter(in): Parse tree of a REFRESH MATERIALIZED VIEW statement
+ *
+ * Note: the stored rows are deleted and the defining query is run again as INSERT ... SELECT. Both steps run
+ *       under the ALTER savepoint, so a failed refresh leaves the previous contents in place. The view is locked
+ *       with SIX_LOCK only, which serializes refreshes but does not block readers; they see the previous contents
+ *       until the refresh commits. Unlike TRUNCATE, the deleted rows are logged and left to vacuum.
+ */
+static int
+do_refresh_materialized_view (PARSER_CONTEXT * parser, PT_NODE * alter)
+{
+  const char *class_name;
+  DB_OBJECT *class_mop;
+  PARSER_CONTEXT *mview_parser = NULL;
+  PT_NODE **stmt;
+  PT_NODE *delete_stmt = NULL;
+  DB_QUERY_TYPE *query_columns = NULL;
+  char delete_query[DB_MAX_IDENTIFIER_LENGTH + 16];
+  char *spec = NULL;
+  int error = NO_ERROR;
+
+  class_name = alter->info.alter.entity_name->info.name.original;
+  class_mop = db_find_class (class_name);
+  if (class_mop == NULL)
+    {
+      ASSERT_ERROR_AND_SET (error);
+      return error;
+    }
+
+  error = sm_get_materialized_view_spec (class_mop, &spec);
+  if (error != NO_ERROR)
+    {
+      return error;
+    }
+  if (spec == NULL)
+    {
+      ERROR0 (error, ER_SM_INVALID_CLASS);
+      return error;
+    }
+
+  /* TRUNCATE would hold SCH_M_LOCK, blocking every reader of the view until the refresh commits */
+  if (locator_fetch_class (class_mop, DB_FETCH_QUERY_WRITE) == NULL)
+    {
+      ASSERT_ERROR_AND_SET (error);
+      goto end;
+    }
+
+  /* the definition is parsed and compiled apart from the REFRESH statement, the same way it was at creation */
+  mview_parser = parser_create_parser ();
+  if (mview_parser == NULL)
+    {
+      error = ER_FAILED;
+      goto end;
+    }
+
+  snprintf (delete_query, sizeof (delete_query), "DELETE FROM [%s]", class_name);
+  stmt = parser_parse_string_use_sys_charset (mview_parser, delete_query);
+  if (stmt == NULL || *stmt == NULL || pt_has_error (mview_parser))
+    {
+      pt_report_to_ersys (mview_parser, PT_SYNTAX);
+      ASSERT_ERROR_AND_SET (error);
+      goto end;
+    }
+
+  delete_stmt = pt_compile (mview_parser, *stmt);
+  if (delete_stmt != NULL && !pt_has_error (mview_parser))
+    {
+      delete_stmt = mq_translate (mview_parser, delete_stmt);
+    }
+  if (delete_stmt == NULL || pt_has_error (mview_parser))
+    {
+      pt_report_to_ersys_with_statement (mview_parser, PT_SEMANTIC, delete_stmt);
+      ASSERT_ERROR_AND_SET (error);
+      goto end;
+    }
+
+  error = do_statement (mview_parser, delete_stmt);
+  pt_free_statement_xasl_id (delete_stmt);
+  if (error < 0)
+    {
+      goto end;
+    }
+  error = NO_ERROR;
+
+  stmt = parser_parse_string_use_sys_charset (mview_parser, spec);
+  if (stmt == NULL || *stmt == NULL || pt_has_error (mview_parser))
+    {
+      pt_report_to_ersys (mview_parser, PT_SYNTAX);
+      ASSERT_ERROR_AND_SET (error);
+      goto end;
+    }
+
+  error = pt_get_select_query_columns (mview_parser, *stmt, &query_columns);
+  if (error != NO_ERROR)
+    {
+      goto end;
+    }
+
+  error =
+    execute_create_select_query (mview_parser, class_name, *stmt, PT_CREATE_SELECT_NO_ACTION, query_columns, *stmt);
+
+end:
+  if (query_columns != NULL)
+    {
+      db_free_query_format (query_columns);
+    }
+  if (mview_parser != NULL)
+    {
+      parser_free_parser (mview_parser);
+    }
+  free_and_init (spec);
+
+  return error;
+}
+
 /*
  * do_create_entity() - Creates a new class/vclass
  *   return: Error code if the class/vclass is not created
@@ -8981,6 +9333,11 @@ do_create_entity (PARSER_CONTEXT * parser, PT_NODE * node)
       error = do_create_local (parser, ctemplate, node, query_columns);
     }
 
+  if (error == NO_ERROR && node->info.create_entity.is_materialized_view)
+    {
+      error = set_materialized_view_spec (parser, ctemplate, create_select);
+    }
+
   if (error != NO_ERROR)
     {
       goto error_exit;
@@ -9375,7 +9732,7 @@ do_recreate_renamed_class_indexes (const PARSER_CONTEXT * parser, const char *co
     {
       error = sm_add_constraint (classmop, saved->constraint_type, saved->name, (const char **) saved->att_names,
 				 saved->asc_desc, saved->prefix_length, false, saved->filter_predicate,
-				 saved->func_index_info, saved->comment, saved->index_status);
+				 saved->func_index_info, saved->include_count, saved->comment, saved->index_status);
 
       if (error != NO_ERROR)
 	{
@@ -9487,14 +9844,14 @@ do_copy_indexes (PARSER_CONTEXT * parser, MOP classmop, SM_CLASS * src_class)
 	{
 	  error = sm_add_constraint (classmop, constraint_type, new_cons_name, att_names, index_save_info->asc_desc,
 				     index_save_info->prefix_length, false, index_save_info->filter_predicate,
-				     index_save_info->func_index_info, index_save_info->comment,
+				     index_save_info->func_index_info, index_save_info->include_count, index_save_info->comment,
 				     index_save_info->index_status);
 	}
       else
 	{
 	  error =
 	    sm_add_constraint (classmop, constraint_type, new_cons_name, att_names, c->asc_desc, c->attrs_prefix_length,
-			       false, c->filter_predicate, c->func_index_info, c->comment, c->index_status);
+			       false, c->filter_predicate, c->func_index_info, c->include_count, c->comment, c->index_status);
 	}
       if (error != NO_ERROR)
 	{
@@ -9850,7 +10207,8 @@ do_alter_clause_change_attribute (PARSER_CONTEXT * const parser, PT_NODE * const
 		      error = sm_add_constraint (class_mop, saved_constr->constraint_type, saved_constr->name,
 						 (const char **) saved_constr->att_names, saved_constr->asc_desc,
 						 saved_constr->prefix_length, false, saved_constr->filter_predicate,
-						 saved_constr->func_index_info, saved_constr->comment,
+						 saved_constr->func_index_info, saved_constr->include_count,
+						 saved_constr->comment,
 						 saved_constr->index_status);
 		      if (error != NO_ERROR)
 			{
@@ -13804,7 +14162,7 @@ do_recreate_att_constraints (MOP class_mop, SM_CONSTRAINT_INFO * constr_info_lis
 	  error =
 	    sm_add_constraint (class_mop, constr->constraint_type, constr->name, (const char **) constr->att_names,
 			       constr->asc_desc, constr->prefix_length, false, constr->filter_predicate,
-			       constr->func_index_info, constr->comment, constr->index_status);
+			       constr->func_index_info, constr->include_count, constr->comment, constr->index_status);
 
 	  if (error != NO_ERROR)
 	    {
@@ -15523,7 +15881,7 @@ do_recreate_saved_indexes (MOP classmop, SM_CONSTRAINT_INFO * index_save_info)
 	{
 	  error = sm_add_constraint (classmop, saved->constraint_type, saved->name, (const char **) saved->att_names,
 				     saved->asc_desc, saved->prefix_length, false, saved->filter_predicate,
-				     saved->func_index_info, saved->comment, saved->index_status);
+				     saved->func_index_info, saved->include_count, saved->comment, saved->index_status);
 
 	  if (error != NO_ERROR)
 	    {
@@ -91,6 +91,43 @@ struct qfile_cleanup_candidate
 typedef SCAN_CODE (*ADVANCE_FUCTION) (THREAD_ENTRY * thread_p, QFILE_LIST_SCAN_ID *, QFILE_TUPLE_RECORD *,
 				      QFILE_LIST_SCAN_ID *, QFILE_TUPLE_RECORD *, QFILE_TUPLE_VALUE_TYPE_LIST *);
 
+/* hash based set operations */
+#define QFILE_HASH_SETOP_HASH_RANGE 0x7FFFFFFF	/* prime; range of the tuple hash values */
+#define QFILE_HASH_SETOP_HT_SIZE 4096	/* initial size of the memory hash table; it grows as needed */
+#define QFILE_HASH_SETOP_MAX_PARTITIONS 256
+
+typedef enum
+{
+  QFILE_HASH_SETOP_UNION,	/* UNION DISTINCT, or DISTINCT of a single list */
+  QFILE_HASH_SETOP_INTERSECT,
+  QFILE_HASH_SETOP_INTERSECT_ALL,
+  QFILE_HASH_SETOP_DIFFERENCE,
+  QFILE_HASH_SETOP_DIFFERENCE_ALL
+} QFILE_HASH_SETOP_TYPE;
+
+typedef struct qfile_hash_setop QFILE_HASH_SETOP;
+struct qfile_hash_setop
+{
+  QFILE_HASH_SETOP_TYPE type;
+  QFILE_TUPLE_VALUE_TYPE_LIST *types;	/* types of both operands */
+  QFILE_LIST_ID *dest_list_id;	/* result list file */
+  MHT_TABLE *ht;		/* tuple -> QFILE_HASH_SETOP_ENTRY */
+  int n_partitions;		/* number of partitions the operands were split into */
+  int flag;			/* flag of qfile_combine_two_list () */
+  UINT64 mem_limit;		/* memory allowed for the hash table */
+};
+
+/* one distinct tuple in the hash table; the tuple copy is allocated together with the entry */
+typedef struct qfile_hash_setop_entry QFILE_HASH_SETOP_ENTRY;
+struct qfile_hash_setop_entry
+{
+  QFILE_HASH_SETOP *setop;
+  QFILE_TUPLE tuple;
+  INT64 count;			/* occurrences in the build side not matched yet */
+  unsigned int hash;
+  bool emitted;			/* already added to the result */
+};
+
 /* query result(list file) cache related things */
 typedef struct qfile_list_cache QFILE_LIST_CACHE;
 struct qfile_list_cache
@@ -243,6 +280,23 @@ static void qfile_close_and_free_list_file (THREAD_ENTRY * thread_p, QFILE_LIST_
 static QFILE_LIST_ID *qfile_union_list (THREAD_ENTRY * thread_p, QFILE_LIST_ID * list_id1, QFILE_LIST_ID * list_id2,
 					int flag);
 
+static int qfile_hash_tuple (QFILE_TUPLE tuple, QFILE_TUPLE_VALUE_TYPE_LIST * types, unsigned int *hash_p);
+static unsigned int qfile_hash_setop_entry_hash (const void *key, unsigned int ht_size);
+static int qfile_hash_setop_entry_equal (const void *key1, const void *key2);
+static int qfile_hash_setop_free_entry (const void *key, void *data, void *args);
+static UINT64 qfile_hash_setop_estimate_size (QFILE_HASH_SETOP * setop, QFILE_LIST_ID * lhs_file_p,
+					      QFILE_LIST_ID * rhs_file_p);
+static QFILE_HASH_SETOP_ENTRY *qfile_hash_setop_add_entry (THREAD_ENTRY * thread_p, QFILE_HASH_SETOP * setop,
+							   QFILE_TUPLE tuple, unsigned int hash);
+static int qfile_hash_setop_build (THREAD_ENTRY * thread_p, QFILE_HASH_SETOP * setop, QFILE_LIST_ID * list_id_p);
+static int qfile_hash_setop_probe (THREAD_ENTRY * thread_p, QFILE_HASH_SETOP * setop, QFILE_LIST_ID * list_id_p);
+static int qfile_hash_setop_in_memory (THREAD_ENTRY * thread_p, QFILE_HASH_SETOP * setop, QFILE_LIST_ID * lhs_file_p,
+				       QFILE_LIST_ID * rhs_file_p);
+static int qfile_hash_setop_partition (THREAD_ENTRY * thread_p, QFILE_HASH_SETOP * setop, QFILE_LIST_ID * list_id_p,
+				       QFILE_LIST_ID ** parts);
+static int qfile_hash_setop_combine_partition (THREAD_ENTRY * thread_p, QFILE_HASH_SETOP * setop,
+					       QFILE_LIST_ID * lhs_file_p, QFILE_LIST_ID * rhs_file_p);
+
 static SORT_STATUS qfile_get_next_sort_item (THREAD_ENTRY * thread_p, RECDES * recdes, void *arg);
 static int qfile_put_next_sort_item (THREAD_ENTRY * thread_p, const RECDES * recdes, void *arg);
 static SORT_INFO *qfile_initialize_sort_info (SORT_INFO * info, QFILE_LIST_ID * listid, SORT_LIST * sort_list);
@@ -3052,6 +3106,629 @@ error:
   return NULL;
 }
 
+/*
+ * qfile_is_hashable_type_list () - can the tuples of the operands be matched through a hash of their values?
+ *   return: true if every column has the same domain in both operands and a type whose hash agrees with the way
+ *	     qfile_compare_tuple_values () compares it
+ *   lhs_file(in): left operand
+ *   rhs_file(in): right operand, or NULL
+ */
+bool
+qfile_is_hashable_type_list (QFILE_LIST_ID * lhs_file_p, QFILE_LIST_ID * rhs_file_p)
+{
+  QFILE_TUPLE_VALUE_TYPE_LIST *types = &lhs_file_p->type_list;
+  int i;
+
+  if (types->type_cnt <= 0)
+    {
+      return false;
+    }
+
+  if (rhs_file_p != NULL && rhs_file_p->type_list.type_cnt != types->type_cnt)
+    {
+      return false;
+    }
+
+  for (i = 0; i < types->type_cnt; i++)
+    {
+      if (rhs_file_p != NULL && rhs_file_p->type_list.domp[i] != types->domp[i])
+	{
+	  return false;
+	}
+
+      switch (TP_DOMAIN_TYPE (types->domp[i]))
+	{
+	case DB_TYPE_NULL:
+	case DB_TYPE_SHORT:
+	case DB_TYPE_INTEGER:
+	case DB_TYPE_BIGINT:
+	case DB_TYPE_DATE:
+	case DB_TYPE_TIME:
+	case DB_TYPE_TIMESTAMP:
+	case DB_TYPE_TIMESTAMPLTZ:
+	case DB_TYPE_DATETIME:
+	case DB_TYPE_DATETIMELTZ:
+	case DB_TYPE_OID:
+	case DB_TYPE_CHAR:
+	case DB_TYPE_VARCHAR:
+	case DB_TYPE_NCHAR:
+	case DB_TYPE_VARNCHAR:
+	case DB_TYPE_BIT:
+	case DB_TYPE_VARBIT:
+	  break;
+
+	default:
+	  /* e.g. -0.0 and 0.0 compare equal but hash differently; collections hash their disk image */
+	  return false;
+	}
+    }
+
+  return true;
+}
+
+/*
+ * qfile_hash_tuple () - hash all the values of a tuple
+ *   return: NO_ERROR or error code
+ *   tuple(in): tuple
+ *   types(in): types of the tuple values
+ *   hash_p(out): hash value
+ *
+ * Note: values that compare equal get the same hash value; NULL values are all equal, like in
+ *       qfile_compare_tuple_values ().
+ */
+static int
+qfile_hash_tuple (QFILE_TUPLE tuple, QFILE_TUPLE_VALUE_TYPE_LIST * types, unsigned int *hash_p)
+{
+  OR_BUF buf;
+  DB_VALUE dbval;
+  TP_DOMAIN *domain_p;
+  char *tuple_p;
+  unsigned int hash = 0;
+  int i, length;
+
+  tuple_p = (char *) tuple + QFILE_TUPLE_LENGTH_SIZE;
+
+  for (i = 0; i < types->type_cnt; i++)
+    {
+      domain_p = types->domp[i];
+      length = QFILE_GET_TUPLE_VALUE_LENGTH (tuple_p);
+
+      /* rotate, so that the same values in swapped columns do not hash the same */
+      hash = (hash << 5) | (hash >> 27);
+
+      /* zero length means NULL */
+      if (length != 0)
+	{
+	  or_init (&buf, tuple_p + QFILE_TUPLE_VALUE_HEADER_SIZE, length);
+	  if (domain_p->type->data_readval (&buf, &dbval, domain_p, -1, false, NULL, 0) != NO_ERROR)
+	    {
+	      return ER_FAILED;
+	    }
+
+	  hash ^= mht_get_hash_number (QFILE_HASH_SETOP_HASH_RANGE, &dbval);
+	  pr_clear_value (&dbval);
+	}
+
+      tuple_p += QFILE_TUPLE_VALUE_HEADER_SIZE + length;
+    }
+
+  *hash_p = hash;
+  return NO_ERROR;
+}
+
+/*
+ * qfile_hash_setop_entry_hash () - hash function of the set operation hash table
+ *   return: hash value
+ *   key(in): QFILE_HASH_SETOP_ENTRY
+ *   ht_size(in): hash table size
+ */
+static unsigned int
+qfile_hash_setop_entry_hash (const void *key, unsigned int ht_size)
+{
+  const QFILE_HASH_SETOP_ENTRY *entry_p = (const QFILE_HASH_SETOP_ENTRY *) key;
+
+  /* the remainder was used to choose the partition and is the same for all the tuples of the table */
+  return (entry_p->hash / entry_p->setop->n_partitions) % ht_size;
+}
+
+/*
+ * qfile_hash_setop_entry_equal () - compare function of the set operation hash table
+ *   return: true if the tuples are equal
+ *   key1(in): QFILE_HASH_SETOP_ENTRY
+ *   key2(in): QFILE_HASH_SETOP_ENTRY
+ */
+static int
+qfile_hash_setop_entry_equal (const void *key1, const void *key2)
+{
+  const QFILE_HASH_SETOP_ENTRY *entry1_p = (const QFILE_HASH_SETOP_ENTRY *) key1;
+  const QFILE_HASH_SETOP_ENTRY *entry2_p = (const QFILE_HASH_SETOP_ENTRY *) key2;
+  int cmp;
+
+  if (entry1_p->hash != entry2_p->hash)
+    {
+      return false;
+    }
+
+  if (qfile_compare_tuple_helper (entry1_p->tuple, entry2_p->tuple, entry1_p->setop->types, &cmp) != NO_ERROR)
+    {
+      return false;
+    }
+
+  return cmp == 0;
+}
+
+/*
+ * qfile_hash_setop_free_entry () - free a set operation hash table entry
+ *   return: NO_ERROR
+ *   key(in): QFILE_HASH_SETOP_ENTRY
+ *   data(in): QFILE_HASH_SETOP_ENTRY
+ *   args(in): not used
+ */
+static int
+qfile_hash_setop_free_entry (const void *key, void *data, void *args)
+{
+  db_private_free (NULL, data);
+  return NO_ERROR;
+}
+
+/*
+ * qfile_hash_setop_estimate_size () - estimate the memory the hash table needs for the given operands
+ *   return: size in bytes
+ *   setop(in): set operation
+ *   lhs_file(in): left operand
+ *   rhs_file(in): right operand, or NULL
+ */
+static UINT64
+qfile_hash_setop_estimate_size (QFILE_HASH_SETOP * setop, QFILE_LIST_ID * lhs_file_p, QFILE_LIST_ID * rhs_file_p)
+{
+  UINT64 entry_overhead = sizeof (QFILE_HASH_SETOP_ENTRY) + sizeof (HENTRY);
+  UINT64 size = 0;
+
+  if (rhs_file_p != NULL)
+    {
+      size += (UINT64) rhs_file_p->page_cnt * DB_PAGESIZE + (UINT64) rhs_file_p->tuple_cnt * entry_overhead;
+    }
+
+  if (setop->type == QFILE_HASH_SETOP_UNION || setop->type == QFILE_HASH_SETOP_DIFFERENCE)
+    {
+      /* the distinct tuples of the left operand are kept too */
+      size += (UINT64) lhs_file_p->page_cnt * DB_PAGESIZE + (UINT64) lhs_file_p->tuple_cnt * entry_overhead;
+    }
+
+  return size;
+}
+
+/*
+ * qfile_hash_setop_add_entry () - add a copy of the tuple to the set operation hash table
+ *   return: new entry, or NULL on error
+ *   setop(in): set operation
+ *   tuple(in): tuple
+ *   hash(in): hash value of the tuple
+ */
+static QFILE_HASH_SETOP_ENTRY *
+qfile_hash_setop_add_entry (THREAD_ENTRY * thread_p, QFILE_HASH_SETOP * setop, QFILE_TUPLE tuple, unsigned int hash)
+{
+  QFILE_HASH_SETOP_ENTRY *entry_p;
+  int tuple_length = QFILE_GET_TUPLE_LENGTH (tuple);
+
+  entry_p = (QFILE_HASH_SETOP_ENTRY *) db_private_alloc (thread_p, sizeof (QFILE_HASH_SETOP_ENTRY) + tuple_length);
+  if (entry_p == NULL)
+    {
+      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_OUT_OF_VIRTUAL_MEMORY, 1,
+	      sizeof (QFILE_HASH_SETOP_ENTRY) + tuple_length);
+      return NULL;
+    }
+
+  entry_p->setop = setop;
+  entry_p->tuple = (QFILE_TUPLE) (entry_p + 1);
+  memcpy (entry_p->tuple, tuple, tuple_length);
+  entry_p->count = 0;
+  entry_p->hash = hash;
+  entry_p->emitted = false;
+
+  if (mht_put_new (setop->ht, entry_p, entry_p) == NULL)
+    {
+      db_private_free_and_init (thread_p, entry_p);
+      return NULL;
+    }
+
+  return entry_p;
+}
+
+/*
+ * qfile_hash_setop_build () - count the tuples of the right operand in the hash table
+ *   return: NO_ERROR or error code
+ *   setop(in): set operation
+ *   list_id(in): right operand
+ */
+static int
+qfile_hash_setop_build (THREAD_ENTRY * thread_p, QFILE_HASH_SETOP * setop, QFILE_LIST_ID * list_id_p)
+{
+  QFILE_LIST_SCAN_ID scan_id;
+  QFILE_TUPLE_RECORD tuple_record = { NULL, 0 };
+  QFILE_HASH_SETOP_ENTRY key, *entry_p;
+  SCAN_CODE qp_scan;
+
+  if (qfile_open_list_scan (list_id_p, &scan_id) != NO_ERROR)
+    {
+      return ER_FAILED;
+    }
+
+  key.setop = setop;
+  while ((qp_scan = qfile_scan_list_next (thread_p, &scan_id, &tuple_record, PEEK)) == S_SUCCESS)
+    {
+      key.tuple = tuple_record.tpl;
+      if (qfile_hash_tuple (key.tuple, setop->types, &key.hash) != NO_ERROR)
+	{
+	  qp_scan = S_ERROR;
+	  break;
+	}
+
+      entry_p = (QFILE_HASH_SETOP_ENTRY *) mht_get (setop->ht, &key);
+      if (entry_p == NULL)
+	{
+	  entry_p = qfile_hash_setop_add_entry (thread_p, setop, key.tuple, key.hash);
+	  if (entry_p == NULL)
+	    {
+	      qp_scan = S_ERROR;
+	      break;
+	    }
+	}
+      entry_p->count++;
+    }
+
+  qfile_close_scan (thread_p, &scan_id);
+
+  return (qp_scan == S_END) ? NO_ERROR : ER_FAILED;
+}
+
+/*
+ * qfile_hash_setop_probe () - match the tuples of an operand against the hash table and add the result tuples
+ *   return: NO_ERROR or error code
+ *   setop(in): set operation
+ *   list_id(in): left operand, or the right one of a UNION
+ */
+static int
+qfile_hash_setop_probe (THREAD_ENTRY * thread_p, QFILE_HASH_SETOP * setop, QFILE_LIST_ID * list_id_p)
+{
+  QFILE_LIST_SCAN_ID scan_id;
+  QFILE_TUPLE_RECORD tuple_record = { NULL, 0 };
+  QFILE_HASH_SETOP_ENTRY key, *entry_p;
+  SCAN_CODE qp_scan;
+  bool emit;
+
+  if (qfile_open_list_scan (list_id_p, &scan_id) != NO_ERROR)
+    {
+      return ER_FAILED;
+    }
+
+  key.setop = setop;
+  while ((qp_scan = qfile_scan_list_next (thread_p, &scan_id, &tuple_record, PEEK)) == S_SUCCESS)
+    {
+      key.tuple = tuple_record.tpl;
+      if (qfile_hash_tuple (key.tuple, setop->types, &key.hash) != NO_ERROR)
+	{
+	  qp_scan = S_ERROR;
+	  break;
+	}
+
+      entry_p = (QFILE_HASH_SETOP_ENTRY *) mht_get (setop->ht, &key);
+
+      switch (setop->type)
+	{
+	case QFILE_HASH_SETOP_UNION:
+	case QFILE_HASH_SETOP_DIFFERENCE:
+	  /* a tuple already in the table is either a duplicate or, for DIFFERENCE, one of the right operand */
+	  emit = (entry_p == NULL);
+	  if (emit && qfile_hash_setop_add_entry (thread_p, setop, key.tuple, key.hash) == NULL)
+	    {
+	      qp_scan = S_ERROR;
+	    }
+	  break;
+
+	case QFILE_HASH_SETOP_INTERSECT:
+	  emit = (entry_p != NULL && !entry_p->emitted);
+	  if (emit)
+	    {
+	      entry_p->emitted = true;
+	    }
+	  break;
+
+	case QFILE_HASH_SETOP_INTERSECT_ALL:
+	  emit = (entry_p != NULL && entry_p->count > 0);
+	  if (emit)
+	    {
+	      entry_p->count--;
+	    }
+	  break;
+
+	case QFILE_HASH_SETOP_DIFFERENCE_ALL:
+	  emit = (entry_p == NULL || entry_p->count == 0);
+	  if (!emit)
+	    {
+	      entry_p->count--;
+	    }
+	  break;
+
+	default:
+	  assert (false);
+	  emit = false;
+	  qp_scan = S_ERROR;
+	  break;
+	}
+
+      if (qp_scan == S_ERROR)
+	{
+	  break;
+	}
+
+      if (emit && qfile_add_tuple_to_list (thread_p, setop->dest_list_id, key.tuple) != NO_ERROR)
+	{
+	  qp_scan = S_ERROR;
+	  break;
+	}
+    }
+
+  qfile_close_scan (thread_p, &scan_id);
+
+  return (qp_scan == S_END) ? NO_ERROR : ER_FAILED;
+}
+
+/*
+ * qfile_hash_setop_in_memory () - combine two operands that fit in the memory hash table
+ *   return: NO_ERROR or error code
+ *   setop(in): set operation
+ *   lhs_file(in): left operand
+ *   rhs_file(in): right operand, or NULL
+ */
+static int
+qfile_hash_setop_in_memory (THREAD_ENTRY * thread_p, QFILE_HASH_SETOP * setop, QFILE_LIST_ID * lhs_file_p,
+			    QFILE_LIST_ID * rhs_file_p)
+{
+  int error = NO_ERROR;
+
+  setop->ht = mht_create ("hash set operation", QFILE_HASH_SETOP_HT_SIZE, qfile_hash_setop_entry_hash,
+			  qfile_hash_setop_entry_equal);
+  if (setop->ht == NULL)
+    {
+      return ER_FAILED;
+    }
+
+  if (setop->type == QFILE_HASH_SETOP_UNION)
+    {
+      error = qfile_hash_setop_probe (thread_p, setop, lhs_file_p);
+      if (error == NO_ERROR && rhs_file_p != NULL)
+	{
+	  error = qfile_hash_setop_probe (thread_p, setop, rhs_file_p);
+	}
+    }
+  else
+    {
+      if (rhs_file_p != NULL)
+	{
+	  error = qfile_hash_setop_build (thread_p, setop, rhs_file_p);
+	}
+      if (error == NO_ERROR)
+	{
+	  error = qfile_hash_setop_probe (thread_p, setop, lhs_file_p);
+	}
+    }
+
+  (void) mht_map (setop->ht, qfile_hash_setop_free_entry, NULL);
+  mht_destroy (setop->ht);
+  setop->ht = NULL;
+
+  return error;
+}
+
+/*
+ * qfile_hash_setop_partition () - split an operand into partitions by the hash of its tuples
+ *   return: NO_ERROR or error code
+ *   setop(in): set operation
+ *   list_id(in): operand
+ *   parts(out): setop->n_partitions list files; the caller destroys them, also on error
+ */
+static int
+qfile_hash_setop_partition (THREAD_ENTRY * thread_p, QFILE_HASH_SETOP * setop, QFILE_LIST_ID * list_id_p,
+			    QFILE_LIST_ID ** parts)
+{
+  QFILE_LIST_SCAN_ID scan_id;
+  QFILE_TUPLE_RECORD tuple_record = { NULL, 0 };
+  SCAN_CODE qp_scan;
+  unsigned int hash;
+  int i;
+
+  for (i = 0; i < setop->n_partitions; i++)
+    {
+      parts[i] = qfile_open_list (thread_p, setop->types, NULL, list_id_p->query_id, QFILE_FLAG_ALL, NULL);
+      if (parts[i] == NULL)
+	{
+	  return ER_FAILED;
+	}
+    }
+
+  if (qfile_open_list_scan (list_id_p, &scan_id) != NO_ERROR)
+    {
+      return ER_FAILED;
+    }
+
+  while ((qp_scan = qfile_scan_list_next (thread_p, &scan_id, &tuple_record, PEEK)) == S_SUCCESS)
+    {
+      if (qfile_hash_tuple (tuple_record.tpl, setop->types, &hash) != NO_ERROR
+	  || qfile_add_tuple_to_list (thread_p, parts[hash % setop->n_partitions], tuple_record.tpl) != NO_ERROR)
+	{
+	  qp_scan = S_ERROR;
+	  break;
+	}
+    }
+
+  qfile_close_scan (thread_p, &scan_id);
+
+  for (i = 0; i < setop->n_partitions; i++)
+    {
+      qfile_close_list (thread_p, parts[i]);
+    }
+
+  return (qp_scan == S_END) ? NO_ERROR : ER_FAILED;
+}
+
+/*
+ * qfile_hash_setop_combine_partition () - combine one pair of partitions and add the result to the destination
+ *   return: NO_ERROR or error code
+ *   setop(in): set operation
+ *   lhs_file(in): partition of the left operand
+ *   rhs_file(in): partition of the right operand, or NULL
+ */
+static int
+qfile_hash_setop_combine_partition (THREAD_ENTRY * thread_p, QFILE_HASH_SETOP * setop, QFILE_LIST_ID * lhs_file_p,
+				    QFILE_LIST_ID * rhs_file_p)
+{
+  QFILE_LIST_ID *list_id_p;
+  int error;
+
+  if (qfile_hash_setop_estimate_size (setop, lhs_file_p, rhs_file_p) <= setop->mem_limit)
+    {
+      return qfile_hash_setop_in_memory (thread_p, setop, lhs_file_p, rhs_file_p);
+    }
+
+  /* the values are skewed and this partition still does not fit; sort it */
+  list_id_p = qfile_combine_two_list (thread_p, lhs_file_p, rhs_file_p, setop->flag & ~QFILE_FLAG_RESULT_FILE);
+  if (list_id_p == NULL)
+    {
+      return ER_FAILED;
+    }
+
+  error = qfile_copy_tuple (thread_p, setop->dest_list_id, list_id_p);
+
+  qfile_close_list (thread_p, list_id_p);
+  qfile_destroy_list (thread_p, list_id_p);
+  qfile_free_list_id (list_id_p);
+
+  return error;
+}
+
+/*
+ * qfile_combine_two_list_by_hash () - qfile_combine_two_list () using a memory hash table instead of sorting
+ *   return: QFILE_LIST_ID *, or NULL
+ *   lhs_file(in): pointer to a QFILE_LIST_ID for one of the input files
+ *   rhs_file(in): pointer to a QFILE_LIST_ID for the other input file, or NULL
+ *   flag(in): same as for qfile_combine_two_list ()
+ *   mem_limit(in): memory allowed for the hash table
+ *
+ * Note: Unlike qfile_combine_two_list (), the result is not sorted, so the caller must not need its order.
+ *       When the operands do not fit in mem_limit they are first split into partitions by the hash of their tuples.
+ *       Equal tuples always land in the same pair of partitions, so each pair is combined on its own; a pair that
+ *       still does not fit is combined by sorting. Operands with columns that cannot be hashed are combined by
+ *       qfile_combine_two_list ().
+ */
+QFILE_LIST_ID *
+qfile_combine_two_list_by_hash (THREAD_ENTRY * thread_p, QFILE_LIST_ID * lhs_file_p, QFILE_LIST_ID * rhs_file_p,
+				int flag, UINT64 mem_limit)
+{
+  QFILE_HASH_SETOP setop;
+  QFILE_LIST_ID **parts = NULL;
+  UINT64 size;
+  int i, error = NO_ERROR;
+
+  if (QFILE_IS_FLAG_SET_BOTH (flag, QFILE_FLAG_UNION, QFILE_FLAG_ALL))
+    {
+      return qfile_union_list (thread_p, lhs_file_p, rhs_file_p, flag);
+    }
+
+  if (mem_limit == 0 || !qfile_is_hashable_type_list (lhs_file_p, rhs_file_p))
+    {
+      return qfile_combine_two_list (thread_p, lhs_file_p, rhs_file_p, flag);
+    }
+
+  memset (&setop, 0, sizeof (setop));
+  if (QFILE_IS_FLAG_SET (flag, QFILE_FLAG_INTERSECT))
+    {
+      setop.type = QFILE_IS_FLAG_SET (flag, QFILE_FLAG_DISTINCT) ? QFILE_HASH_SETOP_INTERSECT
+	: QFILE_HASH_SETOP_INTERSECT_ALL;
+    }
+  else if (QFILE_IS_FLAG_SET (flag, QFILE_FLAG_DIFFERENCE))
+    {
+      setop.type = QFILE_IS_FLAG_SET (flag, QFILE_FLAG_DISTINCT) ? QFILE_HASH_SETOP_DIFFERENCE
+	: QFILE_HASH_SETOP_DIFFERENCE_ALL;
+    }
+  else
+    {
+      setop.type = QFILE_HASH_SETOP_UNION;
+    }
+  setop.flag = flag;
+  setop.mem_limit = mem_limit;
+  setop.n_partitions = 1;
+
+  /* the result is not sorted; QFILE_FLAG_DISTINCT would make qfile_open_list () claim it is */
+  setop.dest_list_id =
+    qfile_open_list (thread_p, &lhs_file_p->type_list, NULL, lhs_file_p->query_id, flag & ~QFILE_FLAG_DISTINCT, NULL);
+  if (setop.dest_list_id == NULL)
+    {
+      return NULL;
+    }
+
+  if (rhs_file_p != NULL && qfile_unify_types (setop.dest_list_id, rhs_file_p) != NO_ERROR)
+    {
+      goto error;
+    }
+  setop.types = &setop.dest_list_id->type_list;
+
+  size = qfile_hash_setop_estimate_size (&setop, lhs_file_p, rhs_file_p);
+  if (size <= mem_limit)
+    {
+      error = qfile_hash_setop_in_memory (thread_p, &setop, lhs_file_p, rhs_file_p);
+    }
+  else
+    {
+      setop.n_partitions = (int) MIN ((size / mem_limit + 1) * 2, QFILE_HASH_SETOP_MAX_PARTITIONS);
+
+      /* partitions of the left operand followed by the ones of the right operand */
+      parts = (QFILE_LIST_ID **) db_private_alloc (thread_p, 2 * setop.n_partitions * sizeof (QFILE_LIST_ID *));
+      if (parts == NULL)
+	{
+	  er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_OUT_OF_VIRTUAL_MEMORY, 1,
+		  2 * setop.n_partitions * sizeof (QFILE_LIST_ID *));
+	  goto error;
+	}
+      memset (parts, 0, 2 * setop.n_partitions * sizeof (QFILE_LIST_ID *));
+
+      error = qfile_hash_setop_partition (thread_p, &setop, lhs_file_p, parts);
+      if (error == NO_ERROR && rhs_file_p != NULL)
+	{
+	  error = qfile_hash_setop_partition (thread_p, &setop, rhs_file_p, parts + setop.n_partitions);
+	}
+
+      for (i = 0; error == NO_ERROR && i < setop.n_partitions; i++)
+	{
+	  error = qfile_hash_setop_combine_partition (thread_p, &setop, parts[i],
+						      (rhs_file_p != NULL) ? parts[setop.n_partitions + i] : NULL);
+	}
+
+      for (i = 0; i < 2 * setop.n_partitions; i++)
+	{
+	  if (parts[i] != NULL)
+	    {
+	      qfile_close_list (thread_p, parts[i]);
+	      qfile_destroy_list (thread_p, parts[i]);
+	      qfile_free_list_id (parts[i]);
+	    }
+	}
+      db_private_free_and_init (thread_p, parts);
+    }
+
+  if (error != NO_ERROR)
+    {
+      goto error;
+    }
+
+  qfile_close_list (thread_p, setop.dest_list_id);
+  return setop.dest_list_id;
+
+error:
+  qfile_close_and_free_list_file (thread_p, setop.dest_list_id);
+  return NULL;
+}
+
 /*
  * qfile_reallocate_tuple () - reallocates a tuple to the desired size.
  *              If it cant, it sets an error and returns 0
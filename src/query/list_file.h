@@ -189,6 +189,9 @@ extern int qfile_fast_val_tuple_to_list (THREAD_ENTRY * thread_p, QFILE_LIST_ID
 extern int qfile_add_item_to_list (THREAD_ENTRY * thread_p, char *item, int item_size, QFILE_LIST_ID * list_id);
 extern QFILE_LIST_ID *qfile_combine_two_list (THREAD_ENTRY * thread_p, QFILE_LIST_ID * lhs_file,
 					      QFILE_LIST_ID * rhs_file, int flag);
+extern QFILE_LIST_ID *qfile_combine_two_list_by_hash (THREAD_ENTRY * thread_p, QFILE_LIST_ID * lhs_file,
+						      QFILE_LIST_ID * rhs_file, int flag, UINT64 mem_limit);
+extern bool qfile_is_hashable_type_list (QFILE_LIST_ID * lhs_file, QFILE_LIST_ID * rhs_file);
 extern int qfile_copy_tuple_descr_to_tuple (THREAD_ENTRY * thread_p, QFILE_TUPLE_DESCRIPTOR * tpl_descr,
 					    QFILE_TUPLE_RECORD * tplrec);
 extern int qfile_reallocate_tuple (QFILE_TUPLE_RECORD * tplrec, int tpl_size);
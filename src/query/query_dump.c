@@ -32,6 +32,7 @@
 #include "dbtype.h"
 #if defined (SERVER_MODE)
 #include "thread_manager.hpp"	// for thread_get_thread_entry_info
+#include "subquery_cache.h"
 #endif // SERVER_MODE
 #include "xasl.h"
 #include "xasl_aggregate.hpp"
@@ -2921,6 +2922,16 @@ qdump_print_stats_json (xasl_node * xasl_p, json_t * parent)
       json_object_set_new (proc, "time", json_integer (TO_MSEC (xasl_p->xasl_stats.elapsed_time)));
       json_object_set_new (proc, "fetch", json_integer (xasl_p->xasl_stats.fetches));
       json_object_set_new (proc, "ioread", json_integer (xasl_p->xasl_stats.ioreads));
+      if (xasl_p->sq_cache != NULL)
+	{
+	  json_t *sq_cache = json_object ();
+
+	  json_object_set_new (sq_cache, "hit", json_integer (xasl_p->sq_cache->n_hits));
+	  json_object_set_new (sq_cache, "miss", json_integer (xasl_p->sq_cache->n_misses));
+	  json_object_set_new (sq_cache, "size", json_integer (xasl_p->sq_cache->size));
+	  json_object_set_new (sq_cache, "disabled", xasl_p->sq_cache->enabled ? json_false () : json_true ());
+	  json_object_set_new (proc, "SUBQUERY_CACHE", sq_cache);
+	}
       break;
 
     case UNION_PROC:
@@ -3212,6 +3223,12 @@ qdump_print_stats_text (FILE * fp, xasl_node * xasl_p, int indent)
 	       TO_MSEC (xasl_p->xasl_stats.elapsed_time), (long long int) xasl_p->xasl_stats.fetches,
 	       (long long int) xasl_p->xasl_stats.ioreads);
       indent += 2;
+      if (xasl_p->sq_cache != NULL)
+	{
+	  fprintf (fp, "%*cSUBQUERY_CACHE (hit: %lld, miss: %lld, size: %lld%s)\n", indent, ' ',
+		   (long long int) xasl_p->sq_cache->n_hits, (long long int) xasl_p->sq_cache->n_misses,
+		   (long long int) xasl_p->sq_cache->size, xasl_p->sq_cache->enabled ? "" : ", disabled");
+	}
       break;
 
     case UNION_PROC:
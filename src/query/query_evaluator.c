@@ -26,6 +26,8 @@
 
 #include <stdio.h>
 #include <string.h>
+#include <float.h>
+#include <chrono>
 
 #include "system_parameter.h"
 #include "error_manager.h"
@@ -45,6 +47,32 @@
 
 #define UNKNOWN_CARD   -2	/* Unknown cardinality of a set member */
 
+#define PRED_REORDER_MAX_TERMS		32	/* longer AND chains are left as generated */
+#define PRED_REORDER_MIN_EVALS		4096	/* evaluations in one execution before the first sample */
+#define PRED_REORDER_SAMPLE_SIZE	512	/* evaluations timed before reordering */
+#define PRED_REORDER_INTERVAL		65536	/* evaluations between two samples */
+
+/* sampled cost and selectivity of one conjunct of an AND chain */
+typedef struct pred_reorder_term PRED_REORDER_TERM;
+struct pred_reorder_term
+{
+  PRED_EXPR *term;
+  UINT64 n_evals;		/* times the conjunct was reached */
+  UINT64 n_passed;		/* times it did not stop the chain (V_TRUE or V_UNKNOWN) */
+  UINT64 cost;			/* nanoseconds spent evaluating it */
+  int orig_pos;			/* position when the statistics were allocated */
+  bool is_safe;			/* can be evaluated ahead of any other conjunct */
+};
+
+/* run-time statistics attached to the head of an AND chain; freed when the XASL is cleared */
+typedef struct pred_reorder_info PRED_REORDER_INFO;
+struct pred_reorder_info
+{
+  int n_terms;			/* 0 if the chain is never reordered */
+  int n_evals;			/* evaluations since the current sample started */
+  PRED_REORDER_TERM terms[1];	/* conjuncts in their current order */
+};
+
 static DB_LOGICAL eval_negative (DB_LOGICAL res);
 static DB_LOGICAL eval_logical_result (DB_LOGICAL res1, DB_LOGICAL res2);
 static DB_LOGICAL eval_value_rel_cmp (THREAD_ENTRY * thread_p, DB_VALUE * dbval1, DB_VALUE * dbval2,
@@ -83,6 +111,15 @@ static DB_LOGICAL eval_sort_list_to_sort_list (THREAD_ENTRY * thread_p, QFILE_LI
 					       QFILE_LIST_ID * list_id2, REL_OP rel_operator);
 static DB_LOGICAL eval_set_list_cmp (THREAD_ENTRY * thread_p, const COMP_EVAL_TERM * et_comp, val_descr * vd,
 				     DB_VALUE * dbval1, DB_VALUE * dbval2);
+static bool eval_pred_reorder_is_plain_regu (const REGU_VARIABLE * regu);
+static bool eval_pred_reorder_same_domain (const REGU_VARIABLE * regu1, const REGU_VARIABLE * regu2);
+static bool eval_pred_reorder_is_safe (const PRED_EXPR * pr);
+static PRED_REORDER_INFO *eval_pred_reorder_init (const PRED_EXPR * pr);
+static bool eval_pred_reorder_is_sampling (const PRED_EXPR * pr);
+static double eval_pred_reorder_rank (const PRED_REORDER_TERM * term);
+static void eval_pred_reorder_terms (const PRED_EXPR * pr, PRED_REORDER_INFO * info);
+static DB_LOGICAL eval_pred_and_sample (THREAD_ENTRY * thread_p, const PRED_EXPR * pr, val_descr * vd,
+					OID * obj_oid);
 
 /*
  * eval_negative () - negate the result
@@ -1641,6 +1678,401 @@ eval_set_list_cmp (THREAD_ENTRY * thread_p, const COMP_EVAL_TERM * et_comp, val_
   return V_UNKNOWN;
 }
 
+/*
+ * Adaptive ordering of AND conjuncts
+ *
+ * The conjuncts of a right-linear AND chain are evaluated in the order generated by the optimizer, which has no
+ * notion of how expensive or how selective each of them is at run time. Once a chain has been evaluated
+ * PRED_REORDER_MIN_EVALS times in one execution, the next PRED_REORDER_SAMPLE_SIZE evaluations are timed per
+ * conjunct; then the chain is rewritten so that conjuncts with the smallest
+ * cost / (1 - pass rate) are evaluated first. Sampling restarts every PRED_REORDER_INTERVAL evaluations to follow
+ * changes in the data. Executions that evaluate a chain fewer times, like OLTP point queries, only pay for a counter.
+ *
+ * Only conjuncts that can neither fail nor have side effects are moved freely. Any other conjunct keeps all the
+ * conjuncts that preceded it in front of it, so it is never evaluated for a row it would not have been evaluated
+ * for before.
+ */
+
+/*
+ * eval_pred_reorder_is_plain_regu () - can fetching the regu variable neither fail nor execute a subquery?
+ *   return: true if plain value access
+ *   regu(in): regu variable
+ */
+static bool
+eval_pred_reorder_is_plain_regu (const REGU_VARIABLE * regu)
+{
+  if (regu == NULL || regu->xasl != NULL)
+    {
+      return false;
+    }
+
+  switch (regu->type)
+    {
+    case TYPE_DBVAL:
+    case TYPE_CONSTANT:
+    case TYPE_ATTR_ID:
+    case TYPE_CLASS_ATTR_ID:
+    case TYPE_SHARED_ATTR_ID:
+    case TYPE_POSITION:
+    case TYPE_POS_VALUE:
+      return true;
+
+    default:
+      return false;
+    }
+}
+
+/*
+ * eval_pred_reorder_same_domain () - are two plain regu variables compared without any coercion?
+ *   return: true if both have the same type (and collation)
+ *   regu1(in): regu variable
+ *   regu2(in): regu variable
+ */
+static bool
+eval_pred_reorder_same_domain (const REGU_VARIABLE * regu1, const REGU_VARIABLE * regu2)
+{
+  DB_TYPE type;
+
+  if (regu1->domain == NULL || regu2->domain == NULL)
+    {
+      return false;
+    }
+
+  type = TP_DOMAIN_TYPE (regu1->domain);
+  if (type != TP_DOMAIN_TYPE (regu2->domain) || type == DB_TYPE_VARIABLE)
+    {
+      return false;
+    }
+
+  if (TP_IS_CHAR_TYPE (type) && TP_DOMAIN_COLLATION (regu1->domain) != TP_DOMAIN_COLLATION (regu2->domain))
+    {
+      return false;
+    }
+
+  return true;
+}
+
+/*
+ * eval_pred_reorder_is_safe () - can the predicate be evaluated for any row without changing the outcome of the
+ *                                statement, other than by its result?
+ *   return: true if the predicate can be moved ahead of other conjuncts
+ *   pr(in): predicate expression
+ */
+static bool
+eval_pred_reorder_is_safe (const PRED_EXPR * pr)
+{
+  const COMP_EVAL_TERM *et_comp;
+  const LIKE_EVAL_TERM *et_like;
+
+  switch (pr->type)
+    {
+    case T_PRED:
+      return (eval_pred_reorder_is_safe (pr->pe.m_pred.lhs) && eval_pred_reorder_is_safe (pr->pe.m_pred.rhs));
+
+    case T_NOT_TERM:
+      return eval_pred_reorder_is_safe (pr->pe.m_not_term);
+
+    case T_EVAL_TERM:
+      switch (pr->pe.m_eval_term.et_type)
+	{
+	case T_COMP_EVAL_TERM:
+	  et_comp = &pr->pe.m_eval_term.et.et_comp;
+	  switch (et_comp->rel_op)
+	    {
+	    case R_NULL:
+	      return eval_pred_reorder_is_plain_regu (et_comp->lhs);
+
+	    case R_EQ:
+	    case R_NE:
+	    case R_GT:
+	    case R_GE:
+	    case R_LT:
+	    case R_LE:
+	    case R_NULLSAFE_EQ:
+	      return (eval_pred_reorder_is_plain_regu (et_comp->lhs) && eval_pred_reorder_is_plain_regu (et_comp->rhs)
+		      && eval_pred_reorder_same_domain (et_comp->lhs, et_comp->rhs));
+
+	    default:
+	      return false;
+	    }
+
+	case T_LIKE_EVAL_TERM:
+	  et_like = &pr->pe.m_eval_term.et.et_like;
+	  return (et_like->esc_char == NULL && eval_pred_reorder_is_plain_regu (et_like->src)
+		  && eval_pred_reorder_is_plain_regu (et_like->pattern)
+		  && eval_pred_reorder_same_domain (et_like->src, et_like->pattern)
+		  && TP_IS_CHAR_TYPE (TP_DOMAIN_TYPE (et_like->src->domain)));
+
+	default:
+	  /* set comparisons may coerce the elements and regular expressions may fail to compile */
+	  return false;
+	}
+
+    default:
+      return false;
+    }
+}
+
+/*
+ * eval_pred_reorder_init () - allocate the run-time statistics of an AND chain
+ *   return: statistics or NULL if out of memory
+ *   pr(in): head of the AND chain
+ *
+ * Note: n_terms is left zero when the chain is not worth or not possible to reorder.
+ */
+static PRED_REORDER_INFO *
+eval_pred_reorder_init (const PRED_EXPR * pr)
+{
+  PRED_REORDER_INFO *info;
+  const PRED_EXPR *t_pr;
+  int n_terms = 1, n_safe = 0, i;
+  bool can_reorder = true;
+
+  for (t_pr = pr; t_pr->type == T_PRED && t_pr->pe.m_pred.bool_op == B_AND; t_pr = t_pr->pe.m_pred.rhs)
+    {
+      n_terms++;
+    }
+  if (n_terms > PRED_REORDER_MAX_TERMS)
+    {
+      can_reorder = false;
+    }
+
+  info = (PRED_REORDER_INFO *) malloc (sizeof (PRED_REORDER_INFO) + (n_terms - 1) * sizeof (PRED_REORDER_TERM));
+  if (info == NULL)
+    {
+      /* not an error, the chain is evaluated as generated */
+      return NULL;
+    }
+  memset (info, 0, sizeof (PRED_REORDER_INFO) + (n_terms - 1) * sizeof (PRED_REORDER_TERM));
+
+  for (i = 0, t_pr = pr; t_pr->type == T_PRED && t_pr->pe.m_pred.bool_op == B_AND; t_pr = t_pr->pe.m_pred.rhs, i++)
+    {
+      info->terms[i].term = t_pr->pe.m_pred.lhs;
+      if (t_pr->pe.m_pred.lhs->type == T_PRED && t_pr->pe.m_pred.lhs->pe.m_pred.bool_op == B_AND)
+	{
+	  /* moving a nested chain to the tail would change the shape of this one */
+	  can_reorder = false;
+	}
+    }
+  info->terms[i].term = (PRED_EXPR *) t_pr;
+
+  for (i = 0; i < n_terms && can_reorder; i++)
+    {
+      info->terms[i].orig_pos = i;
+      info->terms[i].is_safe = eval_pred_reorder_is_safe (info->terms[i].term);
+      n_safe += info->terms[i].is_safe ? 1 : 0;
+    }
+
+  /* nothing can move unless at least one conjunct is safe */
+  info->n_terms = (can_reorder && n_safe > 0) ? n_terms : 0;
+
+  return info;
+}
+
+/*
+ * eval_pred_reorder_is_sampling () - should this evaluation of the AND chain be sampled?
+ *   return: true to evaluate with eval_pred_and_sample
+ *   pr(in): head of the AND chain
+ */
+static bool
+eval_pred_reorder_is_sampling (const PRED_EXPR * pr)
+{
+  PRED_REORDER_INFO *info = pr->pe.m_pred.reorder;
+  int i;
+
+  if (info == NULL)
+    {
+      if (pr->pe.m_pred.n_evals < PRED_REORDER_MIN_EVALS)
+	{
+	  pr->pe.m_pred.n_evals++;
+	  return false;
+	}
+      if (!prm_get_bool_value (PRM_ID_ADAPTIVE_PRED_REORDER))
+	{
+	  return false;
+	}
+
+      info = eval_pred_reorder_init (pr);
+      if (info == NULL)
+	{
+	  return false;
+	}
+      pr->pe.m_pred.reorder = info;
+    }
+
+  if (info->n_terms == 0)
+    {
+      return false;
+    }
+
+  if (info->n_evals < PRED_REORDER_SAMPLE_SIZE)
+    {
+      return true;
+    }
+
+  if (++info->n_evals < PRED_REORDER_INTERVAL)
+    {
+      return false;
+    }
+
+  /* start a new sample */
+  for (i = 0; i < info->n_terms; i++)
+    {
+      info->terms[i].n_evals = 0;
+      info->terms[i].n_passed = 0;
+      info->terms[i].cost = 0;
+    }
+  info->n_evals = 0;
+
+  return true;
+}
+
+/*
+ * eval_pred_reorder_rank () - expected cost of a conjunct per row it filters out
+ *   return: rank; smaller is evaluated first
+ *   term(in): sampled conjunct
+ */
+static double
+eval_pred_reorder_rank (const PRED_REORDER_TERM * term)
+{
+  if (term->n_evals == 0 || term->n_passed >= term->n_evals)
+    {
+      /* filters nothing, or was never reached */
+      return DBL_MAX;
+    }
+
+  return ((double) term->cost / term->n_evals) / (1.0 - (double) term->n_passed / term->n_evals);
+}
+
+/*
+ * eval_pred_reorder_terms () - rewrite the AND chain by the sampled statistics
+ *   return: void
+ *   pr(in): head of the AND chain
+ *   info(in/out): run-time statistics of the chain
+ *
+ * Note: conjuncts are picked greedily by rank. A conjunct that is not safe is not picked before all the conjuncts
+ *       that originally preceded it.
+ */
+static void
+eval_pred_reorder_terms (const PRED_EXPR * pr, PRED_REORDER_INFO * info)
+{
+  PRED_REORDER_TERM ordered[PRED_REORDER_MAX_TERMS];
+  double rank[PRED_REORDER_MAX_TERMS];
+  bool placed[PRED_REORDER_MAX_TERMS];
+  PRED_EXPR *node;
+  double best_rank;
+  int i, j, best, min_unplaced_pos;
+  bool changed = false;
+
+  for (i = 0; i < info->n_terms; i++)
+    {
+      rank[i] = eval_pred_reorder_rank (&info->terms[i]);
+      placed[i] = false;
+    }
+
+  for (i = 0; i < info->n_terms; i++)
+    {
+      min_unplaced_pos = info->n_terms;
+      for (j = 0; j < info->n_terms; j++)
+	{
+	  if (!placed[j] && info->terms[j].orig_pos < min_unplaced_pos)
+	    {
+	      min_unplaced_pos = info->terms[j].orig_pos;
+	    }
+	}
+
+      best = -1;
+      best_rank = DBL_MAX;
+      for (j = 0; j < info->n_terms; j++)
+	{
+	  if (placed[j] || (!info->terms[j].is_safe && info->terms[j].orig_pos != min_unplaced_pos))
+	    {
+	      continue;
+	    }
+	  /* ties keep the current order */
+	  if (best == -1 || rank[j] < best_rank)
+	    {
+	      best = j;
+	      best_rank = rank[j];
+	    }
+	}
+      assert (best != -1);
+
+      placed[best] = true;
+      ordered[i] = info->terms[best];
+      changed = changed || (best != i);
+    }
+
+  if (changed)
+    {
+      memcpy (info->terms, ordered, info->n_terms * sizeof (PRED_REORDER_TERM));
+
+      /* the chain nodes stay in place, only the conjuncts hanging from them are exchanged */
+      node = (PRED_EXPR *) pr;
+      for (i = 0; i < info->n_terms - 2; i++)
+	{
+	  node->pe.m_pred.lhs = info->terms[i].term;
+	  node = node->pe.m_pred.rhs;
+	}
+      node->pe.m_pred.lhs = info->terms[i].term;
+      node->pe.m_pred.rhs = info->terms[i + 1].term;
+    }
+}
+
+/*
+ * eval_pred_and_sample () - evaluate an AND chain and collect cost and selectivity of its conjuncts
+ *   return: DB_LOGICAL (V_TRUE, V_FALSE, V_UNKNOWN or V_ERROR)
+ *   pr(in): head of the AND chain
+ *   vd(in): Value descriptor for positional values (optional)
+ *   obj_oid(in): Object Identifier
+ *
+ * Note: the result and the short-circuit behavior are the same as for the B_AND case of eval_pred.
+ */
+static DB_LOGICAL
+eval_pred_and_sample (THREAD_ENTRY * thread_p, const PRED_EXPR * pr, val_descr * vd, OID * obj_oid)
+{
+  PRED_REORDER_INFO *info = pr->pe.m_pred.reorder;
+  PRED_REORDER_TERM *term;
+  DB_LOGICAL result = V_TRUE, term_result;
+  int i;
+
+  // *INDENT-OFF*
+  std::chrono::steady_clock::time_point start;
+  // *INDENT-ON*
+
+  for (i = 0; i < info->n_terms; i++)
+    {
+      term = &info->terms[i];
+
+      // *INDENT-OFF*
+      start = std::chrono::steady_clock::now ();
+      term_result = eval_pred (thread_p, term->term, vd, obj_oid);
+      term->cost += std::chrono::duration_cast<std::chrono::nanoseconds> (std::chrono::steady_clock::now () - start).count ();
+      // *INDENT-ON*
+
+      term->n_evals++;
+
+      if (term_result == V_FALSE || term_result == V_ERROR)
+	{
+	  result = term_result;
+	  break;
+	}
+
+      term->n_passed++;
+      if (term_result == V_UNKNOWN)
+	{
+	  result = V_UNKNOWN;
+	}
+    }
+
+  if (++info->n_evals == PRED_REORDER_SAMPLE_SIZE)
+    {
+      eval_pred_reorder_terms (pr, info);
+    }
+
+  return result;
+}
+
 /*
  * Main Predicate Evaluation Routines
  */
@@ -1691,6 +2123,12 @@ eval_pred (THREAD_ENTRY * thread_p, const PRED_EXPR * pr, val_descr * vd, OID *
       switch (pr->pe.m_pred.bool_op)
 	{
 	case B_AND:
+	  if (eval_pred_reorder_is_sampling (pr))
+	    {
+	      result = eval_pred_and_sample (thread_p, pr, vd, obj_oid);
+	      break;
+	    }
+
 	  /* 'pt_to_pred_expr()' will generate right-linear tree */
 	  result = V_TRUE;
 	  for (t_pr = pr; result == V_TRUE && t_pr->type == T_PRED && t_pr->pe.m_pred.bool_op == B_AND;
@@ -65,6 +65,7 @@
 #include "db_date.h"
 #include "btree_load.h"
 #include "query_dump.h"
+#include "subquery_cache.h"
 #if defined (SERVER_MODE)
 #include "jansson.h"
 #endif /* defined (SERVER_MODE) */
@@ -419,6 +420,8 @@ static int qexec_orderby_distinct (THREAD_ENTRY * thread_p, XASL_NODE * xasl, QU
 				   XASL_STATE * xasl_state);
 static int qexec_orderby_distinct_by_sorting (THREAD_ENTRY * thread_p, XASL_NODE * xasl, QUERY_OPTIONS option,
 					      XASL_STATE * xasl_state);
+static bool qexec_can_use_hash_setop (XASL_NODE * xasl);
+static int qexec_distinct_by_hash (THREAD_ENTRY * thread_p, XASL_NODE * xasl);
 static DB_LOGICAL qexec_eval_grbynum_pred (THREAD_ENTRY * thread_p, GROUPBY_STATE * gbstate);
 static GROUPBY_STATE *qexec_initialize_groupby_state (GROUPBY_STATE * gbstate, SORT_LIST * groupby_list,
 						      PRED_EXPR * having_pred, PRED_EXPR * grbynum_pred,
@@ -1720,9 +1723,20 @@ qexec_clear_pred (THREAD_ENTRY * thread_p, XASL_NODE * xasl_p, PRED_EXPR * pr, b
   switch (pr->type)
     {
     case T_PRED:
+      /* statistics of adaptive conjunct ordering are collected per execution */
+      if (pr->pe.m_pred.reorder != NULL)
+	{
+	  free_and_init (pr->pe.m_pred.reorder);
+	}
+      pr->pe.m_pred.n_evals = 0;
       pg_cnt += qexec_clear_pred (thread_p, xasl_p, pr->pe.m_pred.lhs, is_final);
       for (expr = pr->pe.m_pred.rhs; expr && expr->type == T_PRED; expr = expr->pe.m_pred.rhs)
 	{
+	  if (expr->pe.m_pred.reorder != NULL)
+	    {
+	      free_and_init (expr->pe.m_pred.reorder);
+	    }
+	  expr->pe.m_pred.n_evals = 0;
 	  pg_cnt += qexec_clear_pred (thread_p, xasl_p, expr->pe.m_pred.lhs, is_final);
 	}
       pg_cnt += qexec_clear_pred (thread_p, xasl_p, expr, is_final);
@@ -2174,6 +2188,9 @@ qexec_clear_xasl (THREAD_ENTRY * thread_p, xasl_node * xasl, bool is_final)
   /* clear the head node */
   pg_cnt += qexec_clear_xasl_head (thread_p, xasl);
 
+  /* cached results of a correlated subquery are only valid during one execution */
+  sq_cache_destroy (xasl);
+
 #if defined (ENABLE_COMPOSITE_LOCK)
   /* free alloced memory for composite locking */
   assert (xasl->composite_lock.lockcomp.class_list == NULL);
@@ -3164,6 +3181,11 @@ qexec_orderby_distinct (THREAD_ENTRY * thread_p, XASL_NODE * xasl, QUERY_OPTIONS
       /* already sorted, just dump tuples to list */
       error = qexec_topn_tuples_to_list_id (thread_p, xasl, xasl_state, true);
     }
+  else if (option == Q_DISTINCT && xasl->orderby_list == NULL && xasl->ordbynum_val == NULL
+	   && qexec_can_use_hash_setop (xasl) && qfile_is_hashable_type_list (xasl->list_id, NULL))
+    {
+      error = qexec_distinct_by_hash (thread_p, xasl);
+    }
   else
     {
       error = qexec_orderby_distinct_by_sorting (thread_p, xasl, option, xasl_state);
@@ -3187,6 +3209,64 @@ qexec_orderby_distinct (THREAD_ENTRY * thread_p, XASL_NODE * xasl, QUERY_OPTIONS
   return error;
 }
 
+/*
+ * qexec_can_use_hash_setop () - may DISTINCT and the set operations of this node be done with a hash table?
+ *   return: true if the order of the result does not matter
+ *   xasl(in)   :
+ *
+ * Note: the sort based methods leave the result ordered. That order is not required by SQL, but the final result of
+ *	 a statement has always been returned this way; keep it unless an ORDER BY sorts the result again.
+ */
+static bool
+qexec_can_use_hash_setop (XASL_NODE * xasl)
+{
+  if (prm_get_bigint_value (PRM_ID_MAX_HASH_SETOP_SIZE) == 0)
+    {
+      return false;
+    }
+
+  if (XASL_IS_FLAGED (xasl, XASL_TOP_MOST_XASL)
+      && (xasl->orderby_list == NULL || XASL_IS_FLAGED (xasl, XASL_SKIP_ORDERBY_LIST)))
+    {
+      return false;
+    }
+
+  return true;
+}
+
+/*
+ * qexec_distinct_by_hash () - eliminate the duplicates of the result list file with a hash table
+ *   return: NO_ERROR, or ER_code
+ *   xasl(in)   :
+ *
+ * Note: the result list file is replaced by one that is not sorted.
+ */
+static int
+qexec_distinct_by_hash (THREAD_ENTRY * thread_p, XASL_NODE * xasl)
+{
+  QFILE_LIST_ID *list_id = xasl->list_id;
+  QFILE_LIST_ID *t_list_id;
+  int ls_flag = 0;
+
+  QFILE_SET_FLAG (ls_flag, QFILE_FLAG_UNION);
+  QFILE_SET_FLAG (ls_flag, QFILE_FLAG_DISTINCT);
+
+  t_list_id =
+    qfile_combine_two_list_by_hash (thread_p, list_id, NULL, ls_flag,
+				    prm_get_bigint_value (PRM_ID_MAX_HASH_SETOP_SIZE));
+  if (t_list_id == NULL)
+    {
+      return ER_FAILED;
+    }
+
+  qfile_close_list (thread_p, list_id);
+  qfile_destroy_list (thread_p, list_id);
+  qfile_copy_list_id (list_id, t_list_id, true);
+  QFILE_FREE_AND_INIT_LIST_ID (t_list_id);
+
+  return NO_ERROR;
+}
+
 /*
  * qexec_orderby_distinct_by_sorting () -
  *   return: NO_ERROR, or ER_code
@@ -13449,8 +13529,19 @@ qexec_end_mainblock_iterations (THREAD_ENTRY * thread_p, XASL_NODE * xasl, XASL_
 	  QFILE_SET_FLAG (ls_flag, QFILE_FLAG_RESULT_FILE);
 	}
 
-      t_list_id =
-	qfile_combine_two_list (thread_p, xasl->proc.union_.left->list_id, xasl->proc.union_.right->list_id, ls_flag);
+      if (qexec_can_use_hash_setop (xasl))
+	{
+	  t_list_id =
+	    qfile_combine_two_list_by_hash (thread_p, xasl->proc.union_.left->list_id,
+					    xasl->proc.union_.right->list_id, ls_flag,
+					    prm_get_bigint_value (PRM_ID_MAX_HASH_SETOP_SIZE));
+	}
+      else
+	{
+	  t_list_id =
+	    qfile_combine_two_list (thread_p, xasl->proc.union_.left->list_id, xasl->proc.union_.right->list_id,
+				    ls_flag);
+	}
       distinct_needed = false;
       if (!t_list_id)
 	{
@@ -13543,6 +13634,39 @@ qexec_clear_mainblock_iterations (THREAD_ENTRY * thread_p, XASL_NODE * xasl)
   return;
 }
 
+/*
+ * qexec_execute_regu_variable_xasl () - execute a subquery linked to a regu variable
+ *   return: NO_ERROR, or ER_code
+ *   xasl(in)   : XASL Tree pointer of the subquery
+ *   xstate(in) : XASL state information
+ *
+ * Note: a correlated scalar subquery with a cache key takes its result from the subquery cache when the outer
+ *	 values it depends on were already seen.
+ */
+int
+qexec_execute_regu_variable_xasl (THREAD_ENTRY * thread_p, xasl_node * xasl, xasl_state * xstate)
+{
+  bool use_cache = (xasl->sq_cache_key != NULL && xasl->is_single_tuple && xasl->single_tuple != NULL);
+
+  if (use_cache && sq_cache_get (thread_p, xasl, &xstate->vd))
+    {
+      xasl->status = XASL_SUCCESS;
+      return NO_ERROR;
+    }
+
+  if (qexec_execute_mainblock (thread_p, xasl, xstate, NULL) != NO_ERROR)
+    {
+      return ER_FAILED;
+    }
+
+  if (use_cache)
+    {
+      sq_cache_put (thread_p, xasl);
+    }
+
+  return NO_ERROR;
+}
+
 /*
  * qexec_execute_mainblock () -
  *   return: NO_ERROR, or ER_code
@@ -149,6 +149,10 @@ static int scan_init_indx_coverage (THREAD_ENTRY * thread_p, int coverage_enable
 static int scan_alloc_oid_list (BTREE_ISCAN_OID_LIST ** oid_list_p);
 static int scan_alloc_iscan_oid_buf_list (BTREE_ISCAN_OID_LIST ** oid_list);
 static void scan_free_iscan_oid_buf_list (BTREE_ISCAN_OID_LIST * oid_list);
+static bool scan_is_unique_lookup (INDX_SCAN_ID * isidp, bool coverage_enabled, PRED_EXPR * pr_key,
+				   int func_index_col_id);
+static int scan_unique_lookup_key_attrs (INDX_SCAN_ID * isidp);
+static int scan_get_unique_key_oid (THREAD_ENTRY * thread_p, INDX_SCAN_ID * iscan_id, KEY_VAL_RANGE * key_val);
 static void rop_to_range (RANGE * range, ROP_TYPE left, ROP_TYPE right);
 static void range_to_rop (ROP_TYPE * left, ROP_TYPE * rightk, RANGE range);
 static ROP_TYPE compare_val_op (DB_VALUE * val1, ROP_TYPE op1, DB_VALUE * val2, ROP_TYPE op2, int num_index_term);
@@ -301,6 +305,7 @@ scan_init_index_scan (INDX_SCAN_ID * isidp, struct btree_iscan_oid_list *oid_lis
   isidp->need_count_only = false;
   isidp->check_not_vacuumed = false;
   isidp->not_vacuumed_res = DISK_VALID;
+  isidp->is_unique_lookup = false;
 }
 
 /*
@@ -2174,6 +2179,110 @@ scan_regu_key_to_index_key (THREAD_ENTRY * thread_p, KEY_RANGE * key_ranges, KEY
   return ret;
 }
 
+/*
+ * scan_unique_lookup_key_attrs () - number of key columns of the index scanned
+ *   return: index columns, INCLUDE columns excluded
+ *   isidp(in): index scan
+ */
+static int
+scan_unique_lookup_key_attrs (INDX_SCAN_ID * isidp)
+{
+  return isidp->bt_num_attrs - isidp->bt_scan.btid_int.include_attr_count;
+}
+
+/*
+ * scan_is_unique_lookup () - is the index scan an equality lookup on all the key columns of a unique index?
+ *   return: true if at most one object can qualify and it can be found with btree_find_unique_visible
+ *   isidp(in): index scan being opened
+ *   coverage_enabled(in): true if the index covers the query
+ *   pr_key(in): key filter
+ *   func_index_col_id(in): function index column or -1
+ *
+ * Note: the optimizer already costs such scans as single row lookups. The range scan machinery (OID buffer from the
+ *       shared pool, key range and filter setup, leaf traversal) is not needed to return at most one OID, so these
+ *       scans use a plain key search instead. The range scan does not lock the objects it selects either; UPDATE,
+ *       DELETE and SELECT ... FOR UPDATE lock and re-evaluate the object when it is fetched from the heap, so locking
+ *       scans take this path too. INCLUDE columns are not part of the unique key and are not searched.
+ */
+static bool
+scan_is_unique_lookup (INDX_SCAN_ID * isidp, bool coverage_enabled, PRED_EXPR * pr_key, int func_index_col_id)
+{
+  indx_info *indx_infop = isidp->indx_info;
+  KEY_RANGE *key_range;
+  regu_variable_list_node *operand;
+  int n_terms;
+
+  if (coverage_enabled || pr_key != NULL || func_index_col_id != -1 || isidp->bt_attrs_prefix_length != NULL)
+    {
+      return false;
+    }
+
+  if (!BTREE_IS_UNIQUE (isidp->bt_scan.btid_int.unique_pk) || indx_infop->range_type != R_KEY
+      || indx_infop->key_info.key_cnt != 1 || indx_infop->use_iss || indx_infop->ils_prefix_len > 0
+      || indx_infop->key_info.key_limit_l != NULL || indx_infop->key_info.key_limit_u != NULL)
+    {
+      return false;
+    }
+
+  key_range = &indx_infop->key_info.key_ranges[0];
+  if (key_range->range != EQ_NA || key_range->key1 == NULL)
+    {
+      return false;
+    }
+
+  if (key_range->key1->type == TYPE_FUNC && key_range->key1->value.funcp->ftype == F_MIDXKEY)
+    {
+      for (operand = key_range->key1->value.funcp->operand, n_terms = 0; operand != NULL; operand = operand->next)
+	{
+	  n_terms++;
+	}
+    }
+  else
+    {
+      n_terms = 1;
+    }
+
+  return n_terms == scan_unique_lookup_key_attrs (isidp);
+}
+
+/*
+ * scan_get_unique_key_oid () - get the OID of a unique lookup
+ *   return: NO_ERROR, or ER_code
+ *   iscan_id(in/out): index scan; oids_count is set to 0 or 1
+ *   key_val(in): key value of the lookup
+ */
+static int
+scan_get_unique_key_oid (THREAD_ENTRY * thread_p, INDX_SCAN_ID * iscan_id, KEY_VAL_RANGE * key_val)
+{
+  BTREE_SEARCH search;
+  int error_code = NO_ERROR;
+
+  assert (iscan_id->is_unique_lookup && iscan_id->oid_list == &iscan_id->unique_oid_list);
+
+  iscan_id->oids_count = 0;
+  iscan_id->oid_list->oid_cnt = 0;
+
+  search =
+    btree_find_unique_visible (thread_p, &iscan_id->indx_info->btid, &key_val->key1, &iscan_id->cls_oid,
+			       iscan_id->scan_cache.mvcc_snapshot, iscan_id->oid_list->oidp);
+  if (search == BTREE_ERROR_OCCURRED)
+    {
+      ASSERT_ERROR_AND_SET (error_code);
+      return error_code;
+    }
+
+  /* keep the scan statistics of a range scan on the key */
+  iscan_id->bt_scan.read_keys++;
+  if (search == BTREE_KEY_FOUND)
+    {
+      iscan_id->bt_scan.qualified_keys++;
+      iscan_id->oids_count = 1;
+      iscan_id->oid_list->oid_cnt = 1;
+    }
+
+  return NO_ERROR;
+}
+
 /*
  * scan_get_index_oidset () - Fetch the next group of set of object identifiers
  * from the index associated with the scan identifier.
@@ -2361,6 +2470,36 @@ scan_get_index_oidset (THREAD_ENTRY * thread_p, SCAN_ID * s_id, DB_BIGINT * key_
 	  goto exit_on_error;
 	}
 
+      if (iscan_id->is_unique_lookup)
+	{
+	  if (!iscan_id->multi_range_opt.use && !iscan_id->iss.use
+	      && key_vals[0].num_index_term == scan_unique_lookup_key_attrs (iscan_id)
+	      && !key_vals[0].is_truncated
+	      && DB_VALUE_DOMAIN_TYPE (&key_vals[0].key1) == TP_DOMAIN_TYPE (bts->btid_int.key_type))
+	    {
+	      /* point lookup: find the visible object without a range scan */
+	      ret = scan_get_unique_key_oid (thread_p, iscan_id, &key_vals[0]);
+	      if (ret != NO_ERROR)
+		{
+		  goto exit_on_error;
+		}
+	      iscan_id->curr_keyno++;
+	      break;
+	    }
+
+	  /* the key value needs the comparisons of a range scan, which needs a regular OID buffer */
+	  iscan_id->is_unique_lookup = false;
+	  iscan_id->oid_list = NULL;
+	  ret = scan_alloc_iscan_oid_buf_list (&iscan_id->oid_list);
+	  if (ret != NO_ERROR)
+	    {
+	      goto exit_on_error;
+	    }
+	  iscan_id->oid_list->max_oid_cnt = ISCAN_OID_BUFFER_COUNT;
+	  iscan_id->oid_list->oid_cnt = 0;
+	  iscan_id->curr_oidp = iscan_id->oid_list->oidp;
+	}
+
       ret =
 	btree_prepare_bts (thread_p, bts, &indx_infop->btid, iscan_id, &key_vals[0], &key_filter,
 			   &iscan_id->cls_oid, key_limit_upper, key_limit_lower, true, NULL);
@@ -3080,6 +3219,7 @@ scan_open_index_scan (THREAD_ENTRY * thread_p, SCAN_ID * scan_id,
   isidp->copy_buf = NULL;
   isidp->copy_buf_len = 0;
   isidp->key_vals = NULL;
+  isidp->is_unique_lookup = false;
 
   isidp->indx_cov.type_list = NULL;
   isidp->indx_cov.list_id = indx_info->cov_list_id;
@@ -3141,12 +3281,26 @@ scan_open_index_scan (THREAD_ENTRY * thread_p, SCAN_ID * scan_id,
   isidp->curr_keyno = -1;
   isidp->curr_oidno = -1;
 
+  isidp->is_unique_lookup = scan_is_unique_lookup (isidp, coverage_enabled, pr_key, func_index_col_id);
+
   /* OID buffer */
   if (coverage_enabled)
     {
       /* Covering index do not use an oid buffer. */
       scan_id->scan_stats.covered_index = true;
     }
+  else if (isidp->is_unique_lookup)
+    {
+      /* At most one object qualifies, do not take a buffer from the shared pool. */
+      isidp->unique_oid_list.oidp = &isidp->unique_oid;
+      isidp->unique_oid_list.capacity = 1;
+      isidp->unique_oid_list.max_oid_cnt = 1;
+      isidp->unique_oid_list.oid_cnt = 0;
+      isidp->unique_oid_list.next_list = NULL;
+
+      isidp->oid_list = &isidp->unique_oid_list;
+      isidp->curr_oidp = isidp->oid_list->oidp;
+    }
   else
     {
       ret = scan_alloc_iscan_oid_buf_list (&isidp->oid_list);
@@ -3306,11 +3460,11 @@ exit_on_error:
     {
       db_private_free_and_init (thread_p, isidp->vstr_ids);
     }
-  if (isidp->oid_list != NULL)
+  if (isidp->oid_list != NULL && isidp->oid_list != &isidp->unique_oid_list)
     {
       scan_free_iscan_oid_buf_list (isidp->oid_list);
-      isidp->oid_list = NULL;
     }
+  isidp->oid_list = NULL;
   if (isidp->copy_buf)
     {
       db_private_free_and_init (thread_p, isidp->copy_buf);
@@ -3411,6 +3565,7 @@ scan_open_index_key_info_scan (THREAD_ENTRY * thread_p, SCAN_ID * scan_id,
   isidp->copy_buf = NULL;
   isidp->copy_buf_len = 0;
   isidp->key_vals = NULL;
+  isidp->is_unique_lookup = false;
 
   isidp->indx_cov.type_list = NULL;
   isidp->indx_cov.list_id = NULL;
@@ -4786,11 +4941,11 @@ scan_close_scan (THREAD_ENTRY * thread_p, SCAN_ID * scan_id)
 	{
 	  db_private_free_and_init (thread_p, isidp->vstr_ids);
 	}
-      if (isidp->oid_list != NULL)
+      if (isidp->oid_list != NULL && isidp->oid_list != &isidp->unique_oid_list)
 	{
 	  scan_free_iscan_oid_buf_list (isidp->oid_list);
-	  isidp->oid_list = NULL;
 	}
+      isidp->oid_list = NULL;
 
       /* free index key copy_buf */
       if (isidp->copy_buf)
@@ -238,6 +238,9 @@ struct indx_scan_id
   bool check_not_vacuumed;	/* if true then during index scan, the entries will be checked if they should've been
 				 * vacuumed. Used in checkdb. */
   DISK_ISVALID not_vacuumed_res;	/* The result of not vacuumed checking operation */
+  bool is_unique_lookup;	/* equality on all the columns of a unique index, see scan_is_unique_lookup */
+  BTREE_ISCAN_OID_LIST unique_oid_list;	/* OID list of a unique lookup; used instead of a pooled OID buffer */
+  OID unique_oid;		/* buffer of unique_oid_list */
 };
 
 typedef struct index_node_scan_id INDEX_NODE_SCAN_ID;
@@ -1800,6 +1800,21 @@ stx_build_xasl_node (THREAD_ENTRY * thread_p, char *ptr, XASL_NODE * xasl)
 
   ptr = or_unpack_int (ptr, &xasl->is_single_tuple);
 
+  ptr = or_unpack_int (ptr, &offset);
+  if (offset == 0)
+    {
+      xasl->sq_cache_key = NULL;
+    }
+  else
+    {
+      xasl->sq_cache_key = stx_restore_regu_variable_list (thread_p, &xasl_unpack_info->packed_xasl[offset]);
+      if (xasl->sq_cache_key == NULL)
+	{
+	  goto error;
+	}
+    }
+  xasl->sq_cache = NULL;
+
   ptr = or_unpack_int (ptr, &tmp);
   xasl->option = (QUERY_OPTIONS) tmp;
 
@@ -3965,6 +3980,9 @@ stx_build_pred (THREAD_ENTRY * thread_p, char *ptr, PRED * pred)
   PRED_EXPR *rhs;
   XASL_UNPACK_INFO *xasl_unpack_info = get_xasl_unpack_info_ptr (thread_p);
 
+  pred->reorder = NULL;
+  pred->n_evals = 0;
+
   /* lhs */
   ptr = or_unpack_int (ptr, &offset);
   if (offset == 0)
@@ -3999,6 +4017,8 @@ stx_build_pred (THREAD_ENTRY * thread_p, char *ptr, PRED * pred)
       rhs->type = T_PRED;
 
       pred = &rhs->pe.m_pred;
+      pred->reorder = NULL;
+      pred->n_evals = 0;
 
       /* lhs */
       ptr = or_unpack_int (ptr, &offset);
@@ -0,0 +1,403 @@
+/*
+ *
+ * Copyright 2016 CUBRID Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ */
+
+/*
+ * subquery_cache.c - memoization of correlated scalar subquery results
+ *
+ * A correlated scalar subquery is executed again for every outer row. When the outer columns it references repeat,
+ * so does its result. The values of those columns (XASL_NODE.sq_cache_key, collected at XASL generation) are packed
+ * into a byte string that is used as hash key for the single tuple result. Packing includes the domain, so only
+ * values that are binary identical share an entry; this never returns the result of a value that is merely equal
+ * under some collation.
+ */
+
+#ident "$Id$"
+
+#include <string.h>
+
+#include "subquery_cache.h"
+
+#include "dbtype.h"
+#include "error_manager.h"
+#include "fetch.h"
+#include "memory_alloc.h"
+#include "object_primitive.h"
+#include "object_representation.h"
+#include "regu_var.hpp"
+#include "system_parameter.h"
+#include "xasl.h"
+
+/* initial number of hash table entries */
+#define SQ_CACHE_HT_SIZE 256
+
+/* after this many lookups, a cache that misses more often than it hits is dropped */
+#define SQ_CACHE_MIN_LOOKUPS 512
+
+typedef struct sq_cache_key SQ_CACHE_KEY;
+struct sq_cache_key
+{
+  char *buf;
+  int size;
+};
+
+typedef struct sq_cache_entry SQ_CACHE_ENTRY;
+struct sq_cache_entry
+{
+  SQ_CACHE_KEY key;
+  int n_values;
+  DB_VALUE *values;
+};
+
+static unsigned int sq_cache_hash (const void *key, const unsigned int ht_size);
+static int sq_cache_compare (const void *key1, const void *key2);
+static int sq_cache_free_entry (const void *key, void *data, void *args);
+static int sq_cache_pack_key (THREAD_ENTRY * thread_p, SQ_CACHE * cache, REGU_VARIABLE_LIST key_list, VAL_DESCR * vd);
+static void sq_cache_drop_entries (SQ_CACHE * cache);
+
+/*
+ * sq_cache_hash () - hash a packed key
+ *   return: hash value
+ *   key(in): SQ_CACHE_KEY
+ *   ht_size(in): hash table size
+ */
+static unsigned int
+sq_cache_hash (const void *key, const unsigned int ht_size)
+{
+  const SQ_CACHE_KEY *sq_key = (const SQ_CACHE_KEY *) key;
+
+  return mht_2str_pseudo_key (sq_key->buf, sq_key->size) % ht_size;
+}
+
+/*
+ * sq_cache_compare () - compare two packed keys
+ *   return: true if keys are identical
+ *   key1(in): SQ_CACHE_KEY
+ *   key2(in): SQ_CACHE_KEY
+ */
+static int
+sq_cache_compare (const void *key1, const void *key2)
+{
+  const SQ_CACHE_KEY *k1 = (const SQ_CACHE_KEY *) key1;
+  const SQ_CACHE_KEY *k2 = (const SQ_CACHE_KEY *) key2;
+
+  return k1->size == k2->size && memcmp (k1->buf, k2->buf, k1->size) == 0;
+}
+
+/*
+ * sq_cache_free_entry () - free one cache entry; mht_map function
+ *   return: NO_ERROR
+ *   key(in): entry key
+ *   data(in): SQ_CACHE_ENTRY
+ *   args(in): not used
+ */
+static int
+sq_cache_free_entry (const void *key, void *data, void *args)
+{
+  SQ_CACHE_ENTRY *entry = (SQ_CACHE_ENTRY *) data;
+  int i;
+
+  for (i = 0; i < entry->n_values; i++)
+    {
+      pr_clear_value (&entry->values[i]);
+    }
+  free_and_init (entry->key.buf);
+  free_and_init (entry->values);
+  free (entry);
+
+  return NO_ERROR;
+}
+
+/*
+ * sq_cache_pack_key () - pack the current values of the correlated columns into cache->key_buf
+ *   return: error code
+ *   cache(in/out): subquery cache
+ *   key_list(in): correlated columns
+ *   vd(in): value descriptor
+ */
+static int
+sq_cache_pack_key (THREAD_ENTRY * thread_p, SQ_CACHE * cache, REGU_VARIABLE_LIST key_list, VAL_DESCR * vd)
+{
+  REGU_VARIABLE_LIST regu_p;
+  DB_VALUE *value;
+  OR_BUF buf;
+  int size = 0;
+  int error = NO_ERROR;
+
+  cache->key_size = 0;
+
+  for (regu_p = key_list; regu_p != NULL; regu_p = regu_p->next)
+    {
+      error = fetch_peek_dbval (thread_p, &regu_p->value, vd, NULL, NULL, NULL, &value);
+      if (error != NO_ERROR)
+	{
+	  return error;
+	}
+      size += or_packed_value_size (value, 0, 1, 1) + MAX_ALIGNMENT;
+    }
+
+  if (size > cache->key_buf_size)
+    {
+      if (cache->key_buf != NULL)
+	{
+	  free_and_init (cache->key_buf);
+	}
+      cache->key_buf_size = 0;
+
+      cache->key_buf = (char *) malloc (size);
+      if (cache->key_buf == NULL)
+	{
+	  er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_OUT_OF_VIRTUAL_MEMORY, 1, (size_t) size);
+	  return ER_OUT_OF_VIRTUAL_MEMORY;
+	}
+      cache->key_buf_size = size;
+    }
+
+  /* padding must not make equal keys look different */
+  memset (cache->key_buf, 0, size);
+  or_init (&buf, cache->key_buf, size);
+
+  for (regu_p = key_list; regu_p != NULL; regu_p = regu_p->next)
+    {
+      error = fetch_peek_dbval (thread_p, &regu_p->value, vd, NULL, NULL, NULL, &value);
+      if (error != NO_ERROR)
+	{
+	  return error;
+	}
+      error = or_put_value (&buf, value, 0, 1, 1);
+      if (error != NO_ERROR)
+	{
+	  return error;
+	}
+    }
+
+  cache->key_size = CAST_BUFLEN (buf.ptr - cache->key_buf);
+  return NO_ERROR;
+}
+
+/*
+ * sq_cache_drop_entries () - free all entries and stop caching
+ *   return: void
+ *   cache(in/out): subquery cache
+ */
+static void
+sq_cache_drop_entries (SQ_CACHE * cache)
+{
+  if (cache->ht != NULL)
+    {
+      (void) mht_map (cache->ht, sq_cache_free_entry, NULL);
+      mht_destroy (cache->ht);
+      cache->ht = NULL;
+    }
+  if (cache->key_buf != NULL)
+    {
+      free_and_init (cache->key_buf);
+    }
+  cache->key_buf_size = 0;
+  cache->key_size = 0;
+  cache->size = 0;
+  cache->enabled = false;
+}
+
+/*
+ * sq_cache_get () - look up the result of a correlated scalar subquery for the current outer row
+ *   return: true if the result was found and copied to xasl->single_tuple
+ *   xasl(in/out): subquery XASL
+ *   vd(in): value descriptor
+ *
+ * Note: on a miss, the packed key is kept for the sq_cache_put that follows the execution of the subquery.
+ *	 Errors only disable the cache; the subquery is then executed as usual.
+ */
+bool
+sq_cache_get (THREAD_ENTRY * thread_p, xasl_node * xasl, val_descr * vd)
+{
+  SQ_CACHE *cache = xasl->sq_cache;
+  SQ_CACHE_ENTRY *entry;
+  SQ_CACHE_KEY key;
+  QPROC_DB_VALUE_LIST value_list;
+  int i;
+
+  assert (xasl->sq_cache_key != NULL && xasl->single_tuple != NULL);
+
+  if (cache == NULL)
+    {
+      UINT64 max_size = prm_get_bigint_value (PRM_ID_MAX_SUBQUERY_CACHE_SIZE);
+
+      if (max_size == 0)
+	{
+	  return false;
+	}
+
+      cache = (SQ_CACHE *) malloc (sizeof (SQ_CACHE));
+      if (cache == NULL)
+	{
+	  er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_OUT_OF_VIRTUAL_MEMORY, 1, sizeof (SQ_CACHE));
+	  er_clear ();
+	  return false;
+	}
+      memset (cache, 0, sizeof (SQ_CACHE));
+      cache->max_size = max_size;
+      cache->enabled = true;
+      xasl->sq_cache = cache;
+
+      cache->ht = mht_create ("subquery cache", SQ_CACHE_HT_SIZE, sq_cache_hash, sq_cache_compare);
+      if (cache->ht == NULL)
+	{
+	  er_clear ();
+	  cache->enabled = false;
+	  return false;
+	}
+    }
+
+  if (!cache->enabled)
+    {
+      return false;
+    }
+
+  if (sq_cache_pack_key (thread_p, cache, xasl->sq_cache_key, vd) != NO_ERROR)
+    {
+      er_clear ();
+      sq_cache_drop_entries (cache);
+      return false;
+    }
+
+  key.buf = cache->key_buf;
+  key.size = cache->key_size;
+  entry = (SQ_CACHE_ENTRY *) mht_get (cache->ht, &key);
+  if (entry == NULL)
+    {
+      cache->n_misses++;
+      if (cache->n_hits + cache->n_misses >= SQ_CACHE_MIN_LOOKUPS && cache->n_hits < cache->n_misses)
+	{
+	  /* correlated values hardly repeat; caching only costs memory */
+	  sq_cache_drop_entries (cache);
+	}
+      return false;
+    }
+
+  assert (entry->n_values == xasl->single_tuple->val_cnt);
+  for (value_list = xasl->single_tuple->valp, i = 0; i < entry->n_values; value_list = value_list->next, i++)
+    {
+      pr_clear_value (value_list->val);
+      if (pr_clone_value (&entry->values[i], value_list->val) != NO_ERROR)
+	{
+	  /* let the subquery compute it */
+	  er_clear ();
+	  return false;
+	}
+    }
+
+  cache->n_hits++;
+  return true;
+}
+
+/*
+ * sq_cache_put () - remember the result of a correlated scalar subquery for the key of the last sq_cache_get
+ *   return: void
+ *   xasl(in): subquery XASL, just executed
+ *
+ * Note: once max_subquery_cache_size is reached, new results are no longer cached but the cached ones are still
+ *	 used.
+ */
+void
+sq_cache_put (THREAD_ENTRY * thread_p, xasl_node * xasl)
+{
+  SQ_CACHE *cache = xasl->sq_cache;
+  SQ_CACHE_ENTRY *entry;
+  QPROC_DB_VALUE_LIST value_list;
+  UINT64 entry_size;
+  int n_values, i;
+
+  if (cache == NULL || !cache->enabled || cache->key_size == 0)
+    {
+      return;
+    }
+
+  n_values = xasl->single_tuple->val_cnt;
+  entry_size = sizeof (SQ_CACHE_ENTRY) + cache->key_size + n_values * sizeof (DB_VALUE);
+  for (value_list = xasl->single_tuple->valp, i = 0; i < n_values; value_list = value_list->next, i++)
+    {
+      entry_size += or_packed_value_size (value_list->val, 0, 0, 0);
+    }
+  if (cache->size + entry_size > cache->max_size)
+    {
+      return;
+    }
+
+  entry = (SQ_CACHE_ENTRY *) malloc (sizeof (SQ_CACHE_ENTRY));
+  if (entry == NULL)
+    {
+      return;
+    }
+  entry->key.buf = (char *) malloc (cache->key_size);
+  entry->values = (DB_VALUE *) malloc (n_values * sizeof (DB_VALUE));
+  if (entry->key.buf == NULL || entry->values == NULL)
+    {
+      if (entry->key.buf != NULL)
+	{
+	  free_and_init (entry->key.buf);
+	}
+      if (entry->values != NULL)
+	{
+	  free_and_init (entry->values);
+	}
+      free (entry);
+      return;
+    }
+  memcpy (entry->key.buf, cache->key_buf, cache->key_size);
+  entry->key.size = cache->key_size;
+  entry->n_values = 0;
+
+  for (value_list = xasl->single_tuple->valp, i = 0; i < n_values; value_list = value_list->next, i++)
+    {
+      if (pr_clone_value (value_list->val, &entry->values[i]) != NO_ERROR)
+	{
+	  er_clear ();
+	  (void) sq_cache_free_entry (&entry->key, entry, NULL);
+	  return;
+	}
+      entry->n_values++;
+    }
+
+  if (mht_put (cache->ht, &entry->key, entry) == NULL)
+    {
+      er_clear ();
+      (void) sq_cache_free_entry (&entry->key, entry, NULL);
+      return;
+    }
+
+  cache->size += entry_size;
+  /* the key belongs to this lookup only */
+  cache->key_size = 0;
+}
+
+/*
+ * sq_cache_destroy () - free the subquery cache of an XASL node
+ *   return: void
+ *   xasl(in/out): subquery XASL
+ */
+void
+sq_cache_destroy (xasl_node * xasl)
+{
+  if (xasl->sq_cache == NULL)
+    {
+      return;
+    }
+
+  sq_cache_drop_entries (xasl->sq_cache);
+  free_and_init (xasl->sq_cache);
+}
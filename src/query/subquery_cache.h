@@ -0,0 +1,57 @@
+/*
+ *
+ * Copyright 2016 CUBRID Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ */
+
+//
+// subquery_cache - memoization of correlated scalar subquery results
+//
+
+#ifndef _SUBQUERY_CACHE_H_
+#define _SUBQUERY_CACHE_H_
+
+#if !defined (SERVER_MODE) && !defined (SA_MODE)
+#error Wrong module
+#endif // not server and not SA mode
+
+#include "memory_hash.h"
+#include "thread_compat.hpp"
+
+// forward definitions
+struct val_descr;
+struct xasl_node;
+
+/* results of one correlated scalar subquery, keyed by the values of the outer columns it references.
+ * lives in the XASL node of the subquery for one execution of the statement. */
+typedef struct sq_cache SQ_CACHE;
+struct sq_cache
+{
+  MHT_TABLE *ht;		/* packed key -> SQ_CACHE_ENTRY */
+  char *key_buf;		/* packed key of the last lookup */
+  int key_buf_size;		/* allocated size of key_buf */
+  int key_size;			/* size of the packed key in key_buf; 0 if it could not be packed */
+  UINT64 size;			/* memory held by the cached entries */
+  UINT64 max_size;		/* max_subquery_cache_size */
+  INT64 n_hits;
+  INT64 n_misses;
+  bool enabled;			/* false once the hit ratio proved too low */
+};
+
+extern bool sq_cache_get (THREAD_ENTRY * thread_p, xasl_node * xasl, val_descr * vd);
+extern void sq_cache_put (THREAD_ENTRY * thread_p, xasl_node * xasl);
+extern void sq_cache_destroy (xasl_node * xasl);
+
+#endif /* _SUBQUERY_CACHE_H_ */
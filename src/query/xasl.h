@@ -155,6 +155,8 @@ typedef struct xasl_stat XASL_STATS;
 typedef struct topn_tuple TOPN_TUPLE;
 typedef struct topn_tuples TOPN_TUPLES;
 
+typedef struct sq_cache SQ_CACHE;
+
 // *INDENT-OFF*
 namespace cubquery
 {
@@ -513,7 +515,7 @@ struct cte_proc_node
 	      if ((_x)->status == XASL_CLEARED || (_x)->status == XASL_INITIALIZED) \
 		{ \
 		  /* execute xasl query */ \
-		  if (qexec_execute_mainblock ((thread_p), _x, (v)->xasl_state, NULL) != NO_ERROR) \
+		  if (qexec_execute_regu_variable_xasl ((thread_p), _x, (v)->xasl_state) != NO_ERROR) \
 		    { \
 		      (_x)->status = XASL_FAILURE; \
 		    } \
@@ -989,6 +991,7 @@ struct xasl_node
   VAL_LIST *single_tuple;	/* single tuple result */
 
   int is_single_tuple;		/* single tuple subquery? */
+  REGU_VARIABLE_LIST sq_cache_key;	/* outer values a correlated subquery depends on; its result is cached for them */
 
   QUERY_OPTIONS option;		/* UNIQUE option */
   OUTPTR_LIST *outptr_list;	/* output pointer list */
@@ -1068,6 +1071,7 @@ struct xasl_node
   XASL_STATS xasl_stats;
 
   TOPN_TUPLES *topn_items;	/* top-n tuples for orderby limit */
+  SQ_CACHE *sq_cache;		/* results of this correlated subquery */
 
   XASL_STATUS status;		/* current status */
 
@@ -2850,6 +2850,13 @@ xts_process_xasl_node (char *ptr, const XASL_NODE * xasl)
 
   ptr = or_pack_int (ptr, xasl->is_single_tuple);
 
+  offset = xts_save_regu_variable_list (xasl->sq_cache_key);
+  if (offset == ER_FAILED)
+    {
+      return NULL;
+    }
+  ptr = or_pack_int (ptr, offset);
+
   ptr = or_pack_int (ptr, xasl->option);
 
   offset = xts_save_outptr_list (xasl->outptr_list);
@@ -5819,6 +5826,7 @@ xts_sizeof_xasl_node (const XASL_NODE * xasl)
 	   + OR_INT_SIZE	/* ordbynum_flag */
 	   + PTR_SIZE		/* single_tuple */
 	   + OR_INT_SIZE	/* is_single_tuple */
+	   + PTR_SIZE		/* sq_cache_key */
 	   + OR_INT_SIZE	/* option */
 	   + PTR_SIZE		/* outptr_list */
 	   + PTR_SIZE		/* selected_upd_list */
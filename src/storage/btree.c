@@ -278,6 +278,9 @@
  *	 (e.g. save last deallocation page LSA - it will be then enough to
  *	 compare with an LSA saved before unfixing).
  */
+/* stop trying the leaf hint of a range scan once it missed this many more times than it hit */
+#define BTREE_LEAF_HINT_MISS_TOLERANCE 8
+
 #define BTREE_IS_PAGE_VALID_LEAF(thread_p, page) \
   ((page) != NULL \
    && pgbuf_get_page_ptype (thread_p, page) == PAGE_BTREE \
@@ -973,6 +976,9 @@ btree_perf_unique_lock_time (THREAD_ENTRY * thread_p, PERF_UTIME_TRACKER * track
       /* Put unique_pk */ \
       OR_PUT_INT (rv_ptr, (btid_int)->unique_pk); \
       (rv_ptr) += OR_INT_SIZE; \
+      /* Put INCLUDE payload size. */ \
+      OR_PUT_INT (rv_ptr, (btid_int)->include_payload_size); \
+      (rv_ptr) += OR_INT_SIZE; \
       if (BTREE_IS_UNIQUE ((btid_int)->unique_pk)) \
 	{ \
 	  /* Put topclass_oid. */ \
@@ -1006,6 +1012,7 @@ btree_perf_unique_lock_time (THREAD_ENTRY * thread_p, PERF_UTIME_TRACKER * track
 #define BTREE_RV_DEBUG_INFO_MAX_SIZE \
   (OR_INT_SIZE /* Debug ID. */ \
    + OR_INT_SIZE /* unique_pk */ \
+   + OR_INT_SIZE /* include_payload_size */ \
    + OR_OID_SIZE /* topclass_oid */ \
    + BTID_DOMAIN_CHECK_MAX_SIZE /* key_type. */)
 #endif /* !NDEBUG */
@@ -1037,9 +1044,10 @@ btree_perf_unique_lock_time (THREAD_ENTRY * thread_p, PERF_UTIME_TRACKER * track
 /* Just a rough estimation */
 const size_t BTREE_RV_BUFFER_SIZE =
 #if defined (NDEBUG)
-  (3 * LOG_RV_RECORD_UPDPARTIAL_ALIGNED_SIZE (BTREE_OBJECT_MAX_SIZE));
+  (3 * LOG_RV_RECORD_UPDPARTIAL_ALIGNED_SIZE (BTREE_OBJECT_MAX_SIZE + BTREE_INCLUDE_PAYLOAD_MAX_SIZE));
 #else /* !NDEBUG */
-  (4 * LOG_RV_RECORD_UPDPARTIAL_ALIGNED_SIZE (BTREE_OBJECT_MAX_SIZE) + BTREE_RV_DEBUG_INFO_MAX_SIZE);
+  (4 * LOG_RV_RECORD_UPDPARTIAL_ALIGNED_SIZE (BTREE_OBJECT_MAX_SIZE + BTREE_INCLUDE_PAYLOAD_MAX_SIZE)
+   + BTREE_RV_DEBUG_INFO_MAX_SIZE);
 #endif /* !NDEBUG */
 
 static void
@@ -1280,8 +1288,8 @@ static int btree_find_next_index_record_holding_current_helper (THREAD_ENTRY * t
 static int btree_apply_key_range_and_filter (THREAD_ENTRY * thread_p, BTREE_SCAN * bts, bool is_iss,
 					     bool * key_range_satisfied, bool * key_filter_satisfied,
 					     bool need_to_check_null);
-static int btree_dump_curr_key (THREAD_ENTRY * thread_p, BTREE_SCAN * bts, FILTER_INFO * filter, OID * oid,
-				INDX_SCAN_ID * iscan_id);
+static int btree_dump_curr_key (THREAD_ENTRY * thread_p, BTREE_SCAN * bts, DB_VALUE * key, FILTER_INFO * filter,
+				OID * oid, INDX_SCAN_ID * iscan_id);
 static DISK_ISVALID btree_find_key_from_leaf (THREAD_ENTRY * thread_p, BTID_INT * btid, PAGE_PTR pg_ptr, int key_cnt,
 					      OID * oid, DB_VALUE * key, bool * clear_key);
 static DISK_ISVALID btree_find_key_from_nleaf (THREAD_ENTRY * thread_p, BTID_INT * btid, PAGE_PTR pg_ptr, int key_cnt,
@@ -1332,7 +1340,7 @@ static int btree_find_oid_from_ovfl (THREAD_ENTRY * thread_p, BTID_INT * btid_in
 static int btree_leaf_get_vpid_for_overflow_oids (RECDES * rec, VPID * vpid);
 static int btree_record_get_last_object (THREAD_ENTRY * thread_p, BTID_INT * btid_int, RECDES * recp,
 					 BTREE_NODE_TYPE node_type, int after_key_offset, OID * oidp, OID * class_oid,
-					 BTREE_MVCC_INFO * mvcc_info, int *last_oid_mvcc_offset);
+					 BTREE_MVCC_INFO * mvcc_info, char *payload, int *last_oid_mvcc_offset);
 static void btree_record_remove_last_object (THREAD_ENTRY * thread_p, BTID_INT * btid, RECDES * recp,
 					     BTREE_NODE_TYPE node_type, int last_oid_mvcc_offset,
 					     char **rv_undo_data_ptr, char **rv_redo_data_ptr);
@@ -1427,11 +1435,21 @@ static int btree_or_get_mvccinfo (OR_BUF * buf, BTREE_MVCC_INFO * mvcc_info, sho
 static int btree_or_put_object (OR_BUF * buf, BTID_INT * btid_int, BTREE_NODE_TYPE node_type,
 				BTREE_OBJECT_INFO * object_info);
 static int btree_or_get_object (OR_BUF * buf, BTID_INT * btid_int, BTREE_NODE_TYPE node_type, int after_key_offset,
-				OID * oid, OID * class_oid, BTREE_MVCC_INFO * mvcc_info);
+				OID * oid, OID * class_oid, BTREE_MVCC_INFO * mvcc_info, char *payload);
 static char *btree_unpack_object (char *ptr, BTID_INT * btid_int, BTREE_NODE_TYPE node_type, RECDES * record,
-				  int after_key_offset, OID * oid, OID * class_oid, BTREE_MVCC_INFO * mvcc_info);
+				  int after_key_offset, OID * oid, OID * class_oid, BTREE_MVCC_INFO * mvcc_info,
+				  char *payload);
 static char *btree_pack_object (char *ptr, BTID_INT * btid_int, BTREE_NODE_TYPE node_type, RECDES * record,
 				BTREE_OBJECT_INFO * object_info);
+static int btree_found_object_get_payload (THREAD_ENTRY * thread_p, BTID_INT * btid_int, PAGE_PTR leaf_page,
+					   RECDES * leaf_record, int offset_after_key, PAGE_PTR found_page,
+					   int offset_to_object, char *payload);
+static bool btree_key_has_include_values (BTID_INT * btid_int, DB_VALUE * key);
+static int btree_key_get_include_payload (BTID_INT * btid_int, DB_VALUE * key, char *payload, int *include_len);
+static int btree_range_scan_get_include_key (BTREE_SCAN * bts, RECDES * record, char *object_ptr,
+					     DB_VALUE * full_key, DB_VALUE ** key_out);
+static int btree_key_add_include_payload (BTID_INT * btid_int, DB_VALUE * key, const char *payload,
+					  DB_VALUE * full_key, DB_VALUE ** key_out);
 
 static int btree_search_key_and_apply_functions (THREAD_ENTRY * thread_p, BTID * btid, BTID_INT * btid_int,
 						 DB_VALUE * key, BTREE_ROOT_WITH_KEY_FUNCTION * root_fnct,
@@ -1480,6 +1498,8 @@ static int btree_range_scan_advance_over_filtered_keys (THREAD_ENTRY * thread_p,
 static int btree_range_scan_descending_fix_prev_leaf (THREAD_ENTRY * thread_p, BTREE_SCAN * bts, int *key_count,
 						      BTREE_NODE_HEADER ** node_header_ptr, VPID * next_vpid);
 static int btree_range_scan_start (THREAD_ENTRY * thread_p, BTREE_SCAN * bts);
+static int btree_range_scan_locate_key_from_hint (THREAD_ENTRY * thread_p, BTREE_SCAN * bts, DB_VALUE * key,
+						  bool * found);
 static int btree_range_scan_resume (THREAD_ENTRY * thread_p, BTREE_SCAN * bts);
 static int btree_range_scan_count_oids_leaf_and_one_ovf (THREAD_ENTRY * thread_p, BTREE_SCAN * bts);
 static int btree_scan_update_range (THREAD_ENTRY * thread_p, BTREE_SCAN * bts, key_val_range * kv_range);
@@ -1567,6 +1587,9 @@ static int btree_merge_node_and_advance (THREAD_ENTRY * thread_p, BTID_INT * bti
 					 PAGE_PTR * crt_page, PAGE_PTR * advance_to_page, bool * is_leaf,
 					 BTREE_SEARCH_KEY_HELPER * search_key, bool * stop, bool * restart,
 					 void *other_args);
+static int btree_fix_root_for_coalesce (THREAD_ENTRY * thread_p, BTID * btid, BTID_INT * btid_int, DB_VALUE * key,
+					PAGE_PTR * root_page, bool * is_leaf, BTREE_SEARCH_KEY_HELPER * search_key,
+					bool * stop, bool * restart, void *other_args);
 static int btree_key_delete_remove_object (THREAD_ENTRY * thread_p, BTID_INT * btid_int, DB_VALUE * key,
 					   PAGE_PTR * leaf_page, BTREE_SEARCH_KEY_HELPER * search_key, bool * restart,
 					   void *other_args);
@@ -2191,6 +2214,9 @@ btree_delete_overflow_key (THREAD_ENTRY * thread_p, BTID_INT * btid, PAGE_PTR pa
 	  mvccids_size += OR_MVCCID_SIZE;
 	}
 
+      /* INCLUDE payload is stored after the MVCCIDs. */
+      mvccids_size += btid->include_payload_size;
+
       if (btree_leaf_is_flaged (&rec, BTREE_LEAF_RECORD_CLASS_OID))
 	{
 	  start_ptr = rec.data + (2 * OR_OID_SIZE) + mvccids_size;
@@ -2403,9 +2429,11 @@ btree_leaf_record_change_overflow_link (THREAD_ENTRY * thread_p, BTID_INT * btid
  * oidp (out)	   : First object OID.
  * class_oid (out) : First object class OID.
  * mvcc_info (out) : First object MVCC info.
+ * payload (out)   : First object INCLUDE payload. Can be NULL.
  */
 int
-btree_leaf_get_first_object (BTID_INT * btid, RECDES * recp, OID * oidp, OID * class_oid, BTREE_MVCC_INFO * mvcc_info)
+btree_leaf_get_first_object (BTID_INT * btid, RECDES * recp, OID * oidp, OID * class_oid, BTREE_MVCC_INFO * mvcc_info,
+			     char *payload)
 {
   OR_BUF record_buffer;
   int error_code = NO_ERROR;
@@ -2417,7 +2445,8 @@ btree_leaf_get_first_object (BTID_INT * btid, RECDES * recp, OID * oidp, OID * c
   /* TODO: consider class_oid and mvcc_info. Should they be required? */
 
   BTREE_RECORD_OR_BUF_INIT (record_buffer, recp);
-  error_code = btree_or_get_object (&record_buffer, btid, BTREE_LEAF_NODE, dummy_offset, oidp, class_oid, mvcc_info);
+  error_code =
+    btree_or_get_object (&record_buffer, btid, BTREE_LEAF_NODE, dummy_offset, oidp, class_oid, mvcc_info, payload);
   /* We expect first object can be successfully obtained. */
   assert (error_code == NO_ERROR);
   return error_code;
@@ -2663,6 +2692,12 @@ btree_record_get_num_visible_oids (THREAD_ENTRY * thread_p, BTID_INT * btid, REC
 
       /* Get MVCC information */
       error_code = btree_or_get_mvccinfo (&buf, &mvcc_info, mvcc_flags);
+      if (error_code != NO_ERROR)
+	{
+	  return error_code;
+	}
+      /* Skip INCLUDE payload */
+      error_code = or_advance (&buf, btid->include_payload_size);
       if (error_code != NO_ERROR)
 	{
 	  return error_code;
@@ -2747,7 +2782,7 @@ btree_record_get_num_oids (THREAD_ENTRY * thread_p, BTID_INT * btid_int, RECDES
       while (buf.ptr < buf.endptr)
 	{
 	  mvcc_flag = btree_record_object_get_mvcc_flags (buf.ptr);
-	  buf.ptr += OR_OID_SIZE + BTREE_GET_MVCC_INFO_SIZE_FROM_FLAGS (mvcc_flag);
+	  buf.ptr += OR_OID_SIZE + BTREE_GET_MVCC_INFO_SIZE_FROM_FLAGS (mvcc_flag) + btid_int->include_payload_size;
 	  rec_oid_cnt++;
 	}
       assert (buf.ptr == buf.endptr);
@@ -2771,14 +2806,15 @@ btree_record_get_num_oids (THREAD_ENTRY * thread_p, BTID_INT * btid_int, RECDES
  * oidp (in)		  : Replacing instance OID.
  * class_oidp (in)	  : Replacing class OID.
  * mvcc_info (in)	  : Replacing MVCC info.
+ * payload (in)		  : Replacing INCLUDE payload. NULL writes an empty payload.
  * key_offset (in)	  : Output new offset to key.
  * rv_undo_data_ptr (out) : If not NULL, output undo logging of this change.
  * rv_redo_data_ptr (out) : If not NULL, output redo logging of this change.
  */
 void
 btree_leaf_change_first_object (THREAD_ENTRY * thread_p, RECDES * recp, BTID_INT * btid, OID * oidp, OID * class_oidp,
-				BTREE_MVCC_INFO * mvcc_info, int *key_offset, char **rv_undo_data_ptr,
-				char **rv_redo_data_ptr)
+				BTREE_MVCC_INFO * mvcc_info, const char *payload, int *key_offset,
+				char **rv_undo_data_ptr, char **rv_redo_data_ptr)
 {
   short old_rec_flag = 0, new_rec_flag = 0, mvcc_flags = 0;
   int old_object_size, new_object_size;
@@ -2870,6 +2906,10 @@ btree_leaf_change_first_object (THREAD_ENTRY * thread_p, RECDES * recp, BTID_INT
 	}
     }
 
+  /* INCLUDE payload follows the MVCC info. */
+  old_object_size += btid->include_payload_size;
+  new_object_size += btid->include_payload_size;
+
   /* Log undo changes. */
   if (rv_undo_data_ptr != NULL && *rv_undo_data_ptr != NULL)
     {
@@ -2937,6 +2977,20 @@ btree_leaf_change_first_object (THREAD_ENTRY * thread_p, RECDES * recp, BTID_INT
       btree_record_object_set_mvcc_flags (recp->data, mvcc_flags);
     }
 
+  if (btid->include_payload_size > 0)
+    {
+      /* Add INCLUDE payload */
+      if (payload != NULL)
+	{
+	  memcpy (buffer.ptr, payload, btid->include_payload_size);
+	}
+      else
+	{
+	  memset (buffer.ptr, 0, btid->include_payload_size);
+	}
+      buffer.ptr += btid->include_payload_size;
+    }
+
   /* Make sure everything was packed correctly */
   assert_release (buffer.ptr == buffer.endptr);
 
@@ -2973,7 +3027,8 @@ btree_leaf_record_handle_first_overflow (THREAD_ENTRY * thread_p, RECDES * recp,
 {
   int old_mvcc_flags;
   int old_object_size = OR_OID_SIZE;
-  int new_object_size = BTREE_OBJECT_FIXED_SIZE (btid_int);
+  /* The INCLUDE payload is not changed; it is moved along with the rest of the record. */
+  int new_object_size = BTREE_OBJECT_FIXED_SIZE (btid_int) - btid_int->include_payload_size;
   MVCCID delid, insid;
   char *ptr = NULL;
 
@@ -3171,7 +3226,7 @@ btree_leaf_get_nth_oid_ptr (BTID_INT * btid, RECDES * recp, BTREE_NODE_TYPE node
       mvcc_flags = btree_record_object_get_mvcc_flags (buf.ptr);
       mvcc_info_size = BTREE_GET_MVCC_INFO_SIZE_FROM_FLAGS (mvcc_flags);
 
-      if (or_advance (&buf, oids_size + mvcc_info_size) != NO_ERROR)
+      if (or_advance (&buf, oids_size + mvcc_info_size + btid->include_payload_size) != NO_ERROR)
 	{
 	  assert_release (false);
 	  return NULL;
@@ -3198,12 +3253,13 @@ btree_leaf_get_nth_oid_ptr (BTID_INT * btid, RECDES * recp, BTREE_NODE_TYPE node
  * oidp (out)		       : Output last object OID.
  * class_oid (out)	       : Output last object class OID.
  * mvcc_info (out)	       : Output last object MVCC info.
+ * payload (out)	       : Output last object INCLUDE payload. Can be NULL.
  * offset_to_last_object (out) : Output offset in record to last object.
  */
 static int
 btree_record_get_last_object (THREAD_ENTRY * thread_p, BTID_INT * btid_int, RECDES * recp, BTREE_NODE_TYPE node_type,
 			      int offset_after_key, OID * oidp, OID * class_oid, BTREE_MVCC_INFO * mvcc_info,
-			      int *offset_to_last_object)
+			      char *payload, int *offset_to_last_object)
 {
   char *offset = NULL;		/* Pointer in record data. */
   OR_BUF buf;			/* Buffer used to parse record. */
@@ -3236,7 +3292,8 @@ btree_record_get_last_object (THREAD_ENTRY * thread_p, BTID_INT * btid_int, RECD
       *offset_to_last_object = CAST_BUFLEN (offset - recp->data);
 
       /* Unpack last object. */
-      offset = btree_unpack_object (offset, btid_int, node_type, recp, offset_after_key, oidp, class_oid, mvcc_info);
+      offset =
+	btree_unpack_object (offset, btid_int, node_type, recp, offset_after_key, oidp, class_oid, mvcc_info, payload);
       assert (offset == buf.endptr);
       return NO_ERROR;
     }
@@ -3249,7 +3306,8 @@ btree_record_get_last_object (THREAD_ENTRY * thread_p, BTID_INT * btid_int, RECD
       /* Get offset to object. */
       *offset_to_last_object = 0;
 
-      (void) btree_unpack_object (recp->data, btid_int, node_type, recp, offset_after_key, oidp, class_oid, mvcc_info);
+      (void) btree_unpack_object (recp->data, btid_int, node_type, recp, offset_after_key, oidp, class_oid, mvcc_info,
+				  payload);
       return NO_ERROR;
     }
   /* Leaf node and more than one object. */
@@ -3266,7 +3324,8 @@ btree_record_get_last_object (THREAD_ENTRY * thread_p, BTID_INT * btid_int, RECD
   while (buf.ptr < buf.endptr)
     {
       offset = buf.ptr;
-      error_code = btree_or_get_object (&buf, btid_int, node_type, offset_after_key, oidp, class_oid, mvcc_info);
+      error_code =
+	btree_or_get_object (&buf, btid_int, node_type, offset_after_key, oidp, class_oid, mvcc_info, payload);
       if (error_code != NO_ERROR)
 	{
 	  ASSERT_ERROR ();
@@ -4043,6 +4102,7 @@ btree_get_disk_size_of_key (DB_VALUE * key)
  *   class_oid(in):
  *   oid(in):
  *   p_mvcc_rec_header(in): MVCC record header
+ *   payload(in): INCLUDE payload of first object (NULL writes an empty payload)
  *   rec(out):
  *
  * Note: This routine forms a btree record for both leaf and non leaf pages.
@@ -4056,7 +4116,7 @@ btree_get_disk_size_of_key (DB_VALUE * key)
 int
 btree_write_record (THREAD_ENTRY * thread_p, BTID_INT * btid, void *node_rec, DB_VALUE * key, BTREE_NODE_TYPE node_type,
 		    int key_type, int key_len, bool during_loading, OID * class_oid, OID * oid,
-		    BTREE_MVCC_INFO * mvcc_info, RECDES * rec)
+		    BTREE_MVCC_INFO * mvcc_info, const char *payload, RECDES * rec)
 {
   VPID key_vpid;
   OR_BUF buf;
@@ -4111,6 +4171,24 @@ btree_write_record (THREAD_ENTRY * thread_p, BTID_INT * btid, void *node_rec, DB
 	    }
 	  btree_record_object_set_mvcc_flags (rec->data, mvcc_info->flags);
 	}
+
+      if (btid->include_payload_size > 0)
+	{
+	  /* INCLUDE payload follows MVCC info. */
+	  if (payload != NULL)
+	    {
+	      error_code = or_put_data (&buf, payload, btid->include_payload_size);
+	    }
+	  else
+	    {
+	      error_code = or_pad (&buf, btid->include_payload_size);
+	    }
+	  if (error_code != NO_ERROR)
+	    {
+	      assert_release (false);
+	      return error_code;
+	    }
+	}
     }
   else
     {
@@ -4381,6 +4459,15 @@ btree_read_record_without_decompression (THREAD_ENTRY * thread_p, BTID_INT * bti
 	    }
 	}
 
+      if (btid->include_payload_size > 0)
+	{
+	  rc = or_advance (&buf, btid->include_payload_size);	/* skip INCLUDE payload */
+	  if (rc != NO_ERROR)
+	    {
+	      return rc;
+	    }
+	}
+
       if (btree_leaf_is_flaged (rec, BTREE_LEAF_RECORD_OVERFLOW_KEY))
 	{
 	  key_type = BTREE_OVERFLOW_KEY;
@@ -4584,6 +4671,7 @@ btree_dump_root_header (THREAD_ENTRY * thread_p, FILE * fp, PAGE_PTR page_ptr)
   fprintf (fp, " OVFID: %d|%d\n", root_header->ovfid.fileid, root_header->ovfid.volid);
   fprintf (fp, " Btree Revision Level: %d\n", root_header->_32.rev_level);
   fprintf (fp, " Btree Decompress position: %d\n", GET_DECOMPRESS_IDX_HEADER (root_header));
+  fprintf (fp, " Btree INCLUDE columns: %d\n", root_header->_32.include_attr_count);
   fprintf (fp, "\n");
 }
 
@@ -4665,7 +4753,7 @@ btree_dump_leaf_record (THREAD_ENTRY * thread_p, FILE * fp, BTID_INT * btid, REC
   fprintf (fp, "Oid_Cnt: %d ", oid_cnt);
 
   /* output first oid */
-  (void) btree_leaf_get_first_object (btid, rec, &oid, &class_oid, &mvcc_info);
+  (void) btree_leaf_get_first_object (btid, rec, &oid, &class_oid, &mvcc_info, NULL);
   if (BTREE_IS_UNIQUE (btid->unique_pk))
     {
       fprintf (fp, " (%d %d %d : %d, %d, %d) ", class_oid.volid, class_oid.pageid, class_oid.slotid, oid.volid,
@@ -4741,6 +4829,9 @@ btree_dump_leaf_record (THREAD_ENTRY * thread_p, FILE * fp, BTID_INT * btid, REC
 	  fprintf (fp, ", delid=%llu", (long long) mvccid);
 
 	  fprintf (fp, ")  ");
+
+	  /* Skip INCLUDE payload */
+	  (void) or_advance (&buf, btid->include_payload_size);
 	}
     }
   else
@@ -4788,6 +4879,9 @@ btree_dump_leaf_record (THREAD_ENTRY * thread_p, FILE * fp, BTID_INT * btid, REC
 		}
 	      fprintf (fp, ")  ");
 	    }
+
+	  /* Skip INCLUDE payload */
+	  (void) or_advance (&buf, btid->include_payload_size);
 	}
     }
 
@@ -4848,6 +4942,7 @@ btree_dump_leaf_record (THREAD_ENTRY * thread_p, FILE * fp, BTID_INT * btid, REC
 	      (void) or_get_mvccid (&buf, &mvccid);
 	      fprintf (fp, ", delid=%llu", (long long) mvccid);
 	      fprintf (fp, ")  ");
+	      (void) or_advance (&buf, btid->include_payload_size);
 	    }
 
 	  pgbuf_unfix_and_init (thread_p, overflow_page_ptr);
@@ -5545,6 +5640,8 @@ btree_search_leaf_page (THREAD_ENTRY * thread_p, BTID_INT * btid, PAGE_PTR page_
  *   num_oids(in):
  *   num_nulls(in):
  *   num_keys(in):
+ *   deduplicate_key_pos(in):
+ *   include_count(in): number of INCLUDE columns, kept as object payload instead of key
  *
  * Note: Creates the B+tree index. A file identifier (index identifier)
  * is defined on the given volume. This identifier is used by
@@ -5554,7 +5651,8 @@ btree_search_leaf_page (THREAD_ENTRY * thread_p, BTID_INT * btid, PAGE_PTR page_
  */
 BTID *
 xbtree_add_index (THREAD_ENTRY * thread_p, BTID * btid, TP_DOMAIN * key_type, OID * class_oid, int attr_id,
-		  int unique_pk, long long num_oids, long long num_nulls, long long num_keys, int deduplicate_key_pos)
+		  int unique_pk, long long num_oids, long long num_nulls, long long num_keys, int deduplicate_key_pos,
+		  int include_count)
 {
   BTREE_ROOT_HEADER root_header_info, *root_header = NULL;
   VPID root_vpid;
@@ -5568,6 +5666,20 @@ xbtree_add_index (THREAD_ENTRY * thread_p, BTID * btid, TP_DOMAIN * key_type, OI
       return NULL;
     }
 
+  if (include_count > 0)
+    {
+      BTID_INT btid_int;
+
+      /* Check that the INCLUDE payload has a bounded size. */
+      btid_int.key_type = key_type;
+      btid_int.deduplicate_key_idx = deduplicate_key_pos;
+      if (btree_set_include_info (&btid_int, include_count) != NO_ERROR)
+	{
+	  ASSERT_ERROR ();
+	  return NULL;
+	}
+    }
+
   log_sysop_start (thread_p);
 
   /* create a file descriptor, allocate and initialize the root page */
@@ -5627,6 +5739,7 @@ xbtree_add_index (THREAD_ENTRY * thread_p, BTID * btid, TP_DOMAIN * key_type, OI
   /* support for SUPPORT_DEDUPLICATE_KEY_MODE */
   // root_header->rev_level = BTREE_CURRENT_REV_LEVEL;
   root_header->_32.rev_level = BTREE_CURRENT_REV_LEVEL;
+  root_header->_32.include_attr_count = include_count;
   SET_DECOMPRESS_IDX_HEADER (root_header, deduplicate_key_pos);
 
 #if defined (SERVER_MODE)
@@ -5810,9 +5923,61 @@ btree_glean_root_header_info (THREAD_ENTRY * thread_p, BTREE_ROOT_HEADER * root_
   btid->rev_level = root_header->_32.rev_level;
   btid->deduplicate_key_idx = GET_DECOMPRESS_IDX_HEADER (root_header);
 
+  btid->include_attr_count = 0;
+  btid->include_attr_start = -1;
+  btid->include_payload_size = 0;
+  if (is_key_type && root_header->_32.include_attr_count > 0)
+    {
+      rc = btree_set_include_info (btid, root_header->_32.include_attr_count);
+    }
+
   return rc;
 }
 
+/*
+ * btree_set_include_info () - Set where the INCLUDE columns are in the key and the size of the payload that keeps
+ *			       their values with each object.
+ *
+ * return	      : Error code.
+ * btid (in/out)      : B-tree info. Key type and deduplicate key position must be already set.
+ * include_count (in) : Number of INCLUDE columns.
+ *
+ * NOTE: INCLUDE columns come after the key columns and before the deduplicate key column. Their values are not part
+ *	 of the stored key; each object carries them in a fixed size payload, so the payload must have a bounded size.
+ */
+int
+btree_set_include_info (BTID_INT * btid, int include_count)
+{
+  int size;
+
+  btid->include_attr_count = 0;
+  btid->include_attr_start = -1;
+  btid->include_payload_size = 0;
+
+  if (include_count <= 0)
+    {
+      return NO_ERROR;
+    }
+
+  assert (TP_DOMAIN_TYPE (btid->key_type) == DB_TYPE_MIDXKEY);
+
+  btid->include_attr_count = include_count;
+  btid->include_attr_start =
+    ((btid->deduplicate_key_idx >= 0) ? btid->deduplicate_key_idx : btid->key_type->precision) - include_count;
+  assert (btid->include_attr_start > 0);
+
+  size = pr_midxkey_elements_max_size (btid->key_type, btid->include_attr_start, include_count);
+  if (size < 0 || DB_ALIGN (size, MAX_ALIGNMENT) > BTREE_INCLUDE_PAYLOAD_MAX_SIZE)
+    {
+      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_BTREE_INCLUDE_PAYLOAD_TOO_LARGE, 1,
+	      BTREE_INCLUDE_PAYLOAD_MAX_SIZE);
+      return ER_BTREE_INCLUDE_PAYLOAD_TOO_LARGE;
+    }
+  btid->include_payload_size = DB_ALIGN (size, MAX_ALIGNMENT);
+
+  return NO_ERROR;
+}
+
 /*
  * xbtree_find_multi_uniques () - search a list of unique indexes for specified values
  * return : search return code
@@ -9599,7 +9764,8 @@ btree_replace_first_oid_with_ovfl_oid (THREAD_ENTRY * thread_p, BTID_INT * btid,
 #endif /* NDEBUG */
   /* Get last object. */
   ret = btree_record_get_last_object (thread_p, btid, &ovfl_copy_rec, BTREE_OVERFLOW_NODE, 0, &last_ovf_object.oid,
-				      &last_ovf_object.class_oid, &last_ovf_object.mvcc_info, &offset_to_ovfl_object);
+				      &last_ovf_object.class_oid, &last_ovf_object.mvcc_info, last_ovf_object.payload,
+				      &offset_to_ovfl_object);
   if (ret != NO_ERROR)
     {
       ASSERT_ERROR ();
@@ -9621,7 +9787,7 @@ btree_replace_first_oid_with_ovfl_oid (THREAD_ENTRY * thread_p, BTID_INT * btid,
 #endif /* !NDEBUG */
   ret =
     btree_leaf_get_first_object (btid, leaf_rec, &delete_helper->object_info.oid, &delete_helper->object_info.class_oid,
-				 &delete_helper->object_info.mvcc_info);
+				 &delete_helper->object_info.mvcc_info, delete_helper->object_info.payload);
   assert (OID_EQ (&save_oid, &delete_helper->object_info.oid));
 
   /* Replace first object with overflow object. */
@@ -9633,7 +9799,7 @@ btree_replace_first_oid_with_ovfl_oid (THREAD_ENTRY * thread_p, BTID_INT * btid,
 #endif /* !NDEBUG */
   LOG_RV_RECORD_SET_MODIFY_MODE (&delete_helper->leaf_addr, LOG_RV_RECORD_UPDATE_PARTIAL);
   btree_leaf_change_first_object (thread_p, leaf_rec, btid, &last_ovf_object.oid, &last_ovf_object.class_oid,
-				  &last_ovf_object.mvcc_info, NULL, &rv_undo_data_ptr,
+				  &last_ovf_object.mvcc_info, last_ovf_object.payload, NULL, &rv_undo_data_ptr,
 				  &delete_helper->rv_redo_data_ptr);
   if (spage_update (thread_p, leaf_page, search_key->slotid, leaf_rec) != SP_SUCCESS)
     {
@@ -11698,8 +11864,8 @@ btree_find_oid_from_leaf (THREAD_ENTRY * thread_p, BTID_INT * btid, RECDES * lea
       *offset_to_object = CAST_BUFLEN (buf.ptr - buf.buffer);
 
       /* Get object and all its information from record. */
-      if (btree_or_get_object (&buf, btid, BTREE_LEAF_NODE, after_key_offset, &inst_oid, &class_oid, mvcc_info) !=
-	  NO_ERROR)
+      if (btree_or_get_object (&buf, btid, BTREE_LEAF_NODE, after_key_offset, &inst_oid, &class_oid, mvcc_info, NULL)
+	  != NO_ERROR)
 	{
 	  assert_release (false);
 	  error_code = ER_FAILED;
@@ -12253,7 +12419,7 @@ btree_find_split_point (THREAD_ENTRY * thread_p, BTID_INT * btid, PAGE_PTR page_
       /* TODO: Fences currently optimize only midxkey key types. Save storage by not using fence keys when they are not
        * required. */
       max_key_len = MAX (key_len, header->max_key_len);
-      new_fence_size = LEAF_FENCE_MAX_SIZE (max_key_len) + SPAGE_SLOT_SIZE;
+      new_fence_size = LEAF_FENCE_MAX_SIZE (max_key_len) + btid->include_payload_size + SPAGE_SLOT_SIZE;
 
       /* Adjust maximum size for both leaves. */
       left_max_size -= new_fence_size;
@@ -13067,7 +13233,7 @@ btree_split_node (THREAD_ENTRY * thread_p, BTID_INT * btid, PAGE_PTR P, PAGE_PTR
 	{
 	  ret =
 	    btree_write_record (thread_p, btid, NULL, sep_key, BTREE_LEAF_NODE, BTREE_NORMAL_KEY, sep_key_len, false,
-				&btid->topclass_oid, &dummy_oid, NULL, &rec);
+				&btid->topclass_oid, &dummy_oid, NULL, NULL, &rec);
 	  if (ret != NO_ERROR)
 	    {
 	      ASSERT_ERROR ();
@@ -13275,7 +13441,7 @@ btree_split_node (THREAD_ENTRY * thread_p, BTID_INT * btid, PAGE_PTR P, PAGE_PTR
 
   ret =
     btree_write_record (thread_p, btid, &nleaf_rec, sep_key, BTREE_NON_LEAF_NODE, key_type, key_len, false, NULL, NULL,
-			NULL, &rec);
+			NULL, NULL, &rec);
   if (ret != NO_ERROR)
     {
       ASSERT_ERROR ();
@@ -13642,7 +13808,7 @@ btree_split_test (THREAD_ENTRY * thread_p, BTID_INT * btid, DB_VALUE * key, VPID
 	    {
 	      ret =
 		btree_write_record (thread_p, btid, NULL, sep_key, BTREE_LEAF_NODE, BTREE_NORMAL_KEY, sep_key_len,
-				    false, &btid->topclass_oid, &dummy_oid, NULL, &rec);
+				    false, &btid->topclass_oid, &dummy_oid, NULL, NULL, &rec);
 
 	      btree_leaf_set_flag (&rec, BTREE_LEAF_RECORD_FENCE);
 	      fence_insert = true;
@@ -13907,7 +14073,7 @@ btree_split_root (THREAD_ENTRY * thread_p, BTID_INT * btid, PAGE_PTR P, PAGE_PTR
 	{
 	  ret =
 	    btree_write_record (thread_p, btid, NULL, sep_key, BTREE_LEAF_NODE, BTREE_NORMAL_KEY, sep_key_len, false,
-				&btid->topclass_oid, &dummy_oid, NULL, &rec);
+				&btid->topclass_oid, &dummy_oid, NULL, NULL, &rec);
 	  if (ret != NO_ERROR)
 	    {
 	      goto exit_on_error;
@@ -14141,7 +14307,7 @@ btree_split_root (THREAD_ENTRY * thread_p, BTID_INT * btid, PAGE_PTR P, PAGE_PTR
 
   ret =
     btree_write_record (thread_p, btid, &nleaf_rec, neg_inf_key, BTREE_NON_LEAF_NODE, key_type, key_len, false, NULL,
-			NULL, NULL, &rec);
+			NULL, NULL, NULL, &rec);
   if (ret != NO_ERROR)
     {
       goto exit_on_error;
@@ -14174,7 +14340,7 @@ btree_split_root (THREAD_ENTRY * thread_p, BTID_INT * btid, PAGE_PTR P, PAGE_PTR
 
   ret =
     btree_write_record (thread_p, btid, &nleaf_rec, sep_key, BTREE_NON_LEAF_NODE, key_type, key_len, false, NULL, NULL,
-			NULL, &rec);
+			NULL, NULL, &rec);
   if (ret != NO_ERROR)
     {
       goto exit_on_error;
@@ -16201,8 +16367,10 @@ btree_apply_key_range_and_filter (THREAD_ENTRY * thread_p, BTREE_SCAN * bts, boo
        * the key filter can be applied to the current key value.
        */
       *is_key_filter_satisfied = true;
-      if (bts->key_filter && bts->key_filter->scan_pred->regu_list)
+      if (bts->key_filter && bts->key_filter->scan_pred->regu_list && bts->btid_int.include_attr_count <= 0)
 	{
+	  /* INCLUDE values are stored with each object; for such indexes the key filter is applied on objects by
+	   * btree_select_visible_object_for_range_scan. */
 	  ev_res = eval_key_filter (thread_p, &bts->cur_key, bts->key_filter);
 	  if (ev_res != V_TRUE)
 	    {
@@ -16339,12 +16507,13 @@ error:
  *      Dump the current key
  *
  *   bts(in): pointer to B+-tree scan structure
+ *   key(in): the current key, with the INCLUDE values of current object if index has any
  *   filter(in): key filter
  *   oid(in): the current oid
  *   iscan_id(in): index scan id
  */
 static int
-btree_dump_curr_key (THREAD_ENTRY * thread_p, BTREE_SCAN * bts, FILTER_INFO * filter, OID * oid,
+btree_dump_curr_key (THREAD_ENTRY * thread_p, BTREE_SCAN * bts, DB_VALUE * key, FILTER_INFO * filter, OID * oid,
 		     INDX_SCAN_ID * iscan_id)
 {
   HEAP_CACHE_ATTRINFO *attr_info;
@@ -16378,7 +16547,7 @@ btree_dump_curr_key (THREAD_ENTRY * thread_p, BTREE_SCAN * bts, FILTER_INFO * fi
     }
 
   error =
-    btree_attrinfo_read_dbvalues (thread_p, &(bts->cur_key), filter->btree_attr_ids, filter->btree_num_attrs, attr_info,
+    btree_attrinfo_read_dbvalues (thread_p, key, filter->btree_attr_ids, filter->btree_num_attrs, attr_info,
 				  iscan_id->indx_cov.func_index_col_id);
   if (error != NO_ERROR)
     {
@@ -19869,7 +20038,7 @@ btree_verify_leaf_node (THREAD_ENTRY * thread_p, BTID_INT * btid_int, PAGE_PTR p
        */
       oid_cnt = btree_record_get_num_oids (thread_p, btid_int, &rec, offset, BTREE_LEAF_NODE);
 
-      (void) btree_leaf_get_first_object (btid_int, &rec, &oid, &class_oid, &mvcc_info);
+      (void) btree_leaf_get_first_object (btid_int, &rec, &oid, &class_oid, &mvcc_info, NULL);
       if (btree_leaf_is_flaged (&rec, BTREE_LEAF_RECORD_FENCE))
 	{
 	  if (oid.pageid != NULL_PAGEID || oid.volid != 0 || oid.slotid != 0)
@@ -19948,7 +20117,7 @@ btree_verify_leaf_node (THREAD_ENTRY * thread_p, BTID_INT * btid_int, PAGE_PTR p
 	      {
 		or_get_oid (&buf, &class_oid);
 	      }
-	    buf.ptr += BTREE_GET_MVCC_INFO_SIZE_FROM_FLAGS (mvcc_flags);
+	    buf.ptr += BTREE_GET_MVCC_INFO_SIZE_FROM_FLAGS (mvcc_flags) + btid_int->include_payload_size;
 
 	    if (oid.pageid <= NULL_PAGEID && oid.volid <= NULL_VOLID && oid.slotid <= NULL_SLOTID)
 	      {
@@ -21612,17 +21781,19 @@ btree_or_put_mvccinfo (OR_BUF * buf, BTREE_MVCC_INFO * mvcc_info)
  * oid (out)		 : Unpacked OID.
  * class_oid (out)	 : Unpacked class OID.
  * mvcc_info (out)	 : Unpacked MVCC info.
+ * payload (out)	 : Unpacked INCLUDE payload. Can be NULL.
  */
 static char *
 btree_unpack_object (char *ptr, BTID_INT * btid_int, BTREE_NODE_TYPE node_type, RECDES * record, int after_key_offset,
-		     OID * oid, OID * class_oid, BTREE_MVCC_INFO * mvcc_info)
+		     OID * oid, OID * class_oid, BTREE_MVCC_INFO * mvcc_info, char *payload)
 {
   OR_BUF buffer;
 
   BTREE_RECORD_OR_BUF_INIT (buffer, record);
   buffer.ptr = ptr;
 
-  if (btree_or_get_object (&buffer, btid_int, node_type, after_key_offset, oid, class_oid, mvcc_info) != NO_ERROR)
+  if (btree_or_get_object (&buffer, btid_int, node_type, after_key_offset, oid, class_oid, mvcc_info, payload)
+      != NO_ERROR)
     {
       assert (false);
       return NULL;
@@ -21659,6 +21830,250 @@ btree_pack_object (char *ptr, BTID_INT * btid_int, BTREE_NODE_TYPE node_type, RE
   return buffer.ptr;
 }
 
+/*
+ * btree_found_object_get_payload () - Copy the INCLUDE payload of an object found in leaf record or in an overflow
+ *				       page.
+ *
+ * return		 : Error code.
+ * thread_p (in)	 : Thread entry.
+ * btid_int (in)	 : B-tree info.
+ * leaf_page (in)	 : Leaf page.
+ * leaf_record (in)	 : Leaf record.
+ * offset_after_key (in) : Offset after key in leaf record.
+ * found_page (in)	 : Page where object was found (leaf or overflow page).
+ * offset_to_object (in) : Offset to object in its record.
+ * payload (out)	 : INCLUDE payload.
+ */
+static int
+btree_found_object_get_payload (THREAD_ENTRY * thread_p, BTID_INT * btid_int, PAGE_PTR leaf_page,
+				RECDES * leaf_record, int offset_after_key, PAGE_PTR found_page, int offset_to_object,
+				char *payload)
+{
+  RECDES ovf_record;
+  OID oid, class_oid;
+  BTREE_MVCC_INFO mvcc_info;
+
+  if (btid_int->include_payload_size == 0)
+    {
+      return NO_ERROR;
+    }
+
+  if (found_page == leaf_page)
+    {
+      if (btree_unpack_object (leaf_record->data + offset_to_object, btid_int, BTREE_LEAF_NODE, leaf_record,
+			       offset_after_key, &oid, &class_oid, &mvcc_info, payload) == NULL)
+	{
+	  assert_release (false);
+	  return ER_FAILED;
+	}
+      return NO_ERROR;
+    }
+
+  if (spage_get_record (thread_p, found_page, 1, &ovf_record, PEEK) != S_SUCCESS)
+    {
+      assert_release (false);
+      return ER_FAILED;
+    }
+  if (btree_unpack_object (ovf_record.data + offset_to_object, btid_int, BTREE_OVERFLOW_NODE, &ovf_record, 0, &oid,
+			   &class_oid, &mvcc_info, payload) == NULL)
+    {
+      assert_release (false);
+      return ER_FAILED;
+    }
+  return NO_ERROR;
+}
+
+/*
+ * btree_key_is_null () - Is key NULL? For indexes having INCLUDE columns, only the key columns are checked.
+ *
+ * return	 : True if key is NULL.
+ * btid_int (in) : B-tree info.
+ * key (in)	 : Key value.
+ */
+bool
+btree_key_is_null (BTID_INT * btid_int, DB_VALUE * key)
+{
+  DB_MIDXKEY *midxkey;
+  int i;
+
+  if (key == NULL || DB_IS_NULL (key) || btree_multicol_key_is_null (key))
+    {
+      return true;
+    }
+  if (btid_int->include_attr_count <= 0 || DB_VALUE_TYPE (key) != DB_TYPE_MIDXKEY)
+    {
+      return false;
+    }
+
+  midxkey = db_get_midxkey (key);
+  if (midxkey->min_max_val.position != -1)
+    {
+      return false;
+    }
+  for (i = 0; i < btid_int->include_attr_start; i++)
+    {
+      if (OR_MULTI_ATT_IS_BOUND (midxkey->buf, i))
+	{
+	  return false;
+	}
+    }
+  /* Only INCLUDE columns (and the deduplicate key) are bound. */
+  return true;
+}
+
+/*
+ * btree_key_has_include_values () - Does key have any INCLUDE value bound?
+ *
+ * return	 : True if at least one INCLUDE column of key is bound.
+ * btid_int (in) : B-tree info.
+ * key (in)	 : Key value.
+ */
+static bool
+btree_key_has_include_values (BTID_INT * btid_int, DB_VALUE * key)
+{
+  DB_MIDXKEY *midxkey;
+  int i;
+
+  if (btid_int->include_attr_count <= 0 || key == NULL || DB_VALUE_TYPE (key) != DB_TYPE_MIDXKEY)
+    {
+      return false;
+    }
+
+  midxkey = db_get_midxkey (key);
+  if (midxkey == NULL || midxkey->domain == NULL
+      || midxkey->domain->precision < btid_int->include_attr_start + btid_int->include_attr_count)
+    {
+      /* Partial key of search. */
+      return false;
+    }
+  for (i = btid_int->include_attr_start; i < btid_int->include_attr_start + btid_int->include_attr_count; i++)
+    {
+      if (OR_MULTI_ATT_IS_BOUND (midxkey->buf, i))
+	{
+	  return true;
+	}
+    }
+  return false;
+}
+
+/*
+ * btree_key_get_include_payload () - Copy the INCLUDE values of a key into an object payload.
+ *
+ * return	     : Error code.
+ * btid_int (in)     : B-tree info.
+ * key (in)	     : Key value with INCLUDE values. Midxkey domain must be set.
+ * payload (out)     : Object INCLUDE payload.
+ * include_len (out) : If not NULL, outputs the size taken by INCLUDE values in key disk image.
+ */
+static int
+btree_key_get_include_payload (BTID_INT * btid_int, DB_VALUE * key, char *payload, int *include_len)
+{
+  DB_MIDXKEY *midxkey;
+  int image_len;
+
+  if (include_len != NULL)
+    {
+      *include_len = 0;
+    }
+  if (btid_int->include_attr_count <= 0)
+    {
+      return NO_ERROR;
+    }
+  memset (payload, 0, btid_int->include_payload_size);
+  if (!btree_key_has_include_values (btid_int, key))
+    {
+      return NO_ERROR;
+    }
+
+  midxkey = db_get_midxkey (key);
+  image_len =
+    pr_midxkey_get_elements_image (midxkey, btid_int->include_attr_start, btid_int->include_attr_count, payload,
+				   btid_int->include_payload_size);
+  if (image_len < 0)
+    {
+      /* Payload size is computed for the largest values of INCLUDE columns. */
+      assert_release (false);
+      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_BTREE_INCLUDE_PAYLOAD_TOO_LARGE, 1,
+	      BTREE_INCLUDE_PAYLOAD_MAX_SIZE);
+      return ER_BTREE_INCLUDE_PAYLOAD_TOO_LARGE;
+    }
+
+  if (include_len != NULL)
+    {
+      /* Bound bits are not repeated in key. */
+      *include_len = image_len - OR_MULTI_BOUND_BIT_BYTES (midxkey->domain->precision);
+    }
+  return NO_ERROR;
+}
+
+/*
+ * btree_key_move_include_values () - Move the INCLUDE values of a key into an object payload.
+ *
+ * return	  : Error code.
+ * btid_int (in)  : B-tree info.
+ * key (in/out)	  : Key value with INCLUDE values. Outputs the key as it is stored in b-tree.
+ * payload (out)  : Object INCLUDE payload.
+ */
+int
+btree_key_move_include_values (BTID_INT * btid_int, DB_VALUE * key, char *payload)
+{
+  int error_code;
+
+  if (btid_int->include_attr_count <= 0)
+    {
+      return NO_ERROR;
+    }
+
+  error_code = btree_key_get_include_payload (btid_int, key, payload, NULL);
+  if (error_code != NO_ERROR)
+    {
+      return error_code;
+    }
+  if (btree_key_has_include_values (btid_int, key))
+    {
+      pr_midxkey_remove_elements (key, btid_int->include_attr_start, btid_int->include_attr_count);
+    }
+  return NO_ERROR;
+}
+
+/*
+ * btree_key_add_include_payload () - Bind the INCLUDE values of an object payload back into its key.
+ *
+ * return	 : Error code.
+ * btid_int (in) : B-tree info.
+ * key (in)	 : Key value as stored in b-tree (without INCLUDE values).
+ * payload (in)	 : Object INCLUDE payload.
+ * full_key (out) : Buffer for key with INCLUDE values. Must be cleared by caller.
+ * key_out (out) : Outputs full_key for indexes having INCLUDE columns, key otherwise.
+ *
+ * NOTE: Undo of an object removal inserts the object again from the logged key. The key must carry the INCLUDE
+ *	 values, since the insert takes the object payload from the key.
+ */
+static int
+btree_key_add_include_payload (BTID_INT * btid_int, DB_VALUE * key, const char *payload, DB_VALUE * full_key,
+			       DB_VALUE ** key_out)
+{
+  int error_code;
+
+  db_make_null (full_key);
+  *key_out = key;
+
+  if (btid_int->include_attr_count <= 0 || key == NULL || DB_VALUE_TYPE (key) != DB_TYPE_MIDXKEY)
+    {
+      return NO_ERROR;
+    }
+
+  error_code =
+    pr_midxkey_add_elements_image (full_key, key, payload, btid_int->include_attr_start, btid_int->include_attr_count);
+  if (error_code != NO_ERROR)
+    {
+      ASSERT_ERROR ();
+      return error_code;
+    }
+  *key_out = full_key;
+  return NO_ERROR;
+}
+
 /*
  * btree_or_get_object () - Get object, class OID and its MVCC info from buffer pointing in a b-tree record.
  *
@@ -21670,6 +22085,7 @@ btree_pack_object (char *ptr, BTID_INT * btid_int, BTREE_NODE_TYPE node_type, RE
  * oid (out)		  : Outputs OID of object.
  * class_oid (out)	  : Outputs OID of object's class.
  * mvcc_info (out)	  : Outputs MVCC info for object.
+ * payload (out)	  : Outputs the INCLUDE payload of object. Can be NULL.
  *
  * NOTE: Buffer.buffer should point to start of b-tree record.
  * NOTE: Buffer pointer will be moved after read object.
@@ -21678,7 +22094,7 @@ btree_pack_object (char *ptr, BTID_INT * btid_int, BTREE_NODE_TYPE node_type, RE
  */
 static int
 btree_or_get_object (OR_BUF * buf, BTID_INT * btid_int, BTREE_NODE_TYPE node_type, int after_key_offset, OID * oid,
-		     OID * class_oid, BTREE_MVCC_INFO * mvcc_info)
+		     OID * class_oid, BTREE_MVCC_INFO * mvcc_info, char *payload)
 {
   short mvcc_flags = 0;		/* MVCC flags read from object OID. */
   int error_code = NO_ERROR;	/* Error code. */
@@ -21743,6 +22159,21 @@ btree_or_get_object (OR_BUF * buf, BTID_INT * btid_int, BTREE_NODE_TYPE node_typ
       return error_code;
     }
 
+  if (btid_int->include_payload_size > 0)
+    {
+      /* Read INCLUDE payload. */
+      if (payload != NULL)
+	{
+	  memcpy (payload, buf->ptr, btid_int->include_payload_size);
+	}
+      error_code = or_advance (buf, btid_int->include_payload_size);
+      if (error_code != NO_ERROR)
+	{
+	  assert (false);
+	  return error_code;
+	}
+    }
+
   if (is_first_of_leaf)
     {
       /* Advance after the first key. */
@@ -21852,6 +22283,16 @@ btree_or_put_object (OR_BUF * buf, BTID_INT * btid_int, BTREE_NODE_TYPE node_typ
 
   /* Add MVCC info */
   error_code = btree_or_put_mvccinfo (buf, &object_info->mvcc_info);
+  if (error_code != NO_ERROR)
+    {
+      return error_code;
+    }
+
+  if (btid_int->include_payload_size > 0)
+    {
+      /* Add INCLUDE payload */
+      error_code = or_put_data (buf, object_info->payload, btid_int->include_payload_size);
+    }
   return error_code;
 }
 
@@ -22671,12 +23112,16 @@ btree_search_key_and_apply_functions (THREAD_ENTRY * thread_p, BTID * btid, BTID
   bool stop = false;		/* Set to true to stop advancing in b-tree. */
   bool restart = false;		/* Set to true to restart b-tree traversal from root. */
   BTREE_SEARCH_KEY_HELPER local_search_key;	/* Store search key result if search key pointer argument is NULL. */
+  DB_VALUE *root_key = key;	/* Key given to root function. */
+  DB_VALUE stripped_key;	/* Key without INCLUDE values, for indexes having INCLUDE columns. */
 
   /* Assert expected arguments. */
   assert (btid != NULL);
   assert (key != NULL);
   assert (advance_function != NULL);
 
+  db_make_null (&stripped_key);
+
   if (leaf_page_ptr != NULL)
     {
       /* Initialize leaf_page_ptr as NULL. */
@@ -22707,6 +23152,8 @@ start_btree_traversal:
   is_leaf = false;
   search_key->result = BTREE_KEY_NOTFOUND;
   search_key->slotid = NULL_SLOTID;
+  key = root_key;
+  pr_clear_value (&stripped_key);
 
   /* Make sure current page has been unfixed before restarting traversal. */
   if (crt_page != NULL)
@@ -22742,6 +23189,30 @@ start_btree_traversal:
   /* Root page must be fixed. */
   assert (crt_page != NULL);
 
+  if (btree_key_has_include_values (btid_int, key))
+    {
+      /* INCLUDE values are not part of stored keys. The root function has seen them; search without them. */
+      error_code = pr_clone_value (key, &stripped_key);
+      if (error_code != NO_ERROR)
+	{
+	  ASSERT_ERROR ();
+	  goto error;
+	}
+      pr_midxkey_remove_elements (&stripped_key, btid_int->include_attr_start, btid_int->include_attr_count);
+      key = &stripped_key;
+
+      if (is_leaf)
+	{
+	  /* Root is also leaf and was searched with the full key. */
+	  error_code = btree_search_leaf_page (thread_p, btid_int, crt_page, key, search_key);
+	  if (error_code != NO_ERROR)
+	    {
+	      ASSERT_ERROR ();
+	      goto error;
+	    }
+	}
+    }
+
   /* Advance until leaf page is found. */
   while (!is_leaf)
     {
@@ -22826,6 +23297,7 @@ end:
       /* Unfix leaf page. */
       pgbuf_unfix (thread_p, crt_page);
     }
+  pr_clear_value (&stripped_key);
   return NO_ERROR;
 
 error:
@@ -22839,6 +23311,7 @@ error:
     {
       pgbuf_unfix (thread_p, advance_page);
     }
+  pr_clear_value (&stripped_key);
   assert (error_code != NO_ERROR);
   ASSERT_ERROR ();
   return error_code;
@@ -23218,7 +23691,7 @@ btree_key_find_and_lock_unique_of_unique (THREAD_ENTRY * thread_p, BTID_INT * bt
 	  goto error_or_not_found;
 	}
       /* Get first object */
-      error_code = btree_leaf_get_first_object (btid_int, &record, &unique_oid, &unique_class_oid, &mvcc_info);
+      error_code = btree_leaf_get_first_object (btid_int, &record, &unique_oid, &unique_class_oid, &mvcc_info, NULL);
       if (error_code != NO_ERROR)
 	{
 	  /* Error! */
@@ -23475,7 +23948,7 @@ btree_key_find_and_lock_unique_of_non_unique (THREAD_ENTRY * thread_p, BTID_INT
 	  /* Get first object. */
 	  error_code =
 	    btree_or_get_object (&buf, btid_int, node_type, offset_after_key, &unique_oid, &unique_class_oid,
-				 &mvcc_info);
+				 &mvcc_info, NULL);
 	  if (error_code != NO_ERROR)
 	    {
 	      ASSERT_ERROR ();
@@ -23539,7 +24012,7 @@ btree_key_find_and_lock_unique_of_non_unique (THREAD_ENTRY * thread_p, BTID_INT
 	  assert (buf.ptr < buf.endptr);
 	  error_code =
 	    btree_or_get_object (&buf, btid_int, node_type, offset_after_key, &unique_oid, &unique_class_oid,
-				 &mvcc_info);
+				 &mvcc_info, NULL);
 	  if (error_code != NO_ERROR)
 	    {
 	      ASSERT_ERROR ();
@@ -23914,7 +24387,8 @@ btree_record_process_objects (THREAD_ENTRY * thread_p, BTID_INT * btid_int, BTRE
       object_ptr = buffer.ptr;
 
       /* Get object data: OID, class OID and MVCC info. */
-      error_code = btree_or_get_object (&buffer, btid_int, node_type, after_key_offset, &oid, &class_oid, &mvcc_info);
+      error_code =
+	btree_or_get_object (&buffer, btid_int, node_type, after_key_offset, &oid, &class_oid, &mvcc_info, NULL);
       if (error_code != NO_ERROR)
 	{
 	  /* Unexpected error. */
@@ -24322,6 +24796,67 @@ xbtree_find_unique (THREAD_ENTRY * thread_p, BTID * btid, SCAN_OPERATION_TYPE sc
   return BTREE_KEY_NOTFOUND;
 }
 
+/*
+ * btree_find_unique_visible () - Find the object version visible to the current snapshot in key of unique index.
+ *
+ * return	   : BTREE_SEARCH result.
+ * thread_p (in)   : Thread entry.
+ * btid (in)	   : B-tree identifier.
+ * key (in)	   : Key value. Must have the type of the index key.
+ * class_oid (in)  : Class OID. Objects of other classes are ignored.
+ * snapshot (in)   : Snapshot used to filter objects not visible. If NULL, objects are not filtered.
+ * oid (out)	   : Found object OID.
+ *
+ * NOTE: Unlike xbtree_find_unique with S_SELECT, the object is neither locked nor looked up with a dirty snapshot.
+ *	 Given the snapshot of an index scan, the result is the same as a range scan of the key with
+ *	 btree_range_scan_select_visible_oids, which makes this suitable for point lookups of index scans. Like the
+ *	 range scan, this does not lock the object; scans that need it locked do so when fetching it from the heap.
+ *	 The caller is expected to hold a lock on the class.
+ */
+BTREE_SEARCH
+btree_find_unique_visible (THREAD_ENTRY * thread_p, BTID * btid, DB_VALUE * key, OID * class_oid,
+			   MVCC_SNAPSHOT * snapshot, OID * oid)
+{
+  BTREE_FIND_UNIQUE_HELPER find_unique_helper = BTREE_FIND_UNIQUE_HELPER_INITIALIZER;
+  int error_code = NO_ERROR;
+
+  assert (btid != NULL);
+  assert (class_oid != NULL && !OID_ISNULL (class_oid));
+  assert (oid != NULL);
+
+  PERF_UTIME_TRACKER_START (thread_p, &find_unique_helper.time_track);
+
+  OID_SET_NULL (oid);
+
+  if (key == NULL || db_value_is_null (key) || btree_multicol_key_is_null (key))
+    {
+      /* Early out: Consider key is not found. */
+      return BTREE_KEY_NOTFOUND;
+    }
+
+  COPY_OID (&find_unique_helper.match_class_oid, class_oid);
+  find_unique_helper.lock_mode = NULL_LOCK;
+  find_unique_helper.snapshot = snapshot;
+
+  error_code =
+    btree_search_key_and_apply_functions (thread_p, btid, NULL, key, NULL, NULL, btree_advance_and_find_key, NULL,
+					  btree_key_find_unique_version_oid, &find_unique_helper, NULL, NULL);
+  if (error_code != NO_ERROR)
+    {
+      ASSERT_ERROR ();
+      return BTREE_ERROR_OCCURRED;
+    }
+
+  if (find_unique_helper.found_object)
+    {
+      assert (!OID_ISNULL (&find_unique_helper.oid));
+      COPY_OID (oid, &find_unique_helper.oid);
+      return BTREE_KEY_FOUND;
+    }
+
+  return BTREE_KEY_NOTFOUND;
+}
+
 /*
  * btree_count_oids () - BTREE_PROCESS_OBJECT_FUNCTION - Increment object counter.
  *
@@ -24424,15 +24959,26 @@ btree_range_scan_start (THREAD_ENTRY * thread_p, BTREE_SCAN * bts)
     }
   else
     {
-      /* Has lower limit. Try to locate the key. */
-      error_code =
-	btree_locate_key (thread_p, &bts->btid_int, bts->key_range.lower_key, &bts->C_vpid, &bts->slot_id,
-			  &bts->C_page, &found);
+      /* Has lower limit. Try to locate the key, first in the leaf where the previous range started. */
+      error_code = btree_range_scan_locate_key_from_hint (thread_p, bts, bts->key_range.lower_key, &found);
       if (error_code != NO_ERROR)
 	{
 	  ASSERT_ERROR ();
 	  return error_code;
 	}
+      if (bts->C_page == NULL)
+	{
+	  error_code =
+	    btree_locate_key (thread_p, &bts->btid_int, bts->key_range.lower_key, &bts->C_vpid, &bts->slot_id,
+			      &bts->C_page, &found);
+	  if (error_code != NO_ERROR)
+	    {
+	      ASSERT_ERROR ();
+	      return error_code;
+	    }
+	}
+      VPID_COPY (&bts->hint_vpid, &bts->C_vpid);
+      BTID_COPY (&bts->hint_btid, bts->btid_int.sys_btid);
       if (!found)
 	{
 	  if (bts->use_desc_index)
@@ -24476,6 +25022,93 @@ btree_range_scan_start (THREAD_ENTRY * thread_p, BTREE_SCAN * bts)
   return NO_ERROR;
 }
 
+/*
+ * btree_range_scan_locate_key_from_hint () - Try to locate the starting key of a range in the leaf where the previous
+ *					       range of the same scan started.
+ *
+ * return	 : Error code.
+ * thread_p (in) : Thread entry.
+ * bts (in/out)	 : B-tree scan. If key belongs to the hinted leaf, C_page, C_vpid and slot_id are set like
+ *		   btree_locate_key does. Otherwise C_page is left NULL.
+ * key (in)	 : Key to locate.
+ * found (out)	 : Output true if key was found in the leaf.
+ *
+ * NOTE: Repeated probes of the same index, like the inner scan of an index nested-loop join whose outer rows come in
+ *	 key order, usually land in the same or a close leaf. A key that is between two keys of a valid leaf belongs to
+ *	 that leaf, so the descent from root can be skipped. Pages are never reused by other files while the index is
+ *	 in use, so checking the b-tree is the same as the one of the hint is enough. Like btree_range_scan_resume, the
+ *	 key is first checked against the first and last key of the leaf.
+ */
+static int
+btree_range_scan_locate_key_from_hint (THREAD_ENTRY * thread_p, BTREE_SCAN * bts, DB_VALUE * key, bool * found)
+{
+  BTREE_SEARCH_KEY_HELPER search_key = BTREE_SEARCH_KEY_HELPER_INITIALIZER;
+  int error_code = NO_ERROR;
+
+  assert (bts->C_page == NULL);
+
+  *found = false;
+  if (VPID_ISNULL (&bts->hint_vpid) || !BTID_IS_EQUAL (&bts->hint_btid, bts->btid_int.sys_btid)
+      || bts->hint_misses > bts->hint_hits + BTREE_LEAF_HINT_MISS_TOLERANCE)
+    {
+      /* No hint or it is not worth trying. */
+      return NO_ERROR;
+    }
+
+  error_code =
+    pgbuf_fix_if_not_deallocated (thread_p, &bts->hint_vpid, PGBUF_LATCH_READ, PGBUF_UNCONDITIONAL_LATCH,
+				  &bts->C_page);
+  if (error_code != NO_ERROR)
+    {
+      ASSERT_ERROR ();
+      return error_code;
+    }
+  if (bts->C_page == NULL)
+    {
+      /* Leaf was deallocated. */
+      VPID_SET_NULL (&bts->hint_vpid);
+      return NO_ERROR;
+    }
+
+  if (BTREE_IS_PAGE_VALID_LEAF (thread_p, bts->C_page))
+    {
+      /* Check the key is inside the leaf first. The binary search skips the common prefix of the leaf and cannot tell
+       * a key of another leaf from one of this leaf. */
+      error_code = btree_leaf_is_key_between_min_max (thread_p, &bts->btid_int, bts->C_page, key, &search_key);
+      if (error_code != NO_ERROR)
+	{
+	  pgbuf_unfix_and_init (thread_p, bts->C_page);
+	  ASSERT_ERROR ();
+	  return error_code;
+	}
+      if (search_key.result == BTREE_KEY_BETWEEN)
+	{
+	  /* We need to find slot of key. */
+	  error_code = btree_search_leaf_page (thread_p, &bts->btid_int, bts->C_page, key, &search_key);
+	  if (error_code != NO_ERROR)
+	    {
+	      pgbuf_unfix_and_init (thread_p, bts->C_page);
+	      ASSERT_ERROR ();
+	      return error_code;
+	    }
+	}
+      if (search_key.result == BTREE_KEY_FOUND || search_key.result == BTREE_KEY_BETWEEN)
+	{
+	  /* Key belongs to this leaf. */
+	  VPID_COPY (&bts->C_vpid, &bts->hint_vpid);
+	  bts->slot_id = search_key.slotid;
+	  *found = (search_key.result == BTREE_KEY_FOUND);
+	  bts->hint_hits++;
+	  return NO_ERROR;
+	}
+    }
+
+  /* Key is not in this leaf or page is no longer a leaf. Caller has to locate the key from root. */
+  pgbuf_unfix_and_init (thread_p, bts->C_page);
+  bts->hint_misses++;
+  return NO_ERROR;
+}
+
 /*
  * btree_range_scan_resume () - Function used to resume range scans after being interrupted. It will try to resume from
  *				saved leaf node (if possible). Otherwise, current key must looked up starting from
@@ -25610,6 +26243,43 @@ btree_range_scan_select_visible_oids (THREAD_ENTRY * thread_p, BTREE_SCAN * bts)
   return NO_ERROR;
 }
 
+/*
+ * btree_range_scan_get_include_key () - Get current key of range scan with the INCLUDE values of an object bound.
+ *
+ * return	   : Error code.
+ * bts (in)	   : B-tree scan.
+ * record (in)	   : Leaf (bts->key_record) or overflow record containing the object.
+ * object_ptr (in) : Pointer in record to object.
+ * full_key (out)  : Buffer for key with INCLUDE values. Must be cleared by caller.
+ * key_out (out)   : Outputs key with INCLUDE values.
+ */
+static int
+btree_range_scan_get_include_key (BTREE_SCAN * bts, RECDES * record, char *object_ptr, DB_VALUE * full_key,
+				  DB_VALUE ** key_out)
+{
+  OR_BUF buffer;
+  OID oid;
+  OID class_oid;
+  BTREE_MVCC_INFO mvcc_info;
+  char payload[BTREE_INCLUDE_PAYLOAD_MAX_SIZE];
+  BTREE_NODE_TYPE node_type;
+  int error_code = NO_ERROR;
+
+  node_type = record == &bts->key_record ? BTREE_LEAF_NODE : BTREE_OVERFLOW_NODE;
+
+  BTREE_RECORD_OR_BUF_INIT (buffer, record);
+  buffer.ptr = object_ptr;
+  error_code =
+    btree_or_get_object (&buffer, &bts->btid_int, node_type, bts->offset, &oid, &class_oid, &mvcc_info, payload);
+  if (error_code != NO_ERROR)
+    {
+      assert_release (false);
+      return error_code;
+    }
+
+  return btree_key_add_include_payload (&bts->btid_int, &bts->cur_key, payload, full_key, key_out);
+}
+
 /*
  * btree_select_visible_object_for_range_scan () - BTREE_PROCESS_OBJECT_FUNCTION
  *						   Function handles each found object based on type of index scan.
@@ -25618,7 +26288,7 @@ btree_range_scan_select_visible_oids (THREAD_ENTRY * thread_p, BTREE_SCAN * bts)
  * thread_p (in)   : Thread entry.
  * btid_int (in)   : B-tree info.
  * record (in)	   : Index record containing one key's objects.
- * object_ptr (in) : Pointer in record to current object (not used).
+ * object_ptr (in) : Pointer in record to current object.
  * oid (in)	   : Current object OID.
  * class_oid (in)  : Current object class OID.
  * mvcc_info (in)  : Current object MVCC info.
@@ -25634,6 +26304,9 @@ btree_select_visible_object_for_range_scan (THREAD_ENTRY * thread_p, BTID_INT *
   int error_code = NO_ERROR;
   MVCC_SNAPSHOT *snapshot = NULL;
   MVCC_REC_HEADER mvcc_header_for_snapshot;
+  DB_VALUE include_key;
+  DB_VALUE *curr_key = NULL;
+  DB_LOGICAL ev_res;
 
   /* Assert expected arguments. */
   assert (args != NULL);
@@ -25704,6 +26377,34 @@ btree_select_visible_object_for_range_scan (THREAD_ENTRY * thread_p, BTID_INT *
       /* Class was matched. */
     }
 
+  curr_key = &bts->cur_key;
+  db_make_null (&include_key);
+  if (bts->btid_int.include_attr_count > 0
+      && ((bts->key_filter != NULL && bts->key_filter->scan_pred->regu_list != NULL) || BTS_IS_INDEX_COVERED (bts)))
+    {
+      /* Key filter and covering index need the INCLUDE values of this object. */
+      error_code = btree_range_scan_get_include_key (bts, record, object_ptr, &include_key, &curr_key);
+      if (error_code != NO_ERROR)
+	{
+	  ASSERT_ERROR ();
+	  goto end;
+	}
+      if (bts->key_filter != NULL && bts->key_filter->scan_pred->regu_list != NULL)
+	{
+	  ev_res = eval_key_filter (thread_p, curr_key, bts->key_filter);
+	  if (ev_res == V_ERROR)
+	    {
+	      ASSERT_ERROR_AND_SET (error_code);
+	      goto end;
+	    }
+	  if (ev_res != V_TRUE)
+	    {
+	      /* Object does not satisfy key filter. */
+	      goto end;
+	    }
+	}
+    }
+
   /* Select object. */
 
   /* Check key limit filters */
@@ -25716,7 +26417,7 @@ btree_select_visible_object_for_range_scan (THREAD_ENTRY * thread_p, BTID_INT *
       /* Do not copy object. Just decrement key_limit_lower until it is 0. */
       assert (!BTS_IS_INDEX_ILS (bts));
       (*bts->key_limit_lower)--;
-      return NO_ERROR;
+      goto end;
     }
   /* No lower key limit or lower key limit was already reached. */
 
@@ -25727,7 +26428,7 @@ btree_select_visible_object_for_range_scan (THREAD_ENTRY * thread_p, BTID_INT *
       assert (!BTS_IS_INDEX_ILS (bts));
       bts->end_scan = true;
       *stop = true;
-      return NO_ERROR;
+      goto end;
     }
   /* No upper key limit or upper key limit was not reached yet. */
 
@@ -25737,7 +26438,7 @@ btree_select_visible_object_for_range_scan (THREAD_ENTRY * thread_p, BTID_INT *
       /* Just count. */
       assert (!BTS_IS_INDEX_ILS (bts));
       BTS_INCREMENT_READ_OIDS (bts);
-      return NO_ERROR;
+      goto end;
     }
   /* Read object. */
 
@@ -25756,7 +26457,7 @@ btree_select_visible_object_for_range_scan (THREAD_ENTRY * thread_p, BTID_INT *
       if (error_code != NO_ERROR)
 	{
 	  ASSERT_ERROR ();
-	  return error_code;
+	  goto end;
 	}
       if (!mro_continue)
 	{
@@ -25771,7 +26472,7 @@ btree_select_visible_object_for_range_scan (THREAD_ENTRY * thread_p, BTID_INT *
 	  BTS_INCREMENT_READ_OIDS (bts);
 	}
       /* Finished handling object for MRO. */
-      return NO_ERROR;
+      goto end;
     }
 
   /* Possible scans that can reach this code: - Covering index. - ISS, if current op is ISS_OP_DO_RANGE_SEARCH. -
@@ -25796,30 +26497,30 @@ btree_select_visible_object_for_range_scan (THREAD_ENTRY * thread_p, BTID_INT *
 	  if (error_code != NO_ERROR)
 	    {
 	      ASSERT_ERROR ();
-	      return error_code;
+	      goto end;
 	    }
 
 	  /* Covering index. */
-	  error_code = btree_dump_curr_key (thread_p, bts, bts->key_filter, oid, bts->index_scan_idp);
+	  error_code = btree_dump_curr_key (thread_p, bts, curr_key, bts->key_filter, oid, bts->index_scan_idp);
 	  if (error_code != NO_ERROR)
 	    {
 	      ASSERT_ERROR ();
-	      return error_code;
+	      goto end;
 	    }
 	  btree_clear_key_value (&bts->clear_cur_key, &bts->cur_key);
 	}
       else
 	{
-	  error_code = btree_dump_curr_key (thread_p, bts, bts->key_filter, oid, bts->index_scan_idp);
+	  error_code = btree_dump_curr_key (thread_p, bts, curr_key, bts->key_filter, oid, bts->index_scan_idp);
 	  if (error_code != NO_ERROR)
 	    {
 	      ASSERT_ERROR ();
-	      return error_code;
+	      goto end;
 	    }
 	}
 
       BTS_INCREMENT_READ_OIDS (bts);
-      return NO_ERROR;
+      goto end;
     }
 
   /* Possible scans that can reach this code: - ISS, if current op is ISS_OP_DO_RANGE_SEARCH. - Regular index range
@@ -25829,7 +26530,9 @@ btree_select_visible_object_for_range_scan (THREAD_ENTRY * thread_p, BTID_INT *
   assert (HEAP_ISVALID_OID (thread_p, oid) != DISK_INVALID);
   assert (HEAP_ISVALID_OID (thread_p, bts->index_scan_idp->oid_list->oidp) != DISK_INVALID);
 
-  return NO_ERROR;
+end:
+  pr_clear_value (&include_key);
+  return error_code;
 }
 
 /*
@@ -26447,6 +27150,7 @@ btree_fix_root_for_insert (THREAD_ENTRY * thread_p, BTID * btid, BTID_INT * btid
   OID *notification_class_oid;
   int error_code;
   int key_len;
+  int include_len = 0;
 
   /* Assert expected arguments. */
   assert (insert_helper != NULL);
@@ -26504,6 +27208,13 @@ btree_fix_root_for_insert (THREAD_ENTRY * thread_p, BTID * btid, BTID_INT * btid
     {
       key->data.midxkey.domain = btid_int->key_type;
     }
+  /* INCLUDE values are kept in the object payload, outside the key. */
+  error_code = btree_key_get_include_payload (btid_int, key, insert_helper->obj_info.payload, &include_len);
+  if (error_code != NO_ERROR)
+    {
+      goto error;
+    }
+  insert_helper->is_null = btree_key_is_null (btid_int, key);
   if (insert_helper->log_operations && insert_helper->printed_key == NULL)
     {
       /* This is postponed here to make sure midxkey domain was initialized. */
@@ -26527,7 +27238,7 @@ btree_fix_root_for_insert (THREAD_ENTRY * thread_p, BTID * btid, BTID_INT * btid
 	  /* Top class OID is not packed for recovery. Save it here. */
 	  COPY_OID (BTREE_INSERT_CLASS_OID (insert_helper), &btid_int->topclass_oid);
 	}
-      key_len = btree_get_disk_size_of_key (key);
+      key_len = btree_get_disk_size_of_key (key) - include_len;
       insert_helper->key_len_in_page = BTREE_GET_KEY_LEN_IN_PAGE (key_len);
       return NO_ERROR;
     }
@@ -26617,7 +27328,7 @@ btree_fix_root_for_insert (THREAD_ENTRY * thread_p, BTID * btid, BTID_INT * btid
   assert (btree_is_insert_object_purpose (insert_helper->purpose));
 
   /* Check if key length is too big and if an overflow key file needs to be created. */
-  key_len = btree_get_disk_size_of_key (key);
+  key_len = btree_get_disk_size_of_key (key) - include_len;
   if (key_len >= BTREE_MAX_KEYLEN_INPAGE && VFID_ISNULL (&btid_int->ovfid))
     {
       /* Promote latch (if required). */
@@ -26746,7 +27457,7 @@ btree_get_max_new_data_size (THREAD_ENTRY * thread_p, BTID_INT * btid_int, PAGE_
       else
 	{
 	  /* A new entry max size (including new slot). */
-	  return LEAF_ENTRY_MAX_SIZE (key_len) + SPAGE_SLOT_SIZE;
+	  return LEAF_ENTRY_MAX_SIZE (key_len) + btid_int->include_payload_size + SPAGE_SLOT_SIZE;
 	}
 
     case BTREE_OP_INSERT_MVCC_DELID:
@@ -27664,7 +28375,7 @@ btree_key_insert_new_key (THREAD_ENTRY * thread_p, BTID_INT * btid_int, DB_VALUE
   error_code =
     btree_write_record (thread_p, btid_int, NULL, new_key, BTREE_LEAF_NODE, key_type, key_len, false,
 			BTREE_INSERT_CLASS_OID (insert_helper), BTREE_INSERT_OID (insert_helper),
-			BTREE_INSERT_MVCC_INFO (insert_helper), &record);
+			BTREE_INSERT_MVCC_INFO (insert_helper), insert_helper->obj_info.payload, &record);
   if (new_key == &local_key)
     {
       pr_clear_value (&local_key);
@@ -27830,12 +28541,14 @@ btree_key_insert_does_leaf_need_split (THREAD_ENTRY * thread_p, BTID_INT * btid_
   if (search_key->result == BTREE_KEY_FOUND)
     {
       /* Does a new object fit the page? */
-      return (BTREE_OBJECT_MAX_SIZE > spage_get_free_space_without_saving (thread_p, leaf_page, NULL));
+      return (BTREE_OBJECT_MAX_SIZE + btid_int->include_payload_size
+	      > spage_get_free_space_without_saving (thread_p, leaf_page, NULL));
     }
   else
     {
       /* Does a new key fit the page? */
-      max_new_data_size = BTREE_NEW_ENTRY_MAX_SIZE (insert_helper->key_len_in_page, BTREE_LEAF_NODE);
+      max_new_data_size =
+	BTREE_NEW_ENTRY_MAX_SIZE (insert_helper->key_len_in_page, BTREE_LEAF_NODE) + btid_int->include_payload_size;
       return (max_new_data_size > spage_max_space_for_new_record (thread_p, leaf_page));
     }
 }
@@ -28141,7 +28854,7 @@ btree_key_lock_and_append_object_unique (THREAD_ENTRY * thread_p, BTID_INT * bti
   /* Get current first object and its info */
   error_code =
     btree_leaf_get_first_object (btid_int, leaf_record, &first_object.oid, &first_object.class_oid,
-				 &first_object.mvcc_info);
+				 &first_object.mvcc_info, first_object.payload);
   if (error_code != NO_ERROR)
     {
       ASSERT_ERROR ();
@@ -28393,8 +29106,8 @@ btree_key_append_object_unique (THREAD_ENTRY * thread_p, BTID_INT * btid_int, DB
 			      &insert_helper->rv_redo_data_ptr);
   /* Replace first object with new object. */
   btree_leaf_change_first_object (thread_p, leaf_record, btid_int, BTREE_INSERT_OID (insert_helper),
-				  BTREE_INSERT_CLASS_OID (insert_helper), BTREE_INSERT_MVCC_INFO (insert_helper), NULL,
-				  NULL, &insert_helper->rv_redo_data_ptr);
+				  BTREE_INSERT_CLASS_OID (insert_helper), BTREE_INSERT_MVCC_INFO (insert_helper),
+				  insert_helper->obj_info.payload, NULL, NULL, &insert_helper->rv_redo_data_ptr);
 
   /* Update leaf record in page. */
   if (spage_update (thread_p, leaf, search_key->slotid, leaf_record) != SP_SUCCESS)
@@ -28474,7 +29187,8 @@ btree_key_relocate_last_into_ovf (THREAD_ENTRY * thread_p, BTID_INT * btid_int,
   /* Get last object. */
   error_code =
     btree_record_get_last_object (thread_p, btid_int, leaf_record, BTREE_LEAF_NODE, offset_after_key, &last_object.oid,
-				  &last_object.class_oid, &last_object.mvcc_info, &offset_to_last_object);
+				  &last_object.class_oid, &last_object.mvcc_info, last_object.payload,
+				  &offset_to_last_object);
   if (error_code != NO_ERROR)
     {
       assert_release (false);
@@ -28508,7 +29222,7 @@ btree_key_relocate_last_into_ovf (THREAD_ENTRY * thread_p, BTID_INT * btid_int,
       error_code =
 	btree_record_get_last_object (thread_p, btid_int, leaf_record, BTREE_LEAF_NODE, offset_after_key,
 				      &last_object.oid, &last_object.class_oid, &last_object.mvcc_info,
-				      &offset_to_last_object);
+				      last_object.payload, &offset_to_last_object);
       if (error_code != NO_ERROR)
 	{
 	  assert_release (false);
@@ -29130,6 +29844,10 @@ btree_rv_record_modify_internal (THREAD_ENTRY * thread_p, LOG_RCV * rcv, bool is
       btid_int_for_debug.unique_pk = OR_GET_INT (rcv_data_ptr);
       rcv_data_ptr += OR_INT_SIZE;
 
+      /* Read INCLUDE payload size. */
+      btid_int_for_debug.include_payload_size = OR_GET_INT (rcv_data_ptr);
+      rcv_data_ptr += OR_INT_SIZE;
+
       /* Set top class OID. */
       if (BTREE_IS_UNIQUE (btid_int_for_debug.unique_pk))
 	{
@@ -29245,7 +29963,7 @@ btree_rv_record_modify_internal (THREAD_ENTRY * thread_p, LOG_RCV * rcv, bool is
 		  BTREE_MVCC_INFO mvcc_info = BTREE_MVCC_INFO_INITIALIZER;
 
 		  btree_unpack_object (update_record.data, &btid_int_for_debug, node_type, &update_record, 0, &oid,
-				       &class_oid, &mvcc_info);
+				       &class_oid, &mvcc_info, NULL);
 		  _er_log_debug (ARG_FILE_LINE,
 				 "%s: create new overflow page %d|%d, lsa=%lld|%d, in an unknown index. "
 				 "Insert object=%d|%d|%d, class_oid=%d|%d|%d, mvcc_info=%llu|%llu."
@@ -29334,7 +30052,7 @@ btree_rv_record_modify_internal (THREAD_ENTRY * thread_p, LOG_RCV * rcv, bool is
 		  btree_clear_key_value (&clear_key, &key);
 
 		  (void) btree_unpack_object (update_record.data, &btid_int_for_debug, node_type, &update_record,
-					      offset_after_key, &oid, &class_oid, &mvcc_info);
+					      offset_after_key, &oid, &class_oid, &mvcc_info, NULL);
 		  _er_log_debug (ARG_FILE_LINE,
 				 "%s: insert slotid=%d in leaf page %d|%d, lsa=%lld|%d, in an unknown index. "
 				 "Object=%d|%d|%d, class_oid=%d|%d|%d, mvcc_info=%lld|%lld, key=%s."
@@ -30049,8 +30767,16 @@ btree_fix_root_for_delete (THREAD_ENTRY * thread_p, BTID * btid, BTID_INT * btid
       key->data.midxkey.domain = btid_int->key_type;
     }
 
+  /* Keep the INCLUDE values of deleted row. Undo of online index delete needs them. */
+  error_code = btree_key_get_include_payload (btid_int, key, delete_helper->object_info.payload, NULL);
+  if (error_code != NO_ERROR)
+    {
+      pgbuf_unfix_and_init (thread_p, *root_page);
+      return error_code;
+    }
+
   /* Is key NULL? */
-  is_null = key == NULL || DB_IS_NULL (key) || btree_multicol_key_is_null (key);
+  is_null = btree_key_is_null (btid_int, key);
 
   /* Safe guard: key type matches. */
   assert (is_null || TP_ARE_COMPARABLE_KEY_TYPES (DB_VALUE_DOMAIN_TYPE (key), btid_int->key_type->type->id));
@@ -30762,6 +31488,241 @@ error:
   return error_code;
 }
 
+/*
+ * btree_fix_root_for_coalesce () - BTREE_ROOT_WITH_KEY_FUNCTION - fix root page before merging the nodes on the path
+ *				    of a key.
+ *
+ * return	       : Error code.
+ * thread_p (in)       : Thread entry.
+ * btid (in)	       : B-tree ID.
+ * btid_int (out)      : Outputs b-tree info.
+ * key (in)	       : Key to follow.
+ * root_page (out)     : Fixed root node page.
+ * is_leaf (in)	       : Not used.
+ * search_key (in)     : Not used.
+ * stop (out)	       : Not used.
+ * restart (out)       : Not used.
+ * other_args (in/out) : BTREE_DELETE_HELPER *
+ */
+static int
+btree_fix_root_for_coalesce (THREAD_ENTRY * thread_p, BTID * btid, BTID_INT * btid_int, DB_VALUE * key,
+			     PAGE_PTR * root_page, bool * is_leaf, BTREE_SEARCH_KEY_HELPER * search_key, bool * stop,
+			     bool * restart, void *other_args)
+{
+  BTREE_DELETE_HELPER *delete_helper = (BTREE_DELETE_HELPER *) other_args;
+  int error_code = NO_ERROR;
+
+  /* Assert expected arguments. */
+  assert (btid != NULL);
+  assert (btid_int != NULL);
+  assert (key != NULL && !DB_IS_NULL (key));
+  assert (root_page != NULL && *root_page == NULL);
+  assert (delete_helper != NULL);
+
+  /* Root node is being fixed. */
+  delete_helper->is_root = true;
+  *root_page = btree_fix_root_with_info (thread_p, btid, delete_helper->nonleaf_latch_mode, NULL, NULL, btid_int);
+  if (*root_page == NULL)
+    {
+      ASSERT_ERROR_AND_SET (error_code);
+      return error_code;
+    }
+
+  if (DB_VALUE_DOMAIN_TYPE (key) == DB_TYPE_MIDXKEY)
+    {
+      /* Set complete set domain. */
+      key->data.midxkey.domain = btid_int->key_type;
+    }
+
+  return NO_ERROR;
+}
+
+/*
+ * xbtree_coalesce_index () - Merge the underfull nodes of a b-tree while the index remains in use.
+ *
+ * return	 : Error code.
+ * thread_p (in) : Thread entry.
+ * btid (in)	 : B-tree identifier.
+ *
+ * Note: Leaves are visited from left to right. Each leaf is reached from root by following its first key with
+ *	 btree_merge_node_and_advance, the function that merges nodes when keys are deleted. Every node on the path that
+ *	 can be merged with its right sibling absorbs it in a system operation of its own and the emptied sibling is
+ *	 deallocated. The leaf is visited again as long as it absorbs its right sibling.
+ *
+ *	 No latch is kept between two visits and no merge depends on a later one, so readers and writers only wait for
+ *	 the latches of one merge, and an interrupted walk leaves a consistent index that the next call compacts further.
+ *	 The walk visits at most index_coalesce_pages_per_sec leaves per second (0 for no limit).
+ */
+int
+xbtree_coalesce_index (THREAD_ENTRY * thread_p, BTID * btid)
+{
+  BTID_INT btid_int;
+  BTREE_DELETE_HELPER delete_helper;
+  PAGE_PTR root_page = NULL;
+  PAGE_PTR leaf_page = NULL;
+  PAGE_PTR next_page = NULL;
+  VPID leaf_vpid, next_vpid, next_vpid_after;
+  RECDES rec;
+  LEAF_REC leaf_rec;
+  DB_VALUE key;
+  bool clear_key = false;
+  bool dummy_continue_checking = true;
+  int key_cnt, offset;
+  PGSLOTID slotid;
+  int pages_per_sec = prm_get_integer_value (PRM_ID_INDEX_COALESCE_PAGES_PER_SEC);
+  INT64 visited_pages = 0;
+  INT64 start_msec, wait_msec;
+  int error_code = NO_ERROR;
+
+  assert (btid != NULL);
+
+  btree_init_temp_key_value (&clear_key, &key);
+
+  /* Get b-tree info to read the keys of leaves. */
+  root_page = btree_fix_root_with_info (thread_p, btid, PGBUF_LATCH_READ, NULL, NULL, &btid_int);
+  if (root_page == NULL)
+    {
+      ASSERT_ERROR_AND_SET (error_code);
+      return error_code;
+    }
+  pgbuf_unfix_and_init (thread_p, root_page);
+
+  leaf_page = btree_find_leftmost_leaf (thread_p, btid, &leaf_vpid, NULL);
+  if (leaf_page == NULL)
+    {
+      ASSERT_ERROR_AND_SET (error_code);
+      return error_code;
+    }
+
+  start_msec = log_get_clock_msec ();
+
+  while (true)
+    {
+      assert (leaf_page != NULL);
+
+      error_code = btree_get_next_page_vpid (thread_p, leaf_page, &next_vpid);
+      if (error_code != NO_ERROR)
+	{
+	  goto exit;
+	}
+
+      /* Follow the first key that is not a fence key. A leaf without such a key is merged when its left neighbor is
+       * visited. */
+      key_cnt = btree_node_number_of_keys (thread_p, leaf_page);
+      for (slotid = 1; slotid <= key_cnt && btree_is_fence_key (leaf_page, slotid); slotid++)
+	{
+	  ;
+	}
+
+      if (slotid <= key_cnt)
+	{
+	  if (spage_get_record (thread_p, leaf_page, slotid, &rec, PEEK) != S_SUCCESS)
+	    {
+	      assert_release (false);
+	      error_code = ER_FAILED;
+	      goto exit;
+	    }
+	  error_code =
+	    btree_read_record (thread_p, &btid_int, leaf_page, &rec, &key, &leaf_rec, BTREE_LEAF_NODE, &clear_key,
+			       &offset, COPY_KEY_VALUE, NULL);
+	  if (error_code != NO_ERROR)
+	    {
+	      ASSERT_ERROR ();
+	      goto exit;
+	    }
+
+	  if (!VPID_ISNULL (&next_vpid))
+	    {
+	      /* Bring the right sibling to the buffer, the merge check skips neighbors that are not there when I/O is
+	       * stressful. */
+	      next_page = pgbuf_fix (thread_p, &next_vpid, OLD_PAGE, PGBUF_LATCH_READ, PGBUF_UNCONDITIONAL_LATCH);
+	      if (next_page == NULL)
+		{
+		  ASSERT_ERROR_AND_SET (error_code);
+		  goto exit;
+		}
+	      pgbuf_unfix_and_init (thread_p, next_page);
+	    }
+
+	  pgbuf_unfix_and_init (thread_p, leaf_page);
+
+	  /* No page is fixed here; interrupt and throttle. */
+	  if (logtb_is_interrupted (thread_p, true, &dummy_continue_checking))
+	    {
+	      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_INTERRUPTED, 0);
+	      error_code = ER_INTERRUPTED;
+	      goto exit;
+	    }
+	  visited_pages++;
+	  if (pages_per_sec > 0)
+	    {
+	      wait_msec = visited_pages * 1000 / pages_per_sec - (log_get_clock_msec () - start_msec);
+	      if (wait_msec > 0)
+		{
+		  thread_sleep ((double) wait_msec);
+		}
+	    }
+
+	  /* Merge the nodes on the path of key. */
+	  delete_helper.nonleaf_latch_mode = PGBUF_LATCH_READ;
+	  error_code =
+	    btree_search_key_and_apply_functions (thread_p, btid, &btid_int, &key, btree_fix_root_for_coalesce,
+						  &delete_helper, btree_merge_node_and_advance, &delete_helper, NULL,
+						  NULL, NULL, &leaf_page);
+	  btree_clear_key_value (&clear_key, &key);
+	  if (error_code != NO_ERROR)
+	    {
+	      ASSERT_ERROR ();
+	      goto exit;
+	    }
+	  assert (leaf_page != NULL);
+
+	  error_code = btree_get_next_page_vpid (thread_p, leaf_page, &next_vpid_after);
+	  if (error_code != NO_ERROR)
+	    {
+	      goto exit;
+	    }
+	  if (VPID_EQ (pgbuf_get_vpid_ptr (leaf_page), &leaf_vpid) && !VPID_EQ (&next_vpid, &next_vpid_after))
+	    {
+	      /* The leaf absorbed its right sibling. Try to merge it with the next one. */
+	      continue;
+	    }
+	  next_vpid = next_vpid_after;
+	}
+
+      if (VPID_ISNULL (&next_vpid))
+	{
+	  /* Last leaf. */
+	  break;
+	}
+
+      /* Advance to next leaf. */
+      next_page = pgbuf_fix (thread_p, &next_vpid, OLD_PAGE, PGBUF_LATCH_READ, PGBUF_UNCONDITIONAL_LATCH);
+      if (next_page == NULL)
+	{
+	  ASSERT_ERROR_AND_SET (error_code);
+	  goto exit;
+	}
+      pgbuf_unfix_and_init (thread_p, leaf_page);
+      leaf_page = next_page;
+      next_page = NULL;
+      leaf_vpid = next_vpid;
+    }
+
+exit:
+  btree_clear_key_value (&clear_key, &key);
+  if (next_page != NULL)
+    {
+      pgbuf_unfix_and_init (thread_p, next_page);
+    }
+  if (leaf_page != NULL)
+    {
+      pgbuf_unfix_and_init (thread_p, leaf_page);
+    }
+
+  return error_code;
+}
+
 /*
  * btree_key_delete_remove_object () - Remove one object and all its info from b-tree key.
  *
@@ -30911,12 +31872,30 @@ btree_key_delete_remove_object (THREAD_ENTRY * thread_p, BTID_INT * btid_int, DB
    * compensate log record and also requires only redo recovery data. */
   if (delete_helper->purpose == BTREE_OP_DELETE_OBJECT_PHYSICAL)
     {
+      DB_VALUE full_key;	/* Key with INCLUDE values of removed object. */
+      DB_VALUE *undo_key = key;
+
+      /* Undo must bring back the INCLUDE payload of removed object. */
+      error_code =
+	btree_found_object_get_payload (thread_p, btid_int, *leaf_page, &leaf_record, offset_after_key, found_page,
+					offset_to_object, delete_helper->object_info.payload);
+      if (error_code == NO_ERROR)
+	{
+	  error_code =
+	    btree_key_add_include_payload (btid_int, key, delete_helper->object_info.payload, &full_key, &undo_key);
+	}
+      if (error_code != NO_ERROR)
+	{
+	  goto exit;
+	}
+
       delete_helper->rv_keyval_data = rv_undo_data_bufalign;
       error_code =
-	btree_rv_save_keyval_for_undo (btid_int, key, BTREE_DELETE_CLASS_OID (delete_helper),
+	btree_rv_save_keyval_for_undo (btid_int, undo_key, BTREE_DELETE_CLASS_OID (delete_helper),
 				       BTREE_DELETE_OID (delete_helper), BTREE_DELETE_MVCC_INFO (delete_helper),
 				       delete_helper->purpose, rv_undo_data_bufalign, &delete_helper->rv_keyval_data,
 				       &rv_undo_data_capacity, &delete_helper->rv_keyval_data_length);
+      pr_clear_value (&full_key);
       if (error_code != NO_ERROR)
 	{
 	  ASSERT_ERROR ();
@@ -31152,7 +32131,7 @@ btree_key_remove_object_and_keep_visible_first (THREAD_ENTRY * thread_p, BTID_IN
 	 * bring first. */
 	BTREE_OBJECT_INFO first_object;
 	btree_leaf_get_first_object (btid_int, &leaf_record, &first_object.oid, &first_object.class_oid,
-				     &first_object.mvcc_info);
+				     &first_object.mvcc_info, NULL);
 	assert (OID_EQ (&first_object.oid, &delete_helper->second_object_info.oid));
       }
 #endif /* !NDEBUG */
@@ -31210,6 +32189,14 @@ btree_key_remove_object_and_keep_visible_first (THREAD_ENTRY * thread_p, BTID_IN
       error_code = ER_FAILED;
       goto exit;
     }
+  /* The second object keeps its INCLUDE payload when it is moved first. */
+  error_code =
+    btree_found_object_get_payload (thread_p, btid_int, *leaf_page, &leaf_record, offset_after_key, found_page,
+				    offset_to_second_object, delete_helper->second_object_info.payload);
+  if (error_code != NO_ERROR)
+    {
+      goto exit;
+    }
 
   /* Prepare leaf page logging. */
   rv_redo_data_ptr = rv_redo_data;
@@ -31257,8 +32244,8 @@ btree_key_remove_object_and_keep_visible_first (THREAD_ENTRY * thread_p, BTID_IN
   /* Replace inserted object with second visible object. */
   btree_leaf_change_first_object (thread_p, &leaf_record, btid_int, &delete_helper->second_object_info.oid,
 				  &delete_helper->second_object_info.class_oid,
-				  &delete_helper->second_object_info.mvcc_info, NULL, &rv_undo_data_ptr,
-				  &rv_redo_data_ptr);
+				  &delete_helper->second_object_info.mvcc_info, delete_helper->second_object_info.payload,
+				  NULL, &rv_undo_data_ptr, &rv_redo_data_ptr);
 
   /* Update record in page. */
   if (spage_update (thread_p, *leaf_page, search_key->slotid, &leaf_record) != SP_SUCCESS)
@@ -31339,6 +32326,7 @@ btree_leaf_record_replace_first_with_last (THREAD_ENTRY * thread_p, BTID_INT * b
   char *rv_undo_data_ptr = NULL;
   int rv_undo_data_length = 0;
   int rv_redo_data_length = 0;
+  char last_payload[BTREE_INCLUDE_PAYLOAD_MAX_SIZE];
 
   LOG_LSA prev_lsa;
 
@@ -31364,12 +32352,18 @@ btree_leaf_record_replace_first_with_last (THREAD_ENTRY * thread_p, BTID_INT * b
   LOG_RV_RECORD_SET_MODIFY_MODE (&delete_helper->leaf_addr, LOG_RV_RECORD_UPDATE_PARTIAL);
 
   /* Replace first object with last object. */
+  /* Keep last object INCLUDE payload. Last object is never first, so the offset after key is not needed. */
+  if (btree_found_object_get_payload (thread_p, btid_int, leaf_page, leaf_record, 0, leaf_page, offset_to_last_object,
+				      last_payload) != NO_ERROR)
+    {
+      return ER_FAILED;
+    }
   /* First remove last object (so its offset doesn't change. */
   btree_record_remove_last_object (thread_p, btid_int, leaf_record, BTREE_LEAF_NODE, offset_to_last_object,
 				   &rv_undo_data_ptr, &delete_helper->rv_redo_data_ptr);
   /* Replace first. */
-  btree_leaf_change_first_object (thread_p, leaf_record, btid_int, last_oid, last_class_oid, last_mvcc_info, NULL,
-				  &rv_undo_data_ptr, &delete_helper->rv_redo_data_ptr);
+  btree_leaf_change_first_object (thread_p, leaf_record, btid_int, last_oid, last_class_oid, last_mvcc_info,
+				  last_payload, NULL, &rv_undo_data_ptr, &delete_helper->rv_redo_data_ptr);
 
   FI_TEST (thread_p, FI_TEST_BTREE_MANAGER_RANDOM_EXIT, 0);
 
@@ -31532,6 +32526,7 @@ btree_record_remove_object_internal (THREAD_ENTRY * thread_p, BTID_INT * btid_in
     }
   object_info_size +=
     BTREE_GET_MVCC_INFO_SIZE_FROM_FLAGS (btree_record_object_get_mvcc_flags (record->data + offset_to_object));
+  object_info_size += btid_int->include_payload_size;
 
   /* Undo logging. */
   if (rv_undo_data != NULL && *rv_undo_data != NULL)
@@ -31830,7 +32825,7 @@ btree_leaf_remove_object (THREAD_ENTRY * thread_p, DB_VALUE * key, BTID_INT * bt
       /* Get last object in leaf. */
       error_code =
 	btree_record_get_last_object (thread_p, btid_int, leaf_record, BTREE_LEAF_NODE, offset_after_key, &last_oid,
-				      &last_class_oid, &last_mvcc_info, &offset_to_last_object);
+				      &last_class_oid, &last_mvcc_info, NULL, &offset_to_last_object);
       if (error_code != NO_ERROR)
 	{
 	  ASSERT_ERROR ();
@@ -32419,7 +33414,7 @@ btree_remove_delete_mvccid_unique_internal (THREAD_ENTRY * thread_p, BTID_INT *
   /* Get the first object in leaf record. */
   error_code =
     btree_leaf_get_first_object (btid_int, leaf_record, &first_object.oid, &first_object.class_oid,
-				 &first_object.mvcc_info);
+				 &first_object.mvcc_info, first_object.payload);
   if (error_code != NO_ERROR)
     {
       ASSERT_ERROR ();
@@ -32447,6 +33442,16 @@ btree_remove_delete_mvccid_unique_internal (THREAD_ENTRY * thread_p, BTID_INT *
   /* Remove delete MVCCID from object. */
   BTREE_MVCC_INFO_CLEAR_DELID (BTREE_DELETE_MVCC_INFO (helper));
 
+  /* Our object keeps its INCLUDE payload. Read it before first object is packed in its place. */
+  error_code =
+    btree_found_object_get_payload (thread_p, btid_int, leaf_page, leaf_record, 0,
+				    node_type == BTREE_LEAF_NODE ? leaf_page : overflow_page, offset_to_object,
+				    helper->object_info.payload);
+  if (error_code != NO_ERROR)
+    {
+      return error_code;
+    }
+
   /* Object are ready to be swapped. */
 
   /* Where is object found (leaf or overflow node). */
@@ -32507,8 +33512,8 @@ btree_remove_delete_mvccid_unique_internal (THREAD_ENTRY * thread_p, BTID_INT *
 
   /* Replace first object. */
   btree_leaf_change_first_object (thread_p, leaf_record, btid_int, BTREE_DELETE_OID (helper),
-				  BTREE_DELETE_CLASS_OID (helper), BTREE_DELETE_MVCC_INFO (helper), NULL, rv_undo_data,
-				  rv_redo_data);
+				  BTREE_DELETE_CLASS_OID (helper), BTREE_DELETE_MVCC_INFO (helper),
+				  helper->object_info.payload, NULL, rv_undo_data, rv_redo_data);
 
   btree_delete_log (helper, "successfully moved object and removed its delete MVCCID %llu (logging is postponed) \n"
 		    BTREE_DELETE_HELPER_MSG ("\t") "\t" PGBUF_PAGE_STATE_MSG ("leaf page") "\n\t" BTREE_ID_MSG,
@@ -32921,7 +33926,8 @@ btree_record_replace_object (THREAD_ENTRY * thread_p, BTID_INT * btid_int, RECDE
 	{
 	  /* First in leaf record. */
 	  btree_leaf_change_first_object (thread_p, record, btid_int, &replacement->oid, &replacement->class_oid,
-					  &replacement->mvcc_info, NULL, rv_undo_data, rv_redo_data);
+					  &replacement->mvcc_info, replacement->payload, NULL, rv_undo_data,
+					  rv_redo_data);
 	  return;
 	}
       /* Not first in leaf record. */
@@ -32937,8 +33943,8 @@ btree_record_replace_object (THREAD_ENTRY * thread_p, BTID_INT * btid_int, RECDE
       else
 	{
 	  /* Compute old and new object size. */
-	  /* Both have instance OID. */
-	  old_object_size = new_object_size = OR_OID_SIZE;
+	  /* Both have instance OID and INCLUDE payload. */
+	  old_object_size = new_object_size = OR_OID_SIZE + btid_int->include_payload_size;
 
 	  /* Add old object MVCC info size. */
 	  old_object_size +=
@@ -34348,12 +35354,24 @@ btree_key_online_index_tran_delete (THREAD_ENTRY * thread_p, BTID_INT * btid_int
   helper->delete_helper.rv_keyval_data = rv_undo_data_bufalign;
   if (helper->delete_helper.purpose == BTREE_OP_ONLINE_INDEX_TRAN_DELETE)
     {
+      DB_VALUE full_key;	/* Key with INCLUDE values of deleted object. */
+      DB_VALUE *undo_key = key;
+
+      /* The INCLUDE payload was taken from the deleted row key by btree_fix_root_for_delete. */
+      error_code =
+	btree_key_add_include_payload (btid_int, key, helper->delete_helper.object_info.payload, &full_key,
+				       &undo_key);
+      if (error_code != NO_ERROR)
+	{
+	  goto end;
+	}
       error_code =
-	btree_rv_save_keyval_for_undo (btid_int, key, BTREE_DELETE_CLASS_OID (&helper->delete_helper),
+	btree_rv_save_keyval_for_undo (btid_int, undo_key, BTREE_DELETE_CLASS_OID (&helper->delete_helper),
 				       BTREE_DELETE_OID (&helper->delete_helper),
 				       BTREE_DELETE_MVCC_INFO (&helper->delete_helper), helper->delete_helper.purpose,
 				       rv_undo_data_bufalign, &helper->delete_helper.rv_keyval_data,
 				       &rv_undo_data_capacity, &helper->delete_helper.rv_keyval_data_length);
+      pr_clear_value (&full_key);
 
       if (error_code != NO_ERROR)
 	{
@@ -131,6 +131,9 @@ struct btid_int
   int copy_buf_len;		/* index key copy_buf length info; derived from INDX_SCAN_ID.copy_buf_len */
   int rev_level;
   int deduplicate_key_idx;	/* support for SUPPORT_DEDUPLICATE_KEY_MODE */
+  int include_attr_start;	/* key position of the first INCLUDE column */
+  int include_attr_count;	/* number of INCLUDE columns; 0 if the index has none */
+  int include_payload_size;	/* bytes of INCLUDE payload stored with each object */
   OID topclass_oid;		/* class oid for which index is created */
 };
 
@@ -246,6 +249,13 @@ struct btree_scan
   bool is_fk_remake;		/* support for SUPPORT_DEDUPLICATE_KEY_MODE */
   PERF_UTIME_TRACKER time_track;
 
+  /* leaf where the last range of this scan started; kept across BTREE_RESET_SCAN so that the next range (e.g. for
+   * the next outer row of an index nested-loop join) can start there without descending from root */
+  VPID hint_vpid;
+  BTID hint_btid;
+  int hint_hits;
+  int hint_misses;
+
   void *bts_other;
 };
 
@@ -292,6 +302,10 @@ struct btree_scan
     (bts)->index_scan_idp = NULL;			\
     (bts)->is_scan_started = false;			\
     (bts)->force_restart_from_root = false;		\
+    VPID_SET_NULL (&(bts)->hint_vpid);			\
+    BTID_SET_NULL (&(bts)->hint_btid);			\
+    (bts)->hint_hits = 0;				\
+    (bts)->hint_misses = 0;				\
     OID_SET_NULL (&(bts)->match_class_oid);		\
     (bts)->time_track.is_perf_tracking = false;		\
     (bts)->bts_other = NULL;				\
@@ -538,6 +552,9 @@ struct btree_mvcc_info
 #define BTREE_MVCC_INFO_INITIALIZER \
   { 0, MVCCID_ALL_VISIBLE, MVCCID_NULL }
 
+/* Maximum size of the INCLUDE column payload kept with each object of an index. */
+#define BTREE_INCLUDE_PAYLOAD_MAX_SIZE 256
+
 /* BTREE_OBJECT_INFO -
  * Structure used to store b-tree specific object information.
  */
@@ -547,6 +564,7 @@ struct btree_object_info
   OID oid;			/* Instance OID. */
   OID class_oid;		/* Class OID. */
   BTREE_MVCC_INFO mvcc_info;	/* MVCC information. */
+  char payload[BTREE_INCLUDE_PAYLOAD_MAX_SIZE];	/* INCLUDE column values (only for indexes having them). */
 };
 #define BTREE_OBJECT_INFO_INITIALIZER \
   { OID_INITIALIZER, OID_INITIALIZER, BTREE_MVCC_INFO_INITIALIZER }
@@ -702,6 +720,8 @@ extern int btree_reflect_global_unique_statistics (THREAD_ENTRY * thread_p, GLOB
 extern int btree_find_min_or_max_key (THREAD_ENTRY * thread_p, BTID * btid, DB_VALUE * key, int flag_minkey);
 
 extern bool btree_multicol_key_is_null (DB_VALUE * key);
+extern bool btree_key_is_null (BTID_INT * btid_int, DB_VALUE * key);
+extern int btree_key_move_include_values (BTID_INT * btid_int, DB_VALUE * key, char *payload);
 extern int btree_multicol_key_has_null (DB_VALUE * key);
 extern DISK_ISVALID btree_find_key (THREAD_ENTRY * thread_p, BTID * btid, OID * oid, DB_VALUE * key, bool * clear_key);
 /* for migration */
@@ -755,6 +775,8 @@ extern int btree_keyval_search (THREAD_ENTRY * thread_p, BTID * btid, SCAN_OPERA
 				INDX_SCAN_ID * isidp, bool is_all_class_srch);
 extern int btree_range_scan (THREAD_ENTRY * thread_p, BTREE_SCAN * bts, BTREE_RANGE_SCAN_PROCESS_KEY_FUNC * key_func);
 extern int btree_range_scan_select_visible_oids (THREAD_ENTRY * thread_p, BTREE_SCAN * bts);
+extern BTREE_SEARCH btree_find_unique_visible (THREAD_ENTRY * thread_p, BTID * btid, DB_VALUE * key,
+					       OID * class_oid, MVCC_SNAPSHOT * snapshot, OID * oid);
 extern int btree_attrinfo_read_dbvalues (THREAD_ENTRY * thread_p, DB_VALUE * curr_key, int *btree_att_ids,
 					 int btree_num_att, HEAP_CACHE_ATTRINFO * attr_info, int func_index_col_id);
 extern int btree_coerce_key (DB_VALUE * src_keyp, int keysize, TP_DOMAIN * btree_domainp, int key_minmax);
@@ -776,10 +798,10 @@ extern SCAN_CODE btree_get_next_node_info (THREAD_ENTRY * thread_p, BTID * btid,
 extern int xbtree_get_key_type (THREAD_ENTRY * thread_p, BTID btid, TP_DOMAIN ** key_type);
 
 extern int btree_leaf_get_first_object (BTID_INT * btid, RECDES * recp, OID * oidp, OID * class_oid,
-					BTREE_MVCC_INFO * mvcc_info);
+					BTREE_MVCC_INFO * mvcc_info, char *payload);
 extern void btree_leaf_change_first_object (THREAD_ENTRY * thread_p, RECDES * recp, BTID_INT * btid, OID * oidp,
-					    OID * class_oidp, BTREE_MVCC_INFO * mvcc_info, int *key_offset,
-					    char **rv_undo_data_ptr, char **rv_redo_data_ptr);
+					    OID * class_oidp, BTREE_MVCC_INFO * mvcc_info, const char *payload,
+					    int *key_offset, char **rv_undo_data_ptr, char **rv_redo_data_ptr);
 extern int btree_insert (THREAD_ENTRY * thread_p, BTID * btid, DB_VALUE * key, OID * cls_oid, OID * oid, int op_type,
 			 btree_unique_stats * unique_stat_info, int *unique, MVCC_REC_HEADER * p_mvcc_rec_header);
 extern int btree_mvcc_delete (THREAD_ENTRY * thread_p, BTID * btid, DB_VALUE * key, OID * class_oid, OID * oid,
@@ -843,7 +865,8 @@ extern int btree_get_num_visible_from_leaf_and_ovf (THREAD_ENTRY * thread_p, BTI
 
 extern int btree_write_record (THREAD_ENTRY * thread_p, BTID_INT * btid, void *node_rec, DB_VALUE * key,
 			       BTREE_NODE_TYPE node_type, int key_type, int key_len, bool during_loading,
-			       OID * class_oid, OID * oid, BTREE_MVCC_INFO * mvcc_info, RECDES * rec);
+			       OID * class_oid, OID * oid, BTREE_MVCC_INFO * mvcc_info, const char *payload,
+			       RECDES * rec);
 extern int btree_read_record (THREAD_ENTRY * thread_p, BTID_INT * btid, PAGE_PTR pgptr, RECDES * Rec, DB_VALUE * key,
 			      void *rec_header, BTREE_NODE_TYPE node_type, bool * clear_key, int *offset, int copy,
 			      BTREE_SCAN * bts);
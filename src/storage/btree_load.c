@@ -229,7 +229,7 @@ static int btree_load_new_page (THREAD_ENTRY * thread_p, const BTID * btid, BTRE
 				VPID * vpid_new, PAGE_PTR * page_new);
 static PAGE_PTR btree_proceed_leaf (THREAD_ENTRY * thread_p, LOAD_ARGS * load_args);
 static int btree_first_oid (THREAD_ENTRY * thread_p, DB_VALUE * this_key, OID * class_oid, OID * first_oid,
-			    MVCC_REC_HEADER * p_mvcc_rec_header, LOAD_ARGS * load_args);
+			    MVCC_REC_HEADER * p_mvcc_rec_header, const char *payload, LOAD_ARGS * load_args);
 static int btree_construct_leafs (THREAD_ENTRY * thread_p, const RECDES * in_recdes, void *arg);
 static int btree_get_value_from_leaf_slot (THREAD_ENTRY * thread_p, BTID_INT * btid_int, PAGE_PTR leaf_ptr,
 					   int slot_id, DB_VALUE * key, bool * clear_key);
@@ -277,11 +277,13 @@ typedef struct
   OID orig_oid;
   OID orig_class_oid;
   MVCC_REC_HEADER orig_mvcc_header;
+
+  char payload[BTREE_INCLUDE_PAYLOAD_MAX_SIZE];	/* INCLUDE payload of object */
 } S_PARAM_ST;
 
 static int bt_load_put_buf_to_record (RECDES * recdes, SORT_ARGS * sort_args, int value_has_null, OID * rec_oid,
-				      MVCC_REC_HEADER * mvcc_header, DB_VALUE * dbvalue_ptr, int key_len,
-				      int cur_class, bool is_btree_ops_log);
+				      MVCC_REC_HEADER * mvcc_header, const char *payload, DB_VALUE * dbvalue_ptr,
+				      int key_len, int cur_class, bool is_btree_ops_log);
 static int bt_load_get_buf_from_record (RECDES * recdes, LOAD_ARGS * load_args, S_PARAM_ST * pparam, bool copy);
 static int bt_load_get_first_leaf_page_and_init_args (THREAD_ENTRY * thread_p, LOAD_ARGS * load_args,
 						      S_PARAM_ST * pparam);
@@ -861,6 +863,7 @@ bt_load_clear_pred_and_unpack (THREAD_ENTRY * thread_p, SORT_ARGS * args, XASL_U
  *   fk_refcls_oid(in):
  *   fk_refcls_pk_btid(in):
  *   fk_name(in):
+ *   include_count(in): number of trailing INCLUDE columns of the key domain
  *
  */
 BTID *
@@ -868,7 +871,7 @@ xbtree_load_index (THREAD_ENTRY * thread_p, BTID * btid, const char *bt_name, TP
 		   int n_classes, int n_attrs, int *attr_ids, int *attrs_prefix_length, HFID * hfids, int unique_pk,
 		   int not_null_flag, OID * fk_refcls_oid, BTID * fk_refcls_pk_btid, const char *fk_name,
 		   char *pred_stream, int pred_stream_size, char *func_pred_stream, int func_pred_stream_size,
-		   int func_col_id, int func_attr_index_start)
+		   int func_col_id, int func_attr_index_start, int include_count)
 {
   LOG_TDES *tdes = NULL;
   SORT_ARGS sort_args_info, *sort_args;
@@ -890,6 +893,14 @@ xbtree_load_index (THREAD_ENTRY * thread_p, BTID * btid, const char *bt_name, TP
       return NULL;
     }
 
+  btid_int.key_type = key_type;
+  /* support for SUPPORT_DEDUPLICATE_KEY_MODE */
+  btid_int.deduplicate_key_idx = dk_get_deduplicate_key_position (n_attrs, attr_ids, func_attr_index_start);
+  if (btree_set_include_info (&btid_int, include_count) != NO_ERROR)
+    {
+      return NULL;
+    }
+
   sort_args = &sort_args_info;
   load_args = &load_args_info;
 
@@ -924,11 +935,8 @@ xbtree_load_index (THREAD_ENTRY * thread_p, BTID * btid, const char *bt_name, TP
       assert (BTREE_IS_PRIMARY_KEY (btid_int.unique_pk) || !BTREE_IS_PRIMARY_KEY (btid_int.unique_pk));
     }
 #endif
-  btid_int.key_type = key_type;
   VFID_SET_NULL (&btid_int.ovfid);
   btid_int.rev_level = BTREE_CURRENT_REV_LEVEL;
-  /* support for SUPPORT_DEDUPLICATE_KEY_MODE */
-  btid_int.deduplicate_key_idx = dk_get_deduplicate_key_position (n_attrs, attr_ids, func_attr_index_start);
 
   COPY_OID (&btid_int.topclass_oid, &class_oids[0]);
 
@@ -1150,7 +1158,7 @@ xbtree_load_index (THREAD_ENTRY * thread_p, BTID * btid, const char *bt_name, TP
 
       BTID_SET_NULL (btid);
       if (xbtree_add_index (thread_p, btid, key_type, &class_oids[0], attr_ids[0], unique_pk, sort_args->n_oids,
-			    sort_args->n_nulls, load_args->n_keys, btid_int.deduplicate_key_idx) == NULL)
+			    sort_args->n_nulls, load_args->n_keys, btid_int.deduplicate_key_idx, include_count) == NULL)
 	{
 	  goto error;
 	}
@@ -1406,7 +1414,7 @@ btree_connect_page (THREAD_ENTRY * thread_p, DB_VALUE * key, int max_key_len, VP
     }
 
   if (btree_write_record (thread_p, load_args->btid, &nleaf_rec, key, BTREE_NON_LEAF_NODE, key_type, key_len, true,
-			  NULL, NULL, NULL, &load_args->leaf_nleaf_recdes) != NO_ERROR)
+			  NULL, NULL, NULL, NULL, &load_args->leaf_nleaf_recdes) != NO_ERROR)
     {
       return NULL;
     }
@@ -1923,6 +1931,7 @@ btree_build_nleafs (THREAD_ENTRY * thread_p, LOAD_ARGS * load_args, int n_nulls,
   root_header->ovfid = load_args->btid->ovfid;	/* structure copy */
 
   root_header->_32.rev_level = BTREE_CURRENT_REV_LEVEL;
+  root_header->_32.include_attr_count = load_args->btid->include_attr_count;
   SET_DECOMPRESS_IDX_HEADER (root_header, load_args->btid->deduplicate_key_idx);
 
 #if defined (SERVER_MODE)
@@ -2185,6 +2194,7 @@ btree_proceed_leaf (THREAD_ENTRY * thread_p, LOAD_ARGS * load_args)
  *   class_oid(in):
  *   first_oid(in): First OID associated with this key; inserted into the
  *                  record.
+ *   payload(in): INCLUDE payload of first object
  *   load_args(in): Contains fields specifying where & how to create the record
  *
  * Note: This function prepares the leaf record for the given key and
@@ -2193,7 +2203,7 @@ btree_proceed_leaf (THREAD_ENTRY * thread_p, LOAD_ARGS * load_args)
  */
 static int
 btree_first_oid (THREAD_ENTRY * thread_p, DB_VALUE * this_key, OID * class_oid, OID * first_oid,
-		 MVCC_REC_HEADER * p_mvcc_rec_header, LOAD_ARGS * load_args)
+		 MVCC_REC_HEADER * p_mvcc_rec_header, const char *payload, LOAD_ARGS * load_args)
 {
   int key_len;
   int key_type;
@@ -2223,7 +2233,7 @@ btree_first_oid (THREAD_ENTRY * thread_p, DB_VALUE * this_key, OID * class_oid,
   btree_mvcc_info_from_heap_mvcc_header (p_mvcc_rec_header, &mvcc_info);
   error =
     btree_write_record (thread_p, load_args->btid, NULL, this_key, BTREE_LEAF_NODE, key_type, key_len, true, class_oid,
-			first_oid, &mvcc_info, load_args->out_recdes);
+			first_oid, &mvcc_info, payload, load_args->out_recdes);
   if (error != NO_ERROR)
     {
       /* this must be an overflow key insertion failure, we assume the overflow manager has logged an error. */
@@ -2275,6 +2285,7 @@ btree_first_oid (THREAD_ENTRY * thread_p, DB_VALUE * this_key, OID * class_oid,
  *   value_has_null(in):
  *   rec_oid(in): Object identifier of current record.
  *   mvcc_header(in):
+ *   payload(in): INCLUDE payload of object
  *   dbvalue_ptr(in): Key value
  *   key_len(in):  get_disk_size_of_value(dbvalue_ptr)
  *   cur_class(in): 
@@ -2283,8 +2294,8 @@ btree_first_oid (THREAD_ENTRY * thread_p, DB_VALUE * this_key, OID * class_oid,
  */
 static int
 bt_load_put_buf_to_record (RECDES * recdes, SORT_ARGS * sort_args, int value_has_null, OID * rec_oid,
-			   MVCC_REC_HEADER * mvcc_header, DB_VALUE * dbvalue_ptr, int key_len, int cur_class,
-			   bool is_btree_ops_log)
+			   MVCC_REC_HEADER * mvcc_header, const char *payload, DB_VALUE * dbvalue_ptr, int key_len,
+			   int cur_class, bool is_btree_ops_log)
 {
   int next_size;
   int record_size;
@@ -2305,6 +2316,7 @@ bt_load_put_buf_to_record (RECDES * recdes, SORT_ARGS * sort_args, int value_has
 		 + OR_INT_SIZE	/* Has null */
 		 + oid_size	/* OID, Class OID */
 		 + 2 * OR_MVCCID_SIZE	/* Insert and delete MVCCID */
+		 + sort_args->btid->include_payload_size	/* INCLUDE payload */
 		 + key_len	/* Key length */
 		 + (int) MAX_ALIGNMENT /* Alignment */ );
 
@@ -2377,6 +2389,14 @@ bt_load_put_buf_to_record (RECDES * recdes, SORT_ARGS * sort_args, int value_has
 	}
     }
 
+  if (sort_args->btid->include_payload_size > 0)
+    {
+      if (or_put_data (&buf, payload, sort_args->btid->include_payload_size) != NO_ERROR)
+	{
+	  return ER_FAILED;
+	}
+    }
+
   if (is_btree_ops_log)
     {
       _er_log_debug (ARG_FILE_LINE,
@@ -2483,6 +2503,15 @@ bt_load_get_buf_from_record (RECDES * recdes, LOAD_ARGS * load_args, S_PARAM_ST
     }
 #endif
 
+  if (load_args->btid->include_payload_size > 0)
+    {
+      ret = or_get_data (&buf, pparam->payload, load_args->btid->include_payload_size);
+      if (ret != NO_ERROR)
+	{
+	  return ret;
+	}
+    }
+
   assert (buf.ptr == PTR_ALIGN (buf.ptr, INT_ALIGNMENT));
 
   if (pparam->is_btree_ops_log)
@@ -2560,7 +2589,7 @@ bt_load_get_first_leaf_page_and_init_args (THREAD_ENTRY * thread_p, LOAD_ARGS *
   /* Create the first record of the current page in main memory */
   load_args->out_recdes = &load_args->leaf_nleaf_recdes;
   return btree_first_oid (thread_p, &pparam->this_key, &pparam->class_oid, &pparam->rec_oid, &pparam->mvcc_header,
-			  load_args);
+			  pparam->payload, load_args);
 }
 
 /*
@@ -2650,7 +2679,7 @@ bt_load_make_new_record_on_leaf_page (THREAD_ENTRY * thread_p, LOAD_ARGS * load_
   /* Create the first part of the next record in main memory */
   load_args->out_recdes = &load_args->leaf_nleaf_recdes;
   return btree_first_oid (thread_p, &pparam->this_key, &pparam->class_oid, &pparam->rec_oid, &pparam->mvcc_header,
-			  load_args);
+			  pparam->payload, load_args);
 }
 
 
@@ -2679,12 +2708,13 @@ bt_load_invalidate_mvcc_del_id (THREAD_ENTRY * thread_p, LOAD_ARGS * load_args,
 	  /* this is the first non-deleted OID of the key; it must be placed as the first OID */
 	  BTREE_MVCC_INFO first_mvcc_info;
 	  OID first_oid, first_class_oid;
+	  char first_payload[BTREE_INCLUDE_PAYLOAD_MAX_SIZE];
 	  int offset = 0;
 
 	  /* Retrieve the first OID from leaf record */
 	  ret =
 	    btree_leaf_get_first_object (load_args->btid, &load_args->leaf_nleaf_recdes, &first_oid,
-					 &first_class_oid, &first_mvcc_info);
+					 &first_class_oid, &first_mvcc_info, first_payload);
 	  if (ret != NO_ERROR)
 	    {
 	      return ret;
@@ -2693,8 +2723,8 @@ bt_load_invalidate_mvcc_del_id (THREAD_ENTRY * thread_p, LOAD_ARGS * load_args,
 	  /* replace with current OID (might move memory in record) */
 	  btree_mvcc_info_from_heap_mvcc_header (&pparam->mvcc_header, &pparam->mvcc_info);
 	  btree_leaf_change_first_object (thread_p, &load_args->leaf_nleaf_recdes, load_args->btid,
-					  &pparam->rec_oid, &pparam->class_oid, &pparam->mvcc_info, &offset, NULL,
-					  NULL);
+					  &pparam->rec_oid, &pparam->class_oid, &pparam->mvcc_info, pparam->payload,
+					  &offset, NULL, NULL);
 	  if (ret != NO_ERROR)
 	    {
 	      return ret;
@@ -2715,6 +2745,7 @@ bt_load_invalidate_mvcc_del_id (THREAD_ENTRY * thread_p, LOAD_ARGS * load_args,
 	  COPY_OID (&pparam->rec_oid, &first_oid);
 	  COPY_OID (&pparam->class_oid, &first_class_oid);
 	  btree_mvcc_info_to_heap_mvcc_header (&first_mvcc_info, &pparam->mvcc_header);
+	  memcpy (pparam->payload, first_payload, load_args->btid->include_payload_size);
 	}
     }
   else if (load_args->curr_non_del_obj_count > 1 && BTREE_IS_UNIQUE (load_args->btid->unique_pk))
@@ -2904,6 +2935,14 @@ bt_load_add_same_key_to_record (THREAD_ENTRY * thread_p, LOAD_ARGS * load_args,
   load_args->out_recdes->length += btree_packed_mvccinfo_size (&pparam->mvcc_info);
   load_args->new_pos = btree_pack_mvccinfo (load_args->new_pos, &pparam->mvcc_info);
 
+  if (load_args->btid->include_payload_size > 0)
+    {
+      /* Insert INCLUDE payload */
+      memcpy (load_args->new_pos, pparam->payload, load_args->btid->include_payload_size);
+      load_args->out_recdes->length += load_args->btid->include_payload_size;
+      load_args->new_pos += load_args->btid->include_payload_size;
+    }
+
   assert (load_args->out_recdes->length <= load_args->out_recdes->area_size);
 
 #if !defined (NDEBUG)
@@ -3256,6 +3295,7 @@ btree_sort_get_next (THREAD_ENTRY * thread_p, RECDES * temp_recdes, void *arg)
   MVCC_SNAPSHOT mvcc_snapshot_dirty;
   MVCC_SATISFIES_SNAPSHOT_RESULT snapshot_dirty_satisfied;
   bool is_btree_ops_log = prm_get_bool_value (PRM_ID_LOG_BTREE_OPS);
+  char include_payload[BTREE_INCLUDE_PAYLOAD_MAX_SIZE];
 
   db_make_null (&dbvalue);
 
@@ -3431,7 +3471,7 @@ btree_sort_get_next (THREAD_ENTRY * thread_p, RECDES * temp_recdes, void *arg)
 	  value_has_null = 1;	/* found null columns */
 	}
 
-      if (DB_IS_NULL (dbvalue_ptr) || btree_multicol_key_is_null (dbvalue_ptr))
+      if (btree_key_is_null (sort_args->btid, dbvalue_ptr))
 	{
 	  if (snapshot_dirty_satisfied == SNAPSHOT_SATISFIED)
 	    {
@@ -3458,11 +3498,21 @@ btree_sort_get_next (THREAD_ENTRY * thread_p, RECDES * temp_recdes, void *arg)
 	  continue;
 	}
 
+      /* INCLUDE values are sorted with the object, not with the key. */
+      if (btree_key_move_include_values (sort_args->btid, dbvalue_ptr, include_payload) != NO_ERROR)
+	{
+	  if (dbvalue_ptr == &dbvalue || dbvalue_ptr->need_clear == true)
+	    {
+	      pr_clear_value (dbvalue_ptr);
+	    }
+	  return SORT_ERROR_OCCURRED;
+	}
+
       key_len = sort_args->key_type->type->get_disk_size_of_value (dbvalue_ptr);
       if (key_len > 0)
 	{
 	  result = bt_load_put_buf_to_record (temp_recdes, sort_args, value_has_null, &prev_oid, &mvcc_header,
-					      dbvalue_ptr, key_len, cur_class, is_btree_ops_log);
+					      include_payload, dbvalue_ptr, key_len, cur_class, is_btree_ops_log);
 	  if (result != NO_ERROR)
 	    {
 	      goto nofit;
@@ -3555,9 +3605,9 @@ compare_driver (const void *first, const void *second, void *arg)
   assert (PTR_ALIGN (mem1, INT_ALIGNMENT) == mem1);
   assert (PTR_ALIGN (mem2, INT_ALIGNMENT) == mem2);
 
-  /* Skip the MVCCID's */
-  mem1 += 2 * OR_MVCCID_SIZE;
-  mem2 += 2 * OR_MVCCID_SIZE;
+  /* Skip the MVCCID's and the INCLUDE payload */
+  mem1 += 2 * OR_MVCCID_SIZE + sort_args->btid->include_payload_size;
+  mem2 += 2 * OR_MVCCID_SIZE + sort_args->btid->include_payload_size;
 
   assert (PTR_ALIGN (mem1, INT_ALIGNMENT) == mem1);
   assert (PTR_ALIGN (mem2, INT_ALIGNMENT) == mem2);
@@ -4582,7 +4632,8 @@ xbtree_load_online_index (THREAD_ENTRY * thread_p, BTID * btid, const char *bt_n
 			  OID * class_oids, int n_classes, int n_attrs, int *attr_ids, int *attrs_prefix_length,
 			  HFID * hfids, int unique_pk, int not_null_flag, OID * fk_refcls_oid, BTID * fk_refcls_pk_btid,
 			  const char *fk_name, char *pred_stream, int pred_stream_size, char *func_pred_stream,
-			  int func_pred_stream_size, int func_col_id, int func_attr_index_start, int ib_thread_count)
+			  int func_pred_stream_size, int func_col_id, int func_attr_index_start, int include_count,
+			  int ib_thread_count)
 {
   int cur_class;
   BTID_INT btid_int;
@@ -4635,6 +4686,10 @@ xbtree_load_online_index (THREAD_ENTRY * thread_p, BTID * btid, const char *bt_n
   VFID_SET_NULL (&btid_int.ovfid);
   btid_int.rev_level = BTREE_CURRENT_REV_LEVEL;
   btid_int.deduplicate_key_idx = dk_get_deduplicate_key_position (n_attrs, attr_ids, func_attr_index_start);
+  if (btree_set_include_info (&btid_int, include_count) != NO_ERROR)
+    {
+      return NULL;
+    }
   COPY_OID (&btid_int.topclass_oid, &class_oids[0]);
   /*
    * for btree_range_search, part_key_desc is re-set at btree_initialize_bts
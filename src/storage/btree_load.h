@@ -110,6 +110,8 @@
  * info).
  * In case of unique: OID, class OID, insert and delete MVCCID.
  * In case of non-unique: OID, insert and delete MVCCID.
+ * Indexes with INCLUDE columns add the INCLUDE payload after the MVCCIDs of
+ * every object.
  *
  * Fixed size is used when:
  * 1. object is saved in overflow page.
@@ -117,9 +119,11 @@
  * 3. object is first in a leaf record that has overflow pages.
  */
 #define BTREE_OBJECT_FIXED_SIZE(btree_info) \
-  (BTREE_IS_UNIQUE ((btree_info)->unique_pk) ? \
-   2 * OR_OID_SIZE + 2 * OR_MVCCID_SIZE : OR_OID_SIZE + 2 * OR_MVCCID_SIZE)
-/* Maximum possible size for one b-tree object including all its information.
+  ((BTREE_IS_UNIQUE ((btree_info)->unique_pk) ? \
+    2 * OR_OID_SIZE + 2 * OR_MVCCID_SIZE : OR_OID_SIZE + 2 * OR_MVCCID_SIZE) \
+   + (btree_info)->include_payload_size)
+/* Maximum possible size for one b-tree object including all its information,
+ * except the INCLUDE payload (see BTREE_INCLUDE_PAYLOAD_MAX_SIZE).
  */
 #define BTREE_OBJECT_MAX_SIZE (2 * OR_OID_SIZE + 2 * OR_MVCCID_SIZE)
 
@@ -223,7 +227,8 @@ struct btree_root_header
   // int rev_level;             /* Btree revision level */
   struct
   {
-    int rev_level:16;		/* Btree revision level */
+    int rev_level:8;		/* Btree revision level */
+    int include_attr_count:8;	/* number of INCLUDE columns kept as object payload */
     int deduplicate_key_idx:16;
 #define SET_DECOMPRESS_IDX_HEADER(hdr, idx)  ((hdr)->_32.deduplicate_key_idx = ((idx) + 1))
 #define GET_DECOMPRESS_IDX_HEADER(hdr)       ((hdr)->_32.deduplicate_key_idx - 1)
@@ -292,6 +297,7 @@ extern int btree_get_disk_size_of_key (DB_VALUE *);
 extern TP_DOMAIN *btree_generate_prefix_domain (BTID_INT * btid);
 extern int btree_glean_root_header_info (THREAD_ENTRY * thread_p, BTREE_ROOT_HEADER * root_header, BTID_INT * btid,
 					 bool is_key_type);
+extern int btree_set_include_info (BTID_INT * btid, int include_count);
 extern DISK_ISVALID btree_verify_tree (THREAD_ENTRY * thread_p, const OID * class_oid_p, BTID_INT * btid,
 				       const char *btname);
 extern int btree_get_prefix_separator (const DB_VALUE * key1, const DB_VALUE * key2, DB_VALUE * prefix_key,
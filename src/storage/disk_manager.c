@@ -205,6 +205,25 @@ struct disk_cache
 
 static DISK_CACHE *disk_Cache = NULL;
 
+/* volume booted while loading disk cache */
+typedef struct disk_cache_load_vol DISK_CACHE_LOAD_VOLUME;
+struct disk_cache_load_vol
+{
+  VOLID volid;
+  DB_VOLPURPOSE purpose;
+  DB_VOLTYPE type;
+  DISK_VOLUME_SPACE_INFO space_info;
+  bool boot_by_caller;		/* volume reset is logged; it is booted by the thread loading disk cache */
+};
+
+/* volumes booted in parallel while loading disk cache */
+typedef struct disk_cache_load_context DISK_CACHE_LOAD_CONTEXT;
+struct disk_cache_load_context
+{
+  DISK_CACHE_LOAD_VOLUME *vols;
+  int nvols;
+};
+
 static DKNSECTS disk_Temp_max_sects = -2;
 
 /************************************************************************/
@@ -357,6 +376,10 @@ static int disk_vhdr_set_vol_remarks (DISK_VOLUME_HEADER * vhdr, const char *vol
 
 static bool disk_cache_load_all_volumes (THREAD_ENTRY * thread_p);
 static bool disk_cache_load_volume (THREAD_ENTRY * thread_p, INT16 volid, void *ignore);
+static void disk_cache_add_volume (INT16 volid, DB_VOLPURPOSE vol_purpose, DB_VOLTYPE vol_type,
+				   const DISK_VOLUME_SPACE_INFO * space_info);
+static bool disk_cache_collect_volume (THREAD_ENTRY * thread_p, INT16 volid, void *args);
+static int disk_cache_boot_volume (THREAD_ENTRY * thread_p, int index, void *args);
 
 static const char *disk_purpose_to_string (DISK_VOLPURPOSE purpose);
 static const char *disk_type_to_string (DB_VOLTYPE voltype);
@@ -2470,25 +2493,42 @@ disk_cache_load_volume (THREAD_ENTRY * thread_p, INT16 volid, void *ignore)
       return false;
     }
 
+  disk_cache_add_volume (volid, vol_purpose, vol_type, &space_info);
+  return true;
+}
+
+/*
+ * disk_cache_add_volume () - save information of a booted volume to disk cache
+ *
+ * return          : void
+ * volid (in)      : volume identifier
+ * vol_purpose (in): volume purpose
+ * vol_type (in)   : volume type
+ * space_info (in) : volume space information
+ */
+static void
+disk_cache_add_volume (INT16 volid, DB_VOLPURPOSE vol_purpose, DB_VOLTYPE vol_type,
+		       const DISK_VOLUME_SPACE_INFO * space_info)
+{
   if (vol_type != DB_PERMANENT_VOLTYPE)
     {
       /* don't save temporary volumes... they will be dropped anyway */
-      return true;
+      return;
     }
 
   /* called during boot, no sync required */
   if (vol_purpose == DB_PERMANENT_DATA_PURPOSE)
     {
-      disk_Cache->perm_purpose_info.extend_info.nsect_free += space_info.n_free_sects;
-      disk_Cache->perm_purpose_info.extend_info.nsect_total += space_info.n_total_sects;
-      disk_Cache->perm_purpose_info.extend_info.nsect_max += space_info.n_max_sects;
+      disk_Cache->perm_purpose_info.extend_info.nsect_free += space_info->n_free_sects;
+      disk_Cache->perm_purpose_info.extend_info.nsect_total += space_info->n_total_sects;
+      disk_Cache->perm_purpose_info.extend_info.nsect_max += space_info->n_max_sects;
 
       assert (disk_Cache->perm_purpose_info.extend_info.nsect_free
 	      <= disk_Cache->perm_purpose_info.extend_info.nsect_total);
       assert (disk_Cache->perm_purpose_info.extend_info.nsect_total
 	      <= disk_Cache->perm_purpose_info.extend_info.nsect_max);
 
-      if (space_info.n_total_sects < space_info.n_max_sects)
+      if (space_info->n_total_sects < space_info->n_max_sects)
 	{
 	  assert (disk_Cache->perm_purpose_info.extend_info.volid_extend == NULL_VOLID);
 	  disk_Cache->perm_purpose_info.extend_info.volid_extend = volid;
@@ -2496,21 +2536,76 @@ disk_cache_load_volume (THREAD_ENTRY * thread_p, INT16 volid, void *ignore)
     }
   else
     {
-      assert (space_info.n_total_sects == space_info.n_max_sects);
+      assert (space_info->n_total_sects == space_info->n_max_sects);
 
-      disk_Cache->temp_purpose_info.nsect_perm_free += space_info.n_free_sects;
-      disk_Cache->temp_purpose_info.nsect_perm_total += space_info.n_total_sects;
+      disk_Cache->temp_purpose_info.nsect_perm_free += space_info->n_free_sects;
+      disk_Cache->temp_purpose_info.nsect_perm_total += space_info->n_total_sects;
 
       assert (disk_Cache->temp_purpose_info.nsect_perm_free <= disk_Cache->temp_purpose_info.nsect_perm_total);
     }
 
-  disk_Cache->vols[volid].nsect_free = space_info.n_free_sects;
+  disk_Cache->vols[volid].nsect_free = space_info->n_free_sects;
   disk_Cache->vols[volid].purpose = vol_purpose;
 
   disk_Cache->nvols_perm++;
+}
+
+/*
+ * disk_cache_collect_volume () - add a mounted volume to the volumes to be booted
+ *
+ * return        : true
+ * thread_p (in) : thread entry
+ * volid (in)    : volume identifier
+ * args (in)     : DISK_CACHE_LOAD_CONTEXT; if the array of volumes is not allocated yet, volumes are only counted
+ */
+static bool
+disk_cache_collect_volume (THREAD_ENTRY * thread_p, INT16 volid, void *args)
+{
+  DISK_CACHE_LOAD_CONTEXT *context = (DISK_CACHE_LOAD_CONTEXT *) args;
+
+  if (context->vols != NULL)
+    {
+      context->vols[context->nvols].volid = volid;
+    }
+  context->nvols++;
   return true;
 }
 
+/*
+ * disk_cache_boot_volume () - boot one of the volumes collected for disk cache; called by several threads
+ *
+ * return        : error code
+ * thread_p (in) : thread entry
+ * index (in)    : index of the volume
+ * args (in)     : DISK_CACHE_LOAD_CONTEXT
+ *
+ * note: permanent volumes with temporary purpose are reset by disk_stab_init, which appends log records. They are
+ *       only marked here and booted afterwards by the thread loading disk cache.
+ */
+static int
+disk_cache_boot_volume (THREAD_ENTRY * thread_p, int index, void *args)
+{
+  DISK_CACHE_LOAD_VOLUME *vol = &((DISK_CACHE_LOAD_CONTEXT *) args)->vols[index];
+  PAGE_PTR page_volheader = NULL;
+  DISK_VOLUME_HEADER *volheader;
+  int error_code = NO_ERROR;
+
+  error_code = disk_get_volheader (thread_p, vol->volid, PGBUF_LATCH_READ, &page_volheader, &volheader);
+  if (error_code != NO_ERROR)
+    {
+      ASSERT_ERROR ();
+      return error_code;
+    }
+  vol->boot_by_caller = (volheader->type == DB_PERMANENT_VOLTYPE && volheader->purpose == DB_TEMPORARY_DATA_PURPOSE);
+  pgbuf_unfix_and_init (thread_p, page_volheader);
+
+  if (vol->boot_by_caller)
+    {
+      return NO_ERROR;
+    }
+  return disk_volume_boot (thread_p, vol->volid, &vol->purpose, &vol->type, &vol->space_info);
+}
+
 /*
  * disk_cache_init () - initialize disk cache
  *
@@ -2607,9 +2702,57 @@ disk_cache_final (void)
 static bool
 disk_cache_load_all_volumes (THREAD_ENTRY * thread_p)
 {
+  DISK_CACHE_LOAD_CONTEXT context = { NULL, 0 };
+  int nvols;
+  int i;
+
   /* Cache every single volume */
   assert (disk_Cache != NULL);
-  return fileio_map_mounted (thread_p, disk_cache_load_volume, NULL);
+
+  /* count the volumes first */
+  (void) fileio_map_mounted (thread_p, disk_cache_collect_volume, &context);
+  if (context.nvols <= 1)
+    {
+      return fileio_map_mounted (thread_p, disk_cache_load_volume, NULL);
+    }
+
+  nvols = context.nvols;
+  context.vols = (DISK_CACHE_LOAD_VOLUME *) malloc (nvols * sizeof (DISK_CACHE_LOAD_VOLUME));
+  if (context.vols == NULL)
+    {
+      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_OUT_OF_VIRTUAL_MEMORY, 1, nvols * sizeof (DISK_CACHE_LOAD_VOLUME));
+      return false;
+    }
+  memset (context.vols, 0, nvols * sizeof (DISK_CACHE_LOAD_VOLUME));
+  context.nvols = 0;
+  (void) fileio_map_mounted (thread_p, disk_cache_collect_volume, &context);
+  assert (context.nvols == nvols);
+
+  /* reading the sector tables is the expensive part; it is done in parallel. the volumes whose reset is logged are
+   * booted by this thread, then the results are added to cache */
+  if (boot_run_in_parallel (thread_p, "disk cache load", nvols, disk_cache_boot_volume, &context) != NO_ERROR)
+    {
+      ASSERT_ERROR ();
+      free_and_init (context.vols);
+      return false;
+    }
+
+  for (i = 0; i < nvols; i++)
+    {
+      if (context.vols[i].boot_by_caller
+	  && disk_volume_boot (thread_p, context.vols[i].volid, &context.vols[i].purpose, &context.vols[i].type,
+			       &context.vols[i].space_info) != NO_ERROR)
+	{
+	  ASSERT_ERROR ();
+	  free_and_init (context.vols);
+	  return false;
+	}
+      disk_cache_add_volume (context.vols[i].volid, context.vols[i].purpose, context.vols[i].type,
+			     &context.vols[i].space_info);
+    }
+
+  free_and_init (context.vols);
+  return true;
 }
 
 /*
@@ -1041,7 +1041,7 @@ dwb_create_blocks (THREAD_ENTRY * thread_p, unsigned int num_blocks, unsigned in
   block_buffer_size = num_block_pages * IO_PAGESIZE;
   for (i = 0; i < num_blocks; i++)
     {
-      blocks_write_buffer[i] = (char *) malloc (block_buffer_size * sizeof (char));
+      blocks_write_buffer[i] = (char *) fileio_alloc_aligned (block_buffer_size * sizeof (char));
       if (blocks_write_buffer[i] == NULL)
 	{
 	  er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_OUT_OF_VIRTUAL_MEMORY, 1, block_buffer_size * sizeof (char));
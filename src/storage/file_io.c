@@ -89,6 +89,7 @@
 #include "vacuum.h"
 #endif /* SERVER_MODE */
 #include "crypt_opfunc.h"
+#include "crc32c.h"
 
 #if defined(WINDOWS)
 #include "wintcp.h"
@@ -510,6 +511,9 @@ static bool fileio_is_terminated_process (int pid);
 
 static ssize_t fileio_os_read (THREAD_ENTRY * thread_p, int vol_fd, void *io_page_p, size_t count, off_t offset);
 static ssize_t fileio_os_write (THREAD_ENTRY * thread_p, int vol_fd, void *io_page_p, size_t count, off_t offset);
+static ssize_t fileio_os_pread (THREAD_ENTRY * thread_p, int vol_fd, void *io_page_p, size_t count, off_t offset);
+static ssize_t fileio_os_pwrite (THREAD_ENTRY * thread_p, int vol_fd, void *io_page_p, size_t count, off_t offset);
+static int fileio_direct_io_flag (VOLID vol_id);
 #if !defined (WINDOWS)
 static ssize_t pwrite_with_injected_fault (THREAD_ENTRY * thread_p, int fd, const void *buf, size_t count,
 					   off_t offset);
@@ -988,14 +992,12 @@ fileio_allocate_and_initialize_volume_info (FILEIO_VOLUME_HEADER * header_p, int
  * Note: Permanent volume informations are stored from volid 0 to
  *       header->max_perm_vols. If header->max_perm_vols is less than volid,
  *       allocate new io_volinfo chunk.
+ *       The caller must hold header->mutex.
  */
 static int
 fileio_expand_permanent_volume_info (FILEIO_VOLUME_HEADER * header_p, int volid)
 {
   int from_idx, to_idx;
-  int rv;
-
-  rv = pthread_mutex_lock (&header_p->mutex);
 
   from_idx = (header_p->max_perm_vols / FILEIO_VOLINFO_INCREMENT);
   to_idx = (volid + 1) / FILEIO_VOLINFO_INCREMENT;
@@ -1003,7 +1005,6 @@ fileio_expand_permanent_volume_info (FILEIO_VOLUME_HEADER * header_p, int volid)
   /* check if to_idx chunks are used for temp volume information */
   if (to_idx >= (header_p->num_volinfo_array - 1 - header_p->max_temp_vols / FILEIO_VOLINFO_INCREMENT))
     {
-      pthread_mutex_unlock (&header_p->mutex);
       return -1;
     }
 
@@ -1011,14 +1012,12 @@ fileio_expand_permanent_volume_info (FILEIO_VOLUME_HEADER * header_p, int volid)
     {
       if (fileio_allocate_and_initialize_volume_info (header_p, from_idx) != NO_ERROR)
 	{
-	  pthread_mutex_unlock (&header_p->mutex);
 	  return -1;
 	}
 
       header_p->max_perm_vols = (from_idx + 1) * FILEIO_VOLINFO_INCREMENT;
     }
 
-  pthread_mutex_unlock (&header_p->mutex);
   return 0;
 }
 
@@ -1033,14 +1032,12 @@ fileio_expand_permanent_volume_info (FILEIO_VOLUME_HEADER * header_p, int volid)
  *       LOG_MAX_DBVOLID-header->max_temp_vols.
  *       If LOG_MAX_DBVOLID-header->max_temp_vols is greater than volid,
  *       allocate new io_volinfo chunk.
+ *       The caller must hold header->mutex.
  */
 static int
 fileio_expand_temporary_volume_info (FILEIO_VOLUME_HEADER * header_p, int volid)
 {
   int from_idx, to_idx;
-  int rv;
-
-  rv = pthread_mutex_lock (&header_p->mutex);
 
   from_idx = header_p->num_volinfo_array - 1 - (header_p->max_temp_vols / FILEIO_VOLINFO_INCREMENT);
   to_idx = header_p->num_volinfo_array - 1 - ((LOG_MAX_DBVOLID - volid) / FILEIO_VOLINFO_INCREMENT);
@@ -1048,7 +1045,6 @@ fileio_expand_temporary_volume_info (FILEIO_VOLUME_HEADER * header_p, int volid)
   /* check if to_idx chunks are used for perm. volume information */
   if (to_idx <= (header_p->max_perm_vols - 1) / FILEIO_VOLINFO_INCREMENT)
     {
-      pthread_mutex_unlock (&header_p->mutex);
       return -1;
     }
 
@@ -1056,14 +1052,12 @@ fileio_expand_temporary_volume_info (FILEIO_VOLUME_HEADER * header_p, int volid)
     {
       if (fileio_allocate_and_initialize_volume_info (header_p, from_idx) != NO_ERROR)
 	{
-	  pthread_mutex_unlock (&header_p->mutex);
 	  return -1;
 	}
 
       header_p->max_temp_vols = (header_p->num_volinfo_array - from_idx) * FILEIO_VOLINFO_INCREMENT;
     }
 
-  pthread_mutex_unlock (&header_p->mutex);
   return 0;
 }
 
@@ -2055,6 +2049,67 @@ fileio_close (int vol_fd)
     }
 }
 
+/*
+ * fileio_is_direct_io_enabled () - are database volumes opened with O_DIRECT?
+ *   return: true if direct_io is set and the platform supports it
+ */
+bool
+fileio_is_direct_io_enabled (void)
+{
+#if defined (O_DIRECT) && !defined (CS_MODE)
+  return prm_get_bool_value (PRM_ID_DIRECT_IO);
+#else
+  return false;
+#endif
+}
+
+/*
+ * fileio_direct_io_flag () - open flag for a volume under direct_io
+ *   return: O_DIRECT or 0
+ *   vol_id(in): volume identifier
+ *
+ * Note: data, temporary and double write buffer volumes and the active log bypass the OS page cache; the page
+ *       buffer and the log buffer already cache them. Archives, backups and other auxiliary files are read
+ *       sequentially once and keep using the OS cache.
+ */
+static int
+fileio_direct_io_flag (VOLID vol_id)
+{
+#if defined (O_DIRECT)
+  if (fileio_is_direct_io_enabled ()
+      && (vol_id >= LOG_DBFIRST_VOLID || vol_id == LOG_DBLOG_ACTIVE_VOLID || vol_id == LOG_DBDWB_VOLID))
+    {
+      return O_DIRECT;
+    }
+#endif /* O_DIRECT */
+
+  return 0;
+}
+
+/*
+ * fileio_alloc_aligned () - allocate a buffer that can be used for direct I/O
+ *   return: buffer or NULL. The buffer is released with free ().
+ *   size(in): size in bytes
+ */
+void *
+fileio_alloc_aligned (size_t size)
+{
+#if !defined (WINDOWS)
+  void *ptr = NULL;
+
+  if (fileio_is_direct_io_enabled ())
+    {
+      if (posix_memalign (&ptr, FILEIO_DIRECT_IO_ALIGNMENT, size) != 0)
+	{
+	  return NULL;
+	}
+      return ptr;
+    }
+#endif /* !WINDOWS */
+
+  return malloc (size);
+}
+
 /*
  * fileio_create () - Create the volume (or file) without initializing it
  *   return: volume descriptor identifier on success, NULL_VOLDES on failure
@@ -2106,6 +2161,7 @@ fileio_create (THREAD_ENTRY * thread_p, const char *db_full_name_p, const char *
 #else /* !WINDOWS */
 
   o_sync = (is_do_sync != false) ? O_SYNC : 0;
+  o_sync |= fileio_direct_io_flag (vol_id);
 
   /* If the file exist make sure that nobody else is using it, before it is truncated */
   if (is_do_lock != false)
@@ -2361,7 +2417,7 @@ fileio_format (THREAD_ENTRY * thread_p, const char *db_full_name_p, const char *
       return NULL_VOLDES;
     }
 
-  malloc_io_page_p = (FILEIO_PAGE *) malloc (page_size);
+  malloc_io_page_p = (FILEIO_PAGE *) fileio_alloc_aligned (page_size);
   if (malloc_io_page_p == NULL)
     {
       er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_OUT_OF_VIRTUAL_MEMORY, 1, page_size);
@@ -2783,7 +2839,7 @@ fileio_copy_volume (THREAD_ENTRY * thread_p, int from_vol_desc, DKNPAGES npages,
     }
 
   /* Don't read the pages from the page buffer pool but directly from disk */
-  malloc_io_page_p = (FILEIO_PAGE *) malloc (IO_PAGESIZE);
+  malloc_io_page_p = (FILEIO_PAGE *) fileio_alloc_aligned (IO_PAGESIZE);
   if (malloc_io_page_p == NULL)
     {
       er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_OUT_OF_VIRTUAL_MEMORY, 1, (size_t) IO_PAGESIZE);
@@ -2859,7 +2915,7 @@ fileio_reset_volume (THREAD_ENTRY * thread_p, int vol_fd, const char *vlabel, DK
   int success = NO_ERROR;
   bool skip_flush = false;
 
-  malloc_io_page_p = (FILEIO_PAGE *) malloc (IO_PAGESIZE);
+  malloc_io_page_p = (FILEIO_PAGE *) fileio_alloc_aligned (IO_PAGESIZE);
   if (malloc_io_page_p == NULL)
     {
       er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_OUT_OF_VIRTUAL_MEMORY, 1, (size_t) IO_PAGESIZE);
@@ -2972,6 +3028,7 @@ fileio_mount (THREAD_ENTRY * thread_p, const char *db_full_name_p, const char *v
 #endif /* !CS_MODE */
 
   o_sync = (is_do_sync != false) ? O_SYNC : 0;
+  o_sync |= fileio_direct_io_flag (vol_id);
 
   /* OPEN THE DISK VOLUME PARTITION OR FILE SIMULATED VOLUME */
 start:
@@ -3831,9 +3888,51 @@ fileio_get_volume_mutex (THREAD_ENTRY * thread_p, int vdes)
  *   io_page_p(out): Address where content of page is stored. Must be of page_size long
  *   count(in): the number of bytes to be read
  *   offset(in): starting file offset
+ *
+ * Note: a volume opened with O_DIRECT rejects a buffer that is not aligned for the device with EINVAL. The page is
+ *       then read into an aligned buffer and copied.
  */
 static ssize_t
 fileio_os_read (THREAD_ENTRY * thread_p, int vol_fd, void *io_page_p, size_t count, off_t offset)
+{
+  ssize_t nbytes;
+#if !defined (WINDOWS)
+  void *aligned_p = NULL;
+#endif
+
+  nbytes = fileio_os_pread (thread_p, vol_fd, io_page_p, count, offset);
+
+#if !defined (WINDOWS)
+  if (nbytes < 0 && errno == EINVAL && fileio_is_direct_io_enabled ())
+    {
+      if (posix_memalign (&aligned_p, FILEIO_DIRECT_IO_ALIGNMENT, count) != 0)
+	{
+	  errno = ENOMEM;
+	  return -1;
+	}
+
+      nbytes = fileio_os_pread (thread_p, vol_fd, aligned_p, count, offset);
+      if (nbytes > 0)
+	{
+	  memcpy (io_page_p, aligned_p, nbytes);
+	}
+      free (aligned_p);
+    }
+#endif /* !WINDOWS */
+
+  return nbytes;
+}
+
+/*
+ * fileio_os_pread () - read from a volume at the given offset
+ *   return: the number of bytes read is returned. On error, error code.
+ *   vol_fd(in): Volume descriptor
+ *   io_page_p(out): Address where content of page is stored
+ *   count(in): the number of bytes to be read
+ *   offset(in): starting file offset
+ */
+static ssize_t
+fileio_os_pread (THREAD_ENTRY * thread_p, int vol_fd, void *io_page_p, size_t count, off_t offset)
 {
 #if !defined (SERVER_MODE)
   /* Locate the desired page */
@@ -4033,9 +4132,46 @@ fileio_write_or_add_to_dwb (THREAD_ENTRY * thread_p, int vol_fd, FILEIO_PAGE * i
  *   count(in): the number of bytes to be written
  *   offset(in): starting file offset
  *
+ * Note: as in fileio_os_read, a buffer O_DIRECT rejects is written through an aligned copy.
  */
 static ssize_t
 fileio_os_write (THREAD_ENTRY * thread_p, int vol_fd, void *io_page_p, size_t count, off_t offset)
+{
+  ssize_t nbytes;
+#if !defined (WINDOWS)
+  void *aligned_p = NULL;
+#endif
+
+  nbytes = fileio_os_pwrite (thread_p, vol_fd, io_page_p, count, offset);
+
+#if !defined (WINDOWS)
+  if (nbytes < 0 && errno == EINVAL && fileio_is_direct_io_enabled ())
+    {
+      if (posix_memalign (&aligned_p, FILEIO_DIRECT_IO_ALIGNMENT, count) != 0)
+	{
+	  errno = ENOMEM;
+	  return -1;
+	}
+
+      memcpy (aligned_p, io_page_p, count);
+      nbytes = fileio_os_pwrite (thread_p, vol_fd, aligned_p, count, offset);
+      free (aligned_p);
+    }
+#endif /* !WINDOWS */
+
+  return nbytes;
+}
+
+/*
+ * fileio_os_pwrite () - write to a volume at the given offset
+ *   return: the number of bytes written is returned. On error, error code.
+ *   vol_fd(in): Volume descriptor
+ *   io_page_p(in): In-memory address where the current content of page resides
+ *   count(in): the number of bytes to be written
+ *   offset(in): starting file offset
+ */
+static ssize_t
+fileio_os_pwrite (THREAD_ENTRY * thread_p, int vol_fd, void *io_page_p, size_t count, off_t offset)
 {
 #if !defined (SERVER_MODE)
   if (lseek (vol_fd, offset, SEEK_SET) != offset)
@@ -4441,7 +4577,13 @@ fileio_synchronize (THREAD_ENTRY * thread_p, int vol_fd, const char *vlabel, FIL
   /* If all_sync is true, everything was synchronized. This happens when DWB is completely flushed. */
   if (ret == NO_ERROR && all_sync == false)
     {
+#if !defined (WINDOWS)
+      /* with direct I/O there is no dirty page cache to write back; only the data and the metadata needed to read it
+       * back (i.e. the file size) must reach the device */
+      ret = fileio_is_direct_io_enabled ()? fdatasync (vol_fd) : fsync (vol_fd);
+#else /* !WINDOWS */
       ret = fsync (vol_fd);
+#endif /* !WINDOWS */
     }
 
 #if defined (EnableThreadMonitoring)
@@ -4640,7 +4782,7 @@ fileio_read_user_area (THREAD_ENTRY * thread_p, int vol_fd, PAGEID page_id, off_
   int actual_nread;
 #endif /* WINDOWS && SERVER_MODE */
 
-  io_page_p = (FILEIO_PAGE *) malloc (IO_PAGESIZE);
+  io_page_p = (FILEIO_PAGE *) fileio_alloc_aligned (IO_PAGESIZE);
   if (io_page_p == NULL)
     {
       er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_OUT_OF_VIRTUAL_MEMORY, 1, (size_t) IO_PAGESIZE);
@@ -4794,7 +4936,7 @@ fileio_write_user_area (THREAD_ENTRY * thread_p, int vol_fd, PAGEID page_id, off
 
 	}
 
-      io_page_p = (FILEIO_PAGE *) malloc (IO_PAGESIZE);
+      io_page_p = (FILEIO_PAGE *) fileio_alloc_aligned (IO_PAGESIZE);
       if (io_page_p == NULL)
 	{
 	  er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_OUT_OF_VIRTUAL_MEMORY, 1, (size_t) IO_PAGESIZE);
@@ -5905,6 +6047,9 @@ fileio_cache (VOLID vol_id, const char *vol_label_p, int vol_fd, FILEIO_LOCKF_TY
 
   if (vol_id > NULL_VOLID)
     {
+      /* volumes may be mounted concurrently; check and grow the volume information under the mutex */
+      rv = pthread_mutex_lock (&fileio_Vol_info_header.mutex);
+
       /* perm volume */
       if (vol_id < fileio_Vol_info_header.next_temp_volid)
 	{
@@ -5913,6 +6058,7 @@ fileio_cache (VOLID vol_id, const char *vol_label_p, int vol_fd, FILEIO_LOCKF_TY
 	  if (vol_id >= fileio_Vol_info_header.max_perm_vols
 	      && fileio_expand_permanent_volume_info (&fileio_Vol_info_header, vol_id) < 0)
 	    {
+	      pthread_mutex_unlock (&fileio_Vol_info_header.mutex);
 	      return NULL_VOLDES;
 	    }
 	  is_permanent_volume = true;
@@ -5925,6 +6071,7 @@ fileio_cache (VOLID vol_id, const char *vol_label_p, int vol_fd, FILEIO_LOCKF_TY
 	  if (((LOG_MAX_DBVOLID - vol_id) >= fileio_Vol_info_header.max_temp_vols)
 	      && fileio_expand_temporary_volume_info (&fileio_Vol_info_header, vol_id) < 0)
 	    {
+	      pthread_mutex_unlock (&fileio_Vol_info_header.mutex);
 	      return NULL_VOLDES;
 	    }
 	  is_permanent_volume = false;
@@ -5936,7 +6083,6 @@ fileio_cache (VOLID vol_id, const char *vol_label_p, int vol_fd, FILEIO_LOCKF_TY
       vol_info_p->lockf_type = lockf_type;
       strncpy (vol_info_p->vlabel, vol_label_p, PATH_MAX);
       /* modify next volume id */
-      rv = pthread_mutex_lock (&fileio_Vol_info_header.mutex);
       if (is_permanent_volume)
 	{
 	  if (fileio_Vol_info_header.next_perm_volid <= vol_id)
@@ -9990,7 +10136,7 @@ fileio_fill_hole_during_restore (THREAD_ENTRY * thread_p, int *next_page_id_p, i
 
   if (malloc_io_pgptr == NULL)
     {
-      malloc_io_pgptr = (FILEIO_PAGE *) malloc (IO_PAGESIZE);
+      malloc_io_pgptr = (FILEIO_PAGE *) fileio_alloc_aligned (IO_PAGESIZE);
       if (malloc_io_pgptr == NULL)
 	{
 	  er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_OUT_OF_VIRTUAL_MEMORY, 1, (size_t) IO_PAGESIZE);
@@ -11569,7 +11715,7 @@ fileio_initialize_res (THREAD_ENTRY * thread_p, FILEIO_PAGE * io_page, PGLENGTH
 
   io_page->prv.ptype = '\0';
   io_page->prv.pflag = '\0';
-  io_page->prv.p_reserve_1 = 0;
+  io_page->prv.checksum = 0;
   io_page->prv.p_reserve_2 = 0;
   io_page->prv.tde_nonce = 0;
 }
@@ -11807,6 +11953,69 @@ fileio_page_bitmap_dump (FILE * out_fp, const FILEIO_RESTORE_PAGE_BITMAP * page_
   fprintf (out_fp, "\n");
 }
 
+/*
+ * fileio_compute_page_checksum - Compute the CRC-32C of a page image.
+ *   return: checksum
+ *   io_page (in): the page
+ *
+ * Note: the checksum field itself is accounted as zero, so the page does not have to be modified to compute or to
+ *       verify its checksum.
+ */
+UINT32
+fileio_compute_page_checksum (const FILEIO_PAGE * io_page)
+{
+  const char *page_p = (const char *) io_page;
+  const size_t checksum_offset = offsetof (FILEIO_PAGE_RESERVED, checksum);
+  const size_t checksum_end = checksum_offset + sizeof (io_page->prv.checksum);
+  const UINT32 zero_checksum = 0;
+  unsigned int crc;
+
+  crc = crc32c_compute (CRC32C_INIT_VALUE, page_p, checksum_offset);
+  crc = crc32c_compute (crc, &zero_checksum, sizeof (zero_checksum));
+  crc = crc32c_compute (crc, page_p + checksum_end, IO_PAGESIZE - checksum_end);
+
+  return (UINT32) crc;
+}
+
+/*
+ * fileio_set_page_checksum - Stamp the page checksum before the page is written to disk.
+ *   return: error code
+ *   thread_p (in): thread entry
+ *   io_page (in/out): the page copy that is going to be written
+ *
+ * Note: must be called on the final image (after encryption), since the checksum covers the bytes on disk.
+ */
+int
+fileio_set_page_checksum (THREAD_ENTRY * thread_p, FILEIO_PAGE * io_page)
+{
+  assert (io_page != NULL);
+
+  io_page->prv.pflag |= FILEIO_PAGE_FLAG_CHECKSUM;
+  io_page->prv.checksum = fileio_compute_page_checksum (io_page);
+
+  return NO_ERROR;
+}
+
+/*
+ * fileio_is_page_checksum_valid - Verify the checksum of a page read from disk.
+ *   return: false if the page carries a checksum that does not match its content, true otherwise
+ *   io_page (in): the page
+ *
+ * Note: pages written before checksums were enabled do not have FILEIO_PAGE_FLAG_CHECKSUM and are always accepted.
+ */
+bool
+fileio_is_page_checksum_valid (const FILEIO_PAGE * io_page)
+{
+  assert (io_page != NULL);
+
+  if (!(io_page->prv.pflag & FILEIO_PAGE_FLAG_CHECKSUM))
+    {
+      return true;
+    }
+
+  return io_page->prv.checksum == fileio_compute_page_checksum (io_page);
+}
+
 /*
  * fileio_page_check_corruption - Check whether the page is corrupted.
  *   return: error code
@@ -11819,7 +12028,7 @@ fileio_page_check_corruption (THREAD_ENTRY * thread_p, FILEIO_PAGE * io_page, bo
 {
   assert (io_page != NULL && is_page_corrupted != NULL);
 
-  *is_page_corrupted = !fileio_is_page_sane (io_page, IO_PAGESIZE);
+  *is_page_corrupted = !fileio_is_page_sane (io_page, IO_PAGESIZE) || !fileio_is_page_checksum_valid (io_page);
 
   return NO_ERROR;
 }
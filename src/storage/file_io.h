@@ -63,9 +63,15 @@
 /* FILEIO_PAGE_FLAG (pflag in FILEIO_PAGE_RESERVED) */
 #define FILEIO_PAGE_FLAG_ENCRYPTED_AES 0x1
 #define FILEIO_PAGE_FLAG_ENCRYPTED_ARIA 0x2
+#define FILEIO_PAGE_FLAG_CHECKSUM 0x4	/* prv.checksum holds the CRC-32C of the page image on disk */
 
 #define FILEIO_PAGE_FLAG_ENCRYPTED_MASK 0x3
 
+/* Buffers handed to volumes opened with O_DIRECT (see direct_io) must be aligned to the logical block size of the
+ * device. Page sized buffers, including the page buffer frames, are aligned to FILEIO_DIRECT_IO_ALIGNMENT, which suits
+ * any device. Other transfers are served through an aligned copy. */
+#define FILEIO_DIRECT_IO_ALIGNMENT      4096
+
 #if defined(WINDOWS)
 #define STR_PATH_SEPARATOR "\\"
 #else /* WINDOWS */
@@ -177,7 +183,7 @@ struct fileio_page_reserved
   INT16 volid;			/* Volume identifier where the page reside */
   unsigned char ptype;		/* Page type */
   unsigned char pflag;
-  INT32 p_reserve_1;
+  UINT32 checksum;		/* Page checksum, valid only on disk when FILEIO_PAGE_FLAG_CHECKSUM is set */
   INT32 p_reserve_2;		/* unused - Reserved field */
   INT64 tde_nonce;		/* tde nonce. atomic counter for temp pages, lsa for perm pages */
 };
@@ -498,6 +504,8 @@ extern void *fileio_writev (THREAD_ENTRY * thread_p, int vdes, void **arrayof_io
 extern int fileio_synchronize (THREAD_ENTRY * thread_p, int vdes, const char *vlabel,
 			       FILEIO_SYNC_OPTION check_sync_dwb);
 extern int fileio_synchronize_all (THREAD_ENTRY * thread_p, bool include_log);
+extern bool fileio_is_direct_io_enabled (void);
+extern void *fileio_alloc_aligned (size_t size);
 #if defined (ENABLE_UNUSED_FUNCTION)
 extern void *fileio_read_user_area (THREAD_ENTRY * thread_p, int vdes, PAGEID pageid, off_t start_offset, size_t nbytes,
 				    void *area);
@@ -629,7 +637,9 @@ extern FILEIO_RESTORE_PAGE_BITMAP *fileio_page_bitmap_list_find (FILEIO_RESTORE_
 extern void fileio_page_bitmap_list_add (FILEIO_RESTORE_PAGE_BITMAP_LIST * page_bitmap_list,
 					 FILEIO_RESTORE_PAGE_BITMAP * page_bitmap);
 extern void fileio_page_bitmap_list_destroy (FILEIO_RESTORE_PAGE_BITMAP_LIST * page_bitmap_list);
+extern UINT32 fileio_compute_page_checksum (const FILEIO_PAGE * io_page);
 extern int fileio_set_page_checksum (THREAD_ENTRY * thread_p, FILEIO_PAGE * io_page);
+extern bool fileio_is_page_checksum_valid (const FILEIO_PAGE * io_page);
 extern int fileio_page_check_corruption (THREAD_ENTRY * thread_p, FILEIO_PAGE * io_page, bool * is_page_corrupted);
 extern void fileio_page_hexa_dump (const char *data, int length);
 extern bool fileio_is_formatted_page (THREAD_ENTRY * thread_p, const char *io_page);
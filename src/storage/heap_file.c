@@ -63,6 +63,7 @@
 #include "stream_to_xasl.h"
 #include "query_opfunc.h"
 #include "set_object.h"
+#include "statistics_sr.h"
 #if defined(ENABLE_SYSTEMTAP)
 #include "probes.h"
 #endif /* ENABLE_SYSTEMTAP */
@@ -17196,39 +17197,31 @@ exit:
 }
 
 /*
- * heap_object_upgrade_domain - upgrades a single attibute in an instance from
- *				the domain of current representation to the
- *				domain of the last representation.
+ * heap_attrinfo_upgrade_domain - casts the value of a single attribute read in
+ *				  the attribute info to the domain of the last
+ *				  representation.
  *
  *    return: error code , NO_ERROR if no error occured
  *    thread_p(in) : thread context
- *    upd_scancache(in): scan context
- *    attr_info(in): aatribute info structure
- *    oid(in): the oid of the object to process
+ *    attr_info(in/out): attribute info structure with the values of the
+ *			 instance; the attribute is marked as written
  *    att_id(in): attribute id within the class (same as in schema)
  *
- *  Note : this function is used in ALTER CHANGE (with type change syntax)
+ *  Note : the instance itself is not changed. It does not use the scan
+ *	   cache, so it can be called by any thread that has its own attribute
+ *	   info structure.
  */
 int
-heap_object_upgrade_domain (THREAD_ENTRY * thread_p, HEAP_SCANCACHE * upd_scancache, HEAP_CACHE_ATTRINFO * attr_info,
-			    OID * oid, const ATTR_ID att_id)
+heap_attrinfo_upgrade_domain (THREAD_ENTRY * thread_p, HEAP_CACHE_ATTRINFO * attr_info, const ATTR_ID att_id)
 {
   int i = 0, error = NO_ERROR;
   HEAP_ATTRVALUE *value = NULL;
-  int force_count = 0, updated_n_attrs_id = 0;
-  ATTR_ID atts_id[1] = { 0 };
+  int updated_n_attrs_id = 0;
   DB_VALUE orig_value;
   TP_DOMAIN_STATUS status;
 
   db_make_null (&orig_value);
 
-  if (upd_scancache == NULL || attr_info == NULL || oid == NULL)
-    {
-      error = ER_UNEXPECTED;
-      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, error, 1, "Unexpected NULL arguments.");
-      goto exit;
-    }
-
   for (i = 0, value = attr_info->values; i < attr_info->num_values; i++, value++)
     {
       TP_DOMAIN *dest_dom = value->last_attrepr->domain;
@@ -17496,7 +17489,6 @@ heap_object_upgrade_domain (THREAD_ENTRY * thread_p, HEAP_SCANCACHE * upd_scanca
 	}
 
       value->state = HEAP_WRITTEN_ATTRVALUE;
-      atts_id[updated_n_attrs_id] = value->attrid;
       updated_n_attrs_id++;
 
       break;
@@ -17513,6 +17505,47 @@ heap_object_upgrade_domain (THREAD_ENTRY * thread_p, HEAP_SCANCACHE * upd_scanca
       goto exit;
     }
 
+exit:
+  pr_clear_value (&orig_value);
+  return error;
+}
+
+/*
+ * heap_object_upgrade_domain - upgrades a single attibute in an instance from
+ *				the domain of current representation to the
+ *				domain of the last representation.
+ *
+ *    return: error code , NO_ERROR if no error occured
+ *    thread_p(in) : thread context
+ *    upd_scancache(in): scan context
+ *    attr_info(in): aatribute info structure
+ *    oid(in): the oid of the object to process
+ *    att_id(in): attribute id within the class (same as in schema)
+ *
+ *  Note : this function is used in ALTER CHANGE (with type change syntax)
+ */
+int
+heap_object_upgrade_domain (THREAD_ENTRY * thread_p, HEAP_SCANCACHE * upd_scancache, HEAP_CACHE_ATTRINFO * attr_info,
+			    OID * oid, const ATTR_ID att_id)
+{
+  int error = NO_ERROR;
+  int force_count = 0, updated_n_attrs_id = 1;
+  ATTR_ID atts_id[1] = { 0 };
+
+  if (upd_scancache == NULL || attr_info == NULL || oid == NULL)
+    {
+      error = ER_UNEXPECTED;
+      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, error, 1, "Unexpected NULL arguments.");
+      goto exit;
+    }
+
+  error = heap_attrinfo_upgrade_domain (thread_p, attr_info, att_id);
+  if (error != NO_ERROR)
+    {
+      goto exit;
+    }
+  atts_id[0] = att_id;
+
   /* the class has XCH_M_LOCK */
   error =
     locator_attribute_info_force (thread_p, &upd_scancache->node.hfid, oid, attr_info, atts_id, updated_n_attrs_id,
@@ -17530,7 +17563,6 @@ heap_object_upgrade_domain (THREAD_ENTRY * thread_p, HEAP_SCANCACHE * upd_scanca
     }
 
 exit:
-  pr_clear_value (&orig_value);
   return error;
 }
 
@@ -23016,6 +23048,11 @@ heap_insert_logical (THREAD_ENTRY * thread_p, HEAP_OPERATION_CONTEXT * context,
       perfmon_inc_stat (thread_p, PSTAT_HEAP_ASSIGN_INSERTS);
     }
 
+  if (context->recdes_p->type != REC_ASSIGN_ADDRESS)
+    {
+      stats_add_class_modifications (thread_p, &context->class_oid, 1);
+    }
+
   if (context->do_supplemental_log && !LSA_ISNULL (&context->supp_redo_lsa)
       && context->recdes_p->type != REC_ASSIGN_ADDRESS)
     {
@@ -23196,6 +23233,11 @@ heap_delete_logical (THREAD_ENTRY * thread_p, HEAP_OPERATION_CONTEXT * context)
       goto error;
     }
 
+  if (rc == NO_ERROR)
+    {
+      stats_add_class_modifications (thread_p, &context->class_oid, 1);
+    }
+
   if (context->do_supplemental_log == true)
     {
       (void) log_append_supplemental_lsa (thread_p,
@@ -23424,6 +23466,8 @@ heap_update_logical (THREAD_ENTRY * thread_p, HEAP_OPERATION_CONTEXT * context)
       goto exit;
     }
 
+  stats_add_class_modifications (thread_p, &context->class_oid, 1);
+
   /*
    * Class update case
    */
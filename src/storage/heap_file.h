@@ -599,6 +599,7 @@ extern void heap_classrepr_dump_all (THREAD_ENTRY * thread_p, FILE * fp, OID * c
 extern int heap_get_btid_from_index_name (THREAD_ENTRY * thread_p, const OID * p_class_oid, const char *index_name,
 					  BTID * p_found_btid);
 
+extern int heap_attrinfo_upgrade_domain (THREAD_ENTRY * thread_p, HEAP_CACHE_ATTRINFO * attr_info, const ATTR_ID att_id);
 extern int heap_object_upgrade_domain (THREAD_ENTRY * thread_p, HEAP_SCANCACHE * upd_scancache,
 				       HEAP_CACHE_ATTRINFO * attr_info, OID * oid, const ATTR_ID att_id);
 
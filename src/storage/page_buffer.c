@@ -129,7 +129,11 @@ static int rv;
   ((PGBUF_BCB *) ((char *) &(pgbuf_Pool.BCB_table[0]) + (PGBUF_BCB_SIZEOF * (i))))
 
 #define PGBUF_FIND_IOPAGE_PTR(i) \
-  ((PGBUF_IOPAGE_BUFFER *) ((char *) &(pgbuf_Pool.iopage_table[0]) + (PGBUF_IOPAGE_BUFFER_SIZE * (i))))
+  ((PGBUF_IOPAGE_BUFFER *) ((char *) &(pgbuf_Pool.iopage_table[0]) + (pgbuf_Pool.iopage_buffer_size * (i))))
+
+/* get the BCB owning the io page buffer; io page buffers and BCBs are kept in two tables with the same order */
+#define PGBUF_FIND_IOPAGE_BCB_PTR(ioptr) \
+  PGBUF_FIND_BCB_PTR (((char *) (ioptr) - (char *) &(pgbuf_Pool.iopage_table[0])) / pgbuf_Pool.iopage_buffer_size)
 
 #define PGBUF_FIND_BUFFER_GUARD(bufptr) \
   (&bufptr->iopage_buffer->iopage.page[DB_PAGESIZE])
@@ -137,9 +141,8 @@ static int rv;
 /* macros for casting pointers */
 #define CAST_PGPTR_TO_BFPTR(bufptr, pgptr) \
   do { \
-    (bufptr) = ((PGBUF_BCB *) ((PGBUF_IOPAGE_BUFFER *) \
-      ((char *) pgptr - offsetof (PGBUF_IOPAGE_BUFFER, iopage.page)))->bcb); \
-    assert ((bufptr) == (bufptr)->iopage_buffer->bcb); \
+    (bufptr) = PGBUF_FIND_IOPAGE_BCB_PTR ((char *) pgptr - offsetof (PGBUF_IOPAGE_BUFFER, iopage.page)); \
+    assert ((char *) (bufptr)->iopage_buffer == (char *) pgptr - offsetof (PGBUF_IOPAGE_BUFFER, iopage.page)); \
   } while (0)
 
 #define CAST_PGPTR_TO_IOPGPTR(io_pgptr, pgptr) \
@@ -154,7 +157,7 @@ static int rv;
 
 #define CAST_BFPTR_TO_PGPTR(pgptr, bufptr) \
   do { \
-    assert ((bufptr) == (bufptr)->iopage_buffer->bcb); \
+    assert ((bufptr) == PGBUF_FIND_IOPAGE_BCB_PTR ((bufptr)->iopage_buffer)); \
     (pgptr) = ((PAGE_PTR) ((char *) (bufptr->iopage_buffer) + offsetof (PGBUF_IOPAGE_BUFFER, iopage.page))); \
   } while (0)
 
@@ -500,15 +503,10 @@ struct pgbuf_bcb
   PGBUF_IOPAGE_BUFFER *iopage_buffer;	/* pointer to iopage buffer structure */
 };
 
-/* iopage buffer structure */
+/* iopage buffer structure. The frames are kept apart from their BCBs (see PGBUF_FIND_IOPAGE_BCB_PTR), so that each
+ * one can start on a device block boundary for direct I/O. */
 struct pgbuf_iopage_buffer
 {
-  PGBUF_BCB *bcb;		/* pointer to BCB structure */
-#if (__WORDSIZE == 32)
-  int dummy;			/* for 8byte align of iopage */
-#elif !defined(LINUX) && !defined(WINDOWS) && !defined(AIX)
-#error "you must check that iopage is aligned by 8byte !!"
-#endif
   FILEIO_PAGE iopage;		/* The actual buffered io page */
 };
 
@@ -720,6 +718,7 @@ struct pgbuf_buffer_pool
   PGBUF_BUFFER_HASH *buf_hash_table;	/* buffer hash table */
   PGBUF_BUFFER_LOCK *buf_lock_table;	/* buffer lock table */
   PGBUF_IOPAGE_BUFFER *iopage_table;	/* IO page table */
+  size_t iopage_buffer_size;	/* distance between two IO page buffers */
   int num_LRU_list;		/* number of shared LRU lists */
   float ratio_lru1;		/* ratio for lru 1 zone */
   float ratio_lru2;		/* ratio for lru 2 zone */
@@ -1011,6 +1010,7 @@ static int pgbuf_unlock_page (THREAD_ENTRY * thread_p, PGBUF_BUFFER_HASH * hash_
 static PGBUF_BCB *pgbuf_allocate_bcb (THREAD_ENTRY * thread_p, const VPID * src_vpid);
 static PGBUF_BCB *pgbuf_claim_bcb_for_fix (THREAD_ENTRY * thread_p, const VPID * vpid, PAGE_FETCH_MODE fetch_mode,
 					   PGBUF_BUFFER_HASH * hash_anchor, PGBUF_FIX_PERF * perf, bool * try_again);
+static int pgbuf_check_and_clear_page_checksum (THREAD_ENTRY * thread_p, const VPID * vpid, FILEIO_PAGE * iopage);
 static int pgbuf_victimize_bcb (THREAD_ENTRY * thread_p, PGBUF_BCB * bufptr);
 static int pgbuf_bcb_safe_flush_internal (THREAD_ENTRY * thread_p, PGBUF_BCB * bufptr, bool synchronous, bool * locked);
 static int pgbuf_invalidate_bcb (THREAD_ENTRY * thread_p, PGBUF_BCB * bufptr);
@@ -2027,7 +2027,7 @@ try_again:
       perf.holder_wait_time = perf.tv_diff.tv_sec * 1000000LL + perf.tv_diff.tv_usec;
     }
 
-  assert (bufptr == bufptr->iopage_buffer->bcb);
+  assert (bufptr == PGBUF_FIND_IOPAGE_BCB_PTR (bufptr->iopage_buffer));
 
   /* In case of NO_ERROR, bufptr->mutex has been released. */
 
@@ -4829,7 +4829,7 @@ pgbuf_set_bcb_page_vpid (PGBUF_BCB * bufptr)
 	  bufptr->iopage_buffer->iopage.prv.volid = bufptr->vpid.volid;
 
 	  bufptr->iopage_buffer->iopage.prv.ptype = PAGE_UNKNOWN;
-	  bufptr->iopage_buffer->iopage.prv.p_reserve_1 = 0;
+	  bufptr->iopage_buffer->iopage.prv.checksum = 0;
 	  bufptr->iopage_buffer->iopage.prv.p_reserve_2 = 0;
 	  bufptr->iopage_buffer->iopage.prv.tde_nonce = 0;
 	}
@@ -4950,7 +4950,13 @@ pgbuf_initialize_bcb_table (void)
     }
 
   /* allocate space for io page buffers */
-  alloc_size = (long long unsigned) pgbuf_Pool.num_buffers * PGBUF_IOPAGE_BUFFER_SIZE;
+  pgbuf_Pool.iopage_buffer_size = PGBUF_IOPAGE_BUFFER_SIZE;
+  if (fileio_is_direct_io_enabled ())
+    {
+      /* direct I/O reads and writes the frames in place, so each one must start on a device block boundary */
+      pgbuf_Pool.iopage_buffer_size = DB_ALIGN (PGBUF_IOPAGE_BUFFER_SIZE, FILEIO_DIRECT_IO_ALIGNMENT);
+    }
+  alloc_size = (long long unsigned) pgbuf_Pool.num_buffers * pgbuf_Pool.iopage_buffer_size;
   if (!MEM_SIZE_IS_VALID (alloc_size))
     {
       er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_PRM_BAD_VALUE, 1, "data_buffer_pages");
@@ -4960,7 +4966,7 @@ pgbuf_initialize_bcb_table (void)
 	}
       return ER_PRM_BAD_VALUE;
     }
-  pgbuf_Pool.iopage_table = (PGBUF_IOPAGE_BUFFER *) malloc ((size_t) alloc_size);
+  pgbuf_Pool.iopage_table = (PGBUF_IOPAGE_BUFFER *) fileio_alloc_aligned ((size_t) alloc_size);
   if (pgbuf_Pool.iopage_table == NULL)
     {
       er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_OUT_OF_VIRTUAL_MEMORY, 1, (size_t) alloc_size);
@@ -5018,12 +5024,11 @@ pgbuf_initialize_bcb_table (void)
 
       ioptr->iopage.prv.ptype = (unsigned char) PAGE_UNKNOWN;
       ioptr->iopage.prv.pflag = '\0';
-      ioptr->iopage.prv.p_reserve_1 = 0;
+      ioptr->iopage.prv.checksum = 0;
       ioptr->iopage.prv.p_reserve_2 = 0;
       ioptr->iopage.prv.tde_nonce = 0;
 
       bufptr->iopage_buffer = ioptr;
-      ioptr->bcb = bufptr;
 
 #if defined(CUBRID_DEBUG)
       /* Reinitizalize the buffer */
@@ -7609,6 +7614,43 @@ end:
   return bufptr;
 }
 
+/*
+ * pgbuf_check_and_clear_page_checksum () - verify the checksum of a page that was just read from disk or from DWB
+ *
+ * return        : ER_PB_PAGE_CHECKSUM_MISMATCH if the page is corrupted, NO_ERROR otherwise
+ * thread_p (in) : thread entry
+ * vpid (in)     : page identifier
+ * iopage (in/out) : page image, still encrypted if TDE is used
+ *
+ * note: the checksum is only meaningful for the on-disk image. it is removed from the buffered page, so it is never
+ *       flushed stale and it is recomputed (or omitted) on the next flush.
+ */
+static int
+pgbuf_check_and_clear_page_checksum (THREAD_ENTRY * thread_p, const VPID * vpid, FILEIO_PAGE * iopage)
+{
+  UINT32 computed_checksum;
+
+  if (!(iopage->prv.pflag & FILEIO_PAGE_FLAG_CHECKSUM))
+    {
+      /* written without checksum */
+      assert (iopage->prv.checksum == 0);
+      return NO_ERROR;
+    }
+
+  computed_checksum = fileio_compute_page_checksum (iopage);
+  if (computed_checksum != iopage->prv.checksum)
+    {
+      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_PB_PAGE_CHECKSUM_MISMATCH, 4, vpid->pageid,
+	      fileio_get_volume_label (vpid->volid, PEEK), iopage->prv.checksum, computed_checksum);
+      return ER_PB_PAGE_CHECKSUM_MISMATCH;
+    }
+
+  iopage->prv.pflag &= ~FILEIO_PAGE_FLAG_CHECKSUM;
+  iopage->prv.checksum = 0;
+
+  return NO_ERROR;
+}
+
 /*
  * pgbuf_claim_bcb_for_fix () - function used for page fix to claim a bcb when page is not found in buffer
  *
@@ -7753,6 +7795,21 @@ pgbuf_claim_bcb_for_fix (THREAD_ENTRY * thread_p, const VPID * vpid, PAGE_FETCH_
 	  return NULL;
 	}
 
+      if (pgbuf_check_and_clear_page_checksum (thread_p, vpid, &bufptr->iopage_buffer->iopage) != NO_ERROR)
+	{
+	  ASSERT_ERROR ();
+	  pgbuf_put_bcb_into_invalid_list (thread_p, bufptr);
+	  (void) pgbuf_unlock_page (thread_p, hash_anchor, vpid, true);
+#if defined(ENABLE_SYSTEMTAP)
+	  if (monitored == true)
+	    {
+	      CUBRID_IO_READ_END (query_id, IO_PAGESIZE, 1);
+	    }
+#endif /* ENABLE_SYSTEMTAP */
+	  PGBUF_BCB_CHECK_MUTEX_LEAKS ();
+	  return NULL;
+	}
+
       CAST_IOPGPTR_TO_PGPTR (pgptr, &bufptr->iopage_buffer->iopage);
       tde_algo = pgbuf_get_tde_algorithm (pgptr);
       if (tde_algo != TDE_ALGORITHM_NONE)
@@ -9991,6 +10048,11 @@ start_copy_page:
     {
       memcpy ((void *) iopage, (void *) (&bufptr->iopage_buffer->iopage), IO_PAGESIZE);
     }
+  if (!is_temp && prm_get_bool_value (PRM_ID_DATA_PAGE_CHECKSUM))
+    {
+      /* stamp the final image, so that a torn or corrupted page is detected when it is read back */
+      (void) fileio_set_page_checksum (thread_p, iopage);
+    }
   if (uses_dwb)
     {
       error = dwb_set_data_on_next_slot (thread_p, iopage, false, &dwb_slot);
@@ -10435,7 +10497,7 @@ pgbuf_check_bcb_page_vpid (PGBUF_BCB * bufptr, bool maybe_deallocated)
 	      || (bufptr->vpid.pageid == bufptr->iopage_buffer->iopage.prv.pageid
 		  && bufptr->vpid.volid == bufptr->iopage_buffer->iopage.prv.volid));
 
-      assert (bufptr->iopage_buffer->iopage.prv.p_reserve_1 == 0);
+      assert (bufptr->iopage_buffer->iopage.prv.checksum == 0);
       assert (bufptr->iopage_buffer->iopage.prv.p_reserve_2 == 0);
 
       return (bufptr->vpid.pageid == bufptr->iopage_buffer->iopage.prv.pageid
@@ -10470,7 +10532,7 @@ pgbuf_scramble (FILEIO_PAGE * iopage)
 
   iopage->prv.ptype = (unsigned char) PAGE_UNKNOWN;
   iopage->prv.pflag = '\0';
-  iopage->prv.p_reserve_1 = 0;
+  iopage->prv.checksum = 0;
   iopage->prv.p_reserve_2 = 0;
   iopage->prv.tde_nonce = 0;
 }
@@ -16279,7 +16341,7 @@ pgbuf_start_scan (THREAD_ENTRY * thread_p, int type, DB_VALUE ** arg_values, int
   db_make_int (&vals[idx], pgbuf_Pool.num_buffers);
   idx++;
 
-  db_make_int (&vals[idx], PGBUF_IOPAGE_BUFFER_SIZE);
+  db_make_int (&vals[idx], (int) pgbuf_Pool.iopage_buffer_size);
   idx++;
 
   db_make_int (&vals[idx], status_snapshot->free_pages);
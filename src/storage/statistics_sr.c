@@ -38,6 +38,20 @@
 #include "object_representation.h"
 #include "thread_entry.hpp"
 #include "system_parameter.h"
+#include "log_impl.h"
+#include "xserver_interface.h"
+#include "xasl_cache.h"
+#if defined (SERVER_MODE)
+#include "server_support.h"
+#include "thread_daemon.hpp"
+#include "thread_entry_task.hpp"
+#include "thread_manager.hpp"
+#endif /* SERVER_MODE */
+
+#include <algorithm>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
 
 #define SQUARE(n) ((n)*(n))
 
@@ -73,6 +87,32 @@ static int stats_compare_money (DB_MONETARY * mn1, DB_MONETARY * mn2);
 static int stats_update_partitioned_statistics (THREAD_ENTRY * thread_p, OID * class_oid, OID * partitions, int count,
 						bool with_fullscan);
 
+/* Number of committed rows inserted, updated or deleted in each class since its statistics were last updated. The
+ * counters live in memory only. Transactions add to them once, at commit; they are split in several maps to keep the
+ * committing threads from waiting on one another. */
+#define STATS_MODIFICATIONS_MAP_COUNT 64
+
+// *INDENT-OFF*
+struct stats_modifications_map
+{
+  std::mutex mutex;
+  std::unordered_map<UINT64, INT64> changes;	/* key is stats_modifications_key () of the class OID */
+};
+
+static stats_modifications_map stats_Modifications[STATS_MODIFICATIONS_MAP_COUNT];
+// *INDENT-ON*
+
+static UINT64 stats_modifications_key (const OID * class_oid);
+static OID stats_modifications_key_to_oid (UINT64 key);
+static INT64 stats_get_class_modifications (const OID * class_oid);
+static void stats_remove_class_modifications (const OID * class_oid, INT64 n_changes);
+#if defined (SERVER_MODE)
+static int stats_auto_update_class (THREAD_ENTRY * thread_p, const OID * class_oid, INT64 n_changes, int *page_budget);
+static void stats_auto_update_execute (cubthread::entry & thread_ref);
+
+static cubthread::daemon *stats_Auto_update_daemon = NULL;
+#endif /* SERVER_MODE */
+
 /*
  * xstats_update_statistics () -  Updates the statistics for the objects
  *                                of a given class
@@ -117,9 +157,13 @@ xstats_update_statistics (THREAD_ENTRY * thread_p, OID * class_id_p, bool with_f
   int count = 0, error_code = NO_ERROR;
   int lk_grant_code = 0;
   CATALOG_ACCESS_INFO catalog_access_info = CATALOG_ACCESS_INFO_INITIALIZER;
+  INT64 n_modifications;
 
   thread_p->push_resource_tracks ();
 
+  /* changes made from now on are not necessarily seen by this update; they count for the next one */
+  n_modifications = stats_get_class_modifications (class_id_p);
+
   OID_SET_NULL (&dir_oid);
 
   if (heap_get_class_name (thread_p, class_id_p, &class_name) != NO_ERROR || class_name == NULL)
@@ -322,6 +366,11 @@ end:
 	  class_name ? class_name : "*UNKNOWN-CLASS*", class_id_p->volid, class_id_p->pageid, class_id_p->slotid,
 	  error_code);
 
+  if (error_code == NO_ERROR)
+    {
+      stats_remove_class_modifications (class_id_p, n_modifications);
+    }
+
   if (class_name)
     {
       free_and_init (class_name);
@@ -1843,3 +1892,364 @@ stats_find_inherited_index_stats (OR_CLASSREP * cls_rep, OR_CLASSREP * subcls_re
   er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_GENERIC_ERROR, 0);
   return NULL;
 }
+
+/*
+ * stats_modifications_key () - key of a class in the modification counters
+ *   return: key
+ *   class_oid(in): class OID
+ */
+static UINT64
+stats_modifications_key (const OID * class_oid)
+{
+  return (((UINT64) (unsigned int) class_oid->pageid) << 32) | (((UINT64) (unsigned short) class_oid->volid) << 16)
+    | (UINT64) (unsigned short) class_oid->slotid;
+}
+
+/*
+ * stats_modifications_key_to_oid () - class OID of a modification counters key
+ *   return: class OID
+ *   key(in): key
+ */
+static OID
+stats_modifications_key_to_oid (UINT64 key)
+{
+  OID class_oid;
+
+  class_oid.pageid = (INT32) (key >> 32);
+  class_oid.volid = (INT16) ((key >> 16) & 0xFFFF);
+  class_oid.slotid = (INT16) (key & 0xFFFF);
+
+  return class_oid;
+}
+
+/*
+ * stats_add_class_modifications () - count rows changed in a class by the current transaction
+ *   return: void
+ *   thread_p(in): thread entry
+ *   class_oid(in): class OID
+ *   n_changes(in): number of inserted, updated or deleted rows
+ *
+ * Note: The rows are counted in the transaction descriptor and added to the counters read by the automatic
+ *	 statistics update daemon when the transaction commits (see stats_publish_class_modifications). Nothing is
+ *	 counted when the daemon is disabled.
+ */
+void
+stats_add_class_modifications (THREAD_ENTRY * thread_p, const OID * class_oid, int n_changes)
+{
+#if defined (SERVER_MODE)
+  LOG_TDES *tdes;
+
+  if (stats_Auto_update_daemon == NULL || OID_ISNULL (class_oid) || OID_IS_ROOTOID (class_oid))
+    {
+      return;
+    }
+
+  tdes = LOG_FIND_CURRENT_TDES (thread_p);
+  if (tdes == NULL)
+    {
+      return;
+    }
+  tdes->m_class_changes.add (*class_oid, n_changes);
+#endif /* SERVER_MODE */
+}
+
+/*
+ * stats_publish_class_modifications () - add the rows changed by a committed transaction to the counters of their
+ *					   classes
+ *   return: void
+ *   tdes(in): transaction descriptor
+ */
+void
+stats_publish_class_modifications (LOG_TDES * tdes)
+{
+#if defined (SERVER_MODE)
+  // *INDENT-OFF*
+  tdes->m_class_changes.map ([] (const OID & class_oid, INT64 n_changes)
+    {
+      UINT64 key = stats_modifications_key (&class_oid);
+      stats_modifications_map & map = stats_Modifications[key % STATS_MODIFICATIONS_MAP_COUNT];
+      std::lock_guard < std::mutex > lock (map.mutex);
+      map.changes[key] += n_changes;
+    });
+  // *INDENT-ON*
+#endif /* SERVER_MODE */
+  tdes->m_class_changes.clear ();
+}
+
+/*
+ * stats_get_class_modifications () - rows changed in a class since its statistics were last updated
+ *   return: number of changes
+ *   class_oid(in): class OID
+ */
+static INT64
+stats_get_class_modifications (const OID * class_oid)
+{
+  UINT64 key = stats_modifications_key (class_oid);
+  stats_modifications_map & map = stats_Modifications[key % STATS_MODIFICATIONS_MAP_COUNT];
+  std::lock_guard < std::mutex > lock (map.mutex);
+
+  auto it = map.changes.find (key);
+  return it != map.changes.end ()? it->second : 0;
+}
+
+/*
+ * stats_remove_class_modifications () - forget the changes accounted by an update of the statistics of a class
+ *   return: void
+ *   class_oid(in): class OID
+ *   n_changes(in): changes counted when the update started
+ */
+static void
+stats_remove_class_modifications (const OID * class_oid, INT64 n_changes)
+{
+  UINT64 key = stats_modifications_key (class_oid);
+  stats_modifications_map & map = stats_Modifications[key % STATS_MODIFICATIONS_MAP_COUNT];
+  std::lock_guard < std::mutex > lock (map.mutex);
+
+  auto it = map.changes.find (key);
+  if (it == map.changes.end ())
+    {
+      return;
+    }
+  it->second -= n_changes;
+  if (it->second <= 0)
+    {
+      map.changes.erase (it);
+    }
+}
+
+#if defined (SERVER_MODE)
+/*
+ * stats_auto_update_class () - update the statistics of a class if enough of its rows changed
+ *   return: error code
+ *   class_oid(in): class OID
+ *   n_changes(in): rows changed in the class
+ *   page_budget(in/out): pages that may still be sampled by this run of the daemon
+ *
+ * Note: The statistics of a partition are updated together with the partitioned class, since the optimizer reads
+ *	 the latter. Statistics are sampled (as UPDATE STATISTICS without FULLSCAN), and the XASL cache entries of the
+ *	 class are removed so that the plans are compiled again with the new statistics.
+ */
+static int
+stats_auto_update_class (THREAD_ENTRY * thread_p, const OID * class_oid, INT64 n_changes, int *page_budget)
+{
+  CLS_INFO *cls_info_p = NULL;
+  OID target_oid, root_oid;
+  OID *partitions = NULL;
+  int count = 0;
+  int npages;
+  double threshold;
+  int error;
+
+  cls_info_p = catalog_get_class_info (thread_p, (OID *) class_oid, NULL);
+  if (cls_info_p == NULL)
+    {
+      /* dropped class */
+      er_clear ();
+      stats_remove_class_modifications (class_oid, n_changes);
+      return NO_ERROR;
+    }
+
+  threshold = prm_get_integer_value (PRM_ID_AUTO_UPDATE_STATISTICS_MIN_CHANGES)
+    + prm_get_float_value (PRM_ID_AUTO_UPDATE_STATISTICS_CHANGE_RATIO) * (double) cls_info_p->ci_tot_objects;
+  npages = cls_info_p->ci_tot_pages;
+  catalog_free_class_info_and_init (cls_info_p);
+
+  if ((double) n_changes < threshold)
+    {
+      return NO_ERROR;
+    }
+
+  COPY_OID (&target_oid, class_oid);
+  error = partition_find_root_class_oid (thread_p, class_oid, &root_oid);
+  if (error != NO_ERROR)
+    {
+      return error;
+    }
+  if (!OID_ISNULL (&root_oid) && !OID_EQ (&root_oid, class_oid))
+    {
+      error = partition_get_partition_oids (thread_p, &root_oid, &partitions, &count);
+      if (error != NO_ERROR)
+	{
+	  return error;
+	}
+      if (partitions != NULL)
+	{
+	  db_private_free_and_init (thread_p, partitions);
+	}
+      if (count > 0)
+	{
+	  COPY_OID (&target_oid, &root_oid);
+
+	  cls_info_p = catalog_get_class_info (thread_p, &target_oid, NULL);
+	  if (cls_info_p == NULL)
+	    {
+	      ASSERT_ERROR_AND_SET (error);
+	      return error;
+	    }
+	  npages = cls_info_p->ci_tot_pages;
+	  catalog_free_class_info_and_init (cls_info_p);
+	}
+    }
+
+  if (npages > *page_budget && *page_budget < prm_get_integer_value (PRM_ID_AUTO_UPDATE_STATISTICS_MAX_PAGES))
+    {
+      /* over budget; keep the changes for the next run. a class larger than the whole budget runs alone. */
+      return NO_ERROR;
+    }
+  *page_budget -= MAX (npages, 1);
+
+  error = xstats_update_statistics (thread_p, &target_oid, STATS_WITH_SAMPLING);
+  if (error == ER_UPDATE_STAT_CANNOT_GET_LOCK || error == ER_SP_UNKNOWN_SLOTID)
+    {
+      /* the class is being altered or was dropped; try again the next time */
+      er_clear ();
+      return NO_ERROR;
+    }
+  else if (error != NO_ERROR)
+    {
+      return error;
+    }
+
+  /* the changes of the class (and of all partitions) were removed by xstats_update_statistics */
+  xcache_remove_by_oid (thread_p, &target_oid);
+
+  return NO_ERROR;
+}
+
+/*
+ * stats_auto_update_execute () - update the statistics of the classes with many changed rows
+ *   return: void
+ *   thread_ref(in): daemon thread
+ *
+ * Note: The classes with most changes are handled first, until the pages of the sampled classes reach
+ *	 auto_update_statistics_max_pages. Each class is updated in its own transaction.
+ */
+static void
+stats_auto_update_execute (cubthread::entry & thread_ref)
+{
+  THREAD_ENTRY *thread_p = &thread_ref;
+  std::vector < std::pair < UINT64, INT64 >> candidates;
+  INT64 min_changes;
+  int page_budget;
+  int tran_index;
+  int error;
+
+  if (!BO_IS_SERVER_RESTARTED ())
+    {
+      // wait for boot to finish
+      return;
+    }
+  if (!HA_DISABLED () && css_ha_server_state () != HA_SERVER_STATE_ACTIVE)
+    {
+      /* only the active server changes the catalog */
+      return;
+    }
+
+  min_changes = prm_get_integer_value (PRM_ID_AUTO_UPDATE_STATISTICS_MIN_CHANGES);
+  for (stats_modifications_map & map : stats_Modifications)
+    {
+      std::lock_guard < std::mutex > lock (map.mutex);
+      for (const auto & it : map.changes)
+	{
+	  if (it.second > 0 && it.second >= min_changes)
+	    {
+	      candidates.push_back (it);
+	    }
+	}
+    }
+  if (candidates.empty ())
+    {
+      return;
+    }
+
+  std::sort (candidates.begin (), candidates.end (),
+	     [] (const std::pair < UINT64, INT64 > &a, const std::pair < UINT64, INT64 > &b)
+	     {
+	       return a.second > b.second;
+	     });
+
+  page_budget = prm_get_integer_value (PRM_ID_AUTO_UPDATE_STATISTICS_MAX_PAGES);
+  for (const auto & candidate : candidates)
+    {
+      OID class_oid = stats_modifications_key_to_oid (candidate.first);
+
+      if (page_budget <= 0)
+	{
+	  break;
+	}
+
+      tran_index =
+	logtb_assign_tran_index (thread_p, NULL_TRANID, TRAN_ACTIVE, NULL, NULL, TRAN_LOCK_INFINITE_WAIT,
+				 TRAN_DEFAULT_ISOLATION_LEVEL ());
+      if (tran_index == NULL_TRAN_INDEX)
+	{
+	  /* no free transaction slot; try again the next time */
+	  er_clear ();
+	  break;
+	}
+
+      error = stats_auto_update_class (thread_p, &class_oid, candidate.second, &page_budget);
+      if (error == NO_ERROR)
+	{
+	  (void) xtran_server_commit (thread_p, false);
+	}
+      else
+	{
+	  (void) xtran_server_abort (thread_p);
+	  er_clear ();
+	}
+
+      logtb_free_tran_index (thread_p, tran_index);
+      logtb_set_to_system_tran_index (thread_p);
+    }
+}
+
+/*
+ * stats_daemons_init () - start the automatic statistics update daemon
+ *   return: void
+ *
+ * Note: The daemon is not started when auto_update_statistics_interval_in_secs is 0.
+ */
+void
+stats_daemons_init (void)
+{
+  int interval_secs = prm_get_integer_value (PRM_ID_AUTO_UPDATE_STATISTICS_INTERVAL_IN_SECS);
+
+  assert (stats_Auto_update_daemon == NULL);
+  if (interval_secs <= 0)
+    {
+      return;
+    }
+
+  // *INDENT-OFF*
+  cubthread::looper looper = cubthread::looper (std::chrono::seconds (interval_secs));
+  cubthread::entry_callable_task *daemon_task =
+    new cubthread::entry_callable_task (std::bind (stats_auto_update_execute, std::placeholders::_1));
+
+  stats_Auto_update_daemon = cubthread::get_manager ()->create_daemon (looper, daemon_task, "stats_auto_update");
+  // *INDENT-ON*
+}
+
+/*
+ * stats_daemons_destroy () - stop the automatic statistics update daemon
+ *   return: void
+ */
+void
+stats_daemons_destroy (void)
+{
+  if (stats_Auto_update_daemon == NULL)
+    {
+      return;
+    }
+
+  // *INDENT-OFF*
+  cubthread::get_manager ()->destroy_daemon (stats_Auto_update_daemon);
+  // *INDENT-ON*
+
+  for (stats_modifications_map & map : stats_Modifications)
+    {
+      std::lock_guard < std::mutex > lock (map.mutex);
+      map.changes.clear ();
+    }
+}
+#endif /* SERVER_MODE */
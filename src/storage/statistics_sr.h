@@ -34,10 +34,17 @@
 #include "statistics.h"
 #include "system_catalog.h"
 #include "object_representation_sr.h"
+#include "log_impl.h"
 
 extern unsigned int stats_get_time_stamp (void);
 extern const BTREE_STATS *stats_find_inherited_index_stats (OR_CLASSREP * cls_rep, OR_CLASSREP * subcls_rep,
 							    DISK_ATTR * subcls_attr, BTID * cls_btid);
+extern void stats_add_class_modifications (THREAD_ENTRY * thread_p, const OID * class_oid, int n_changes);
+extern void stats_publish_class_modifications (LOG_TDES * tdes);
+#if defined (SERVER_MODE)
+extern void stats_daemons_init (void);
+extern void stats_daemons_destroy (void);
+#endif /* SERVER_MODE */
 #if defined(CUBRID_DEBUG)
 extern void stats_dump_class_statistics (CLASS_STATS * class_stats, FILE * fpp);
 #endif /* CUBRID_DEBUG */
@@ -1027,6 +1027,10 @@ extern const int SM_MAX_STRING_LENGTH;
 #define SM_FILTER_INDEX_ID "*FP*"
 #define SM_FUNCTION_INDEX_ID "*FI*"
 #define SM_PREFIX_INDEX_ID "*PLID*"
+#define SM_INCLUDE_INDEX_ID "*INC*"
+
+/* class property holding the defining query of a materialized view */
+#define SM_PROPERTY_MATERIALIZED_VIEW "*MV"
 
 /*
  *    Bit field identifiers for attribute flags.  These could be defined
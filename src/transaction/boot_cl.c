@@ -91,6 +91,7 @@
 #if defined(CS_MODE)
 #include "network.h"
 #include "connection_cl.h"
+#include "schema_shm_cache.h"
 #endif /* CS_MODE */
 #include "network_interface_cl.h"
 
@@ -1569,6 +1570,9 @@ boot_client_all_finalize (bool is_er_final)
 #endif /* !WINDOWS */
 
       locator_free_areas ();
+#if defined (CS_MODE)
+      schema_shm_cache_final ();
+#endif /* CS_MODE */
       sysprm_final ();
       perfmon_finalize ();
       area_final ();
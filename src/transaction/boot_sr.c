@@ -75,12 +75,15 @@
 #include "filter_pred_cache.h"
 #include "scan_manager.h"
 #include "slotted_page.h"
+#include "thread_entry_task.hpp"
 #include "thread_manager.hpp"
 #include "double_write_buffer.h"
+#include "statistics_sr.h"
 #include "xasl_cache.h"
 #include "log_volids.hpp"
 #include "vacuum.h"
 #include "tde.h"
+#include "tsc_timer.h"
 #include "porting.h"
 #include "log_manager.h"
 
@@ -99,6 +102,12 @@
 #include "probes.h"
 #endif /* ENABLE_SYSTEMTAP */
 
+#include <atomic>
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <vector>
+
 #define BOOT_LEAVE_SAFE_OSDISK_PARTITION_FREE_SPACE  \
   (1250 * (IO_DEFAULT_PAGE_SIZE / IO_PAGESIZE))	/* 5 Mbytes */
 
@@ -131,6 +140,48 @@ enum remove_temp_vol_action
 { REMOVE_TEMP_VOL_DEFAULT_ACTION, ONLY_PHYSICAL_REMOVE_TEMP_VOL_ACTION };
 typedef enum remove_temp_vol_action REMOVE_TEMP_VOL_ACTION;
 
+/* state shared by the workers of boot_run_in_parallel */
+typedef struct boot_parallel_context BOOT_PARALLEL_CONTEXT;
+struct boot_parallel_context
+{
+  int (*fun) (THREAD_ENTRY * thread_p, int index, void *args);
+  void *args;
+  int n_items;
+  std::atomic<int> next_item;	/* next item to be claimed by a worker */
+  std::vector<bool> failed;	/* items to be processed again by the caller */
+  int n_running_workers;
+  std::mutex mutex;
+  std::condition_variable workers_done;
+};
+
+/* items collected for the parallel mount of the volumes */
+typedef struct boot_volume_item BOOT_VOLUME_ITEM;
+struct boot_volume_item
+{
+  VOLID volid;
+  char vlabel[PATH_MAX];
+};
+
+typedef struct boot_volume_list BOOT_VOLUME_LIST;
+struct boot_volume_list
+{
+  BOOT_VOLUME_ITEM *items;
+  int n_items;
+  int max_items;
+};
+
+/* elapsed time of the steps of boot_restart_server, in microseconds */
+typedef struct boot_restart_times BOOT_RESTART_TIMES;
+struct boot_restart_times
+{
+  UINT64 mount_usec;
+  UINT64 disk_cache_usec;
+  UINT64 recovery_usec;		/* DWB, vacuum data and log recovery */
+  UINT64 classname_usec;
+  UINT64 cache_usec;		/* XASL, query, list file and filter predicate caches */
+  UINT64 total_usec;
+};
+
 extern bool catcls_Enable;
 extern int catcls_compile_catalog_classes (THREAD_ENTRY * thread_p);
 extern int catcls_finalize_class_oid_to_oid_hash_table (THREAD_ENTRY * thread_p);
@@ -190,6 +241,13 @@ static void boot_find_rest_temp_volumes (THREAD_ENTRY * thread_p, VOLID volid,
 					 bool forward_dir, bool check_before_access);
 static int boot_check_permanent_volumes (THREAD_ENTRY * thread_p);
 static int boot_mount (THREAD_ENTRY * thread_p, VOLID volid, const char *vlabel, void *ignore_arg);
+static int boot_collect_volume (THREAD_ENTRY * thread_p, VOLID volid, const char *vlabel, void *args);
+static int boot_premount_volume (THREAD_ENTRY * thread_p, int index, void *args);
+static void boot_mount_volumes_in_parallel (THREAD_ENTRY * thread_p);
+static UINT64 boot_restart_step_usec (TSC_TICKS * step_tick);
+#if defined (SERVER_MODE)
+static void boot_report_restart_time (const BOOT_RESTART_TIMES * times);
+#endif /* SERVER_MODE */
 static char *boot_find_new_db_path (char *db_pathbuf, const char *fileof_vols_and_wherepaths);
 static int boot_create_all_volumes (THREAD_ENTRY * thread_p, const BOOT_CLIENT_CREDENTIAL * client_credential,
 				    const char *db_comments, DKNPAGES db_npages, const char *file_addmore_vols,
@@ -1374,6 +1432,258 @@ boot_mount (THREAD_ENTRY * thread_p, VOLID volid, const char *vlabel, void *igno
   return NO_ERROR;
 }
 
+/*
+ * boot_parallel_worker_execute () - worker of boot_run_in_parallel
+ *
+ * return : void
+ *
+ *   thread_ref(in): worker thread entry
+ *   context(in): shared context of the parallel run
+ *
+ * Note: Items are claimed one at a time until none are left. The error of a failed item is not kept in the worker;
+ *       the item is only marked, so the caller can execute it again in its own context.
+ */
+static void
+boot_parallel_worker_execute (cubthread::entry & thread_ref, BOOT_PARALLEL_CONTEXT * context)
+{
+  int index;
+
+  /* workers do not log; they must not share the transaction of the caller */
+  thread_ref.tran_index = LOG_SYSTEM_TRAN_INDEX;
+
+  while ((index = context->next_item++) < context->n_items)
+    {
+      if ((*context->fun) (&thread_ref, index, context->args) != NO_ERROR)
+	{
+	  context->failed[index] = true;
+	  er_clear ();
+	}
+    }
+
+  std::unique_lock<std::mutex> ulock (context->mutex);
+  if (--context->n_running_workers == 0)
+    {
+      context->workers_done.notify_all ();
+    }
+}
+
+/*
+ * boot_run_in_parallel () - call a function on every item of a boot step using boot_worker_count threads
+ *
+ * return : NO_ERROR if all OK, ER_ status otherwise
+ *
+ *   name(in): name of the temporary worker pool
+ *   n_items(in): number of items
+ *   fun(in): function to call on thread entry, item index and arguments; it must be safe to call concurrently for
+ *            different items and must not append log records
+ *   args(in): extra arguments for function to call
+ *
+ * Note: When no worker pool can be created (stand-alone mode or no free thread entries), the items are processed by
+ *       the calling thread. Items that failed in a worker are processed again by the calling thread, so the error is
+ *       set in the context of the caller.
+ */
+int
+boot_run_in_parallel (THREAD_ENTRY * thread_p, const char *name, int n_items,
+		      int (*fun) (THREAD_ENTRY * thread_p, int index, void *args), void *args)
+{
+  BOOT_PARALLEL_CONTEXT context;
+  cubthread::entry_workpool *workpool = NULL;
+  int n_workers;
+  int index;
+  int error_code = NO_ERROR;
+
+  if (n_items <= 0)
+    {
+      return NO_ERROR;
+    }
+
+  n_workers = MIN (prm_get_integer_value (PRM_ID_BOOT_WORKER_COUNT), n_items);
+  if (n_workers > 1)
+    {
+      workpool = cubthread::get_manager ()->create_worker_pool (n_workers, n_workers, name, NULL, 1, false);
+    }
+
+  if (workpool == NULL)
+    {
+      for (index = 0; index < n_items; index++)
+	{
+	  error_code = (*fun) (thread_p, index, args);
+	  if (error_code != NO_ERROR)
+	    {
+	      return error_code;
+	    }
+	}
+      return NO_ERROR;
+    }
+
+  context.fun = fun;
+  context.args = args;
+  context.n_items = n_items;
+  context.next_item = 0;
+  context.failed.assign (n_items, false);
+  context.n_running_workers = n_workers;
+
+  for (index = 0; index < n_workers; index++)
+    {
+      cubthread::get_manager ()->push_task (workpool,
+					    new cubthread::entry_callable_task (std::bind (boot_parallel_worker_execute,
+											   std::placeholders::_1,
+											   &context)));
+    }
+
+  {
+    std::unique_lock<std::mutex> ulock (context.mutex);
+    context.workers_done.wait (ulock, [&context] { return context.n_running_workers == 0; });
+  }
+
+  cubthread::get_manager ()->destroy_worker_pool (workpool);
+
+  for (index = 0; index < n_items; index++)
+    {
+      if (context.failed[index])
+	{
+	  error_code = (*fun) (thread_p, index, args);
+	  if (error_code != NO_ERROR)
+	    {
+	      return error_code;
+	    }
+	}
+    }
+
+  return NO_ERROR;
+}
+
+/*
+ * boot_collect_volume () - add a volume found in the volume information to a volume list
+ *
+ * return : NO_ERROR if all OK, ER_ status otherwise
+ *
+ *   volid(in): Volume identifier
+ *   vlabel(in): Volume label
+ *   args(in): BOOT_VOLUME_LIST
+ */
+static int
+boot_collect_volume (THREAD_ENTRY * thread_p, VOLID volid, const char *vlabel, void *args)
+{
+  BOOT_VOLUME_LIST *list = (BOOT_VOLUME_LIST *) args;
+  BOOT_VOLUME_ITEM *new_items;
+  int new_max_items;
+
+  if (list->n_items == list->max_items)
+    {
+      new_max_items = list->max_items == 0 ? 16 : list->max_items * 2;
+      new_items = (BOOT_VOLUME_ITEM *) realloc (list->items, new_max_items * sizeof (BOOT_VOLUME_ITEM));
+      if (new_items == NULL)
+	{
+	  er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_OUT_OF_VIRTUAL_MEMORY, 1,
+		  (size_t) (new_max_items * sizeof (BOOT_VOLUME_ITEM)));
+	  return ER_OUT_OF_VIRTUAL_MEMORY;
+	}
+      list->items = new_items;
+      list->max_items = new_max_items;
+    }
+
+  list->items[list->n_items].volid = volid;
+  strncpy_bufsize (list->items[list->n_items].vlabel, vlabel);
+  list->n_items++;
+
+  return NO_ERROR;
+}
+
+/*
+ * boot_premount_volume () - mount a volume of a volume list and read its header
+ *
+ * return : NO_ERROR
+ *
+ *   index(in): index of the volume in the list
+ *   args(in): BOOT_VOLUME_LIST
+ *
+ * Note: Errors are ignored. boot_mount is called on every volume afterwards and reports them.
+ */
+static int
+boot_premount_volume (THREAD_ENTRY * thread_p, int index, void *args)
+{
+  BOOT_VOLUME_LIST *list = (BOOT_VOLUME_LIST *) args;
+  BOOT_VOLUME_ITEM *item = &list->items[index];
+  char check_vlabel[PATH_MAX];
+
+  if (fileio_mount (thread_p, boot_Db_full_name, item->vlabel, item->volid, false, false) == NULL_VOLDES
+      || xdisk_get_fullname (thread_p, item->volid, check_vlabel) == NULL)
+    {
+      er_clear ();
+    }
+
+  return NO_ERROR;
+}
+
+/*
+ * boot_mount_volumes_in_parallel () - mount the volumes listed in the volume information using several threads
+ *
+ * return : void
+ *
+ * Note: This only speeds up boot_find_rest_volumes, which finds the volumes already mounted and checks them as usual.
+ *       Nothing is done if the volume information cannot be read.
+ */
+static void
+boot_mount_volumes_in_parallel (THREAD_ENTRY * thread_p)
+{
+  BOOT_VOLUME_LIST list = { NULL, 0, 0 };
+
+  if (logpb_scan_volume_info (thread_p, NULL, LOG_DBFIRST_VOLID, LOG_DBFIRST_VOLID, boot_collect_volume, &list) > 0)
+    {
+      (void) boot_run_in_parallel (thread_p, "boot volume mount", list.n_items, boot_premount_volume, &list);
+    }
+  er_clear ();
+
+  if (list.items != NULL)
+    {
+      free_and_init (list.items);
+    }
+}
+
+/*
+ * boot_restart_step_usec () - get the time elapsed since the start of a restart step and start the next step
+ *
+ * return : elapsed time in microseconds
+ *
+ *   step_tick(in/out): start of the step; set to the current time
+ */
+static UINT64
+boot_restart_step_usec (TSC_TICKS * step_tick)
+{
+  TSC_TICKS now_tick;
+  UINT64 elapsed_usec;
+
+  tsc_getticks (&now_tick);
+  elapsed_usec = tsc_elapsed_utime (now_tick, *step_tick);
+  *step_tick = now_tick;
+
+  return elapsed_usec;
+}
+
+#if defined (SERVER_MODE)
+/*
+ * boot_report_restart_time () - write the time spent in the steps of the restart to the error log
+ *
+ * return : void
+ *
+ *   times(in): elapsed time of the restart steps
+ */
+static void
+boot_report_restart_time (const BOOT_RESTART_TIMES * times)
+{
+  char buf[256];
+
+  snprintf (buf, sizeof (buf),
+	    "%lld ms (volume mount %lld ms, disk cache %lld ms, recovery %lld ms, class names %lld ms, caches %lld ms)",
+	    (long long) (times->total_usec / 1000), (long long) (times->mount_usec / 1000),
+	    (long long) (times->disk_cache_usec / 1000), (long long) (times->recovery_usec / 1000),
+	    (long long) (times->classname_usec / 1000), (long long) (times->cache_usec / 1000));
+
+  er_set (ER_NOTIFICATION_SEVERITY, ARG_FILE_LINE, ER_BO_RESTART_TIME_BREAKDOWN, 1, buf);
+}
+#endif /* SERVER_MODE */
+
 #if !defined(WINDOWS)
 static jmp_buf boot_Init_server_jmpbuf;
 #endif
@@ -2068,6 +2378,8 @@ boot_restart_server (THREAD_ENTRY * thread_p, bool print_restart, const char *db
   char *mk_path;
   int jsp_port;
   bool jsp;
+  TSC_TICKS start_tick, step_tick;
+  BOOT_RESTART_TIMES restart_times = { 0, 0, 0, 0, 0, 0 };
 
   /* language data is loaded in context of server */
   if (lang_init () != NO_ERROR)
@@ -2426,13 +2738,22 @@ boot_restart_server (THREAD_ENTRY * thread_p, bool print_restart, const char *db
       lang_set_charset (db_charset_db_header);
     }
 
+  tsc_getticks (&start_tick);
+  step_tick = start_tick;
+
   /* Find the rest of the volumes and mount them */
 
+  if (!from_backup || r_args == NULL || !r_args->newvolpath)
+    {
+      boot_mount_volumes_in_parallel (thread_p);
+    }
+
   error_code = boot_find_rest_volumes (thread_p, from_backup ? r_args : NULL, LOG_DBFIRST_VOLID, boot_mount, NULL);
   if (error_code != NO_ERROR)
     {
       goto error;
     }
+  restart_times.mount_usec = boot_restart_step_usec (&step_tick);
 
   /* initialize disk manager */
   error_code = disk_manager_init (thread_p, true);
@@ -2441,6 +2762,7 @@ boot_restart_server (THREAD_ENTRY * thread_p, bool print_restart, const char *db
       ASSERT_ERROR ();
       goto error;
     }
+  restart_times.disk_cache_usec = boot_restart_step_usec (&step_tick);
 
   error_code = logtb_initialize_global_unique_stats_table (thread_p);
   if (error_code != NO_ERROR)
@@ -2483,6 +2805,7 @@ boot_restart_server (THREAD_ENTRY * thread_p, bool print_restart, const char *db
    */
 
   log_initialize (thread_p, boot_Db_full_name, log_path, log_prefix, from_backup, r_args);
+  restart_times.recovery_usec = boot_restart_step_usec (&step_tick);
 
   error_code = boot_after_copydb (thread_p);	// only does something if this is first boot after copydb
   if (error_code != NO_ERROR)
@@ -2495,6 +2818,7 @@ boot_restart_server (THREAD_ENTRY * thread_p, bool print_restart, const char *db
   pgbuf_daemons_init ();
   dwb_daemons_init ();
   cdc_daemons_init ();
+  stats_daemons_init ();
 #endif /* SERVER_MODE */
 
   // after recovery we can boot vacuum
@@ -2510,6 +2834,7 @@ boot_restart_server (THREAD_ENTRY * thread_p, bool print_restart, const char *db
    * classes
    */
 
+  (void) boot_restart_step_usec (&step_tick);
   error_code = locator_initialize (thread_p);
   if (error_code != NO_ERROR)
     {
@@ -2522,6 +2847,7 @@ boot_restart_server (THREAD_ENTRY * thread_p, bool print_restart, const char *db
     {
       goto error;
     }
+  restart_times.classname_usec = boot_restart_step_usec (&step_tick);
 
   error_code = xcache_initialize (thread_p);
   if (error_code != NO_ERROR)
@@ -2548,6 +2874,7 @@ boot_restart_server (THREAD_ENTRY * thread_p, bool print_restart, const char *db
       ASSERT_ERROR ();
       goto error;
     }
+  restart_times.cache_usec = boot_restart_step_usec (&step_tick);
 
   /*
    * Initialize system locale using values from db_root system table
@@ -2774,6 +3101,11 @@ boot_restart_server (THREAD_ENTRY * thread_p, bool print_restart, const char *db
   json_set_alloc_funcs (malloc, free);
 #endif
 
+  restart_times.total_usec = boot_restart_step_usec (&start_tick);
+#if defined (SERVER_MODE)
+  boot_report_restart_time (&restart_times);
+#endif /* SERVER_MODE */
+
   return NO_ERROR;
 
 error:
@@ -2806,6 +3138,7 @@ error:
   vacuum_stop_master (thread_p);
 
 #if defined(SERVER_MODE)
+  stats_daemons_destroy ();
   cdc_daemons_destroy ();
 
   pgbuf_daemons_destroy ();
@@ -3098,6 +3431,11 @@ xboot_shutdown_server (REFPTR (THREAD_ENTRY, thread_p), ER_FINAL_CODE is_er_fina
 
   sysprm_set_force (prm_get_name (PRM_ID_SUPPRESS_FSYNC), "0");
 
+#if defined(SERVER_MODE)
+  /* the daemon runs its own transactions; stop it before aborting the active ones */
+  stats_daemons_destroy ();
+#endif /* SERVER_MODE */
+
   /* Shutdown the system with the system transaction */
   logtb_set_to_system_tran_index (thread_p);
   log_abort_all_active_transaction (thread_p);
@@ -52,6 +52,9 @@
 #include "network_interface_cl.h"
 #include "execute_statement.h"
 #include "log_lsa.hpp"
+#if defined (CS_MODE)
+#include "schema_shm_cache.h"
+#endif /* CS_MODE */
 
 #define WS_SET_FOUND_DELETED(mop) WS_SET_DELETED(mop)
 #define MAX_FETCH_SIZE 64
@@ -620,6 +623,11 @@ locator_lock (MOP mop, LC_OBJTYPE isclass, LOCK lock, LC_FETCH_VERSION_TYPE fetc
   int error_code = NO_ERROR;
   bool is_prefetch;
   LOCK class_lock;
+#if defined (CS_MODE)
+  RECDES shm_class;		/* Class record shared by the processes of this host */
+
+  shm_class.data = NULL;
+#endif /* CS_MODE */
 
   oid = ws_oid (mop);
 
@@ -782,6 +790,24 @@ locator_lock (MOP mop, LC_OBJTYPE isclass, LOCK lock, LC_FETCH_VERSION_TYPE fetc
       is_prefetch = false;
     }
 
+#if defined (CS_MODE)
+  if (object == NULL && class_mop == sm_Root_class_mop)
+    {
+      /*
+       * The class may have been fetched by another process of this host.
+       * Ask the server with the CHN of the shared record; it sends the class
+       * only if the shared record is not current.
+       */
+      shm_class.data = schema_shm_cache_get (oid, &shm_class.length);
+      if (shm_class.data != NULL)
+	{
+	  shm_class.area_size = shm_class.length;
+	  shm_class.type = REC_HOME;
+	  chn = or_chn (&shm_class);
+	}
+    }
+#endif /* CS_MODE */
+
   if (fetch_version_type == LC_FETCH_CURRENT_VERSION && TM_TRAN_READ_FETCH_VERSION () == LC_FETCH_CURRENT_VERSION)
     {
       /* The purpose was to fetch current version from beginning (not based on mop). This may happen when write results
@@ -810,6 +836,28 @@ locator_lock (MOP mop, LC_OBJTYPE isclass, LOCK lock, LC_FETCH_VERSION_TYPE fetc
 	}
     }
 
+#if defined (CS_MODE)
+  if (shm_class.data != NULL)
+    {
+      /* The class was not sent, so the shared record is current */
+      if (ws_find (mop, &object) != WS_FIND_MOP_DELETED && object == NULL)
+	{
+	  object = tf_disk_to_class (oid, &shm_class);
+	  if (object == NULL)
+	    {
+	      error_code = ER_FAILED;
+	      if (er_errid () == ER_OUT_OF_VIRTUAL_MEMORY)
+		{
+		  error_code = ER_OUT_OF_VIRTUAL_MEMORY;
+		}
+	      goto error;
+	    }
+	  ws_cache (object, mop, sm_Root_class_mop);
+	}
+      free_and_init (shm_class.data);
+    }
+#endif /* CS_MODE */
+
   /*
    * Cache the lock for the object and its class.
    * We need to do this since we don't know if the object was received in
@@ -826,6 +874,13 @@ end:
   return error_code;
 
 error:
+#if defined (CS_MODE)
+  if (shm_class.data != NULL)
+    {
+      free_and_init (shm_class.data);
+    }
+#endif /* CS_MODE */
+
   /* There was a failure. Was the transaction aborted ? */
   if (er_errid () == ER_LK_UNILATERALLY_ABORTED)
     {
@@ -3346,6 +3401,9 @@ locator_cache_object_class (MOP mop, LC_COPYAREA_ONEOBJ * obj, MOBJ * object_p,
 	}
 
       ws_cache (*object_p, mop, sm_Root_class_mop);
+#if defined (CS_MODE)
+      schema_shm_cache_put (&obj->oid, recdes_p);
+#endif /* CS_MODE */
       break;
 
     case LC_FETCH_DECACHE_LOCK:
@@ -3378,6 +3436,9 @@ locator_cache_object_class (MOP mop, LC_COPYAREA_ONEOBJ * obj, MOBJ * object_p,
 	  else
 	    {
 	      ws_cache (*object_p, mop, sm_Root_class_mop);
+#if defined (CS_MODE)
+	      schema_shm_cache_put (&obj->oid, recdes_p);
+#endif /* CS_MODE */
 	    }
 	}
       ws_set_lock (mop, NULL_LOCK);
@@ -31,6 +31,10 @@
 #include <fcntl.h>
 #include <assert.h>
 #include <cstring>		// for std::memcpy
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <mutex>
 
 #include "locator_sr.h"
 
@@ -62,6 +66,7 @@
 #include "slotted_page.h"
 #include "xasl_cache.h"
 #include "xasl_predicate.hpp"
+#include "thread_entry_task.hpp"
 #include "thread_manager.hpp"	// for thread_get_thread_entry_info
 #include "transaction_transient.hpp"
 #include "xserver_interface.h"
@@ -118,6 +123,54 @@ struct locator_return_nxobj
   int area_offset;		/* Relative offset to recdes->data in the communication area */
 };
 
+/* objects whose new records are built by one task of a parallel domain upgrade */
+#define LOCATOR_UPGRADE_CHUNK_OBJECTS 64
+/* chunks queued to the workers of a domain upgrade before the caller applies the oldest one */
+#define LOCATOR_UPGRADE_CHUNKS_PER_WORKER 8
+/* seconds between two progress notifications of a domain upgrade */
+#define LOCATOR_UPGRADE_PROGRESS_INTERVAL 60
+
+typedef enum
+{
+  LOCATOR_UPGRADE_CHUNK_QUEUED,
+  LOCATOR_UPGRADE_CHUNK_BUILT,
+  LOCATOR_UPGRADE_CHUNK_FAILED	/* built again by the caller, so the error is set in its context */
+} LOCATOR_UPGRADE_CHUNK_STATE;
+
+typedef struct locator_upgrade_object LOCATOR_UPGRADE_OBJECT;
+struct locator_upgrade_object
+{
+  OID oid;
+  RECDES old_recdes;		/* record in the fetch area */
+  RECDES new_recdes;		/* record in the upgraded domain; points to new_area */
+  LC_COPYAREA *new_area;
+};
+
+typedef struct locator_upgrade_chunk LOCATOR_UPGRADE_CHUNK;
+struct locator_upgrade_chunk
+{
+  LC_COPYAREA *fetch_area;	/* freed with the last chunk of the area; NULL for other chunks */
+  LOCATOR_UPGRADE_CHUNK_STATE state;
+  int n_objects;
+  LOCATOR_UPGRADE_OBJECT objects[LOCATOR_UPGRADE_CHUNK_OBJECTS];
+};
+
+/* state shared by xlocator_upgrade_instances_domain and its workers. the workers build the new records and the
+ * caller updates the instances in fetch order, since all changes are logged by its transaction. */
+typedef struct locator_upgrade_context LOCATOR_UPGRADE_CONTEXT;
+struct locator_upgrade_context
+{
+  cubthread::entry_workpool *workpool;
+  OID class_oid;
+  ATTR_ID att_id;
+  int tran_index;		/* transaction index the workers run with */
+  int max_queued_chunks;
+  bool is_stopped;		/* the caller failed; queued chunks are not built */
+  std::deque<LOCATOR_UPGRADE_CHUNK *> chunks;	/* in fetch order */
+  std::mutex mutex;
+  std::condition_variable chunk_built;
+};
+
 bool locator_Dont_check_foreign_key = false;
 
 static MHT_TABLE *locator_Mht_classnames = NULL;
@@ -235,6 +288,19 @@ static DB_LOGICAL locator_mvcc_reev_cond_and_assignment (THREAD_ENTRY * thread_p
 							 MVCC_REEV_DATA * mvcc_reev_data_p,
 							 MVCC_REC_HEADER * mvcc_header_p,
 							 const OID * curr_row_version_oid_p, RECDES * recdes);
+static int locator_upgrade_build_chunk (THREAD_ENTRY * thread_p, LOCATOR_UPGRADE_CONTEXT * context,
+					LOCATOR_UPGRADE_CHUNK * chunk);
+static void locator_upgrade_build_chunk_task (cubthread::entry & thread_ref, LOCATOR_UPGRADE_CONTEXT * context,
+					      LOCATOR_UPGRADE_CHUNK * chunk);
+static LOCATOR_UPGRADE_CONTEXT *locator_upgrade_start_workers (THREAD_ENTRY * thread_p, OID * class_oid, int att_id,
+							       HEAP_CACHE_ATTRINFO * attr_info);
+static void locator_upgrade_queue_area (LOCATOR_UPGRADE_CONTEXT * context, LC_COPYAREA * fetch_area, OID * last_oid);
+static int locator_upgrade_apply_chunk (THREAD_ENTRY * thread_p, LOCATOR_UPGRADE_CONTEXT * context, HFID * hfid,
+					HEAP_SCANCACHE * upd_scancache, int has_index, INT64 * n_upgraded);
+static void locator_upgrade_stop_workers (LOCATOR_UPGRADE_CONTEXT * context);
+static void locator_upgrade_report_progress (THREAD_ENTRY * thread_p, OID * class_oid, int att_id, INT64 n_upgraded,
+					     INT64 n_objects, time_t start_time, time_t * last_report_time,
+					     bool is_final);
 
 /*
  * locator_initialize () - Initialize the locator on the server
@@ -253,6 +319,7 @@ locator_initialize (THREAD_ENTRY * thread_p)
   char *classname = NULL;
   HEAP_SCANCACHE scan_cache;
   LOCATOR_CLASSNAME_ENTRY *entry;
+  int num_classes;
 
   if (csect_enter (thread_p, CSECT_LOCATOR_SR_CLASSNAME_TABLE, INF_WAIT) != NO_ERROR)
     {
@@ -268,14 +335,22 @@ locator_initialize (THREAD_ENTRY * thread_p)
       return DISK_ERROR;
     }
 
+  if (boot_find_root_heap (&root_hfid) != NO_ERROR || HFID_IS_NULL (&root_hfid))
+    {
+      goto error;
+    }
+
   if (locator_Mht_classnames != NULL)
     {
       (void) mht_map (locator_Mht_classnames, locator_force_drop_class_name_entry, NULL);
     }
   else
     {
+      /* size the table for the classes of the database, so it does not have to grow while they are loaded */
+      num_classes = heap_estimate_num_objects (thread_p, &root_hfid);
       locator_Mht_classnames =
-	mht_create ("Memory hash Classname to OID", CLASSNAME_CACHE_SIZE, mht_1strhash, mht_compare_strings_are_equal);
+	mht_create ("Memory hash Classname to OID", MAX (CLASSNAME_CACHE_SIZE, num_classes + num_classes / 4),
+		    mht_1strhash, mht_compare_strings_are_equal);
     }
 
   if (locator_Mht_classnames == NULL)
@@ -286,11 +361,6 @@ locator_initialize (THREAD_ENTRY * thread_p)
 
   /* Find every single class */
 
-  if (boot_find_root_heap (&root_hfid) != NO_ERROR || HFID_IS_NULL (&root_hfid))
-    {
-      goto error;
-    }
-
   if (heap_scancache_start (thread_p, &scan_cache, &root_hfid, NULL, true, false, NULL) != NO_ERROR)
     {
       goto error;
@@ -6939,6 +7009,7 @@ xlocator_repl_force (THREAD_ENTRY * thread_p, LC_COPYAREA * force_area, LC_COPYA
   DB_VALUE key_value;
   int packed_key_value_len;
   HFID prev_hfid = HFID_INITIALIZER;
+  OID prev_class_oid = OID_INITIALIZER;
   int has_index;
 
   /* need to start a topop to ensure the atomic operation. */
@@ -6968,10 +7039,19 @@ xlocator_repl_force (THREAD_ENTRY * thread_p, LC_COPYAREA * force_area, LC_COPYA
 
       LC_REPL_RECDES_FOR_ONEOBJ (force_area, obj, packed_key_value_len, &recdes);
 
-      error_code = heap_get_class_info (thread_p, &obj->class_oid, &obj->hfid, NULL, NULL);
-      if (error_code != NO_ERROR)
+      /* the log applier sends runs of objects of the same class */
+      if (force_scancache != NULL && OID_EQ (&prev_class_oid, &obj->class_oid))
 	{
-	  goto exit_on_error;
+	  HFID_COPY (&obj->hfid, &prev_hfid);
+	}
+      else
+	{
+	  error_code = heap_get_class_info (thread_p, &obj->class_oid, &obj->hfid, NULL, NULL);
+	  if (error_code != NO_ERROR)
+	    {
+	      goto exit_on_error;
+	    }
+	  COPY_OID (&prev_class_oid, &obj->class_oid);
 	}
 
       if (HFID_EQ (&prev_hfid, &obj->hfid) != true && force_scancache != NULL)
@@ -12103,6 +12183,378 @@ error:
   return error_code;
 }
 
+/*
+ * locator_upgrade_build_chunk () - build the records of a chunk of instances in the last representation of their
+ *				    class, with the attribute upgraded to its new domain
+ *
+ * return: NO_ERROR if all OK, ER_ status otherwise
+ *
+ *   thread_p(in): thread context
+ *   context(in): domain upgrade context
+ *   chunk(in/out): chunk of instances
+ *
+ * Note: Records already built by a worker that failed later in the chunk are kept.
+ */
+static int
+locator_upgrade_build_chunk (THREAD_ENTRY * thread_p, LOCATOR_UPGRADE_CONTEXT * context, LOCATOR_UPGRADE_CHUNK * chunk)
+{
+  HEAP_CACHE_ATTRINFO attr_info;
+  LOCATOR_UPGRADE_OBJECT *object;
+  int i;
+  int error = NO_ERROR;
+
+  error = heap_attrinfo_start (thread_p, &context->class_oid, -1, NULL, &attr_info);
+  if (error != NO_ERROR)
+    {
+      return error;
+    }
+
+  for (i = 0; i < chunk->n_objects; i++)
+    {
+      object = &chunk->objects[i];
+      if (object->new_area != NULL)
+	{
+	  continue;
+	}
+
+      error = heap_attrinfo_clear_dbvalues (&attr_info);
+      if (error != NO_ERROR)
+	{
+	  break;
+	}
+
+      error = heap_attrinfo_read_dbvalues (thread_p, &object->oid, &object->old_recdes, &attr_info);
+      if (error != NO_ERROR)
+	{
+	  break;
+	}
+
+      error = heap_attrinfo_upgrade_domain (thread_p, &attr_info, context->att_id);
+      if (error != NO_ERROR)
+	{
+	  break;
+	}
+
+      object->new_area =
+	locator_allocate_copy_area_by_attr_info (thread_p, &attr_info, &object->old_recdes, &object->new_recdes, -1,
+						 LOB_FLAG_INCLUDE_LOB);
+      if (object->new_area == NULL)
+	{
+	  error = ER_FAILED;
+	  break;
+	}
+    }
+
+  heap_attrinfo_end (thread_p, &attr_info);
+
+  return error;
+}
+
+/*
+ * locator_upgrade_build_chunk_task () - worker task of a domain upgrade
+ *
+ * return: void
+ *
+ *   thread_ref(in): worker thread entry
+ *   context(in): domain upgrade context
+ *   chunk(in/out): chunk of instances
+ */
+static void
+locator_upgrade_build_chunk_task (cubthread::entry & thread_ref, LOCATOR_UPGRADE_CONTEXT * context,
+				  LOCATOR_UPGRADE_CHUNK * chunk)
+{
+  LOCATOR_UPGRADE_CHUNK_STATE state = LOCATOR_UPGRADE_CHUNK_FAILED;
+  bool is_stopped;
+
+  thread_ref.tran_index = context->tran_index;
+
+  {
+    std::unique_lock<std::mutex> ulock (context->mutex);
+    is_stopped = context->is_stopped;
+  }
+
+  if (!is_stopped && locator_upgrade_build_chunk (&thread_ref, context, chunk) == NO_ERROR)
+    {
+      state = LOCATOR_UPGRADE_CHUNK_BUILT;
+    }
+  er_clear ();
+
+  std::unique_lock<std::mutex> ulock (context->mutex);
+  chunk->state = state;
+  context->chunk_built.notify_all ();
+}
+
+/*
+ * locator_upgrade_start_workers () - start the workers of a domain upgrade
+ *
+ * return: domain upgrade context, or NULL if the instances are upgraded by the calling thread only
+ *
+ *   thread_p(in): thread context
+ *   class_oid(in): class to upgrade
+ *   att_id(in): attribute id within class to update
+ *   attr_info(in): attribute information of the class
+ *
+ * Note: A LOB attribute is always upgraded by the calling thread, since LOB copies are registered to the
+ *	 transaction while the new record is built.
+ */
+static LOCATOR_UPGRADE_CONTEXT *
+locator_upgrade_start_workers (THREAD_ENTRY * thread_p, OID * class_oid, int att_id, HEAP_CACHE_ATTRINFO * attr_info)
+{
+  LOCATOR_UPGRADE_CONTEXT *context;
+  cubthread::entry_workpool *workpool;
+  int n_workers;
+  int i;
+
+  n_workers = prm_get_integer_value (PRM_ID_ALTER_TABLE_CHANGE_TYPE_WORKER_COUNT);
+  if (n_workers < 2)
+    {
+      return NULL;
+    }
+
+  for (i = 0; i < attr_info->num_values; i++)
+    {
+      if (attr_info->values[i].attrid == att_id && attr_info->values[i].last_attrepr != NULL
+	  && (attr_info->values[i].last_attrepr->type == DB_TYPE_BLOB
+	      || attr_info->values[i].last_attrepr->type == DB_TYPE_CLOB))
+	{
+	  return NULL;
+	}
+    }
+
+  workpool = cubthread::get_manager ()->create_worker_pool (n_workers, n_workers * LOCATOR_UPGRADE_CHUNKS_PER_WORKER,
+							    "alter change type workers", NULL, 1, false);
+  if (workpool == NULL)
+    {
+      return NULL;
+    }
+
+  context = new LOCATOR_UPGRADE_CONTEXT ();
+  context->workpool = workpool;
+  COPY_OID (&context->class_oid, class_oid);
+  context->att_id = att_id;
+  context->tran_index = LOG_FIND_THREAD_TRAN_INDEX (thread_p);
+  context->max_queued_chunks = n_workers * LOCATOR_UPGRADE_CHUNKS_PER_WORKER;
+  context->is_stopped = false;
+
+  return context;
+}
+
+/*
+ * locator_upgrade_queue_area () - split the instances of a fetch area in chunks and queue them to the workers
+ *
+ * return: void
+ *
+ *   context(in): domain upgrade context
+ *   fetch_area(in): fetched instances; owned by the chunks afterwards
+ *   last_oid(out): last instance of the area
+ */
+static void
+locator_upgrade_queue_area (LOCATOR_UPGRADE_CONTEXT * context, LC_COPYAREA * fetch_area, OID * last_oid)
+{
+  LC_COPYAREA_MANYOBJS *mobjs;
+  LC_COPYAREA_ONEOBJ *obj;
+  LOCATOR_UPGRADE_CHUNK *chunk = NULL;
+  LOCATOR_UPGRADE_OBJECT *object;
+  std::vector<LOCATOR_UPGRADE_CHUNK *> area_chunks;
+  int i;
+
+  mobjs = LC_MANYOBJS_PTR_IN_COPYAREA (fetch_area);
+  obj = LC_START_ONEOBJ_PTR_IN_COPYAREA (mobjs);
+
+  for (i = 0; i < mobjs->num_objs; i++, obj = LC_NEXT_ONEOBJ_PTR_IN_COPYAREA (obj))
+    {
+      if (obj->operation == LC_FETCH_DECACHE_LOCK)
+	{
+	  /* Skip decache lock objects, they have been added by lock_notify_isolation_incons function. */
+	  continue;
+	}
+
+      if (chunk == NULL || chunk->n_objects == LOCATOR_UPGRADE_CHUNK_OBJECTS)
+	{
+	  chunk = new LOCATOR_UPGRADE_CHUNK ();
+	  chunk->fetch_area = NULL;
+	  chunk->state = LOCATOR_UPGRADE_CHUNK_QUEUED;
+	  chunk->n_objects = 0;
+	  area_chunks.push_back (chunk);
+	}
+
+      object = &chunk->objects[chunk->n_objects++];
+      COPY_OID (&object->oid, &obj->oid);
+      LC_RECDES_TO_GET_ONEOBJ (fetch_area, obj, &object->old_recdes);
+      object->new_area = NULL;
+
+      COPY_OID (last_oid, &obj->oid);
+    }
+
+  if (area_chunks.empty ())
+    {
+      locator_free_copy_area (fetch_area);
+      return;
+    }
+  area_chunks.back ()->fetch_area = fetch_area;
+
+  for (LOCATOR_UPGRADE_CHUNK * area_chunk : area_chunks)
+    {
+      {
+	std::unique_lock<std::mutex> ulock (context->mutex);
+	context->chunks.push_back (area_chunk);
+      }
+      cubthread::get_manager ()->push_task (context->workpool,
+					    new cubthread::entry_callable_task (std::bind (locator_upgrade_build_chunk_task,
+											   std::placeholders::_1,
+											   context, area_chunk)));
+    }
+}
+
+/*
+ * locator_upgrade_apply_chunk () - wait for the oldest queued chunk and update its instances
+ *
+ * return: NO_ERROR if all OK, ER_ status otherwise
+ *
+ *   thread_p(in): thread context
+ *   context(in): domain upgrade context
+ *   hfid(in): heap file of the class
+ *   upd_scancache(in): scan cache for the updates
+ *   has_index(in): LC_FLAG_HAS_INDEX, and LC_FLAG_HAS_UNIQUE_INDEX if the attribute has a unique index
+ *   n_upgraded(in/out): number of upgraded instances
+ *
+ * Note: The chunk is freed even on error. If the chunk is the last one of its fetch area, the area is freed too.
+ */
+static int
+locator_upgrade_apply_chunk (THREAD_ENTRY * thread_p, LOCATOR_UPGRADE_CONTEXT * context, HFID * hfid,
+			     HEAP_SCANCACHE * upd_scancache, int has_index, INT64 * n_upgraded)
+{
+  LOCATOR_UPGRADE_CHUNK *chunk;
+  LOCATOR_UPGRADE_OBJECT *object;
+  ATTR_ID att_id = context->att_id;
+  int force_count = 0;
+  int i;
+  int error = NO_ERROR;
+
+  {
+    std::unique_lock<std::mutex> ulock (context->mutex);
+
+    assert (!context->chunks.empty ());
+    chunk = context->chunks.front ();
+    context->chunks.pop_front ();
+    context->chunk_built.wait (ulock, [chunk] { return chunk->state != LOCATOR_UPGRADE_CHUNK_QUEUED; });
+  }
+
+  if (!context->is_stopped)
+    {
+      if (chunk->state == LOCATOR_UPGRADE_CHUNK_FAILED)
+	{
+	  error = locator_upgrade_build_chunk (thread_p, context, chunk);
+	}
+
+      for (i = 0; i < chunk->n_objects && error == NO_ERROR; i++)
+	{
+	  object = &chunk->objects[i];
+
+	  /* the class has SCH_M_LOCK */
+	  error =
+	    locator_update_force (thread_p, hfid, &context->class_oid, &object->oid, &object->old_recdes,
+				  &object->new_recdes, has_index, &att_id, 1, SINGLE_ROW_UPDATE, upd_scancache,
+				  &force_count, false, REPL_INFO_TYPE_RBR_NORMAL, DB_NOT_PARTITIONED_CLASS, NULL, NULL,
+				  UPDATE_INPLACE_OLD_MVCCID, false);
+	  if (error == ER_MVCC_NOT_SATISFIED_REEVALUATION)
+	    {
+	      error = NO_ERROR;
+	    }
+	  if (error == NO_ERROR)
+	    {
+	      (*n_upgraded)++;
+	    }
+	}
+    }
+
+  for (i = 0; i < chunk->n_objects; i++)
+    {
+      if (chunk->objects[i].new_area != NULL)
+	{
+	  locator_free_copy_area (chunk->objects[i].new_area);
+	}
+    }
+  if (chunk->fetch_area != NULL)
+    {
+      locator_free_copy_area (chunk->fetch_area);
+    }
+  delete chunk;
+
+  return error;
+}
+
+/*
+ * locator_upgrade_stop_workers () - free the chunks left and stop the workers of a domain upgrade
+ *
+ * return: void
+ *
+ *   context(in): domain upgrade context
+ */
+static void
+locator_upgrade_stop_workers (LOCATOR_UPGRADE_CONTEXT * context)
+{
+  THREAD_ENTRY *thread_p = thread_get_thread_entry_info ();
+
+  {
+    std::unique_lock<std::mutex> ulock (context->mutex);
+    context->is_stopped = true;
+  }
+
+  while (!context->chunks.empty ())
+    {
+      (void) locator_upgrade_apply_chunk (thread_p, context, NULL, NULL, 0, NULL);
+    }
+
+  cubthread::get_manager ()->destroy_worker_pool (context->workpool);
+  delete context;
+}
+
+/*
+ * locator_upgrade_report_progress () - notify the progress of a domain upgrade in the error log
+ *
+ * return: void
+ *
+ *   thread_p(in): thread context
+ *   class_oid(in): class to upgrade
+ *   att_id(in): attribute id within class to update
+ *   n_upgraded(in): number of upgraded instances
+ *   n_objects(in): estimated number of instances of the class
+ *   start_time(in): start of the upgrade
+ *   last_report_time(in/out): time of the last notification
+ *   is_final(in): true when the upgrade is finished; it is notified only if progress was notified before
+ */
+static void
+locator_upgrade_report_progress (THREAD_ENTRY * thread_p, OID * class_oid, int att_id, INT64 n_upgraded,
+				 INT64 n_objects, time_t start_time, time_t * last_report_time, bool is_final)
+{
+  time_t now = time (NULL);
+  char *class_name = NULL;
+
+  if (is_final ? *last_report_time == start_time : now - *last_report_time < LOCATOR_UPGRADE_PROGRESS_INTERVAL)
+    {
+      return;
+    }
+  *last_report_time = now;
+
+  if (heap_get_class_name (thread_p, class_oid, &class_name) != NO_ERROR)
+    {
+      er_clear ();
+    }
+
+  /* the notification is only logged; it is not returned to the client */
+  er_stack_push ();
+  er_set (ER_NOTIFICATION_SEVERITY, ARG_FILE_LINE, ER_LC_UPGRADE_DOMAIN_PROGRESS, 5, att_id,
+	  class_name != NULL ? class_name : "", (long long) n_upgraded, (long long) MAX (n_upgraded, n_objects),
+	  (int) (now - start_time));
+  er_stack_pop ();
+
+  if (class_name != NULL)
+    {
+      free_and_init (class_name);
+    }
+}
+
 /*
  * xlocator_upgrade_instances_domain () - scans all instances of a class and
  *		performs an in-place domain upgrade of the specified attribute
@@ -12141,6 +12593,10 @@ xlocator_upgrade_instances_domain (THREAD_ENTRY * thread_p, OID * class_oid, int
   int tran_index;
   LOG_TDES *tdes = LOG_FIND_CURRENT_TDES (thread_p);
   MVCCID threshold_mvccid;
+  LOCATOR_UPGRADE_CONTEXT *upgrade_context = NULL;
+  int has_index;
+  INT64 n_upgraded = 0;
+  time_t start_time, last_report_time;
 
   HFID_SET_NULL (&hfid);
   OID_SET_NULL (&last_oid);
@@ -12186,6 +12642,16 @@ xlocator_upgrade_instances_domain (THREAD_ENTRY * thread_p, OID * class_oid, int
     }
   attrinfo_inited = true;
 
+  /* the new records are built by workers when there are enough of them; the updates are always done here */
+  upgrade_context = locator_upgrade_start_workers (thread_p, class_oid, att_id, &attr_info);
+  has_index = LC_FLAG_HAS_INDEX;
+  if (heap_attrinfo_check_unique_index (thread_p, &attr_info, &att_id, 1))
+    {
+      has_index |= LC_FLAG_HAS_UNIQUE_INDEX;
+    }
+
+  start_time = last_report_time = time (NULL);
+
   while (nobjects != nfetched)
     {
       int nfailed_instances = 0;
@@ -12211,6 +12677,29 @@ xlocator_upgrade_instances_domain (THREAD_ENTRY * thread_p, OID * class_oid, int
 	  er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, error, 1, "Fetch area should not be NULL.");
 	  goto error_exit;
 	}
+
+      if (upgrade_context != NULL)
+	{
+	  locator_upgrade_queue_area (upgrade_context, fetch_area, &last_oid);
+	  fetch_area = NULL;
+
+	  /* keep the workers busy while the oldest chunks are applied */
+	  while ((int) upgrade_context->chunks.size () > upgrade_context->max_queued_chunks
+		 || (nobjects == nfetched && !upgrade_context->chunks.empty ()))
+	    {
+	      error = locator_upgrade_apply_chunk (thread_p, upgrade_context, &hfid, &upd_scancache, has_index,
+						   &n_upgraded);
+	      if (error != NO_ERROR)
+		{
+		  goto error_exit;
+		}
+	    }
+
+	  locator_upgrade_report_progress (thread_p, class_oid, att_id, n_upgraded, nobjects, start_time,
+					   &last_report_time, false);
+	  continue;
+	}
+
       mobjs = LC_MANYOBJS_PTR_IN_COPYAREA (fetch_area);
       obj = LC_START_ONEOBJ_PTR_IN_COPYAREA (mobjs);
 
@@ -12245,16 +12734,27 @@ xlocator_upgrade_instances_domain (THREAD_ENTRY * thread_p, OID * class_oid, int
 
 	  COPY_OID (&last_oid, &obj->oid);
 	  obj = LC_NEXT_ONEOBJ_PTR_IN_COPYAREA (obj);
+	  n_upgraded++;
 	}
       if (fetch_area)
 	{
 	  locator_free_copy_area (fetch_area);
 	  fetch_area = NULL;
 	}
+
+      locator_upgrade_report_progress (thread_p, class_oid, att_id, n_upgraded, nobjects, start_time,
+				       &last_report_time, false);
     }
 
+  locator_upgrade_report_progress (thread_p, class_oid, att_id, n_upgraded, nobjects, start_time, &last_report_time,
+				   true);
+
 error_exit:
 
+  if (upgrade_context != NULL)
+    {
+      locator_upgrade_stop_workers (upgrade_context);
+    }
   if (fetch_area)
     {
       locator_free_copy_area (fetch_area);
@@ -12921,6 +13421,161 @@ xlocator_redistribute_partition_data (THREAD_ENTRY * thread_p, OID * class_oid,
   return redistribute_partition_data (thread_p, class_oid, no_oids, oid_list);
 }
 
+/*
+ * xlocator_move_partition_rows () - move the rows of a partitioned class to the partitions they belong to
+ *
+ * return : error code
+ *
+ * thread_p (in)      :
+ * class_oid (in)     : partitioned class OID
+ *
+ * Note: This is used when the partitioning of a class changes (e.g. ALTER ... PARTITION BY or ADD PARTITION on a
+ *	 hash partitioned class) and replaces an UPDATE of the partitioning key with itself. The heap of the
+ *	 partitioned class and the heaps of all its partitions are scanned, each row is routed with the pruning
+ *	 context of the class and only the rows that belong to another partition are moved there. Rows that stay in
+ *	 place are neither rewritten nor reindexed.
+ *	 Proper lock (SCH_M_LOCK) on the partitioned class is assumed, so the rows are not locked.
+ */
+int
+xlocator_move_partition_rows (THREAD_ENTRY * thread_p, OID * class_oid)
+{
+  int error = NO_ERROR;
+  int i;
+  PRUNING_CONTEXT pcontext;
+  HEAP_SCANCACHE scan_cache, del_scan_cache;
+  bool is_pcontext_inited = false;
+  bool is_scancache_started = false;
+  bool is_del_scancache_started = false;
+  MVCC_SNAPSHOT *mvcc_snapshot;
+  RECDES recdes = RECDES_INITIALIZER;
+  SCAN_CODE scan;
+  OID part_oid, inst_oid, moved_oid, target_oid, superclass_oid;
+  HFID part_hfid, target_hfid;
+  int force_count = 0;
+
+  mvcc_snapshot = logtb_get_mvcc_snapshot (thread_p);
+  if (mvcc_snapshot == NULL)
+    {
+      ASSERT_ERROR_AND_SET (error);
+      return error;
+    }
+
+  (void) partition_init_pruning_context (&pcontext);
+  error = partition_load_pruning_context (thread_p, class_oid, DB_PARTITIONED_CLASS, &pcontext);
+  if (error != NO_ERROR)
+    {
+      goto exit;
+    }
+  is_pcontext_inited = true;
+
+  if (pcontext.partitions == NULL)
+    {
+      /* not a partitioned class */
+      error = ER_INVALID_PARTITION_REQUEST;
+      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, error, 0);
+      goto exit;
+    }
+
+  /* the partitioned class holds the rows when it has just been partitioned; partitions[0] describes it */
+  for (i = 0; i < pcontext.count; i++)
+    {
+      if (i == 0)
+	{
+	  COPY_OID (&part_oid, class_oid);
+	  error = heap_get_class_info (thread_p, class_oid, &part_hfid, NULL, NULL);
+	  if (error != NO_ERROR)
+	    {
+	      goto exit;
+	    }
+	}
+      else
+	{
+	  COPY_OID (&part_oid, &pcontext.partitions[i].class_oid);
+	  HFID_COPY (&part_hfid, &pcontext.partitions[i].class_hfid);
+	}
+
+      if (HFID_IS_NULL (&part_hfid))
+	{
+	  continue;
+	}
+
+      error = heap_scancache_start (thread_p, &scan_cache, &part_hfid, &part_oid, false, false, mvcc_snapshot);
+      if (error != NO_ERROR)
+	{
+	  goto exit;
+	}
+      is_scancache_started = true;
+
+      error = heap_scancache_start_modify (thread_p, &del_scan_cache, &part_hfid, &part_oid, SINGLE_ROW_UPDATE, NULL);
+      if (error != NO_ERROR)
+	{
+	  goto exit;
+	}
+      is_del_scancache_started = true;
+
+      OID_SET_NULL (&inst_oid);
+      while ((scan = heap_next (thread_p, &part_hfid, &part_oid, &inst_oid, &recdes, &scan_cache, COPY)) == S_SUCCESS)
+	{
+	  error =
+	    partition_prune_update (thread_p, &part_oid, &recdes, &pcontext, DB_PARTITIONED_CLASS, &target_oid,
+				    &target_hfid, &superclass_oid);
+	  if (error != NO_ERROR)
+	    {
+	      goto exit;
+	    }
+
+	  if (OID_EQ (&target_oid, &part_oid))
+	    {
+	      /* the row is already where it belongs */
+	      continue;
+	    }
+
+	  /* No supplemental log for the move is appended due to DDL statement */
+	  thread_p->no_supplemental_log = true;
+
+	  /* the scan continues from inst_oid; moved_oid gets the new location of the row */
+	  COPY_OID (&moved_oid, &inst_oid);
+	  error =
+	    locator_move_record (thread_p, &part_hfid, &part_oid, &moved_oid, &target_oid, &target_hfid, &recdes,
+				 &del_scan_cache, SINGLE_ROW_UPDATE, LC_FLAG_HAS_INDEX, &force_count, &pcontext, NULL,
+				 false);
+
+	  thread_p->no_supplemental_log = false;
+
+	  if (error != NO_ERROR)
+	    {
+	      goto exit;
+	    }
+	}
+      if (scan == S_ERROR)
+	{
+	  ASSERT_ERROR_AND_SET (error);
+	  goto exit;
+	}
+
+      heap_scancache_end_modify (thread_p, &del_scan_cache);
+      is_del_scancache_started = false;
+      (void) heap_scancache_end (thread_p, &scan_cache);
+      is_scancache_started = false;
+    }
+
+exit:
+  if (is_del_scancache_started)
+    {
+      heap_scancache_end_modify (thread_p, &del_scan_cache);
+    }
+  if (is_scancache_started)
+    {
+      (void) heap_scancache_end (thread_p, &scan_cache);
+    }
+  if (is_pcontext_inited)
+    {
+      partition_clear_pruning_context (&pcontext);
+    }
+
+  return error;
+}
+
 /*
  * locator_lock_and_get_object_internal () - Internal function: aquire lock and return object
  *
@@ -246,6 +246,13 @@ struct lk_lockinfo
 };
 
 
+/* wait edges kept per transaction for the wait probe; a waiter blocked by more transactions is left to the
+ * periodic deadlock detection */
+#define LK_MAX_WAIT_EDGES 8
+/* bounds of the wait probe run when a transaction blocks */
+#define LK_WAIT_PROBE_MAX_DEPTH 16
+#define LK_WAIT_PROBE_MAX_VISITS 256
+
 /* TWFG (transaction wait-for graph) entry and edge */
 typedef struct lk_WFG_node LK_WFG_NODE;
 struct lk_WFG_node
@@ -258,6 +265,9 @@ struct lk_WFG_node
   int tran_edge_seq_num;
   bool checked_by_deadlock_detector;
   bool DL_victim;
+  /* transactions this one is waiting for, recorded when it blocks. read without latches by the wait probe */
+  volatile int num_wait_edges;
+  int wait_edges[LK_MAX_WAIT_EDGES];
 };
 
 typedef struct lk_WFG_edge LK_WFG_EDGE;
@@ -320,6 +330,7 @@ struct lk_tran_lock
   LK_ENTRY *root_class_hold;	/* root class lock hold */
   LK_ENTRY *lk_entry_pool;	/* local pool of lock entries which can be used with no synchronization. */
   int lk_entry_pool_count;	/* Current count of lock entries in local pool. */
+  LK_ENTRY *volatile granted_handoff;	/* entries granted by other threads, not yet in the hold lists */
   int inst_hold_count;		/* # of entries in inst_hold_list */
   int class_hold_count;		/* # of entries in class_hold_list */
 
@@ -336,8 +347,9 @@ struct lk_tran_lock
   /* locking on manual duration */
   bool is_instant_duration;
 };
-/* Max size of transaction local pool of lock entries. */
-#define LOCK_TRAN_LOCAL_POOL_MAX_SIZE 10
+/* Number of lock entries preallocated in the transaction local pool. The pool keeps up to
+ * PRM_ID_LK_TRAN_ENTRY_POOL_SIZE entries freed by the transaction. */
+#define LOCK_TRAN_LOCAL_POOL_INIT_SIZE 10
 
 /*
  * Lock Manager Global Data Structure
@@ -374,6 +386,7 @@ struct lk_global_data
   bool verbose_mode;
   // *INDENT-OFF*
   std::atomic_int deadlock_and_timeout_detector;
+  std::atomic_bool deadlock_detection_requested;	/* a wait probe found a cycle */
   // *INDENT-ON*
 #if defined(LK_DUMP)
   bool dump_level;
@@ -396,6 +409,7 @@ struct lk_global_data
     , no_victim_case_count (0)
     , verbose_mode (false)
     , deadlock_and_timeout_detector { 0 }
+    , deadlock_detection_requested { false }
 #if defined(LK_DUMP)
     , dump_level (0)
 #endif
@@ -487,6 +501,8 @@ static int lock_initialize_deadlock_detection (void);
 static int lock_remove_resource (THREAD_ENTRY * thread_p, LK_RES * res_ptr);
 static void lock_finalize_tran_lock_table (void);
 static void lock_insert_into_tran_hold_list (LK_ENTRY * entry_ptr, int owner_tran_index);
+static void lock_handoff_granted_entry (LK_ENTRY * entry_ptr, int owner_tran_index);
+static void lock_collect_granted_entries (int tran_index);
 static int lock_delete_from_tran_hold_list (LK_ENTRY * entry_ptr, int owner_tran_index);
 static void lock_insert_into_tran_non2pl_list (LK_ENTRY * non2pl, int owner_tran_index);
 static int lock_delete_from_tran_non2pl_list (LK_ENTRY * non2pl, int owner_tran_index);
@@ -494,6 +510,10 @@ static LK_ENTRY *lock_find_tran_hold_entry (THREAD_ENTRY * thread_p, int tran_in
 static bool lock_force_timeout_expired_wait_transactions (void *thrd_entry);
 static bool lock_is_local_deadlock_detection_interval_up (void);
 static void lock_detect_local_deadlock (THREAD_ENTRY * thread_p);
+#if defined(SERVER_MODE)
+static void lock_record_wait_edges (LK_RES * res_ptr, LK_ENTRY * entry_ptr);
+static bool lock_probe_wait_cycle (int tran_index);
+#endif /* SERVER_MODE */
 static bool lock_is_class_lock_escalated (LOCK class_lock, LOCK lock_escalation);
 static LK_ENTRY *lock_add_non2pl_lock (THREAD_ENTRY * thread_p, LK_RES * res_ptr, int tran_index, LOCK lock);
 static void lock_position_holder_entry (LK_RES * res_ptr, LK_ENTRY * entry_ptr);
@@ -1074,7 +1094,7 @@ lock_initialize_tran_lock_table (void)
       pthread_mutex_init (&tran_lock->hold_mutex, NULL);
       pthread_mutex_init (&tran_lock->non2pl_mutex, NULL);
 
-      for (j = 0; j < LOCK_TRAN_LOCAL_POOL_MAX_SIZE; j++)
+      for (j = 0; j < LOCK_TRAN_LOCAL_POOL_INIT_SIZE; j++)
 	{
 	  entry = (LK_ENTRY *) malloc (sizeof (LK_ENTRY));
 	  if (entry == NULL)
@@ -1087,7 +1107,7 @@ lock_initialize_tran_lock_table (void)
 	  entry->next = tran_lock->lk_entry_pool;
 	  tran_lock->lk_entry_pool = entry;
 	}
-      tran_lock->lk_entry_pool_count = LOCK_TRAN_LOCAL_POOL_MAX_SIZE;
+      tran_lock->lk_entry_pool_count = LOCK_TRAN_LOCAL_POOL_INIT_SIZE;
     }
 
   return NO_ERROR;
@@ -1180,6 +1200,7 @@ lock_initialize_deadlock_detection (void)
       lk_Gl.TWFG_node[i].DL_victim = false;
       lk_Gl.TWFG_node[i].checked_by_deadlock_detector = false;
       lk_Gl.TWFG_node[i].thrd_wait_stime = 0;
+      lk_Gl.TWFG_node[i].num_wait_edges = 0;
     }
 
   /* initialize other related fields */
@@ -1339,6 +1360,70 @@ lock_insert_into_tran_hold_list (LK_ENTRY * entry_ptr, int owner_tran_index)
 }
 #endif /* SERVER_MODE */
 
+#if defined(SERVER_MODE)
+/*
+ * lock_handoff_granted_entry - Hand a lock granted to a waiting transaction over to its owner
+ *
+ * return: nothing
+ *
+ *   entry_ptr(in): granted lock entry of a suspended waiter
+ *   owner_tran_index(in): transaction index of the waiter
+ *
+ * Note: the granter does not take the hold list mutex of the waiter. The entry is pushed on a lock-free list
+ *     and the waiter links it into its hold lists when it resumes (see lock_collect_granted_entries). The
+ *     caller holds the thread entry mutex of the waiter, so the entry is published before the waiter wakes.
+ */
+static void
+lock_handoff_granted_entry (LK_ENTRY * entry_ptr, int owner_tran_index)
+{
+  LK_TRAN_LOCK *tran_lock;
+  LK_ENTRY *head;
+
+  if (owner_tran_index != entry_ptr->tran_index)
+    {
+      assert (owner_tran_index == entry_ptr->tran_index);
+      return;
+    }
+
+  tran_lock = &lk_Gl.tran_lock_table[entry_ptr->tran_index];
+  do
+    {
+      head = tran_lock->granted_handoff;
+      entry_ptr->tran_next = head;
+    }
+  while (!ATOMIC_CAS_ADDR (&tran_lock->granted_handoff, head, entry_ptr));
+}
+#endif /* SERVER_MODE */
+
+#if defined(SERVER_MODE)
+/*
+ * lock_collect_granted_entries - Move the entries handed over by granters into the transaction hold lists
+ *
+ * return: nothing
+ *
+ *   tran_index(in): transaction index
+ */
+static void
+lock_collect_granted_entries (int tran_index)
+{
+  LK_TRAN_LOCK *tran_lock = &lk_Gl.tran_lock_table[tran_index];
+  LK_ENTRY *entry_ptr, *next;
+
+  if (tran_lock->granted_handoff == NULL)
+    {
+      return;
+    }
+
+  for (entry_ptr = ATOMIC_TAS_ADDR (&tran_lock->granted_handoff, (LK_ENTRY *) NULL); entry_ptr != NULL;
+       entry_ptr = next)
+    {
+      next = entry_ptr->tran_next;
+      entry_ptr->tran_next = NULL;
+      lock_insert_into_tran_hold_list (entry_ptr, tran_index);
+    }
+}
+#endif /* SERVER_MODE */
+
 #if defined(SERVER_MODE)
 /*
  * lock_delete_from_tran_hold_list - Delted the given lock entry
@@ -2133,6 +2218,131 @@ lock_set_error_for_aborted (LK_ENTRY * entry_ptr)
 }
 #endif /* SERVER_MODE */
 
+#if defined(SERVER_MODE)
+/*
+ * lock_record_wait_edges - Record the transactions a blocked lock request waits for
+ *
+ * return: nothing
+ *
+ *   res_ptr(in): lock resource (its mutex is held by the caller)
+ *   entry_ptr(in): blocked lock entry, either an upgrading holder or a waiter
+ *
+ * Note: the edges are the ones lock_detect_local_deadlock would add for entry_ptr. Only the first
+ *       LK_MAX_WAIT_EDGES are kept; the periodic detection still sees the complete graph.
+ */
+static void
+lock_record_wait_edges (LK_RES * res_ptr, LK_ENTRY * entry_ptr)
+{
+  LK_WFG_NODE *node = &lk_Gl.TWFG_node[entry_ptr->tran_index];
+  LK_ENTRY *i;
+  LOCK blocked_mode = entry_ptr->blocked_mode;
+  bool is_before_entry = true;
+  int num_edges = 0;
+
+  node->num_wait_edges = 0;
+
+  for (i = res_ptr->holder; i != NULL && num_edges < LK_MAX_WAIT_EDGES; i = i->next)
+    {
+      if (i == entry_ptr)
+	{
+	  is_before_entry = false;
+	  continue;
+	}
+      if (i->tran_index == entry_ptr->tran_index)
+	{
+	  continue;
+	}
+
+      /* blocked holders positioned ahead of an upgrader are served first */
+      if (lock_Comp[blocked_mode][i->granted_mode] == LOCK_COMPAT_NO
+	  || (is_before_entry && lock_Comp[blocked_mode][i->blocked_mode] == LOCK_COMPAT_NO))
+	{
+	  node->wait_edges[num_edges++] = i->tran_index;
+	}
+    }
+
+  if (is_before_entry)
+    {
+      /* entry_ptr is in the waiter list and also waits for the incompatible waiters ahead of it */
+      for (i = res_ptr->waiter; i != NULL && i != entry_ptr && num_edges < LK_MAX_WAIT_EDGES; i = i->next)
+	{
+	  if (i->tran_index != entry_ptr->tran_index && lock_Comp[blocked_mode][i->blocked_mode] == LOCK_COMPAT_NO)
+	    {
+	      node->wait_edges[num_edges++] = i->tran_index;
+	    }
+	}
+    }
+
+  /* publish the edges after they are written */
+  ATOMIC_STORE (&node->num_wait_edges, num_edges);
+}
+
+/*
+ * lock_probe_wait_cycle - Look for a wait cycle through a transaction that is about to block
+ *
+ * return: true if a cycle leading back to tran_index was found
+ *
+ *   tran_index(in): blocked transaction
+ *
+ * Note: this is a bounded depth-first search over the edges recorded by lock_record_wait_edges. The edges of
+ *       other transactions are read without latches, so the result is only a hint used to run the deadlock
+ *       detection right away; the detection itself verifies the cycle and picks the victim.
+ */
+static bool
+lock_probe_wait_cycle (int tran_index)
+{
+  int path_tran[LK_WAIT_PROBE_MAX_DEPTH];
+  int path_edge[LK_WAIT_PROBE_MAX_DEPTH];
+  int depth, visits = 0;
+  int curr, next, num_edges, k;
+
+  path_tran[0] = tran_index;
+  path_edge[0] = 0;
+  depth = 1;
+
+  while (depth > 0)
+    {
+      curr = path_tran[depth - 1];
+      num_edges = MIN (lk_Gl.TWFG_node[curr].num_wait_edges, LK_MAX_WAIT_EDGES);
+      if (path_edge[depth - 1] >= num_edges)
+	{
+	  depth--;
+	  continue;
+	}
+
+      next = lk_Gl.TWFG_node[curr].wait_edges[path_edge[depth - 1]++];
+      if (next == tran_index)
+	{
+	  return true;
+	}
+      if (++visits > LK_WAIT_PROBE_MAX_VISITS)
+	{
+	  return false;
+	}
+      if (next < 0 || next >= lk_Gl.num_trans || depth >= LK_WAIT_PROBE_MAX_DEPTH)
+	{
+	  continue;
+	}
+
+      /* do not walk around a cycle that does not include tran_index */
+      for (k = 1; k < depth && path_tran[k] != next; k++)
+	{
+	  ;
+	}
+      if (k < depth)
+	{
+	  continue;
+	}
+
+      path_tran[depth] = next;
+      path_edge[depth] = 0;
+      depth++;
+    }
+
+  return false;
+}
+#endif /* SERVER_MODE */
+
 #if defined(SERVER_MODE)
 /*
  * lock_suspend - Suspend current thread (transaction)
@@ -2194,12 +2404,27 @@ lock_suspend (THREAD_ENTRY * thread_p, LK_ENTRY * entry_ptr, int wait_msecs)
 
   lock_event_set_tran_wait_entry (entry_ptr->tran_index, entry_ptr);
 
+  /* the waiter is registered, so the detector counts it when it runs for this request */
+  if (lock_probe_wait_cycle (entry_ptr->tran_index))
+    {
+      /* do not let the cycle wait for the next detection interval */
+      lk_Gl.deadlock_detection_requested = true;
+      if (lock_Deadlock_detect_daemon != NULL)
+	{
+	  lock_Deadlock_detect_daemon->wakeup ();
+	}
+    }
+
   /* suspend the worker thread (transaction) */
   thread_suspend_wakeup_and_unlock_entry (entry_ptr->thrd_entry, THREAD_LOCK_SUSPENDED);
 
   lk_Gl.deadlock_and_timeout_detector--;
   lk_Gl.TWFG_node[entry_ptr->tran_index].thrd_wait_stime = 0;
 
+  /* move the entry into the hold lists if a granter handed it over */
+  lock_collect_granted_entries (entry_ptr->tran_index);
+  lk_Gl.TWFG_node[entry_ptr->tran_index].num_wait_edges = 0;
+
   if (tdes)
     {
       tdes->waiting_for_res = NULL;
@@ -2683,7 +2908,7 @@ lock_grant_blocked_waiter (THREAD_ENTRY * thread_p, LK_RES * res_ptr)
 
 	  /* insert the lock entry into transaction hold list. */
 	  owner_tran_index = LOG_FIND_THREAD_TRAN_INDEX (waiter->thrd_entry);
-	  lock_insert_into_tran_hold_list (waiter, owner_tran_index);
+	  lock_handoff_granted_entry (waiter, owner_tran_index);
 
 	  /* reflect the granted lock in the non2pl list */
 	  lock_update_non2pl_list (thread_p, res_ptr, waiter->tran_index, waiter->granted_mode);
@@ -2835,7 +3060,7 @@ lock_grant_blocked_waiter_partial (THREAD_ENTRY * thread_p, LK_RES * res_ptr, LK
 
 	  /* insert into transaction lock hold list */
 	  owner_tran_index = LOG_FIND_THREAD_TRAN_INDEX (check->thrd_entry);
-	  lock_insert_into_tran_hold_list (check, owner_tran_index);
+	  lock_handoff_granted_entry (check, owner_tran_index);
 
 	  /* reflect the granted lock in the non2pl list */
 	  lock_update_non2pl_list (thread_p, res_ptr, check->tran_index, check->granted_mode);
@@ -3841,11 +4066,17 @@ blocked:
   LK_MSG_LOCK_WAITFOR (entry_ptr);
 #endif /* LK_TRACE_OBJECT */
 
+  if (is_res_mutex_locked)
+    {
+      lock_record_wait_edges (res_ptr, entry_ptr);
+    }
+
   thread_lock_entry (entry_ptr->thrd_entry);
   if (is_res_mutex_locked)
     {
       pthread_mutex_unlock (&res_ptr->res_mutex);
     }
+
   ret_val = lock_suspend (thread_p, entry_ptr, wait_msecs);
 
   if (perfmon_is_perf_tracking_and_active (PERFMON_ACTIVATION_FLAG_LOCK_OBJECT))
@@ -5786,6 +6017,15 @@ deadlock_detect_task_execute (cubthread::entry & thread_ref)
   size_t lock_wait_count = 0;
   thread_get_manager ()->map_entries (lock_check_timeout_expired_and_count_suspended_mapfunc, lock_wait_count);
 
+  if (lock_wait_count >= 2 && lk_Gl.deadlock_detection_requested.exchange (false))
+    {
+      /* a blocked transaction found a wait cycle; the periodic run below remains the backstop for cycles the
+       * probe cannot see. a request seen with fewer waiters is kept for the next run. */
+      gettimeofday (&lk_Gl.last_deadlock_run, NULL);
+      lock_detect_local_deadlock (&thread_ref);
+      return;
+    }
+
   if (lock_is_local_deadlock_detection_interval_up () && lock_wait_count >= 2)
     {
       lock_detect_local_deadlock (&thread_ref);
@@ -9704,6 +9944,9 @@ lock_get_new_entry (int tran_index, LF_TRAN_ENTRY * tran_entry, LF_FREELIST * fr
  * lock_free_entry () - Free lock entry. Local pool has high priority if its
  *			maximum size is not reached. Otherwise, the entry
  *			is "retired" to shared list of free lock entries.
+ *			Keeping the entries of a transaction that releases
+ *			many locks at once lets its next statements lock
+ *			rows without going through the shared list.
  *
  * return	   : Error code.
  * tran_index (in) : Transaction index.
@@ -9716,10 +9959,10 @@ lock_free_entry (int tran_index, LF_TRAN_ENTRY * tran_entry, LF_FREELIST * freel
 {
   LK_TRAN_LOCK *tran_lock = &lk_Gl.tran_lock_table[tran_index];
 
-  assert (tran_lock->lk_entry_pool_count >= 0 && tran_lock->lk_entry_pool_count <= LOCK_TRAN_LOCAL_POOL_MAX_SIZE);
+  assert (tran_lock->lk_entry_pool_count >= 0);
 
   /* "Free" entry to local pool or shared list. */
-  if (tran_lock->lk_entry_pool_count < LOCK_TRAN_LOCAL_POOL_MAX_SIZE)
+  if (tran_lock->lk_entry_pool_count < prm_get_integer_value (PRM_ID_LK_TRAN_ENTRY_POOL_SIZE))
     {
       lock_uninit_entry (lock_entry);
       lock_entry->next = tran_lock->lk_entry_pool;
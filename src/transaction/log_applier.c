@@ -211,6 +211,21 @@ struct la_repl_filter
   REPL_FILTER_TYPE type;
 };
 
+/*
+ * class information of the last applied row item. Row items of a bulk DML
+ * on the master come in long runs for the same class, so it is resolved
+ * only once per run instead of once per item.
+ */
+typedef struct la_class_cache LA_CLASS_CACHE;
+struct la_class_cache
+{
+  char class_name[DB_MAX_IDENTIFIER_LENGTH + 1];
+  MOP class_mop;
+  int pruning_type;
+  bool has_index;
+  bool is_prepared;		/* pruning_type and has_index are set */
+};
+
 typedef struct la_act_log LA_ACT_LOG;
 struct la_act_log
 {
@@ -338,6 +353,7 @@ struct la_info
   bool is_apply_info_updated;	/* whether catalog is partially updated or not */
 
   int num_unflushed;
+  LA_CLASS_CACHE class_cache;
 
   /* file lock */
   int log_path_lockf_vdes;
@@ -559,6 +575,8 @@ static float la_get_avg (int *array, int size);
 static void la_get_adaptive_time_commit_interval (int *time_commit_interval, int *delay_hist);
 
 static int la_flush_repl_items (bool immediate);
+static DB_OBJECT *la_find_class (const char *class_name);
+static void la_clear_class_cache (void);
 
 static bool la_need_filter_out (LA_ITEM * item);
 static int la_create_repl_filter (void);
@@ -4775,6 +4793,12 @@ la_flush_repl_items (bool immediate)
 
   string_buffer sb;
 
+  if (immediate == true)
+    {
+      /* statements (e.g. DDL) may change the classes */
+      la_clear_class_cache ();
+    }
+
   if (la_Info.num_unflushed == 0)
     {
       return NO_ERROR;
@@ -4888,6 +4912,48 @@ la_flush_repl_items (bool immediate)
   return error;
 }
 
+/*
+ * la_clear_class_cache () - forget the class of the last applied row item
+ *   return: none
+ */
+static void
+la_clear_class_cache (void)
+{
+  la_Info.class_cache.class_name[0] = '\0';
+  la_Info.class_cache.class_mop = NULL;
+  la_Info.class_cache.is_prepared = false;
+}
+
+/*
+ * la_find_class () - find the class object of a replication item
+ *   return: class object or NULL
+ *   class_name(in): class name of the item
+ *
+ * Note: consecutive items of the same class reuse the class of the previous
+ *       item.
+ */
+static DB_OBJECT *
+la_find_class (const char *class_name)
+{
+  DB_OBJECT *class_obj;
+
+  if (la_Info.class_cache.class_mop != NULL && strcmp (la_Info.class_cache.class_name, class_name) == 0)
+    {
+      return la_Info.class_cache.class_mop;
+    }
+
+  la_clear_class_cache ();
+
+  class_obj = db_find_class (class_name);
+  if (class_obj != NULL && strlen (class_name) <= DB_MAX_IDENTIFIER_LENGTH)
+    {
+      strcpy (la_Info.class_cache.class_name, class_name);
+      la_Info.class_cache.class_mop = class_obj;
+    }
+
+  return class_obj;
+}
+
 /*
  * la_repl_add_object : create a replication object and add it to link for bulk flushing
  *    return:
@@ -4909,25 +4975,39 @@ la_repl_add_object (MOP classop, LA_ITEM * item, RECDES * recdes)
 
   class_oid = ws_oid (classop);
 
-  error = au_fetch_class (classop, &class_, AU_FETCH_READ, AU_SELECT);
-  if (error != NO_ERROR)
+  if (la_Info.class_cache.is_prepared && la_Info.class_cache.class_mop == classop)
     {
-      return error;
+      pruning_type = la_Info.class_cache.pruning_type;
+      has_index = la_Info.class_cache.has_index;
     }
-
-  error = sm_flush_objects (classop);
-  if (error != NO_ERROR)
+  else
     {
-      return error;
-    }
+      error = au_fetch_class (classop, &class_, AU_FETCH_READ, AU_SELECT);
+      if (error != NO_ERROR)
+	{
+	  return error;
+	}
+
+      error = sm_flush_objects (classop);
+      if (error != NO_ERROR)
+	{
+	  return error;
+	}
 
-  if (item->item_type != RVREPL_DATA_DELETE)
-    {
       error = sm_partitioned_class_type (classop, &pruning_type, NULL, NULL);
       if (error != NO_ERROR)
 	{
 	  return error;
 	}
+
+      has_index = classobj_class_has_indexes (class_);
+
+      if (la_Info.class_cache.class_mop == classop)
+	{
+	  la_Info.class_cache.pruning_type = pruning_type;
+	  la_Info.class_cache.has_index = has_index;
+	  la_Info.class_cache.is_prepared = true;
+	}
     }
 
   switch (item->item_type)
@@ -4947,8 +5027,6 @@ la_repl_add_object (MOP classop, LA_ITEM * item, RECDES * recdes)
       assert (false);
     }
 
-  has_index = classobj_class_has_indexes (class_);
-
   error = ws_add_to_repl_obj_list (class_oid, item->packed_key_value, item->packed_key_value_length, recdes,
 				   operation, has_index);
   return error;
@@ -4978,7 +5056,7 @@ la_apply_delete_log (LA_ITEM * item)
     }
 
   /* find out class object by class name */
-  class_obj = db_find_class (item->class_name);
+  class_obj = la_find_class (item->class_name);
   if (class_obj == NULL)
     {
       assert (er_errid () != NO_ERROR);
@@ -5098,7 +5176,7 @@ la_apply_update_log (LA_ITEM * item)
       goto end;
     }
 
-  class_obj = db_find_class (item->class_name);
+  class_obj = la_find_class (item->class_name);
   if (class_obj == NULL)
     {
       assert (er_errid () != NO_ERROR);
@@ -5292,7 +5370,7 @@ la_apply_insert_log (LA_ITEM * item)
       return er_errid ();
     }
 
-  class_obj = db_find_class (item->class_name);
+  class_obj = la_find_class (item->class_name);
   if (class_obj == NULL)
     {
       assert (er_errid () != NO_ERROR);
@@ -7082,6 +7160,7 @@ la_shutdown (void)
     }
 
   la_Info.num_unflushed = 0;
+  la_clear_class_cache ();
 
   la_destroy_repl_filter ();
 
@@ -559,6 +559,7 @@ struct log_tdes
   /* Set to one when the current execution must be stopped somehow. We stop it by sending an error message during
    * fetching of a page. */
   tx_transient_class_registry m_modified_classes;	// list of classes made dirty
+  tx_transient_class_changes m_class_changes;	// rows changed in each class; see stats_publish_class_modifications
 
   int num_transient_classnames;	/* # of transient classnames by this transaction */
   int num_repl_records;		/* # of replication records */
@@ -68,6 +68,7 @@
 #include "log_volids.hpp"
 #include "log_writer.h"
 #include "partition_sr.h"
+#include "statistics_sr.h"
 #include "filter_pred_cache.h"
 #include "heap_file.h"
 #include "slotted_page.h"
@@ -1118,7 +1119,7 @@ log_initialize_internal (THREAD_ENTRY * thread_p, const char *db_fullname, const
   log_Gl.run_nxchkpt_atpageid = NULL_PAGEID;	/* Don't run the checkpoint */
   log_Gl.rcv_phase = LOG_RECOVERY_ANALYSIS_PHASE;
 
-  log_Gl.loghdr_pgptr = (LOG_PAGE *) malloc (LOG_PAGESIZE);
+  log_Gl.loghdr_pgptr = (LOG_PAGE *) fileio_alloc_aligned (LOG_PAGESIZE);
   if (log_Gl.loghdr_pgptr == NULL)
     {
       er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_OUT_OF_VIRTUAL_MEMORY, 1, (size_t) LOG_PAGESIZE);
@@ -5176,6 +5177,9 @@ log_commit_local (THREAD_ENTRY * thread_p, LOG_TDES * tdes, bool retain_lock, bo
 
       log_cleanup_modified_class_list (thread_p, tdes, NULL, true, false);
 
+      /* only committed changes count for the automatic update of statistics */
+      stats_publish_class_modifications (tdes);
+
       if (is_local_tran)
 	{
 	  LOG_LSA commit_lsa;
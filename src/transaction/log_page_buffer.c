@@ -580,7 +580,7 @@ logpb_initialize_pool (THREAD_ENTRY * thread_p)
     }
 
   size = ((size_t) log_Pb.num_buffers * (LOG_PAGESIZE));
-  log_Pb.pages_area = (LOG_PAGE *) malloc (size);
+  log_Pb.pages_area = (LOG_PAGE *) fileio_alloc_aligned (size);
   if (log_Pb.pages_area == NULL)
     {
       free_and_init (log_Pb.buffers);
@@ -597,7 +597,7 @@ logpb_initialize_pool (THREAD_ENTRY * thread_p)
     }
 
   size = LOG_PAGESIZE;
-  log_Pb.header_page = (LOG_PAGE *) malloc (size);
+  log_Pb.header_page = (LOG_PAGE *) fileio_alloc_aligned (size);
   if (log_Pb.header_page == NULL)
     {
       free_and_init (log_Pb.buffers);
@@ -1678,7 +1678,7 @@ logpb_flush_header (THREAD_ENTRY * thread_p)
 
       /* This is just a safe guard. log_initialize frees log_Gl.loghdr_pgptr when it fails. It can only happen when
        * deletedb or emergency utilities fail to initialize log. */
-      log_Gl.loghdr_pgptr = (LOG_PAGE *) malloc (LOG_PAGESIZE);
+      log_Gl.loghdr_pgptr = (LOG_PAGE *) fileio_alloc_aligned (LOG_PAGESIZE);
       if (log_Gl.loghdr_pgptr == NULL)
 	{
 	  er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_OUT_OF_VIRTUAL_MEMORY, 1, (size_t) LOG_PAGESIZE);
@@ -1521,6 +1521,7 @@ logtb_clear_tdes (THREAD_ENTRY * thread_p, LOG_TDES * tdes)
 #endif
     }
   tdes->m_modified_classes.clear ();
+  tdes->m_class_changes.clear ();
 
   for (i = 0; i < tdes->cur_repl_record; i++)
     {
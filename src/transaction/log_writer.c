@@ -131,6 +131,8 @@ LOGWR_GLOBAL logwr_Gl = {
   0,
   /* logpg_fill_size */
   0,
+  /* logpg_zip */
+  NULL,
   /* toflush */
   NULL,
   /* max_toflush */
@@ -471,6 +473,15 @@ logwr_initialize (const char *db_name, const char *log_path, int mode, LOG_PAGEI
 	}
     }
 
+  if (logwr_Gl.logpg_zip == NULL && prm_get_bool_value (PRM_ID_HA_COPY_LOG_COMPRESS))
+    {
+      logwr_Gl.logpg_zip = log_zip_alloc (logwr_Gl.logpg_area_size);
+      if (logwr_Gl.logpg_zip == NULL)
+	{
+	  return ER_OUT_OF_VIRTUAL_MEMORY;
+	}
+    }
+
   if (logwr_Gl.toflush == NULL)
     {
       int i;
@@ -593,6 +604,11 @@ logwr_finalize (void)
       logwr_Gl.logpg_fill_size = 0;
       logwr_Gl.loghdr_pgptr = NULL;
     }
+  if (logwr_Gl.logpg_zip != NULL)
+    {
+      log_zip_free (logwr_Gl.logpg_zip);
+      logwr_Gl.logpg_zip = NULL;
+    }
   if (logwr_Gl.toflush != NULL)
     {
       free_and_init (logwr_Gl.toflush);
@@ -627,6 +643,50 @@ logwr_finalize (void)
   logwr_Gl.reinit_copylog = false;
 }
 
+/*
+ * logwr_unzip_log_pages - decompress the received page area into logpg_area
+ *
+ * return: NO_ERROR or ER_IO_LZ4_DECOMPRESS_FAIL
+ *
+ *   zip_area(in): received compressed page area
+ *   zip_length(in): length of zip_area
+ *
+ * Note: The area is laid out as log_zip () produces it, i.e. the original
+ *       length followed by the LZ4 block.
+ */
+int
+logwr_unzip_log_pages (const char *zip_area, int zip_length)
+{
+  LOG_ZIP_SIZE_T unzip_length;
+  int length;
+
+  if (zip_length <= (int) sizeof (LOG_ZIP_SIZE_T))
+    {
+      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_IO_LZ4_DECOMPRESS_FAIL, 0);
+      return ER_IO_LZ4_DECOMPRESS_FAIL;
+    }
+
+  memcpy (&unzip_length, zip_area, sizeof (LOG_ZIP_SIZE_T));
+  if (unzip_length <= 0 || unzip_length > logwr_Gl.logpg_area_size)
+    {
+      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_IO_LZ4_DECOMPRESS_FAIL, 0);
+      return ER_IO_LZ4_DECOMPRESS_FAIL;
+    }
+
+  length =
+    LZ4_decompress_safe (zip_area + sizeof (LOG_ZIP_SIZE_T), logwr_Gl.logpg_area,
+			 zip_length - sizeof (LOG_ZIP_SIZE_T), logwr_Gl.logpg_area_size);
+  if (length != unzip_length)
+    {
+      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_IO_LZ4_DECOMPRESS_FAIL, 0);
+      return ER_IO_LZ4_DECOMPRESS_FAIL;
+    }
+
+  logwr_Gl.logpg_fill_size = length;
+
+  return NO_ERROR;
+}
+
 /*
  * logwr_set_hdr_and_flush_info -
  *
@@ -2586,6 +2646,8 @@ xlogwr_get_log_pages (THREAD_ENTRY * thread_p, LOG_PAGEID first_pageid, LOGWR_MO
   struct timespec to;
   LOGWR_INFO *writer_info = log_Gl.writer_info;
   bool copy_from_first_phy_page = false;
+  bool is_compressed;
+  LOG_ZIP *logpg_zip = NULL;
 
   logpg_used_size = 0;
   logpg_area = (char *) db_private_alloc (thread_p, (LOGWR_COPY_LOG_BUFFER_NPAGES * LOG_PAGESIZE));
@@ -2609,7 +2671,12 @@ xlogwr_get_log_pages (THREAD_ENTRY * thread_p, LOG_PAGEID first_pageid, LOGWR_MO
 	{
 	  copy_from_first_phy_page = false;
 	}
-      mode = (LOGWR_MODE) (mode & ~LOGWR_COPY_FROM_FIRST_PHY_PAGE_MASK);
+      if ((mode & LOGWR_COMPRESS_LOG_PAGES_MASK) && logpg_zip == NULL)
+	{
+	  logpg_zip = log_zip_alloc (LOGWR_COPY_LOG_BUFFER_NPAGES * LOG_PAGESIZE);
+	  /* if it fails, the pages are just sent uncompressed */
+	}
+      mode = (LOGWR_MODE) (mode & ~(LOGWR_COPY_FROM_FIRST_PHY_PAGE_MASK | LOGWR_COMPRESS_LOG_PAGES_MASK));
 
       /* In case that a non-ASYNC mode client internally uses ASYNC mode */
       orig_mode = MAX (mode, orig_mode);
@@ -2758,7 +2825,19 @@ xlogwr_get_log_pages (THREAD_ENTRY * thread_p, LOG_PAGEID first_pageid, LOGWR_MO
 	  need_cs_exit_after_send = false;
 	}
 
-      error_code = xlog_send_log_pages_to_client (thread_p, logpg_area, logpg_used_size, mode);
+      /* Send the compressed area only when the client asked for it and the pages actually shrink */
+      is_compressed = (logpg_zip != NULL && log_zip (logpg_zip, logpg_used_size, logpg_area));
+      if (is_compressed)
+	{
+	  logwr_er_log ("xlogwr_get_log_pages, compressed %d bytes to %d bytes\n", logpg_used_size,
+			logpg_zip->data_length);
+	  error_code =
+	    xlog_send_log_pages_to_client (thread_p, logpg_zip->log_data, logpg_zip->data_length, mode, true);
+	}
+      else
+	{
+	  error_code = xlog_send_log_pages_to_client (thread_p, logpg_area, logpg_used_size, mode, false);
+	}
       if (error_code != NO_ERROR)
 	{
 	  status = LOGWR_STATUS_ERROR;
@@ -2809,6 +2888,10 @@ xlogwr_get_log_pages (THREAD_ENTRY * thread_p, LOG_PAGEID first_pageid, LOGWR_MO
     }
 
   db_private_free_and_init (thread_p, logpg_area);
+  if (logpg_zip != NULL)
+    {
+      log_zip_free (logpg_zip);
+    }
 
   assert_release (false);
   return ER_FAILED;
@@ -2821,6 +2904,10 @@ error:
   logwr_write_end (thread_p, writer_info, entry, status);
 
   db_private_free_and_init (thread_p, logpg_area);
+  if (logpg_zip != NULL)
+    {
+      log_zip_free (logpg_zip);
+    }
 
   return error_code;
 }
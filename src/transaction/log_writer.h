@@ -28,6 +28,7 @@
 #include "client_credentials.hpp"
 #include "log_archives.hpp"
 #include "log_common_impl.h"
+#include "log_compress.h"
 #include "log_lsa.hpp"
 #include "tde.h"
 #include "storage_common.h"
@@ -53,6 +54,8 @@ enum logwr_mode
 };
 typedef enum logwr_mode LOGWR_MODE;
 #define LOGWR_COPY_FROM_FIRST_PHY_PAGE_MASK	(0x80000000)
+/* copylogdb asks the server to send the page area LZ4 compressed */
+#define LOGWR_COMPRESS_LOG_PAGES_MASK		(0x40000000)
 
 #if defined(CS_MODE)
 enum logwr_action
@@ -82,6 +85,9 @@ struct logwr_global
   int logpg_area_size;
   int logpg_fill_size;
 
+  /* receive buffer for the compressed page area */
+  LOG_ZIP *logpg_zip;
+
   LOG_PAGE **toflush;
   int max_toflush;
   int num_toflush;
@@ -124,6 +130,7 @@ extern LOGWR_GLOBAL logwr_Gl;
 extern void logwr_flush_header_page (void);
 extern int logwr_write_log_pages (void);
 extern int logwr_set_hdr_and_flush_info (void);
+extern int logwr_unzip_log_pages (const char *zip_area, int zip_length);
 #if !defined(WINDOWS)
 extern int logwr_copy_log_header_check (const char *db_name, bool verbose, LOG_LSA * master_eof_lsa);
 #endif /* !WINDOWS */
@@ -56,6 +56,9 @@
 #include "db.h"			/* for db_Connect_status */
 #include "porting.h"
 #include "network_interface_cl.h"
+#if defined (CS_MODE)
+#include "schema_shm_cache.h"
+#endif /* CS_MODE */
 
 #if defined(WINDOWS)
 #include "wintcp.h"
@@ -365,6 +368,11 @@ tran_commit (bool retain_lock)
       er_log_debug (ARG_FILE_LINE, "tran_commit: DB_CONNECTION_STATUS_RESET\n");
     }
 
+#if defined (CS_MODE)
+  /* the class records read by the transaction are committed now and can be shared */
+  schema_shm_cache_end_transaction (error_code == NO_ERROR);
+#endif /* CS_MODE */
+
   /* Increment snapshot version in work space */
   ws_increment_mvcc_snapshot_version ();
 
@@ -430,6 +438,9 @@ tran_abort (void)
   /* Remove any dirty objects and remove any hints */
   ws_abort_mops (false);
   ws_filter_dirty ();
+#if defined (CS_MODE)
+  schema_shm_cache_end_transaction (false);
+#endif /* CS_MODE */
 #endif /* SA_MODE */
 
   /* free the local list of savepoint names */
@@ -578,6 +589,9 @@ tran_abort_only_client (bool is_server_down)
   /* Remove any dirty objects and close all open query cursors */
   ws_abort_mops (true);
   ws_filter_dirty ();
+#if defined (CS_MODE)
+  schema_shm_cache_end_transaction (false);
+#endif /* CS_MODE */
   db_clear_client_query_result (false, true);
 
   tm_Tran_rep_read_lock = NULL_LOCK;
@@ -1235,6 +1249,11 @@ tran_internal_abort_upto_savepoint (const char *savepoint_name, SAVEPOINT_TYPE s
 #endif /* SA_MODE */
     }
 
+#if defined (CS_MODE)
+  /* records read since the savepoint may be rolled back; they are not shared */
+  schema_shm_cache_end_transaction (false);
+#endif /* CS_MODE */
+
   state = tran_server_partial_abort (savepoint_name, &savept_lsa);
   if (state != TRAN_UNACTIVE_ABORTED)
     {
@@ -140,6 +140,47 @@ tx_transient_class_registry::clear ()
   m_list.clear ();
 }
 
+//
+// Changed rows of classes
+//
+
+void
+tx_transient_class_changes::add (const OID &class_oid, INT64 n_changes)
+{
+  assert (!OID_ISNULL (&class_oid));
+
+  for (auto &it : m_changes)
+    {
+      if (OID_EQ (&it.first, &class_oid))
+	{
+	  it.second += n_changes;
+	  return;
+	}
+    }
+  m_changes.emplace_back (class_oid, n_changes);
+}
+
+bool
+tx_transient_class_changes::empty () const
+{
+  return m_changes.empty ();
+}
+
+void
+tx_transient_class_changes::map (const map_func_type &func) const
+{
+  for (const auto &it : m_changes)
+    {
+      func (it.first, it.second);
+    }
+}
+
+void
+tx_transient_class_changes::clear ()
+{
+  m_changes.clear ();
+}
+
 //
 // Lobs
 //
@@ -26,6 +26,8 @@
 
 #include <forward_list>
 #include <functional>
+#include <utility>
+#include <vector>
 
 // todo - namespace cubtx
 
@@ -80,6 +82,29 @@ class tx_transient_class_registry
     void clear ();
 };
 
+//
+// Changed rows of classes
+//
+
+class tx_transient_class_changes
+{
+  private:
+    using entry_type = std::pair<OID, INT64>;
+    std::vector<entry_type> m_changes;	// a transaction changes few classes, so they are searched in order
+
+  public:
+    using map_func_type = std::function<void (const OID &, INT64)>;
+
+    tx_transient_class_changes () = default;
+    ~tx_transient_class_changes () = default;
+
+    bool empty () const;
+    void map (const map_func_type &func) const;
+
+    void add (const OID &class_oid, INT64 n_changes);
+    void clear ();
+};
+
 //
 // Lobs
 //
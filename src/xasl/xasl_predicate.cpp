@@ -38,6 +38,12 @@ namespace cubxasl
       case T_PRED:
 	free_pred_not_null (pe.m_pred.lhs);
 	free_pred_not_null (pe.m_pred.rhs);
+	if (pe.m_pred.reorder != NULL)
+	  {
+	    free (pe.m_pred.reorder);
+	    pe.m_pred.reorder = NULL;
+	  }
+	pe.m_pred.n_evals = 0;
 	break;
 
       case T_EVAL_TERM:
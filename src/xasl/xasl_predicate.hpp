@@ -28,6 +28,7 @@
 
 // forward definitions
 class regu_variable_node;
+struct pred_reorder_info;
 
 typedef enum
 {
@@ -101,6 +102,8 @@ namespace cubxasl
     pred_expr *lhs;
     pred_expr *rhs;
     BOOL_OP bool_op;
+    mutable pred_reorder_info *reorder;	// run-time statistics of AND conjuncts, see eval_pred
+    mutable int n_evals;	// evaluations of the AND chain before its statistics are allocated
   };
 
   struct comp_eval_term
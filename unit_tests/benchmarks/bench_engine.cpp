@@ -0,0 +1,814 @@
+/*
+ * Copyright 2008 Search Solution Corporation
+ * Copyright 2016 CUBRID Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ */
+
+/*
+ * bench_engine.cpp - microbenchmarks of the storage, transaction and query engine components
+ *
+ *  The program is linked with the stand-alone library, so the engine functions are called directly in the same
+ *  process. Tables are created with SQL; their heap files and indexes are then used through the engine interfaces.
+ */
+
+#include "bench_engine.hpp"
+
+#include "btree.h"
+#include "dbi.h"
+#include "dbtype.h"
+#include "error_manager.h"
+#include "external_sort.h"
+#include "file_io.h"
+#include "heap_file.h"
+#include "log_impl.h"
+#include "log_manager.h"
+#include "object_primitive.h"
+#include "object_representation.h"
+#include "page_buffer.h"
+#include "recovery.h"
+#include "schema_manager.h"
+#include "thread_manager.hpp"
+#include "work_space.h"
+#include "xserver_interface.h"
+
+#include <algorithm>
+#include <cstring>
+
+namespace bench_engine
+{
+  /* table scanned by pgbuf, heap scan, point lookup and list file benchmarks */
+  static const char *SCAN_TABLE = "bench_scan";
+  static const char *SCAN_INDEX = "bench_scan_uk";
+  /* table that grows with heap inserts */
+  static const char *INSERT_TABLE = "bench_insert";
+  /* table whose index grows with b-tree inserts */
+  static const char *INDEX_TABLE = "bench_index";
+  static const char *INDEX_INDEX = "bench_index_ix";
+
+  static const int PAD_LENGTH = 100;
+  static const int LOG_RECORD_LENGTH = 64;
+
+  struct bench_table
+  {
+    OID class_oid;
+    HFID hfid;
+    BTID btid;
+  };
+
+  static int g_rows_count = 0;
+  static bench_table g_scan_table;
+  static bench_table g_insert_table;
+  static bench_table g_index_table;
+  static std::vector<VPID> g_scan_pages;	/* heap pages of the scanned table */
+  static std::vector<char> g_insert_record;	/* record inserted by heap insert benchmark */
+  static int g_next_index_key = 0;
+
+  /* simple generator, so runs are repeatable */
+  static unsigned int
+  next_random (unsigned int &seed)
+  {
+    seed = seed * 1103515245 + 12345;
+    return (seed >> 8);
+  }
+
+  static int
+  execute_sql (const char *sql)
+  {
+    DB_QUERY_RESULT *result = NULL;
+    DB_QUERY_ERROR query_error;
+    int error;
+
+    error = db_execute (sql, &result, &query_error);
+    if (result != NULL)
+      {
+	db_query_end (result);
+      }
+    return error < 0 ? error : NO_ERROR;
+  }
+
+  static int
+  insert_rows (const char *table_name, int first_id, int count)
+  {
+    char sql[256];
+    char pad[PAD_LENGTH + 1];
+    DB_SESSION *session;
+    DB_QUERY_RESULT *result;
+    DB_VALUE values[2];
+    int stmt_id;
+    int error = NO_ERROR;
+
+    snprintf (sql, sizeof (sql), "INSERT INTO %s (id, pad) VALUES (?, ?)", table_name);
+    memset (pad, 'x', PAD_LENGTH);
+    pad[PAD_LENGTH] = '\0';
+
+    session = db_open_buffer (sql);
+    if (session == NULL)
+      {
+	ASSERT_ERROR_AND_SET (error);
+	return error;
+      }
+    stmt_id = db_compile_statement (session);
+    if (stmt_id < 0)
+      {
+	db_close_session (session);
+	return stmt_id;
+      }
+
+    for (int i = 0; i < count && error == NO_ERROR; i++)
+      {
+	db_make_int (&values[0], first_id + i);
+	db_make_string (&values[1], pad);
+
+	error = db_push_values (session, 2, values);
+	if (error == NO_ERROR)
+	  {
+	    result = NULL;
+	    error = db_execute_statement (session, stmt_id, &result);
+	    if (result != NULL)
+	      {
+		db_query_end (result);
+	      }
+	    error = error < 0 ? error : NO_ERROR;
+	  }
+      }
+
+    db_close_session (session);
+    return error;
+  }
+
+  static int
+  find_table (const char *table_name, const char *index_name, bench_table &table)
+  {
+    DB_OBJECT *class_mop;
+    HFID *hfid;
+    SM_CLASS_CONSTRAINT *constraint;
+
+    class_mop = db_find_class (table_name);
+    if (class_mop == NULL)
+      {
+	return er_errid () != NO_ERROR ? er_errid () : ER_FAILED;
+      }
+
+    COPY_OID (&table.class_oid, ws_oid (class_mop));
+
+    hfid = sm_get_ch_heap (class_mop);
+    if (hfid == NULL || HFID_IS_NULL (hfid))
+      {
+	return er_errid () != NO_ERROR ? er_errid () : ER_FAILED;
+      }
+    HFID_COPY (&table.hfid, hfid);
+
+    BTID_SET_NULL (&table.btid);
+    if (index_name == NULL)
+      {
+	return NO_ERROR;
+      }
+
+    for (constraint = sm_class_constraints (class_mop); constraint != NULL; constraint = constraint->next)
+      {
+	if (constraint->name != NULL && strcmp (constraint->name, index_name) == 0)
+	  {
+	    BTID_COPY (&table.btid, &constraint->index_btid);
+	    return NO_ERROR;
+	  }
+      }
+
+    er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_SM_NO_INDEX, 1, index_name);
+    return ER_SM_NO_INDEX;
+  }
+
+  /* collect the heap pages of the scanned table and the record inserted by the heap insert benchmark */
+  static int
+  collect_heap_info (THREAD_ENTRY *thread_p)
+  {
+    HEAP_SCANCACHE scan_cache;
+    RECDES recdes = RECDES_INITIALIZER;
+    OID oid;
+    VPID vpid;
+    int error;
+
+    g_scan_pages.clear ();
+    error = heap_scancache_start (thread_p, &scan_cache, &g_scan_table.hfid, &g_scan_table.class_oid, true, false,
+				  logtb_get_mvcc_snapshot (thread_p));
+    if (error != NO_ERROR)
+      {
+	return error;
+      }
+    OID_SET_NULL (&oid);
+    while (heap_next (thread_p, &g_scan_table.hfid, &g_scan_table.class_oid, &oid, &recdes, &scan_cache, PEEK)
+	   == S_SUCCESS)
+      {
+	VPID_GET_FROM_OID (&vpid, &oid);
+	if (g_scan_pages.empty () || !VPID_EQ (&g_scan_pages.back (), &vpid))
+	  {
+	    g_scan_pages.push_back (vpid);
+	  }
+      }
+    heap_scancache_end (thread_p, &scan_cache);
+
+    error = heap_scancache_start (thread_p, &scan_cache, &g_insert_table.hfid, &g_insert_table.class_oid, true, false,
+				  logtb_get_mvcc_snapshot (thread_p));
+    if (error != NO_ERROR)
+      {
+	return error;
+      }
+    OID_SET_NULL (&oid);
+    if (heap_next (thread_p, &g_insert_table.hfid, &g_insert_table.class_oid, &oid, &recdes, &scan_cache, PEEK)
+	== S_SUCCESS)
+      {
+	g_insert_record.assign (recdes.data, recdes.data + recdes.length);
+      }
+    heap_scancache_end (thread_p, &scan_cache);
+
+    if (g_scan_pages.empty () || g_insert_record.empty ())
+      {
+	er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_GENERIC_ERROR, 0);
+	return ER_GENERIC_ERROR;
+      }
+    return NO_ERROR;
+  }
+
+  int
+  setup (int rows_count)
+  {
+    char sql[256];
+    int error;
+
+    g_rows_count = rows_count;
+    (void) teardown ();
+
+    snprintf (sql, sizeof (sql), "CREATE TABLE %s (id INT, pad VARCHAR(%d))", SCAN_TABLE, PAD_LENGTH);
+    error = execute_sql (sql);
+    if (error == NO_ERROR)
+      {
+	snprintf (sql, sizeof (sql), "CREATE TABLE %s (id INT, pad VARCHAR(%d))", INSERT_TABLE, PAD_LENGTH);
+	error = execute_sql (sql);
+      }
+    if (error == NO_ERROR)
+      {
+	snprintf (sql, sizeof (sql), "CREATE TABLE %s (id INT, pad VARCHAR(%d))", INDEX_TABLE, PAD_LENGTH);
+	error = execute_sql (sql);
+      }
+    if (error == NO_ERROR)
+      {
+	snprintf (sql, sizeof (sql), "CREATE INDEX %s ON %s (id)", INDEX_INDEX, INDEX_TABLE);
+	error = execute_sql (sql);
+      }
+    if (error == NO_ERROR)
+      {
+	error = insert_rows (SCAN_TABLE, 0, rows_count);
+      }
+    if (error == NO_ERROR)
+      {
+	error = insert_rows (INSERT_TABLE, 0, 1);
+      }
+    if (error == NO_ERROR)
+      {
+	/* loaded after the rows, so the index is built bottom-up like in a real database */
+	snprintf (sql, sizeof (sql), "CREATE UNIQUE INDEX %s ON %s (id)", SCAN_INDEX, SCAN_TABLE);
+	error = execute_sql (sql);
+      }
+    if (error == NO_ERROR)
+      {
+	error = db_commit_transaction ();
+      }
+    if (error == NO_ERROR)
+      {
+	error = find_table (SCAN_TABLE, SCAN_INDEX, g_scan_table);
+      }
+    if (error == NO_ERROR)
+      {
+	error = find_table (INSERT_TABLE, NULL, g_insert_table);
+      }
+    if (error == NO_ERROR)
+      {
+	error = find_table (INDEX_TABLE, INDEX_INDEX, g_index_table);
+      }
+    if (error == NO_ERROR)
+      {
+	error = collect_heap_info (thread_get_thread_entry_info ());
+      }
+
+    if (error != NO_ERROR)
+      {
+	(void) db_abort_transaction ();
+      }
+    return error;
+  }
+
+  int
+  teardown (void)
+  {
+    char sql[256];
+
+    snprintf (sql, sizeof (sql), "DROP TABLE IF EXISTS %s, %s, %s", SCAN_TABLE, INSERT_TABLE, INDEX_TABLE);
+    if (execute_sql (sql) != NO_ERROR)
+      {
+	(void) db_abort_transaction ();
+	return er_errid ();
+      }
+    return db_commit_transaction ();
+  }
+
+  /* fix and unfix a page that stays in the buffer */
+  static int
+  bench_pgbuf_fix_hit (cubbench::state &st)
+  {
+    THREAD_ENTRY *thread_p = thread_get_thread_entry_info ();
+    PAGE_PTR page;
+
+    for (std::uint64_t i = 0; i < st.iterations (); i++)
+      {
+	page = pgbuf_fix (thread_p, &g_scan_pages[0], OLD_PAGE, PGBUF_LATCH_READ, PGBUF_UNCONDITIONAL_LATCH);
+	if (page == NULL)
+	  {
+	    return er_errid ();
+	  }
+	pgbuf_unfix_and_init (thread_p, page);
+      }
+    return NO_ERROR;
+  }
+
+  /* fix pages that are not in the buffer; each page is invalidated after it is fixed. unless direct_io is set, the
+   * pages are usually read from the OS cache. */
+  static int
+  bench_pgbuf_fix_miss (cubbench::state &st)
+  {
+    THREAD_ENTRY *thread_p = thread_get_thread_entry_info ();
+    PAGE_PTR page;
+
+    for (std::uint64_t i = 0; i < st.iterations (); i++)
+      {
+	page = pgbuf_fix (thread_p, &g_scan_pages[i % g_scan_pages.size ()], OLD_PAGE, PGBUF_LATCH_WRITE,
+			  PGBUF_UNCONDITIONAL_LATCH);
+	if (page == NULL)
+	  {
+	    return er_errid ();
+	  }
+	if (pgbuf_invalidate (thread_p, page) != NO_ERROR)
+	  {
+	    return er_errid ();
+	  }
+      }
+    return NO_ERROR;
+  }
+
+  /* read pages of the scanned table straight from its volume into an I/O aligned buffer, bypassing the page buffer.
+   * with direct_io the latency is the device latency; otherwise the pages usually come from the OS cache. */
+  static int
+  bench_volume_page_read (cubbench::state &st)
+  {
+    THREAD_ENTRY *thread_p = thread_get_thread_entry_info ();
+    FILEIO_PAGE *io_page;
+    VPID *vpid;
+    int error = NO_ERROR;
+
+    st.pause_timing ();
+    io_page = (FILEIO_PAGE *) fileio_alloc_aligned (IO_PAGESIZE);
+    if (io_page == NULL)
+      {
+	er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_OUT_OF_VIRTUAL_MEMORY, 1, (size_t) IO_PAGESIZE);
+	return ER_OUT_OF_VIRTUAL_MEMORY;
+      }
+    st.resume_timing ();
+
+    for (std::uint64_t i = 0; i < st.iterations (); i++)
+      {
+	vpid = &g_scan_pages[i % g_scan_pages.size ()];
+	if (fileio_read (thread_p, fileio_get_volume_descriptor (vpid->volid), io_page, vpid->pageid,
+			 IO_PAGESIZE) == NULL)
+	  {
+	    ASSERT_ERROR_AND_SET (error);
+	    break;
+	  }
+      }
+
+    st.pause_timing ();
+    free (io_page);
+    return error;
+  }
+
+  /* write pages of the scanned table back to their volume from an I/O aligned buffer. each page is read first and
+   * written back unchanged, so the table is not modified. */
+  static int
+  bench_volume_page_write (cubbench::state &st)
+  {
+    THREAD_ENTRY *thread_p = thread_get_thread_entry_info ();
+    std::vector<FILEIO_PAGE *> io_pages;
+    FILEIO_PAGE *io_page;
+    VPID *vpid;
+    size_t pages_count;
+    int error = NO_ERROR;
+
+    st.pause_timing ();
+    /* flush the page buffer first, so that the images on disk are the latest ones */
+    error = pgbuf_flush_all (thread_p, NULL_VOLID);
+    pages_count = std::min (g_scan_pages.size (), (size_t) 64);
+    for (size_t i = 0; i < pages_count && error == NO_ERROR; i++)
+      {
+	vpid = &g_scan_pages[i];
+	io_page = (FILEIO_PAGE *) fileio_alloc_aligned (IO_PAGESIZE);
+	if (io_page == NULL)
+	  {
+	    er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_OUT_OF_VIRTUAL_MEMORY, 1, (size_t) IO_PAGESIZE);
+	    error = ER_OUT_OF_VIRTUAL_MEMORY;
+	    break;
+	  }
+	io_pages.push_back (io_page);
+	if (fileio_read (thread_p, fileio_get_volume_descriptor (vpid->volid), io_page, vpid->pageid,
+			 IO_PAGESIZE) == NULL)
+	  {
+	    ASSERT_ERROR_AND_SET (error);
+	  }
+      }
+    st.resume_timing ();
+
+    for (std::uint64_t i = 0; i < st.iterations () && error == NO_ERROR; i++)
+      {
+	vpid = &g_scan_pages[i % pages_count];
+	if (fileio_write (thread_p, fileio_get_volume_descriptor (vpid->volid), io_pages[i % pages_count],
+			  vpid->pageid, IO_PAGESIZE, FILEIO_WRITE_NO_COMPENSATE_WRITE) == NULL)
+	  {
+	    ASSERT_ERROR_AND_SET (error);
+	  }
+      }
+
+    st.pause_timing ();
+    for (FILEIO_PAGE *page : io_pages)
+      {
+	free (page);
+      }
+    return error;
+  }
+
+  /* insert copies of a record into a heap file */
+  static int
+  bench_heap_insert (cubbench::state &st)
+  {
+    THREAD_ENTRY *thread_p = thread_get_thread_entry_info ();
+    HEAP_SCANCACHE scan_cache;
+    HEAP_OPERATION_CONTEXT context;
+    RECDES recdes = RECDES_INITIALIZER;
+    int error;
+
+    st.pause_timing ();
+    error = heap_scancache_start_modify (thread_p, &scan_cache, &g_insert_table.hfid, &g_insert_table.class_oid,
+					 SINGLE_ROW_INSERT, NULL);
+    if (error != NO_ERROR)
+      {
+	return error;
+      }
+    st.resume_timing ();
+
+    for (std::uint64_t i = 0; i < st.iterations () && error == NO_ERROR; i++)
+      {
+	recdes.data = g_insert_record.data ();
+	recdes.length = recdes.area_size = (int) g_insert_record.size ();
+	recdes.type = REC_HOME;
+
+	heap_create_insert_context (&context, &g_insert_table.hfid, &g_insert_table.class_oid, &recdes, &scan_cache);
+	error = heap_insert_logical (thread_p, &context, NULL);
+      }
+
+    st.pause_timing ();
+    heap_scancache_end_modify (thread_p, &scan_cache);
+    if (error == NO_ERROR)
+      {
+	error = db_commit_transaction ();
+      }
+    return error;
+  }
+
+  /* scan all rows of a heap file; one iteration is a full scan */
+  static int
+  bench_heap_scan (cubbench::state &st)
+  {
+    THREAD_ENTRY *thread_p = thread_get_thread_entry_info ();
+    HEAP_SCANCACHE scan_cache;
+    RECDES recdes = RECDES_INITIALIZER;
+    OID oid;
+    SCAN_CODE scan_code;
+    std::uint64_t rows = 0;
+    int error;
+
+    for (std::uint64_t i = 0; i < st.iterations (); i++)
+      {
+	error = heap_scancache_start (thread_p, &scan_cache, &g_scan_table.hfid, &g_scan_table.class_oid, true, false,
+				      logtb_get_mvcc_snapshot (thread_p));
+	if (error != NO_ERROR)
+	  {
+	    return error;
+	  }
+
+	OID_SET_NULL (&oid);
+	while ((scan_code = heap_next (thread_p, &g_scan_table.hfid, &g_scan_table.class_oid, &oid, &recdes,
+				       &scan_cache, PEEK)) == S_SUCCESS)
+	  {
+	    rows++;
+	  }
+	heap_scancache_end (thread_p, &scan_cache);
+
+	if (scan_code == S_ERROR)
+	  {
+	    return er_errid ();
+	  }
+      }
+
+    st.set_items_processed (rows);
+    return NO_ERROR;
+  }
+
+  /* insert increasing keys into a non-unique index */
+  static int
+  bench_btree_insert (cubbench::state &st)
+  {
+    THREAD_ENTRY *thread_p = thread_get_thread_entry_info ();
+    DB_VALUE key;
+    OID oid;
+    int error = NO_ERROR;
+
+    for (std::uint64_t i = 0; i < st.iterations () && error == NO_ERROR; i++)
+      {
+	int key_value = g_next_index_key++;
+
+	/* objects do not need to exist; the index is only read by this benchmark */
+	oid.volid = g_index_table.hfid.vfid.volid;
+	oid.pageid = key_value / 64 + 1;
+	oid.slotid = key_value % 64 + 1;
+	db_make_int (&key, key_value);
+
+	error = btree_insert (thread_p, &g_index_table.btid, &key, &g_index_table.class_oid, &oid, SINGLE_ROW_INSERT,
+			      NULL, NULL, NULL);
+      }
+
+    st.pause_timing ();
+    if (error == NO_ERROR)
+      {
+	error = db_commit_transaction ();
+      }
+    return error;
+  }
+
+  /* find random keys of a unique index */
+  static int
+  bench_btree_point_lookup (cubbench::state &st)
+  {
+    THREAD_ENTRY *thread_p = thread_get_thread_entry_info ();
+    DB_VALUE key;
+    OID oid;
+    unsigned int seed = 1;
+
+    for (std::uint64_t i = 0; i < st.iterations (); i++)
+      {
+	db_make_int (&key, (int) (next_random (seed) % g_rows_count));
+	if (xbtree_find_unique (thread_p, &g_scan_table.btid, S_SELECT, &key, &g_scan_table.class_oid, &oid, false)
+	    != BTREE_KEY_FOUND)
+	  {
+	    if (er_errid () == NO_ERROR)
+	      {
+		er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_GENERIC_ERROR, 0);
+	      }
+	    return er_errid ();
+	  }
+      }
+    return NO_ERROR;
+  }
+
+  /* append log records; the transaction is committed once at the end, outside of the measure */
+  static int
+  bench_log_append (cubbench::state &st)
+  {
+    THREAD_ENTRY *thread_p = thread_get_thread_entry_info ();
+    char data[LOG_RECORD_LENGTH];
+
+    memset (data, 0, sizeof (data));
+    for (std::uint64_t i = 0; i < st.iterations (); i++)
+      {
+	log_append_dboutside_redo (thread_p, RVLOG_OUTSIDE_LOGICAL_REDO_NOOP, sizeof (data), data);
+      }
+
+    st.pause_timing ();
+    return db_commit_transaction ();
+  }
+
+  /* append a log record and commit; every commit waits for its log flush */
+  static int
+  bench_log_append_commit (cubbench::state &st)
+  {
+    THREAD_ENTRY *thread_p = thread_get_thread_entry_info ();
+    char data[LOG_RECORD_LENGTH];
+    int error = NO_ERROR;
+
+    memset (data, 0, sizeof (data));
+    for (std::uint64_t i = 0; i < st.iterations () && error == NO_ERROR; i++)
+      {
+	log_append_dboutside_redo (thread_p, RVLOG_OUTSIDE_LOGICAL_REDO_NOOP, sizeof (data), data);
+	error = db_commit_transaction ();
+      }
+    return error;
+  }
+
+  static int
+  bench_lock_acquire_release (cubbench::state &st)
+  {
+    /* lock_object grants every lock at once without the lock table in this build */
+    st.skip ("the lock manager is not used in stand-alone mode");
+    return NO_ERROR;
+  }
+
+  struct sort_context
+  {
+    int count;			/* records left to generate */
+    unsigned int seed;
+    int last_key;		/* to check the output is sorted */
+    bool is_sorted;
+  };
+
+  /* sort records are a link to the next record of the same key followed by the key */
+  static const int SORT_RECORD_SIZE = (int) (sizeof (char *) + sizeof (int));
+
+  static SORT_STATUS
+  sort_get_next (THREAD_ENTRY *thread_p, RECDES *recdes, void *arg)
+  {
+    sort_context *context = (sort_context *) arg;
+    char *no_next = NULL;
+    int key;
+
+    if (context->count == 0)
+      {
+	return SORT_NOMORE_RECS;
+      }
+    if (recdes->area_size < SORT_RECORD_SIZE)
+      {
+	recdes->length = SORT_RECORD_SIZE;
+	return SORT_REC_DOESNT_FIT;
+      }
+
+    key = (int) next_random (context->seed);
+    memcpy (recdes->data, &no_next, sizeof (no_next));
+    memcpy (recdes->data + sizeof (char *), &key, sizeof (key));
+    recdes->length = SORT_RECORD_SIZE;
+    context->count--;
+    return SORT_SUCCESS;
+  }
+
+  static int
+  sort_put_next (THREAD_ENTRY *thread_p, const RECDES *recdes, void *arg)
+  {
+    sort_context *context = (sort_context *) arg;
+    int key;
+
+    memcpy (&key, recdes->data + sizeof (char *), sizeof (key));
+    if (key < context->last_key)
+      {
+	context->is_sorted = false;
+      }
+    context->last_key = key;
+    return NO_ERROR;
+  }
+
+  static int
+  sort_compare (const void *first, const void *second, void *arg)
+  {
+    int key1, key2;
+
+    memcpy (&key1, *(char **) first + sizeof (char *), sizeof (key1));
+    memcpy (&key2, *(char **) second + sizeof (char *), sizeof (key2));
+    return key1 < key2 ? -1 : (key1 > key2 ? 1 : 0);
+  }
+
+  /* sort as many random integers as the rows of the scanned table; one iteration is a full sort */
+  static int
+  bench_external_sort (cubbench::state &st)
+  {
+    THREAD_ENTRY *thread_p = thread_get_thread_entry_info ();
+    sort_context context;
+    int error;
+
+    for (std::uint64_t i = 0; i < st.iterations (); i++)
+      {
+	context.count = g_rows_count;
+	context.seed = (unsigned int) i + 1;
+	context.last_key = INT_MIN;
+	context.is_sorted = true;
+
+	error = sort_listfile (thread_p, NULL_VOLID, 0, sort_get_next, &context, sort_put_next, &context, sort_compare,
+			       NULL, SORT_DUP, NO_SORT_LIMIT, false);
+	if (error != NO_ERROR)
+	  {
+	    return error;
+	  }
+	if (!context.is_sorted)
+	  {
+	    er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_GENERIC_ERROR, 0);
+	    return ER_GENERIC_ERROR;
+	  }
+      }
+
+    st.set_items_processed (st.iterations () * g_rows_count);
+    return NO_ERROR;
+  }
+
+  /* a query without a usable index writes the rows to a list file, and the cursor scans it back; one iteration is
+   * one query. list files need a query entry, so they are exercised through the query interface. */
+  static int
+  bench_list_file_write_scan (cubbench::state &st)
+  {
+    char sql[256];
+    DB_QUERY_RESULT *result;
+    DB_QUERY_ERROR query_error;
+    DB_VALUE value;
+    std::uint64_t rows = 0;
+    int error;
+
+    snprintf (sql, sizeof (sql), "SELECT id, pad FROM %s", SCAN_TABLE);
+    for (std::uint64_t i = 0; i < st.iterations (); i++)
+      {
+	result = NULL;
+	error = db_execute (sql, &result, &query_error);
+	if (error < 0)
+	  {
+	    return error;
+	  }
+
+	for (error = db_query_first_tuple (result); error == DB_CURSOR_SUCCESS; error = db_query_next_tuple (result))
+	  {
+	    if (db_query_get_tuple_value (result, 0, &value) != NO_ERROR)
+	      {
+		db_query_end (result);
+		return er_errid ();
+	      }
+	    rows++;
+	  }
+	db_query_end (result);
+
+	if (error != DB_CURSOR_END)
+	  {
+	    return er_errid ();
+	  }
+      }
+
+    st.set_items_processed (rows);
+    return NO_ERROR;
+  }
+
+  /* pack a string value with its domain and unpack it */
+  static int
+  bench_db_value_pack (cubbench::state &st)
+  {
+    DB_VALUE value, unpacked;
+    std::vector<char> buffer;
+    char str[PAD_LENGTH + 1];
+
+    memset (str, 'x', PAD_LENGTH);
+    str[PAD_LENGTH] = '\0';
+    db_make_string (&value, str);
+    buffer.resize (or_packed_value_size (&value, 1, 1, 0) + MAX_ALIGNMENT);
+
+    for (std::uint64_t i = 0; i < st.iterations (); i++)
+      {
+	char *buf = PTR_ALIGN (buffer.data (), MAX_ALIGNMENT);
+
+	if (or_pack_value (buf, &value) == NULL || or_unpack_value (buf, &unpacked) == NULL)
+	  {
+	    return er_errid () != NO_ERROR ? er_errid () : ER_FAILED;
+	  }
+	pr_clear_value (&unpacked);
+      }
+    return NO_ERROR;
+  }
+
+  std::vector<cubbench::benchmark>
+  get_benchmarks (void)
+  {
+    return
+    {
+      { "pgbuf_fix_hit", bench_pgbuf_fix_hit },
+      { "pgbuf_fix_miss", bench_pgbuf_fix_miss },
+      { "volume_page_read", bench_volume_page_read },
+      { "volume_page_write", bench_volume_page_write },
+      { "heap_insert", bench_heap_insert },
+      { "heap_scan", bench_heap_scan },
+      { "btree_insert", bench_btree_insert },
+      { "btree_point_lookup", bench_btree_point_lookup },
+      { "log_append", bench_log_append },
+      { "log_append_commit", bench_log_append_commit },
+      { "lock_acquire_release", bench_lock_acquire_release },
+      { "external_sort", bench_external_sort },
+      { "list_file_write_scan", bench_list_file_write_scan },
+      { "db_value_pack", bench_db_value_pack },
+    };
+  }
+}
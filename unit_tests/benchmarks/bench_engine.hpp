@@ -0,0 +1,42 @@
+/*
+ * Copyright 2008 Search Solution Corporation
+ * Copyright 2016 CUBRID Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ */
+
+/*
+ * bench_engine.hpp - microbenchmarks of the storage, transaction and query engine components
+ */
+
+#ifndef _BENCH_ENGINE_HPP_
+#define _BENCH_ENGINE_HPP_
+
+#include "benchmark.hpp"
+
+#include <vector>
+
+namespace bench_engine
+{
+  /* create the benchmark tables in the scratch database; the scanned table gets rows_count rows */
+  int setup (int rows_count);
+
+  /* drop the benchmark tables */
+  int teardown (void);
+
+  /* all engine benchmarks, in the order they run */
+  std::vector<cubbench::benchmark> get_benchmarks (void);
+}
+
+#endif // _BENCH_ENGINE_HPP_
@@ -0,0 +1,142 @@
+/*
+ * Copyright 2008 Search Solution Corporation
+ * Copyright 2016 CUBRID Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ */
+
+/*
+ * bench_main.cpp - runs the engine microbenchmarks against a scratch database
+ *
+ *  usage: cubrid_benchmarks [--filter=STRING] [--json=FILE] [--min-time=SECONDS] [--rows=N] DATABASE
+ *
+ *  The database must exist and must not be used by a server; the benchmarks create and drop their own tables.
+ */
+
+#include "bench_engine.hpp"
+
+#include "authenticate.h"
+#include "db.h"
+#include "error_manager.h"
+#include "file_io.h"
+#include "storage_common.h"
+
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+
+static const int DEFAULT_ROWS_COUNT = 100000;
+static const double DEFAULT_MIN_TIME_SEC = 0.5;
+
+static void
+usage (const char *program)
+{
+  std::cerr << "usage: " << program << " [--filter=STRING] [--json=FILE] [--min-time=SECONDS] [--rows=N] DATABASE"
+	    << std::endl;
+}
+
+int
+main (int argc, char *argv[])
+{
+  cubbench::run_options options = { "", DEFAULT_MIN_TIME_SEC };
+  const char *json_file = NULL;
+  const char *database_name = NULL;
+  int rows_count = DEFAULT_ROWS_COUNT;
+  int failed;
+  int error;
+
+  for (int i = 1; i < argc; i++)
+    {
+      if (strncmp (argv[i], "--filter=", 9) == 0)
+	{
+	  options.filter = argv[i] + 9;
+	}
+      else if (strncmp (argv[i], "--json=", 7) == 0)
+	{
+	  json_file = argv[i] + 7;
+	}
+      else if (strncmp (argv[i], "--min-time=", 11) == 0)
+	{
+	  options.min_time_sec = atof (argv[i] + 11);
+	}
+      else if (strncmp (argv[i], "--rows=", 7) == 0)
+	{
+	  rows_count = atoi (argv[i] + 7);
+	}
+      else if (argv[i][0] != '-' && database_name == NULL)
+	{
+	  database_name = argv[i];
+	}
+      else
+	{
+	  usage (argv[0]);
+	  return EXIT_FAILURE;
+	}
+    }
+  if (database_name == NULL || rows_count <= 0 || options.min_time_sec <= 0)
+    {
+      usage (argv[0]);
+      return EXIT_FAILURE;
+    }
+
+  AU_DISABLE_PASSWORDS ();
+  db_set_client_type (DB_CLIENT_TYPE_ADMIN_UTILITY);
+  if (db_login ("DBA", NULL) != NO_ERROR || db_restart (argv[0], TRUE, database_name) != NO_ERROR)
+    {
+      std::cerr << db_error_string (3) << std::endl;
+      return EXIT_FAILURE;
+    }
+
+  error = bench_engine::setup (rows_count);
+  if (error != NO_ERROR)
+    {
+      std::cerr << "setup failed: " << db_error_string (3) << std::endl;
+      (void) db_shutdown ();
+      return EXIT_FAILURE;
+    }
+
+  std::vector<std::pair<std::string, std::string>> context =
+  {
+    { "executable", argv[0] },
+    { "database", database_name },
+    { "rows", std::to_string (rows_count) },
+    { "db_page_size", std::to_string (IO_PAGESIZE) },
+    { "direct_io", fileio_is_direct_io_enabled () ? "on" : "off" },
+    { "library_build_type", "standalone" },
+  };
+
+  if (json_file != NULL)
+    {
+      std::ofstream json_output (json_file);
+      if (!json_output)
+	{
+	  std::cerr << "cannot open " << json_file << std::endl;
+	  (void) bench_engine::teardown ();
+	  (void) db_shutdown ();
+	  return EXIT_FAILURE;
+	}
+      failed = cubbench::run_benchmarks (bench_engine::get_benchmarks (), options, context, std::cout, json_output);
+    }
+  else
+    {
+      std::ofstream null_output;	/* not open; writes are discarded */
+      failed = cubbench::run_benchmarks (bench_engine::get_benchmarks (), options, context, std::cout, null_output);
+    }
+
+  (void) bench_engine::teardown ();
+  (void) db_shutdown ();
+
+  return failed == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+}
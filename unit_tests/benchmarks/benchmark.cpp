@@ -0,0 +1,251 @@
+/*
+ * Copyright 2008 Search Solution Corporation
+ * Copyright 2016 CUBRID Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ */
+
+#include "benchmark.hpp"
+
+#include "error_manager.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <iomanip>
+
+namespace cubbench
+{
+  /* a run is repeated with more iterations until it lasts min_time; iterations grow at most this much at once */
+  static const double MAX_ITERATION_GROWTH = 10.0;
+  static const std::uint64_t MAX_ITERATIONS = 1000000000;
+
+  struct result
+  {
+    std::string name;
+    std::uint64_t iterations;
+    double real_time_ns;	/* per iteration */
+    double items_per_second;
+    bool is_skipped;
+    bool is_failed;
+    std::string message;
+  };
+
+  state::state (std::uint64_t iterations)
+    : m_iterations (iterations)
+    , m_items_processed (iterations)
+    , m_is_running (false)
+    , m_is_skipped (false)
+    , m_skip_reason ()
+    , m_start ()
+    , m_elapsed (0)
+  {
+  }
+
+  void
+  state::pause_timing ()
+  {
+    if (m_is_running)
+      {
+	m_elapsed += std::chrono::duration_cast<std::chrono::nanoseconds> (std::chrono::steady_clock::now () - m_start);
+	m_is_running = false;
+      }
+  }
+
+  void
+  state::resume_timing ()
+  {
+    if (!m_is_running)
+      {
+	m_start = std::chrono::steady_clock::now ();
+	m_is_running = true;
+      }
+  }
+
+  void
+  state::set_items_processed (std::uint64_t items)
+  {
+    m_items_processed = items;
+  }
+
+  void
+  state::skip (const char *reason)
+  {
+    m_is_skipped = true;
+    m_skip_reason = reason;
+  }
+
+  static void
+  write_json_string (std::ostream &out, const std::string &str)
+  {
+    out << '"';
+    for (char c : str)
+      {
+	switch (c)
+	  {
+	  case '"':
+	    out << "\\\"";
+	    break;
+	  case '\\':
+	    out << "\\\\";
+	    break;
+	  case '\n':
+	    out << "\\n";
+	    break;
+	  case '\t':
+	    out << "\\t";
+	    break;
+	  default:
+	    if ((unsigned char) c < 0x20)
+	      {
+		char buf[8];
+		snprintf (buf, sizeof (buf), "\\u%04x", (unsigned char) c);
+		out << buf;
+	      }
+	    else
+	      {
+		out << c;
+	      }
+	    break;
+	  }
+      }
+    out << '"';
+  }
+
+  static result
+  run_one (const benchmark &bench, const run_options &options)
+  {
+    result res = { bench.name, 0, 0, 0, false, false, "" };
+    std::uint64_t iterations = 1;
+    std::chrono::nanoseconds min_time =
+	    std::chrono::duration_cast<std::chrono::nanoseconds> (std::chrono::duration<double> (options.min_time_sec));
+
+    for (;;)
+      {
+	state st (iterations);
+	int error;
+
+	er_clear ();
+	st.resume_timing ();
+	error = bench.func (st);
+	st.pause_timing ();
+
+	if (error != NO_ERROR)
+	  {
+	    res.is_failed = true;
+	    res.message = er_msg () != NULL ? er_msg () : "unknown error";
+	    return res;
+	  }
+	if (st.is_skipped ())
+	  {
+	    res.is_skipped = true;
+	    res.message = st.skip_reason ();
+	    return res;
+	  }
+
+	if (st.elapsed () >= min_time || iterations >= MAX_ITERATIONS)
+	  {
+	    double seconds = std::chrono::duration<double> (st.elapsed ()).count ();
+
+	    res.iterations = iterations;
+	    res.real_time_ns = (double) st.elapsed ().count () / (double) iterations;
+	    res.items_per_second = seconds > 0 ? (double) st.items_processed () / seconds : 0;
+	    return res;
+	  }
+
+	/* aim a bit over min_time with the next run */
+	double growth = MAX_ITERATION_GROWTH;
+	if (st.elapsed ().count () > 0)
+	  {
+	    growth = std::min (MAX_ITERATION_GROWTH, 1.4 * min_time.count () / st.elapsed ().count ());
+	  }
+	iterations = std::min (MAX_ITERATIONS, std::max (iterations + 1, (std::uint64_t) (iterations * growth)));
+      }
+  }
+
+  int
+  run_benchmarks (const std::vector<benchmark> &benchmarks, const run_options &options,
+		  const std::vector<std::pair<std::string, std::string>> &context, std::ostream &output,
+		  std::ostream &json_output)
+  {
+    std::vector<result> results;
+    int failed = 0;
+
+    output << std::left << std::setw (32) << "benchmark" << std::right << std::setw (16) << "time/iter (ns)"
+	   << std::setw (14) << "iterations" << std::setw (18) << "items/s" << std::endl;
+
+    for (const benchmark &bench : benchmarks)
+      {
+	if (!options.filter.empty () && std::string (bench.name).find (options.filter) == std::string::npos)
+	  {
+	    continue;
+	  }
+
+	result res = run_one (bench, options);
+
+	output << std::left << std::setw (32) << res.name << std::right;
+	if (res.is_failed)
+	  {
+	    output << "  FAILED: " << res.message << std::endl;
+	    failed++;
+	  }
+	else if (res.is_skipped)
+	  {
+	    output << "  skipped: " << res.message << std::endl;
+	  }
+	else
+	  {
+	    output << std::fixed << std::setprecision (1) << std::setw (16) << res.real_time_ns << std::setw (14)
+		   << res.iterations << std::setprecision (0) << std::setw (18) << res.items_per_second << std::endl;
+	  }
+	results.push_back (res);
+      }
+
+    /* the layout follows the JSON output of Google Benchmark, so the usual comparison tools can read it */
+    json_output << "{" << std::endl << "  \"context\": {";
+    for (size_t i = 0; i < context.size (); i++)
+      {
+	json_output << (i == 0 ? "" : ",") << std::endl << "    ";
+	write_json_string (json_output, context[i].first);
+	json_output << ": ";
+	write_json_string (json_output, context[i].second);
+      }
+    json_output << std::endl << "  }," << std::endl << "  \"benchmarks\": [";
+    for (size_t i = 0; i < results.size (); i++)
+      {
+	const result &res = results[i];
+
+	json_output << (i == 0 ? "" : ",") << std::endl << "    {" << std::endl << "      \"name\": ";
+	write_json_string (json_output, res.name);
+	if (res.is_failed || res.is_skipped)
+	  {
+	    json_output << "," << std::endl << "      \"" << (res.is_failed ? "error_message" : "skip_message")
+			<< "\": ";
+	    write_json_string (json_output, res.message);
+	  }
+	else
+	  {
+	    json_output << "," << std::endl << "      \"iterations\": " << res.iterations;
+	    json_output << "," << std::endl << "      \"real_time\": " << std::fixed << std::setprecision (3)
+			<< res.real_time_ns;
+	    json_output << "," << std::endl << "      \"time_unit\": \"ns\"";
+	    json_output << "," << std::endl << "      \"items_per_second\": " << std::setprecision (1)
+			<< res.items_per_second;
+	  }
+	json_output << std::endl << "    }";
+      }
+    json_output << std::endl << "  ]" << std::endl << "}" << std::endl;
+
+    return failed;
+  }
+}
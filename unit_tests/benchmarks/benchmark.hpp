@@ -0,0 +1,107 @@
+/*
+ * Copyright 2008 Search Solution Corporation
+ * Copyright 2016 CUBRID Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ */
+
+/*
+ * benchmark.hpp - minimal microbenchmark runner with JSON output
+ */
+
+#ifndef _BENCHMARK_HPP_
+#define _BENCHMARK_HPP_
+
+#include <chrono>
+#include <cstdint>
+#include <ostream>
+#include <string>
+#include <vector>
+
+namespace cubbench
+{
+  /* state of one run of a benchmark.
+   *
+   *  The benchmark function executes the measured operation iterations () times. The runner starts the timer before
+   *  calling it and stops it after; the function can exclude its setup and cleanup with pause_timing/resume_timing.
+   */
+  class state
+  {
+    public:
+      explicit state (std::uint64_t iterations);
+
+      std::uint64_t iterations () const
+      {
+	return m_iterations;
+      }
+
+      void pause_timing ();
+      void resume_timing ();
+
+      /* items handled by the run, when it is not one per iteration (e.g. rows of a scan) */
+      void set_items_processed (std::uint64_t items);
+
+      /* the benchmark cannot run in this build or database */
+      void skip (const char *reason);
+
+      std::chrono::nanoseconds elapsed () const
+      {
+	return m_elapsed;
+      }
+      std::uint64_t items_processed () const
+      {
+	return m_items_processed;
+      }
+      bool is_skipped () const
+      {
+	return m_is_skipped;
+      }
+      const std::string &skip_reason () const
+      {
+	return m_skip_reason;
+      }
+
+    private:
+      std::uint64_t m_iterations;
+      std::uint64_t m_items_processed;
+      bool m_is_running;
+      bool m_is_skipped;
+      std::string m_skip_reason;
+      std::chrono::steady_clock::time_point m_start;
+      std::chrono::nanoseconds m_elapsed;
+  };
+
+  /* returns NO_ERROR or the error code; the error message is taken from the error manager */
+  typedef int (*function) (state &st);
+
+  struct benchmark
+  {
+    const char *name;
+    function func;
+  };
+
+  struct run_options
+  {
+    std::string filter;		/* run only benchmarks whose name contains it */
+    double min_time_sec;	/* minimum measured time of the reported run */
+  };
+
+  /* run the benchmarks, print one line per benchmark to output and the results as JSON to json_output.
+   * context is a list of name/value pairs written to the "context" object. returns the number of failed benchmarks. */
+  int run_benchmarks (const std::vector<benchmark> &benchmarks, const run_options &options,
+		      const std::vector<std::pair<std::string, std::string>> &context, std::ostream &output,
+		      std::ostream &json_output);
+}
+
+#endif // _BENCHMARK_HPP_
@@ -0,0 +1,169 @@
+/*
+ * Copyright 2008 Search Solution Corporation
+ * Copyright 2016 CUBRID Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ */
+
+/* own header */
+#include "test_checksum.hpp"
+
+/* headers from common */
+#include "test_perf_compare.hpp"
+#include "test_string_collection.hpp"
+#include "test_timers.hpp"
+
+/* headers from cubrid */
+#include "crc32c.h"
+#include "crypt_opfunc.h"
+
+/* system headers */
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <vector>
+
+namespace test_checksum
+{
+  const size_t PAGE_SIZE = 16 * 1024;
+  const size_t PAGE_COUNT = 16 * 1024;
+
+  enum checksum_type
+  {
+    CRC32C_HW,
+    CRC32C_SW,
+    CRC32_LOG,
+    CHECKSUM_TYPE_COUNT
+  };
+  test_common::string_collection checksum_names ("CRC-32C (crc32c_compute)", "CRC-32C (software)",
+      "CRC-32 (crypt_crc32)");
+  test_common::string_collection checksum_step_names ("16K pages");
+
+  static unsigned int
+  compute_checksum (checksum_type type, const char *buf, size_t len)
+  {
+    int crc32;
+
+    switch (type)
+      {
+      case CRC32C_HW:
+	return crc32c_compute (CRC32C_INIT_VALUE, buf, len);
+      case CRC32C_SW:
+	return crc32c_compute_sw (CRC32C_INIT_VALUE, buf, len);
+      case CRC32_LOG:
+      default:
+	crypt_crc32 (buf, (int) len, &crc32);
+	return (unsigned int) crc32;
+      }
+  }
+
+  static void
+  fill_random (std::vector<char> &buf)
+  {
+    for (size_t i = 0; i < buf.size (); i++)
+      {
+	buf[i] = (char) std::rand ();
+      }
+  }
+
+  int
+  test_crc32c_correctness (void)
+  {
+    const char *check_str = "123456789";
+    std::vector<char> buf (PAGE_SIZE + 8);
+    unsigned int crc_hw, crc_sw, crc_chained;
+
+    std::cout << "crc32c correctness (hardware acceleration is "
+	      << (crc32c_is_hw_accelerated () ? "on" : "off") << ")" << std::endl;
+
+    /* standard check value of CRC-32C */
+    if (crc32c_compute (CRC32C_INIT_VALUE, check_str, 9) != 0xE3069283
+	|| crc32c_compute_sw (CRC32C_INIT_VALUE, check_str, 9) != 0xE3069283)
+      {
+	std::cout << "    ERROR: wrong check value" << std::endl;
+	return -1;
+      }
+
+    fill_random (buf);
+
+    /* all alignments and tail lengths must produce the same result with both implementations */
+    for (size_t offset = 0; offset < 8; offset++)
+      {
+	for (size_t len = 0; len <= 256; len++)
+	  {
+	    crc_hw = crc32c_compute (CRC32C_INIT_VALUE, &buf[offset], len);
+	    crc_sw = crc32c_compute_sw (CRC32C_INIT_VALUE, &buf[offset], len);
+	    if (crc_hw != crc_sw)
+	      {
+		std::cout << "    ERROR: mismatch for offset " << offset << " length " << len << std::endl;
+		return -1;
+	      }
+	  }
+
+	crc_hw = crc32c_compute (CRC32C_INIT_VALUE, &buf[offset], PAGE_SIZE);
+	crc_chained = crc32c_compute (CRC32C_INIT_VALUE, &buf[offset], 100);
+	crc_chained = crc32c_compute (crc_chained, &buf[offset + 100], PAGE_SIZE - 100);
+	if (crc_hw != crc32c_compute_sw (CRC32C_INIT_VALUE, &buf[offset], PAGE_SIZE) || crc_hw != crc_chained)
+	  {
+	    std::cout << "    ERROR: page checksum mismatch for offset " << offset << std::endl;
+	    return -1;
+	  }
+      }
+
+    return 0;
+  }
+
+  int
+  test_checksum_throughput (void)
+  {
+    test_common::perf_compare compare_result (checksum_names, checksum_step_names);
+    std::vector<char> pages (PAGE_SIZE * 64);
+    /* keep the computation from being optimized away */
+    volatile unsigned int sink = 0;
+
+    std::cout << "checksum throughput of " << PAGE_COUNT << " pages of " << PAGE_SIZE << " bytes" << std::endl;
+
+    fill_random (pages);
+
+    for (int type = 0; type < CHECKSUM_TYPE_COUNT; type++)
+      {
+	test_common::us_timer timer;
+	test_common::us_timer throughput_timer;
+
+	for (size_t i = 0; i < PAGE_COUNT; i++)
+	  {
+	    /* cycle through a few pages, like a flush of consecutive buffers would */
+	    sink = sink ^ compute_checksum ((checksum_type) type, &pages[(i % 64) * PAGE_SIZE], PAGE_SIZE);
+	  }
+
+	long long usecs = (long long) throughput_timer.time ().count ();
+	compare_result.register_time (timer, (size_t) type, 0);
+
+	std::cout << "    " << checksum_names.get_name ((size_t) type) << ": ";
+	if (usecs > 0)
+	  {
+	    std::cout << (PAGE_SIZE * PAGE_COUNT) / (size_t) usecs << " MB/s" << std::endl;
+	  }
+	else
+	  {
+	    std::cout << "too fast to measure" << std::endl;
+	  }
+      }
+
+    std::cout << std::endl;
+    compare_result.print_results_and_warnings (std::cout);
+
+    return 0;
+  }
+}